@@ -17,6 +17,22 @@ if(${SPECTRE_DEBUG})
     APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS SPECTRE_DEBUG)
 endif()
 
+option(SPECTRE_PROFILE_ACTIONS "Record call counts and wallclock times of \
+all iterable actions and write them to the reductions file" OFF)
+
+if(${SPECTRE_PROFILE_ACTIONS})
+  set_property(TARGET SpectreFlags
+    APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS SPECTRE_PROFILE_ACTIONS)
+endif()
+
+option(SPECTRE_PROFILE_KERNELS "Record call counts and wallclock times of \
+the kernels annotated with SPECTRE_KERNEL_TIMER" OFF)
+
+if(${SPECTRE_PROFILE_KERNELS})
+  set_property(TARGET SpectreFlags
+    APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS SPECTRE_PROFILE_KERNELS)
+endif()
+
 if(APPLE AND "${CMAKE_HOST_SYSTEM_PROCESSOR}" STREQUAL "arm64")
   # Because of a bug in macOS on Apple Silicon, executables larger than
   # 2GB in size cannot run. The -Oz flag minimizes executable size, to
@@ -7,6 +7,7 @@
 #include <complex>
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -15,24 +16,109 @@
 #include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+
+namespace {
+// Computes `result = matrix * u` for the `Extent x Extent` `matrix` applied to
+// each contiguous stripe of `u`. The extent is known at compile time so the
+// loops are fully unrolled, and the matrix is copied into a contiguous buffer
+// without padding that stays in cache across stripes. Each stripe of the
+// result is computed as a linear combination of the columns of the matrix,
+// processing the rows in SIMD batches.
+template <size_t Extent>
+void apply_fixed_extent_matrix(const gsl::not_null<double*> result,
+                               const Matrix& matrix, const double* const u,
+                               const size_t number_of_stripes) {
+  std::array<double, Extent * Extent> matrix_data{};
+  for (size_t j = 0; j < Extent; ++j) {
+    for (size_t i = 0; i < Extent; ++i) {
+      gsl::at(matrix_data, i + Extent * j) = matrix(i, j);
+    }
+  }
+#ifdef SPECTRE_USE_XSIMD
+  using SimdType = simd::batch<double>;
+  constexpr size_t simd_width = simd::size<SimdType>();
+  constexpr size_t vectorized_extent = Extent - Extent % simd_width;
+#else
+  constexpr size_t vectorized_extent = 0;
+#endif
+  for (size_t stripe = 0; stripe < number_of_stripes; ++stripe) {
+    // clang-tidy: no pointer arithmetic
+    const double* const u_stripe = u + stripe * Extent;       // NOLINT
+    double* const result_stripe = result.get() + stripe * Extent;  // NOLINT
+#ifdef SPECTRE_USE_XSIMD
+    for (size_t i = 0; i < vectorized_extent; i += simd_width) {
+      SimdType sum = simd::load_unaligned(&gsl::at(matrix_data, i)) *
+                     SimdType(u_stripe[0]);
+      for (size_t j = 1; j < Extent; ++j) {
+        sum = simd::fma(
+            simd::load_unaligned(&gsl::at(matrix_data, i + Extent * j)),
+            SimdType(u_stripe[j]),  // NOLINT
+            sum);
+      }
+      simd::store_unaligned(&result_stripe[i], sum);  // NOLINT
+    }
+#endif
+    for (size_t i = vectorized_extent; i < Extent; ++i) {
+      double sum = gsl::at(matrix_data, i) * u_stripe[0];
+      for (size_t j = 1; j < Extent; ++j) {
+        sum += gsl::at(matrix_data, i + Extent * j) * u_stripe[j];  // NOLINT
+      }
+      result_stripe[i] = sum;  // NOLINT
+    }
+  }
+}
+
+// The range of extents for which `apply_fixed_extent_matrix` is used. Larger
+// matrices are multiplied with BLAS, where the dispatch overhead is
+// negligible compared to the computation.
+constexpr size_t minimum_fixed_extent = 2;
+constexpr size_t maximum_fixed_extent = 12;
+
+template <size_t... Is>
+bool apply_if_fixed_extent(const gsl::not_null<double*> result,
+                           const Matrix& matrix, const double* const u,
+                           const size_t number_of_stripes,
+                           std::index_sequence<Is...> /*meta*/) {
+  return (... or (matrix.rows() == minimum_fixed_extent + Is and
+                  (apply_fixed_extent_matrix<minimum_fixed_extent + Is>(
+                       result, matrix, u, number_of_stripes),
+                   true)));
+}
+}  // namespace
+
+namespace apply_matrices_detail {
+void multiply_stripes(const gsl::not_null<double*> result, const Matrix& matrix,
+                      const double* const u, const size_t number_of_stripes) {
+  if (matrix.rows() == matrix.columns() and
+      apply_if_fixed_extent(
+          result, matrix, u, number_of_stripes,
+          std::make_index_sequence<maximum_fixed_extent -
+                                   minimum_fixed_extent + 1>{})) {
+    return;
+  }
+  dgemm_<true>('N', 'N',
+               matrix.rows(),      // rows of matrix and result
+               number_of_stripes,  // columns of result and u
+               matrix.columns(),   // columns of matrix and rows of u
+               1.0,                // overall multiplier
+               matrix.data(),      // matrix
+               matrix.spacing(),   // rows of matrix including padding
+               u,                  // u
+               matrix.columns(),   // rows of u
+               0.0,                // overwrite output with result
+               result.get(),       // result
+               matrix.rows());     // rows of result
+}
+}  // namespace apply_matrices_detail
 
 namespace {
 void multiply_in_first_dimension(const gsl::not_null<double*> result,
                                  const gsl::not_null<size_t*> data_size,
                                  const Matrix& matrix, const double* data) {
   *data_size /= matrix.columns();
-  dgemm_<true>('N', 'N',
-               matrix.rows(),     // rows of matrix and result
-               *data_size,        // columns of result and u
-               matrix.columns(),  // columns of matrix and rows of u
-               1.0,               // overall multiplier
-               matrix.data(),     // matrix
-               matrix.spacing(),  // rows of matrix including padding
-               data,              // u
-               matrix.columns(),  // rows of u
-               0.0,               // multiplier for unused term
-               result.get(),      // result
-               matrix.rows());    // rows of result
+  apply_matrices_detail::multiply_stripes(result, matrix, data, *data_size);
   *data_size *= matrix.rows();
 }
 
@@ -48,28 +134,26 @@ struct Scratch {
   double* b;
 };
 
-// This does not take into account the order that the matrices are
-// applied in and gives the largest amount of space that could be
-// required for any application order.
+// Uses the caller-supplied buffer if one is given, otherwise allocates.
 template <typename MatrixType, size_t Dim>
 Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
-  size_t size = number_of_independent_components;
-  for (size_t i = 0; i < Dim; ++i) {
-    const auto& matrix = gsl::at(matrices, i);
-    if (dereference_wrapper(matrix) == Matrix{}) {
-      size *= extents[i];
-    } else {
-      size *= std::max(dereference_wrapper(matrix).rows(),
-                       dereference_wrapper(matrix).columns());
-    }
-  }
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
+  const size_t size = apply_matrices_detail::scratch_size(
+                          matrices, extents, number_of_independent_components) /
+                      2;
   Scratch result{};
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  result.buffer = cpp20::make_unique_for_overwrite<double[]>(2 * size);
-  result.a = &result.buffer[0];
-  result.b = &result.buffer[size];
+  if (scratch_buffer == nullptr) {
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    result.buffer = cpp20::make_unique_for_overwrite<double[]>(2 * size);
+    result.a = &result.buffer[0];
+    result.b = &result.buffer[size];
+  } else {
+    result.a = scratch_buffer;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    result.b = scratch_buffer + size;
+  }
   return result;
 }
 
@@ -96,14 +180,17 @@ template <typename MatrixType>
 void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
     const gsl::not_null<ElementType*> result,
     const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
-    const Index<Dim>& extents, const size_t number_of_independent_components) {
+    const Index<Dim>& extents, const size_t number_of_independent_components,
+    double* const scratch_buffer) {
   if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
       Matrix{}) {
     Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
-        result, matrices, data, extents, number_of_independent_components);
+        result, matrices, data, extents, number_of_independent_components,
+        scratch_buffer);
   } else {
     Impl<ElementType, Dim, DimensionIsIdentity..., false>::apply(
-        result, matrices, data, extents, number_of_independent_components);
+        result, matrices, data, extents, number_of_independent_components,
+        scratch_buffer);
   }
 }
 
@@ -115,7 +202,8 @@ struct Impl<ElementType, 0> {
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data,
                     const Index<Dim>& /*extents*/,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components, result.get());
   }
@@ -128,7 +216,8 @@ struct Impl<double, 1, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(result, &data_size, matrices[0], data);
   }
@@ -142,10 +231,12 @@ struct Impl<std::complex<double>, 1, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     size_t data_size = number_of_independent_components * extents.product() * 2;
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
     // treat the complex values as an additional 'dimension' to transpose, a
@@ -167,7 +258,8 @@ struct Impl<ElementType, 1, true> {
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
@@ -181,10 +273,12 @@ struct Impl<double, 2, false, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -203,10 +297,12 @@ struct Impl<std::complex<double>, 2, false, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -233,7 +329,8 @@ struct Impl<double, 2, false, true> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(result, &data_size, matrices[0], data);
   }
@@ -247,9 +344,11 @@ struct Impl<std::complex<double>, 2, false, true> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -273,10 +372,12 @@ struct Impl<double, 2, true, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0]);
@@ -294,10 +395,12 @@ struct Impl<std::complex<double>, 2, true, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -323,7 +426,8 @@ struct Impl<ElementType, 2, true, true> {
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
@@ -337,10 +441,12 @@ struct Impl<double, 3, false, false, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -361,10 +467,12 @@ struct Impl<std::complex<double>, 3, false, false, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -393,10 +501,12 @@ struct Impl<double, 3, false, false, true> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -415,10 +525,12 @@ struct Impl<std::complex<double>, 3, false, false, true> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -445,10 +557,12 @@ struct Impl<double, 3, false, true, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -467,10 +581,12 @@ struct Impl<std::complex<double>, 3, false, true, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -497,7 +613,8 @@ struct Impl<double, 3, false, true, true> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(result, &data_size, matrices[0], data);
   }
@@ -511,9 +628,11 @@ struct Impl<std::complex<double>, 3, false, true, true> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -537,10 +656,12 @@ struct Impl<double, 3, true, false, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0]);
@@ -560,10 +681,12 @@ struct Impl<std::complex<double>, 3, true, false, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -591,10 +714,12 @@ struct Impl<double, 3, true, false, true> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0]);
@@ -612,10 +737,12 @@ struct Impl<std::complex<double>, 3, true, false, true> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -641,10 +768,12 @@ struct Impl<double, 3, true, true, false> {
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+        get_scratch(matrices, extents, number_of_independent_components,
+                    scratch_buffer);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0] * rows[1]);
@@ -662,10 +791,12 @@ struct Impl<std::complex<double>, 3, true, true, false> {
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const scratch_buffer) {
     const auto rows = matrix_rows(matrices, extents);
     auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+        get_scratch(matrices, extents, number_of_independent_components * 2,
+                    scratch_buffer);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -691,7 +822,8 @@ struct Impl<ElementType, 3, true, true, true> {
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) {
+                    const size_t number_of_independent_components,
+                    double* const /*scratch_buffer*/) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
@@ -705,7 +837,8 @@ struct Impl<ElementType, 3, true, true, true> {
   template void Impl<ELEMENTTYPE(data), DIM(data)>::apply( \
       const gsl::not_null<ELEMENTTYPE(data)*>,             \
       const std::array<MATRIX(data), DIM(data)>&,          \
-      const ELEMENTTYPE(data)* const, const Index<DIM(data)>&, const size_t);
+      const ELEMENTTYPE(data)* const, const Index<DIM(data)>&, const size_t,    \
+      double* const);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (double, std::complex<double>),
                         (0, 1, 2, 3),
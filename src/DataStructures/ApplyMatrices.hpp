@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <ostream>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
@@ -20,13 +22,21 @@ class Index;
 /// \endcond
 
 namespace apply_matrices_detail {
+// Computes `result = matrix * u` for each of the `number_of_stripes`
+// contiguous stripes of `u`. Small square matrices are applied with unrolled
+// SIMD kernels, since for these sizes the BLAS dispatch overhead is larger
+// than the computation. Everything else is passed to `dgemm_`.
+void multiply_stripes(gsl::not_null<double*> result, const Matrix& matrix,
+                      const double* u, size_t number_of_stripes);
+
 template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
 struct Impl {
   template <typename MatrixType>
   static void apply(gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const ElementType* data, const Index<Dim>& extents,
-                    size_t number_of_independent_components);
+                    size_t number_of_independent_components,
+                    double* scratch_buffer);
 };
 
 template <typename MatrixType, size_t Dim>
@@ -47,6 +57,41 @@ size_t result_size(const std::array<MatrixType, Dim>& matrices,
   }
   return num_points_result;
 }
+
+// The number of doubles of scratch space needed to apply the matrices.  This
+// does not take into account the order that the matrices are applied in and
+// gives the largest amount of space that could be required for any
+// application order.
+template <typename MatrixType, size_t Dim>
+size_t scratch_size(const std::array<MatrixType, Dim>& matrices,
+                    const Index<Dim>& extents,
+                    const size_t number_of_doubles_per_point) {
+  size_t size = number_of_doubles_per_point;
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix.columns() == 0) {
+      size *= extents[d];
+    } else {
+      size *= std::max(matrix.rows(), matrix.columns());
+    }
+  }
+  return 2 * size;
+}
+
+template <typename ElementType, typename MatrixType, size_t Dim>
+double* prepare_scratch(const gsl::not_null<DataVector*> scratch,
+                        const std::array<MatrixType, Dim>& matrices,
+                        const Index<Dim>& extents,
+                        const size_t number_of_independent_components) {
+  const size_t required_size =
+      scratch_size(matrices, extents,
+                   number_of_independent_components * sizeof(ElementType) /
+                       sizeof(double));
+  if (scratch->size() < required_size) {
+    scratch->destructive_resize(required_size);
+  }
+  return scratch->data();
+}
 }  // namespace apply_matrices_detail
 
 /// @{
@@ -64,6 +109,13 @@ size_t result_size(const std::array<MatrixType, Dim>& matrices,
 /// the case of acting on a vector of complex values, the matrix is treated as
 /// having zero imaginary part. This is chosen for efficiency in all
 /// use-cases for spectral matrix arithmetic so far encountered.
+///
+/// All components of `u` are transformed together in each dimension. The
+/// transformation needs intermediate storage, which is allocated on every
+/// call unless a `scratch` buffer is passed. The `scratch` buffer is resized
+/// if it is too small and otherwise left untouched, so reusing the same buffer
+/// across calls (e.g. on every mortar or every refinement step) avoids all
+/// allocations.
 template <typename VariableTags, typename MatrixType, size_t Dim>
 void apply_matrices(const gsl::not_null<Variables<VariableTags>*> result,
                     const std::array<MatrixType, Dim>& matrices,
@@ -81,7 +133,31 @@ void apply_matrices(const gsl::not_null<Variables<VariableTags>*> result,
   apply_matrices_detail::Impl<typename Variables<VariableTags>::value_type,
                               Dim>::apply(result->data(), matrices, u.data(),
                                           extents,
-                                          u.number_of_independent_components);
+                                          u.number_of_independent_components,
+                                          nullptr);
+}
+
+template <typename VariableTags, typename MatrixType, size_t Dim>
+void apply_matrices(const gsl::not_null<Variables<VariableTags>*> result,
+                    const std::array<MatrixType, Dim>& matrices,
+                    const Variables<VariableTags>& u,
+                    const Index<Dim>& extents,
+                    const gsl::not_null<DataVector*> scratch) {
+  using ElementType = typename Variables<VariableTags>::value_type;
+  ASSERT(u.number_of_grid_points() == extents.product(),
+         "Mismatch between extents (" << extents.product()
+                                      << ") and variables ("
+                                      << u.number_of_grid_points() << ").");
+  ASSERT(result->number_of_grid_points() ==
+             apply_matrices_detail::result_size(matrices, extents),
+         "result has wrong size.  Expected "
+             << apply_matrices_detail::result_size(matrices, extents)
+             << ", received " << result->number_of_grid_points());
+  apply_matrices_detail::Impl<ElementType, Dim>::apply(
+      result->data(), matrices, u.data(), extents,
+      u.number_of_independent_components,
+      apply_matrices_detail::prepare_scratch<ElementType>(
+          scratch, matrices, extents, u.number_of_independent_components));
 }
 
 template <typename VariableTags, typename MatrixType, size_t Dim>
@@ -115,7 +191,35 @@ void apply_matrices(const gsl::not_null<ResultType*> result,  // NOLINT
              << ", received " << result->size());
   apply_matrices_detail::Impl<typename VectorType::ElementType, Dim>::apply(
       result->data(), matrices, u.data(), extents,
-      number_of_independent_components);
+      number_of_independent_components, nullptr);
+}
+
+// clang tidy mistakenly fails to identify this as a function definition
+template <typename ResultType, typename MatrixType, typename VectorType,
+          size_t Dim>
+void apply_matrices(const gsl::not_null<ResultType*> result,  // NOLINT
+                    const std::array<MatrixType, Dim>& matrices,
+                    const VectorType& u, const Index<Dim>& extents,
+                    const gsl::not_null<DataVector*> scratch) {
+  using ElementType = typename VectorType::ElementType;
+  const size_t number_of_independent_components = u.size() / extents.product();
+  ASSERT(u.size() == number_of_independent_components * extents.product(),
+         "The size of the vector u ("
+             << u.size()
+             << ") must be a multiple of the number of grid points ("
+             << extents.product() << ").");
+  ASSERT(result->size() ==
+             number_of_independent_components *
+                 apply_matrices_detail::result_size(matrices, extents),
+         "result has wrong size.  Expected "
+             << number_of_independent_components *
+                    apply_matrices_detail::result_size(matrices, extents)
+             << ", received " << result->size());
+  apply_matrices_detail::Impl<ElementType, Dim>::apply(
+      result->data(), matrices, u.data(), extents,
+      number_of_independent_components,
+      apply_matrices_detail::prepare_scratch<ElementType>(
+          scratch, matrices, extents, number_of_independent_components));
 }
 
 template <typename MatrixType, typename VectorType, size_t Dim>
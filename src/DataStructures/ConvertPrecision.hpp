@@ -0,0 +1,52 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/FloatDataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// @{
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Convert a Tensor or Variables between double and single precision.
+ *
+ * The Tensor overload converts each component. The Variables overload converts
+ * the contiguous buffer in one pass, so the tags of the `result` and the
+ * `input` must have the same structure (e.g. tags templated on the data type).
+ * The `result` is resized to the size of the `input`.
+ */
+template <typename ResultVector, typename InputVector, typename Symm,
+          typename IndexList>
+void convert_precision(
+    const gsl::not_null<Tensor<ResultVector, Symm, IndexList>*> result,
+    const Tensor<InputVector, Symm, IndexList>& input) {
+  for (size_t i = 0; i < input.size(); ++i) {
+    convert_precision(make_not_null(&(*result)[i]), input[i]);
+  }
+}
+
+template <typename... ResultTags, typename... InputTags>
+void convert_precision(
+    const gsl::not_null<Variables<tmpl::list<ResultTags...>>*> result,
+    const Variables<tmpl::list<InputTags...>>& input) {
+  using ResultVariables = Variables<tmpl::list<ResultTags...>>;
+  using InputVariables = Variables<tmpl::list<InputTags...>>;
+  static_assert(ResultVariables::number_of_independent_components ==
+                    InputVariables::number_of_independent_components,
+                "The Variables must have the same number of components.");
+  result->initialize(input.number_of_grid_points());
+  typename ResultVariables::vector_type result_view(result->data(),
+                                                    result->size());
+  const typename InputVariables::vector_type input_view(
+      const_cast<typename InputVariables::value_type*>(input.data()),
+      input.size());
+  convert_precision(make_not_null(&result_view), input_view);
+}
+/// @}
@@ -18,6 +18,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/Access.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
@@ -27,6 +28,7 @@
 #include "DataStructures/DataBox/Subitems.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataBox/TagTraits.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/CleanupRoutine.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -413,9 +415,17 @@ class DataBox<tmpl::list<Tags...>> : public Access,
   static const TagGraphs tag_graphs_;
   /// \endcond
   static TagGraphs compute_tag_graphs();
-  void reset_parent(const std::string& item_name,
-                    const std::string& skip_this_subitem);
-  void reset_compute_items(const std::string& item_name);
+  static void add_subitem_dependents_to_reset(
+      gsl::not_null<std::vector<std::string>*> items_to_reset,
+      const std::string& item_name, const std::string& skip_this_subitem);
+  static void add_item_to_reset(
+      gsl::not_null<std::vector<std::string>*> items_to_reset,
+      const std::string& item_name);
+  static void add_dependents_to_reset(
+      gsl::not_null<std::vector<std::string>*> items_to_reset,
+      const std::string& item_name);
+  template <typename MutatedTag>
+  static std::vector<bool (DataBox::*)()> reset_functions_after_mutate();
   template <typename MutatedTag>
   void reset_compute_items_after_mutate();
   void mutate_mutable_subitems(const std::string& tag_name) override;
@@ -842,7 +852,8 @@ auto DataBox<tmpl::list<Tags...>>::compute_tag_graphs() -> TagGraphs {
 }
 
 template <typename... Tags>
-void DataBox<tmpl::list<Tags...>>::reset_parent(
+void DataBox<tmpl::list<Tags...>>::add_subitem_dependents_to_reset(
+    const gsl::not_null<std::vector<std::string>*> items_to_reset,
     const std::string& item_name, const std::string& skip_this_subitem) {
   if (const auto parent_tag_it =
           tag_graphs_.parent_to_subitem_tags.find(item_name);
@@ -858,77 +869,57 @@ void DataBox<tmpl::list<Tags...>>::reset_parent(
       }
       for (const std::string& dependent_item_name :
            dependent_items_it->second) {
-        ASSERT(tag_graphs_.tags_and_reset_functions.find(dependent_item_name) !=
-                   tag_graphs_.tags_and_reset_functions.end(),
-               "Item " << dependent_item_name
-                       << " does not have a reset function.");
-        if ((this->*(tag_graphs_.tags_and_reset_functions)
-                        .at(dependent_item_name))()) {
-          if (tag_graphs_.tags_and_dependents.find(dependent_item_name) !=
-              tag_graphs_.tags_and_dependents.end()) {
-            // If the compute tag was evaluated, then we need to check the
-            // items that depend on it.
-            reset_compute_items(dependent_item_name);
-          }
-          reset_parent(dependent_item_name, "");
-          if (const auto parent_it =
-                  tag_graphs_.subitem_to_parent_tag.find(dependent_item_name);
-              parent_it != tag_graphs_.subitem_to_parent_tag.end()) {
-            reset_parent(parent_it->second, dependent_item_name);
-          }
-        }
+        add_item_to_reset(items_to_reset, dependent_item_name);
       }
     }
   }
 }
 
 template <typename... Tags>
-void DataBox<tmpl::list<Tags...>>::reset_compute_items(
+void DataBox<tmpl::list<Tags...>>::add_item_to_reset(
+    const gsl::not_null<std::vector<std::string>*> items_to_reset,
     const std::string& item_name) {
-  // If the compute tag was evaluated before reset, then we reset dependent
-  // compute tags.
-  ASSERT(tag_graphs_.tags_and_dependents.find(item_name) !=
-             tag_graphs_.tags_and_dependents.end(),
-         "Item " << item_name << " does not have any dependents.");
-  for (const std::string& dependent_item_name :
-       tag_graphs_.tags_and_dependents.at(item_name)) {
-    ASSERT(
-        tag_graphs_.tags_and_reset_functions.find(dependent_item_name) !=
-            tag_graphs_.tags_and_reset_functions.end(),
-        "Item " << dependent_item_name << " does not have a reset function.");
-    if ((this->*(tag_graphs_.tags_and_reset_functions)
-                    .at(dependent_item_name))()) {
-      reset_parent(dependent_item_name, "");
-      if (const auto parent_it =
-              tag_graphs_.subitem_to_parent_tag.find(dependent_item_name);
-          parent_it != tag_graphs_.subitem_to_parent_tag.end()) {
-        reset_parent(parent_it->second, dependent_item_name);
-      }
-      if (tag_graphs_.tags_and_dependents.find(dependent_item_name) !=
-          tag_graphs_.tags_and_dependents.end()) {
-        // If the compute tag was evaluated, then we need to check the items
-        // that depend on it.
-        reset_compute_items(dependent_item_name);
-      }
+  ASSERT(tag_graphs_.tags_and_reset_functions.find(item_name) !=
+             tag_graphs_.tags_and_reset_functions.end(),
+         "Item " << item_name << " does not have a reset function.");
+  // The dependents of an item don't depend on how the item was reached, so
+  // each item only needs to be visited once.
+  if (alg::found(*items_to_reset, item_name)) {
+    return;
+  }
+  items_to_reset->push_back(item_name);
+  add_dependents_to_reset(items_to_reset, item_name);
+}
+
+template <typename... Tags>
+void DataBox<tmpl::list<Tags...>>::add_dependents_to_reset(
+    const gsl::not_null<std::vector<std::string>*> items_to_reset,
+    const std::string& item_name) {
+  if (const auto dependent_items_it =
+          tag_graphs_.tags_and_dependents.find(item_name);
+      dependent_items_it != tag_graphs_.tags_and_dependents.end()) {
+    for (const std::string& dependent_item_name :
+         dependent_items_it->second) {
+      add_item_to_reset(items_to_reset, dependent_item_name);
     }
   }
   // If this tag is a parent tag, reset subitems and their dependents
-  reset_parent(item_name, "");
+  add_subitem_dependents_to_reset(items_to_reset, item_name, "");
   // If this tag is a subitem, reset parent and other subitem dependents
   if (const auto parent_it = tag_graphs_.subitem_to_parent_tag.find(item_name);
       parent_it != tag_graphs_.subitem_to_parent_tag.end()) {
-    reset_parent(parent_it->second, item_name);
+    add_subitem_dependents_to_reset(items_to_reset, parent_it->second,
+                                    item_name);
   }
 }
 
 template <typename... Tags>
 template <typename MutatedTag>
-void DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate() {
-  static const std::string mutated_tag = pretty_type::get_name<MutatedTag>();
-  if (tag_graphs_.tags_and_dependents.find(mutated_tag) !=
-      tag_graphs_.tags_and_dependents.end()) {
-    reset_compute_items(mutated_tag);
-  }
+auto DataBox<tmpl::list<Tags...>>::reset_functions_after_mutate()
+    -> std::vector<bool (DataBox::*)()> {
+  const std::string mutated_tag = pretty_type::get_name<MutatedTag>();
+  std::vector<std::string> items_to_reset{};
+  add_dependents_to_reset(make_not_null(&items_to_reset), mutated_tag);
 
   // Handled subitems
   if constexpr (detail::has_subitems<MutatedTag>::value) {
@@ -940,10 +931,7 @@ void DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate() {
                   "an internal inconsistency bug.\n");
     for (const auto& subitem_name :
          tag_graphs_.parent_to_subitem_tags.at(mutated_tag)) {
-      if (tag_graphs_.tags_and_dependents.find(subitem_name) !=
-          tag_graphs_.tags_and_dependents.end()) {
-        reset_compute_items(subitem_name);
-      }
+      add_dependents_to_reset(make_not_null(&items_to_reset), subitem_name);
     }
   }
   // Handle parent tags
@@ -955,19 +943,36 @@ void DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate() {
                << " but did not. This is an internal inconsistency bug.");
     const auto& parent_tag_name =
         tag_graphs_.subitem_to_parent_tag.at(mutated_tag);
-    if (tag_graphs_.tags_and_dependents.find(parent_tag_name) !=
-        tag_graphs_.tags_and_dependents.end()) {
-      reset_compute_items(parent_tag_name);
-    }
+    add_dependents_to_reset(make_not_null(&items_to_reset), parent_tag_name);
     for (const auto& subitem_name :
          tag_graphs_.parent_to_subitem_tags.at(parent_tag_name)) {
-      if (tag_graphs_.tags_and_dependents.find(subitem_name) !=
-              tag_graphs_.tags_and_dependents.end() and
-          subitem_name != mutated_tag) {
-        reset_compute_items(subitem_name);
+      if (subitem_name != mutated_tag) {
+        add_dependents_to_reset(make_not_null(&items_to_reset), subitem_name);
       }
     }
   }
+
+  std::vector<bool (DataBox::*)()> result{};
+  result.reserve(items_to_reset.size());
+  for (const std::string& item_name : items_to_reset) {
+    result.push_back(tag_graphs_.tags_and_reset_functions.at(item_name));
+  }
+  return result;
+}
+
+template <typename... Tags>
+template <typename MutatedTag>
+void DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate() {
+  // Every item that can depend on `MutatedTag` is found once by walking the
+  // tag graphs, so a mutation only has to clear the `evaluated` flag of each
+  // of them. Items that were not evaluated are cheap to reset, and an item
+  // can only have been evaluated if the items it depends on were, so
+  // resetting all of them is equivalent to stopping at unevaluated items.
+  static const std::vector<bool (DataBox::*)()> reset_functions =
+      reset_functions_after_mutate<MutatedTag>();
+  for (const auto reset_function : reset_functions) {
+    (this->*reset_function)();
+  }
 }
 
 template <typename... Tags>
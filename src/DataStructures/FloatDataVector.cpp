@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/FloatDataVector.hpp"
+
+#include <algorithm>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <typename ResultVector, typename InputVector>
+void convert_precision_impl(const gsl::not_null<ResultVector*> result,
+                            const InputVector& input) {
+  using ResultValueType = typename ResultVector::value_type;
+  result->destructive_resize(input.size());
+  std::transform(input.begin(), input.end(), result->begin(),
+                 [](const auto value) {
+                   return static_cast<ResultValueType>(value);
+                 });
+}
+}  // namespace
+
+void convert_precision(const gsl::not_null<FloatDataVector*> result,
+                       const DataVector& input) {
+  convert_precision_impl(result, input);
+}
+
+void convert_precision(const gsl::not_null<DataVector*> result,
+                       const FloatDataVector& input) {
+  convert_precision_impl(result, input);
+}
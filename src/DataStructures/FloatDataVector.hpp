@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/VectorImpl.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class FloatDataVector;
+/// \endcond
+
+namespace blaze {
+DECLARE_GENERAL_VECTOR_BLAZE_TRAITS(FloatDataVector);
+}  // namespace blaze
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Stores a collection of function values in single precision.
+ *
+ * \details Use FloatDataVector in place of a DataVector where single precision
+ * is sufficient and memory or bandwidth is the limiting factor, e.g. when
+ * storing or communicating data that is only used for output, for
+ * preconditioning, or for interpolation. FloatDataVector supports the same
+ * elementwise math operations as DataVector. Tensors and Variables can hold
+ * FloatDataVectors, and `convert_precision` converts between the double and
+ * single precision types.
+ *
+ * Mixing DataVectors and FloatDataVectors in a math expression is
+ * deliberately not supported so that conversions are always explicit.
+ */
+class FloatDataVector : public VectorImpl<float, FloatDataVector> {
+ public:
+  FloatDataVector() = default;
+  FloatDataVector(const FloatDataVector&) = default;
+  FloatDataVector(FloatDataVector&&) = default;
+  FloatDataVector& operator=(const FloatDataVector&) = default;
+  FloatDataVector& operator=(FloatDataVector&&) = default;
+  ~FloatDataVector() = default;
+
+  using BaseType = VectorImpl<float, FloatDataVector>;
+
+  using BaseType::operator=;
+  using BaseType::VectorImpl;
+};
+
+// Specialize the Blaze type traits to correctly handle FloatDataVector
+namespace blaze {
+VECTOR_BLAZE_TRAIT_SPECIALIZE_ARITHMETIC_TRAITS(FloatDataVector);
+VECTOR_BLAZE_TRAIT_SPECIALIZE_ALL_MAP_TRAITS(FloatDataVector);
+}  // namespace blaze
+
+SPECTRE_ALWAYS_INLINE auto fabs(const FloatDataVector& t) { return abs(*t); }
+
+MAKE_STD_ARRAY_VECTOR_BINOPS(FloatDataVector)
+
+MAKE_WITH_VALUE_IMPL_DEFINITION_FOR(FloatDataVector)
+
+/// @{
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Convert between double and single precision data.
+ *
+ * The `result` is resized to the size of the `input` if it is owning, and must
+ * already have the correct size otherwise.
+ */
+void convert_precision(gsl::not_null<FloatDataVector*> result,
+                       const DataVector& input);
+
+void convert_precision(gsl::not_null<DataVector*> result,
+                       const FloatDataVector& input);
+/// @}
@@ -3,13 +3,15 @@
 
 #pragma once
 
+#include <iterator>
 #include <optional>
 #include <ostream>
 #include <pup.h>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/LinkedMessageId.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/TMPL.hpp"
@@ -27,6 +29,12 @@ class LinkedMessageQueue;
 /// messages, possibly from multiple sources, until sufficient data
 /// has been received for processing.  Each tag in \p QueueTags
 /// defines a queue of messages of type `Tag::type`.
+///
+/// Only the messages that arrived out of order are stored, so there
+/// are usually very few of them.  They are kept in a flat vector that
+/// is searched linearly and whose storage is reused as messages are
+/// extracted, so after the first few messages no allocations are made
+/// by the queue itself.
 template <typename Id, typename... QueueTags>
 class LinkedMessageQueue<Id, tmpl::list<QueueTags...>> {
   static_assert(sizeof...(QueueTags) > 0,
@@ -67,10 +75,22 @@ class LinkedMessageQueue<Id, tmpl::list<QueueTags...>> {
   };
 
   using OptionalTuple = tuples::TaggedTuple<Optional<QueueTags>...>;
+  using Entry = std::pair<std::optional<Id>, std::pair<Id, OptionalTuple>>;
+
+  auto find(const std::optional<Id>& previous) {
+    return alg::find_if(messages_, [&previous](const Entry& entry) {
+      return entry.first == previous;
+    });
+  }
+  auto find(const std::optional<Id>& previous) const {
+    return alg::find_if(messages_, [&previous](const Entry& entry) {
+      return entry.first == previous;
+    });
+  }
 
   std::optional<Id> previous_id_{};
-  std::unordered_map<std::optional<Id>, std::pair<Id, OptionalTuple>>
-      messages_{};
+  // The messages with the previous id as the first member of each entry
+  std::vector<Entry> messages_{};
 };
 
 template <typename Id, typename... QueueTags>
@@ -78,11 +98,12 @@ template <typename Tag>
 void LinkedMessageQueue<Id, tmpl::list<QueueTags...>>::insert(
     const LinkedMessageId<Id>& id_and_previous, typename Tag::type message) {
   static_assert((... or std::is_same_v<Tag, QueueTags>), "Unrecognized tag.");
-  const auto entry =
-      messages_
-          .insert({id_and_previous.previous,
-                   std::pair{id_and_previous.id, OptionalTuple{}}})
-          .first;
+  auto entry = find(id_and_previous.previous);
+  if (entry == messages_.end()) {
+    messages_.emplace_back(id_and_previous.previous,
+                           std::pair{id_and_previous.id, OptionalTuple{}});
+    entry = std::prev(messages_.end());
+  }
   auto& [id, tuple] = entry->second;
   ASSERT(id_and_previous.id == id,
          "Received messages with different ids (" << id << " and "
@@ -97,7 +118,7 @@ void LinkedMessageQueue<Id, tmpl::list<QueueTags...>>::insert(
 template <typename Id, typename... QueueTags>
 std::optional<Id>
 LinkedMessageQueue<Id, tmpl::list<QueueTags...>>::next_ready_id() const {
-  const auto current_entry = messages_.find(previous_id_);
+  const auto current_entry = find(previous_id_);
   if (current_entry == messages_.end()) {
     return {};
   }
@@ -116,13 +137,17 @@ tuples::TaggedTuple<QueueTags...>
 LinkedMessageQueue<Id, tmpl::list<QueueTags...>>::extract() {
   ASSERT(next_ready_id().has_value(),
          "Cannot extract before all messages have been received.");
-  const auto current_entry = messages_.find(previous_id_);
+  const auto current_entry = find(previous_id_);
   auto& current_value = current_entry->second;
   auto& [current_id, current_messages] = current_value;
   tuples::TaggedTuple<QueueTags...> result{};
   (void)(..., (tuples::get<QueueTags>(result) = std::move(
                    *tuples::get<Optional<QueueTags>>(current_messages))));
   previous_id_ = current_id;
-  messages_.erase(current_entry);
+  // The order of the entries is irrelevant, so avoid shifting the rest.
+  if (current_entry != std::prev(messages_.end())) {
+    *current_entry = std::move(messages_.back());
+  }
+  messages_.pop_back();
   return result;
 }
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "DataStructures/Index.hpp"
+#include "DataStructures/Python/ComplexDataVector.hpp"
 #include "DataStructures/Python/DataVector.hpp"
 #include "DataStructures/Python/Matrix.hpp"
 #include "DataStructures/Python/ModalVector.hpp"
@@ -91,6 +92,7 @@ void bind_impl(py::module& m) {  // NOLINT
 PYBIND11_MODULE(_Pybindings, m) {  // NOLINT
   enable_segfault_handler();
   py_bindings::bind_datavector(m);
+  py_bindings::bind_complexdatavector(m);
   py_bindings::bind_matrix(m);
   py_bindings::bind_modalvector(m);
   bind_impl<0>(m);
@@ -0,0 +1,127 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/Python/ComplexDataVector.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <pybind11/complex.h>
+#include <pybind11/numpy.h>
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <string>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "PythonBindings/BoundChecks.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace py = pybind11;
+
+namespace py_bindings {
+void bind_complexdatavector(py::module& m) {
+  // Wrapper for basic ComplexDataVector operations. Most of the math is done
+  // in Numpy, so this binding focuses on passing data to and from C++ without
+  // copying.
+  py::class_<ComplexDataVector>(m, "ComplexDataVector", py::buffer_protocol())
+      .def(py::init<size_t>(), py::arg("size"))
+      .def(py::init<size_t, std::complex<double>>(), py::arg("size"),
+           py::arg("fill"))
+      .def(py::init([](const std::vector<std::complex<double>>& values) {
+             ComplexDataVector result{values.size()};
+             std::copy(values.begin(), values.end(), result.begin());
+             return result;
+           }),
+           py::arg("values"))
+      .def(py::init([](const py::buffer& buffer, const bool copy) {
+             py::buffer_info info = buffer.request();
+             // Sanity-check the buffer
+             if (info.format !=
+                 py::format_descriptor<std::complex<double>>::format()) {
+               throw std::runtime_error(
+                   "Incompatible format: expected a complex double array.");
+             }
+             if (info.ndim != 1) {
+               throw std::runtime_error("Incompatible dimension.");
+             }
+             const auto size = static_cast<size_t>(info.shape[0]);
+             const auto stride =
+                 static_cast<size_t>(info.strides[0] / info.itemsize);
+             auto data = static_cast<std::complex<double>*>(info.ptr);
+             if (copy) {
+               ComplexDataVector result{size};
+               for (size_t i = 0; i < size; ++i) {
+                 // NOLINTNEXTLINE
+                 result[i] = data[i * stride];
+               }
+               return result;
+             } else {
+               if (stride != 1) {
+                 throw std::runtime_error(
+                     "Non-owning ComplexDataVectors only work with a stride "
+                     "of 1, but stride is " +
+                     std::to_string(stride) + ".");
+               }
+               // Create a non-owning ComplexDataVector from the buffer
+               return ComplexDataVector{data, size};
+             }
+           }),
+           py::arg("buffer"), py::arg("copy") = true,
+           // Keep the buffer alive while a non-owning ComplexDataVector
+           // refers to it
+           py::keep_alive<1, 2>())
+      // Expose the data as a Python buffer so it can be cast into Numpy arrays
+      .def_buffer([](ComplexDataVector& data_vector) {
+        return py::buffer_info(
+            data_vector.data(),
+            // Size of one scalar
+            sizeof(std::complex<double>),
+            py::format_descriptor<std::complex<double>>::format(),
+            // Number of dimensions
+            1,
+            // Size of the buffer
+            {data_vector.size()},
+            // Stride for each index (in bytes)
+            {sizeof(std::complex<double>)});
+      })
+      .def(
+          "__iter__",
+          [](const ComplexDataVector& t) {
+            return py::make_iterator(t.begin(), t.end());
+          },
+          // Keep object alive while iterator exists
+          py::keep_alive<0, 1>())
+      .def("__len__", [](const ComplexDataVector& t) { return t.size(); })
+      .def("__getitem__",
+           +[](const ComplexDataVector& t, const size_t i) {
+             bounds_check(t, i);
+             return t[i];
+           })
+      .def("__setitem__",
+           +[](ComplexDataVector& t, const size_t i,
+               const std::complex<double> v) {
+             bounds_check(t, i);
+             t[i] = v;
+           })
+      .def("__str__",
+           +[](const ComplexDataVector& t) { return get_output(t); })
+      .def("__repr__",
+           +[](const ComplexDataVector& t) { return get_output(t); })
+      .def("real",
+           +[](const ComplexDataVector& t) { return DataVector{real(t)}; })
+      .def("imag",
+           +[](const ComplexDataVector& t) { return DataVector{imag(t)}; })
+      .def("abs",
+           +[](const ComplexDataVector& t) { return DataVector{abs(t)}; })
+      .def("conj", +[](const ComplexDataVector& t) {
+        return ComplexDataVector{conj(t)};
+      })
+      // NOLINTNEXTLINE(misc-redundant-expression)
+      .def(py::self == py::self)
+      // NOLINTNEXTLINE(misc-redundant-expression)
+      .def(py::self != py::self);
+  py::implicitly_convertible<py::array, ComplexDataVector>();
+}
+}  // namespace py_bindings
@@ -41,17 +41,30 @@ void bind_modalvector(py::module& m) {
                throw std::runtime_error("Incompatible dimension.");
              }
              const auto size = static_cast<size_t>(info.shape[0]);
+             const auto stride =
+                 static_cast<size_t>(info.strides[0] / info.itemsize);
              auto data = static_cast<double*>(info.ptr);
              if (copy) {
                ModalVector result{size};
-               std::copy_n(data, result.size(), result.begin());
+               for (size_t i = 0; i < size; ++i) {
+                 // NOLINTNEXTLINE
+                 result[i] = data[i * stride];
+               }
                return result;
              } else {
+               if (stride != 1) {
+                 throw std::runtime_error(
+                     "Non-owning ModalVectors only work with a stride of 1, "
+                     "but stride is " +
+                     std::to_string(stride) + ".");
+               }
                // Create a non-owning ModalVector from the buffer
                return ModalVector{data, size};
              }
            }),
-           py::arg("buffer"), py::arg("copy") = true)
+           py::arg("buffer"), py::arg("copy") = true,
+           // Keep the buffer alive while a non-owning ModalVector refers to it
+           py::keep_alive<1, 2>())
       // Expose the data as a Python buffer so it can be cast into Numpy arrays
       .def_buffer([](ModalVector& data_vector) {
         return py::buffer_info(data_vector.data(),
@@ -0,0 +1,102 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ScratchArena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+
+namespace {
+// Allocations are rounded up to a multiple of this many doubles (64 bytes) so
+// consecutive allocations don't share cache lines.
+constexpr size_t alignment_in_doubles = 8;
+// The smallest block the arena allocates, 1 MiB.
+constexpr size_t minimum_block_size = 131072;
+
+struct ThreadArena {
+  std::vector<std::unique_ptr<double[]>> blocks{};
+  std::vector<size_t> block_sizes{};
+  // The block that is currently allocated from and the number of doubles
+  // already handed out from it
+  size_t block = 0;
+  size_t offset = 0;
+  // The number of live `ScratchArena`s on this thread
+  size_t depth = 0;
+
+  size_t capacity() const {
+    size_t result = 0;
+    for (const size_t block_size : block_sizes) {
+      result += block_size;
+    }
+    return result;
+  }
+
+  void add_block(const size_t size) {
+    const size_t block_size = std::max({size, minimum_block_size, capacity()});
+    blocks.push_back(cpp20::make_unique_for_overwrite<double[]>(block_size));
+    block_sizes.push_back(block_size);
+  }
+};
+
+ThreadArena& thread_arena() {
+  thread_local ThreadArena arena{};
+  return arena;
+}
+}  // namespace
+
+ScratchArena::ScratchArena() {
+  auto& arena = thread_arena();
+  ++arena.depth;
+  depth_ = arena.depth;
+  block_ = arena.block;
+  offset_ = arena.offset;
+}
+
+ScratchArena::~ScratchArena() {
+  auto& arena = thread_arena();
+  ASSERT(arena.depth == depth_,
+         "ScratchArenas must be destroyed in the reverse order of their "
+         "construction.");
+  --arena.depth;
+  arena.block = block_;
+  arena.offset = offset_;
+  // Once nothing is allocated anymore, merge the blocks so that the next use
+  // only touches a single contiguous allocation.
+  if (arena.depth == 0 and arena.blocks.size() > 1) {
+    const size_t total_size = arena.capacity();
+    arena.blocks.clear();
+    arena.block_sizes.clear();
+    arena.add_block(total_size);
+  }
+}
+
+gsl::span<double> ScratchArena::allocate(const size_t size) {
+  auto& arena = thread_arena();
+  ASSERT(arena.depth == depth_,
+         "Only the innermost ScratchArena on a thread may allocate.");
+  if (size == 0) {
+    return {};
+  }
+  const size_t aligned_size =
+      (size + alignment_in_doubles - 1) / alignment_in_doubles *
+      alignment_in_doubles;
+  while (arena.block < arena.blocks.size() and
+         arena.offset + aligned_size > arena.block_sizes[arena.block]) {
+    ++arena.block;
+    arena.offset = 0;
+  }
+  if (arena.block == arena.blocks.size()) {
+    arena.add_block(aligned_size);
+  }
+  double* const result = &arena.blocks[arena.block][arena.offset];
+  arena.offset += aligned_size;
+  return {result, size};
+}
+
+size_t ScratchArena::capacity() { return thread_arena().capacity(); }
@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Utilities/Gsl.hpp"
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Thread-local scratch memory for short-lived temporaries.
+ *
+ * Each thread owns a bump allocator of `double`s. Memory is obtained through a
+ * `ScratchArena` object, which releases everything it allocated when it goes
+ * out of scope. `ScratchArena`s must therefore be destroyed in the reverse
+ * order of their construction on a thread, which is automatic when they are
+ * local variables. The memory of the thread is never returned to the system,
+ * so once the largest set of temporaries needed at the same time has been
+ * allocated, e.g. after the first time step, no further calls to `malloc` are
+ * made.
+ *
+ * This is intended for buffers that are allocated and freed on every call of
+ * a hot function, such as the temporaries of the DG time derivative:
+ *
+ * \code{.cpp}
+ * ScratchArena arena{};
+ * auto temporaries =
+ *     arena.make_variables<Variables<temporary_tags>>(number_of_grid_points);
+ * \endcode
+ *
+ * \warning The memory is uninitialized and must not be used after the
+ * `ScratchArena` that allocated it is destroyed. Objects holding the memory,
+ * like the non-owning `Variables` returned by `make_variables()`, must not be
+ * moved to another thread or stored beyond the scope of the `ScratchArena`.
+ */
+class ScratchArena {
+ public:
+  ScratchArena();
+  ~ScratchArena();
+
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+  ScratchArena(ScratchArena&&) = delete;
+  ScratchArena& operator=(ScratchArena&&) = delete;
+
+  /// Returns uninitialized memory for `size` doubles that remains valid until
+  /// this `ScratchArena` is destroyed.
+  ///
+  /// Only the innermost `ScratchArena` on a thread may allocate.
+  gsl::span<double> allocate(size_t size);
+
+  /// Returns a non-owning `Variables` (or `TempBuffer`) of uninitialized
+  /// values on `number_of_grid_points` grid points.
+  template <typename VariablesType>
+  VariablesType make_variables(const size_t number_of_grid_points) {
+    static_assert(
+        std::is_same_v<typename VariablesType::value_type, double>,
+        "The ScratchArena can only provide storage for real-valued data.");
+    const size_t size =
+        VariablesType::number_of_independent_components * number_of_grid_points;
+    return VariablesType(allocate(size).data(), size);
+  }
+
+  /// The number of doubles the arena of the calling thread can hand out
+  /// without allocating.
+  static size_t capacity();
+
+ private:
+  size_t depth_;
+  size_t block_;
+  size_t offset_;
+};
@@ -18,8 +18,7 @@ template <size_t Dim>
 SliceIterator::SliceIterator(const Index<Dim>& extents, const size_t fixed_dim,
                              const size_t fixed_index)
     : size_(extents.product()),
-      stride_(std::accumulate(extents.begin(), extents.begin() + fixed_dim,
-                              1_st, std::multiplies<size_t>())),
+      stride_(stride(extents, fixed_dim)),
       stride_count_(0),
       jump_((extents[fixed_dim] - 1) * stride_),
       initial_offset_(fixed_index * stride_),
@@ -37,6 +36,16 @@ SliceIterator& SliceIterator::operator++() {
   return *this;
 }
 
+template <size_t Dim>
+size_t SliceIterator::stride(const Index<Dim>& extents,
+                             const size_t fixed_dim) {
+  ASSERT(fixed_dim < Dim, "Cannot slice dimension " << fixed_dim
+                                                    << " of a " << Dim
+                                                    << "D extents.");
+  return std::accumulate(extents.begin(), extents.begin() + fixed_dim, 1_st,
+                         std::multiplies<size_t>());
+}
+
 void SliceIterator::reset() {
   volume_offset_ = initial_offset_;
   slice_offset_ = 0;
@@ -105,6 +114,8 @@ volume_and_slice_indices(const Index<VolumeDim>& extents) {
 #define INSTANTIATION(r, data)                                                 \
   template SliceIterator::SliceIterator(const Index<DIM(data)>&, const size_t, \
                                         const size_t);                         \
+  template size_t SliceIterator::stride(const Index<DIM(data)>&,               \
+                                        const size_t);                         \
   template std::pair<                                                          \
       std::unique_ptr<std::pair<size_t, size_t>[]>,                            \
       std::array<std::pair<gsl::span<std::pair<size_t, size_t>>,               \
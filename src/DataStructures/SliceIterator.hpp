@@ -51,6 +51,13 @@ class SliceIterator {
   /// Reset the iterator
   void reset();
 
+  /// The number of consecutive volume points that lie on a slice with fixed
+  /// dimension `fixed_dim`, i.e. the product of the extents in the dimensions
+  /// below `fixed_dim`. A slice is made up of runs of this length separated by
+  /// `extents[fixed_dim] * stride(extents, fixed_dim)` volume points.
+  template <size_t Dim>
+  static size_t stride(const Index<Dim>& extents, size_t fixed_dim);
+
  private:
   size_t size_ = std::numeric_limits<size_t>::max();
   size_t stride_ = std::numeric_limits<size_t>::max();
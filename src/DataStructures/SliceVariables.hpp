@@ -44,14 +44,26 @@ void data_on_slice(const gsl::not_null<Variables<TagsList>*> interface_vars,
   using value_type = typename Variables<TagsList>::value_type;
   const value_type* vars_data = vars.data();
   value_type* interface_vars_data = interface_vars->data();
-  for (SliceIterator si(element_extents, sliced_dim, fixed_index); si; ++si) {
-    for (size_t i = 0; i < number_of_independent_components; ++i) {
-      // clang-tidy: do not use pointer arithmetic
-      interface_vars_data[si.slice_offset() +                      // NOLINT
-                          i * interface_grid_points] =             // NOLINT
-          vars_data[si.volume_offset() + i * volume_grid_points];  // NOLINT
+  // The slice is made up of contiguous runs of `stride` points in the
+  // volume, so we copy each run for one component at a time instead of
+  // stepping a SliceIterator through each point of each component.
+  const size_t stride = SliceIterator::stride(element_extents, sliced_dim);
+  const size_t jump = element_extents[sliced_dim] * stride;
+  const size_t number_of_runs = interface_grid_points / stride;
+  // clang-tidy: do not use pointer arithmetic
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t i = 0; i < number_of_independent_components; ++i) {
+    const value_type* volume_run =
+        vars_data + i * volume_grid_points + fixed_index * stride;
+    value_type* slice_run = interface_vars_data + i * interface_grid_points;
+    for (size_t run = 0; run < number_of_runs;
+         ++run, volume_run += jump, slice_run += stride) {
+      for (size_t s = 0; s < stride; ++s) {
+        slice_run[s] = volume_run[s];
+      }
     }
   }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 }
 
 template <std::size_t VolumeDim, typename TagsList>
@@ -106,11 +118,22 @@ void add_slice_to_data(
   using value_type = typename Variables<tmpl::list<VolumeTags...>>::value_type;
   value_type* const volume_data = volume_vars->data();
   const value_type* const slice_data = vars_on_slice.data();
-  for (SliceIterator si(extents, sliced_dim, fixed_index); si; ++si) {
-    for (size_t i = 0; i < number_of_independent_components; ++i) {
-      // clang-tidy: do not use pointer arithmetic
-      volume_data[si.volume_offset() + i * volume_grid_points] +=  // NOLINT
-          slice_data[si.slice_offset() + i * slice_grid_points];   // NOLINT
+  // See data_on_slice for the layout of the runs.
+  const size_t stride = SliceIterator::stride(extents, sliced_dim);
+  const size_t jump = extents[sliced_dim] * stride;
+  const size_t number_of_runs = slice_grid_points / stride;
+  // clang-tidy: do not use pointer arithmetic
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t i = 0; i < number_of_independent_components; ++i) {
+    value_type* volume_run =
+        volume_data + i * volume_grid_points + fixed_index * stride;
+    const value_type* slice_run = slice_data + i * slice_grid_points;
+    for (size_t run = 0; run < number_of_runs;
+         ++run, volume_run += jump, slice_run += stride) {
+      for (size_t s = 0; s < stride; ++s) {
+        volume_run[s] += slice_run[s];
+      }
     }
   }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 }
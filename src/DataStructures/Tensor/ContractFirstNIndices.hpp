@@ -198,7 +198,7 @@ struct contract_first_n_indices_impl<
     // `evaluate()` call that is normally used when evaluating the result of a
     // `TensorExpression`
     tenex::detail::evaluate_impl<
-        evaluate_subtrees,
+        evaluate_subtrees, false,
         TensorIndex<result_tensor_index_values[ResultInts]>...>(
         lhs_tensor, tensor1(TensorIndex<tensor_index_values1[Ints1]>{}...) *
                         tensor2(TensorIndex<tensor_index_values2[Ints2]>{}...));
@@ -4,9 +4,42 @@
 #include "DataStructures/Tensor/EagerMath/Trace.hpp"
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// The traced indices of `tensor` and both indices of `metric` are symmetric
+// with the same dimension, so every independent pair contributes once,
+// weighted by its multiplicity. All contributions are summed in one
+// expression so that each component of the result is written only once.
+template <typename DataType, typename TensorType, typename MetricType,
+          size_t... Is>
+void trace_last_indices_component(
+    const gsl::not_null<DataType*> trace_component,
+    const TensorType& tensor, const MetricType& metric, const size_t i,
+    std::index_sequence<Is...> /*meta*/) {
+  *trace_component =
+      (... + (static_cast<double>(MetricType::multiplicity(Is)) *
+              tensor.get(i, MetricType::get_tensor_index(Is)[0],
+                         MetricType::get_tensor_index(Is)[1]) *
+              metric[Is]));
+}
+
+// `tensor` and `metric` have the same symmetry and dimension, so their
+// storage indices refer to the same components and they can be contracted
+// storage index by storage index.
+template <typename DataType, typename TensorType, typename MetricType,
+          size_t... Is>
+void trace_impl(const gsl::not_null<DataType*> trace, const TensorType& tensor,
+                const MetricType& metric, std::index_sequence<Is...> /*meta*/) {
+  *trace = (... + (static_cast<double>(MetricType::multiplicity(Is)) *
+                   tensor[Is] * metric[Is]));
+}
+}  // namespace
 
 template <typename DataType, typename Index0, typename Index1>
 void trace_last_indices(
@@ -17,18 +50,12 @@ void trace_last_indices(
     const Tensor<DataType, Symmetry<1, 1>,
                  index_list<change_index_up_lo<Index1>,
                             change_index_up_lo<Index1>>>& metric) {
+  using metric_type = std::decay_t<decltype(metric)>;
   constexpr auto dimension_of_trace = Index0::dim;
-  constexpr auto dimension_of_metric = Index1::dim;
   for (size_t i = 0; i < dimension_of_trace; ++i) {
-    trace_of_tensor->get(i) = tensor.get(i, 0, 0) * get<0, 0>(metric);
-    for (size_t j = 0; j < dimension_of_metric; ++j) {
-      if (j != 0) {
-        trace_of_tensor->get(i) += tensor.get(i, j, j) * metric.get(j, j);
-      }
-      for (size_t k = j + 1; k < dimension_of_metric; ++k) {
-        trace_of_tensor->get(i) += 2.0 * tensor.get(i, j, k) * metric.get(j, k);
-      }
-    }
+    trace_last_indices_component(
+        make_not_null(&trace_of_tensor->get(i)), tensor, metric, i,
+        std::make_index_sequence<metric_type::size()>{});
   }
 }
 
@@ -39,16 +66,10 @@ void trace(
     const Tensor<DataType, Symmetry<1, 1>,
                  index_list<change_index_up_lo<Index0>,
                             change_index_up_lo<Index0>>>& metric) {
-  constexpr auto dimension = Index0::dim;
-  get(*trace) = get<0, 0>(tensor) * get<0, 0>(metric);
-  for (size_t i = 0; i < dimension; ++i) {
-    if (i != 0) {
-      get(*trace) += tensor.get(i, i) * metric.get(i, i);
-    }
-    for (size_t j = i + 1; j < dimension; ++j) {  // symmetry
-      get(*trace) += 2.0 * tensor.get(i, j) * metric.get(i, j);
-    }
-  }
+  using metric_type = std::decay_t<decltype(metric)>;
+  static_assert(std::decay_t<decltype(tensor)>::size() == metric_type::size());
+  trace_impl(make_not_null(&get(*trace)), tensor, metric,
+             std::make_index_sequence<metric_type::size()>{});
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <blaze/math/Subvector.h>
 #include <complex>
 #include <cstddef>
 #include <type_traits>
@@ -103,6 +105,13 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
   static constexpr bool value = (... and (Symm::value > 0));
 };
 
+/// The number of grid points evaluated at a time by `tenex::evaluate_in_chunks`
+///
+/// Small enough that the chunks of all `Tensor` components accessed by a
+/// large expression stay in cache, large enough that the loop over the chunks
+/// costs little compared to the arithmetic.
+constexpr size_t evaluate_in_chunks_size = 256;
+
 /*!
  * \ingroup TensorExpressionsGroup
  * \brief Evaluate subtrees of the RHS expression or the RHS expression as a
@@ -133,20 +142,29 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
  * implementation-dependent. Specifically, the safety of the operation depends
  * on the order of LHS component access and assignment.
  *
+ * If `EvaluateInChunks == true`, the whole RHS expression is evaluated for
+ * `evaluate_in_chunks_size` grid points at a time, computing all LHS
+ * components for one chunk before moving on to the next. This requires
+ * `EvaluateSubtrees == false` and has the same safety properties with respect
+ * to the LHS tensor appearing in the RHS expression.
+ *
  * \note `LhsTensorIndices` must be passed by reference because non-type
  * template parameters cannot be class types until C++20.
  *
  * @tparam EvaluateSubtrees whether or not to evaluate subtrees of RHS
  * expression
+ * @tparam EvaluateInChunks whether to evaluate all LHS components on one chunk
+ * of grid points at a time
  * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
  * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
  * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
  */
-template <bool EvaluateSubtrees, typename... LhsTensorIndices,
-          typename LhsDataType, typename LhsSymmetry, typename LhsIndexList,
-          typename Derived, typename RhsDataType, typename RhsSymmetry,
-          typename RhsIndexList, typename... RhsTensorIndices>
+template <bool EvaluateSubtrees, bool EvaluateInChunks,
+          typename... LhsTensorIndices, typename LhsDataType,
+          typename LhsSymmetry, typename LhsIndexList, typename Derived,
+          typename RhsDataType, typename RhsSymmetry, typename RhsIndexList,
+          typename... RhsTensorIndices>
 void evaluate_impl(
     const gsl::not_null<Tensor<LhsDataType, LhsSymmetry, LhsIndexList>*>
         lhs_tensor,
@@ -230,12 +248,25 @@ void evaluate_impl(
                 "size_t value, then there is a flaw in the logic for computing "
                 "the derived TensorExpression types' member, "
                 "height_relative_to_closest_tensor_leaf_in_subtree.");
-
-  if constexpr (EvaluateSubtrees) {
+  static_assert(not(EvaluateSubtrees and EvaluateInChunks),
+                "Expressions evaluated in chunks of grid points can't be "
+                "split into subtrees.");
+  static_assert(not EvaluateInChunks or
+                    (is_derived_of_vector_impl_v<LhsDataType> and
+                     is_derived_of_vector_impl_v<RhsDataType>),
+                "Only expressions with vector data types can be evaluated in "
+                "chunks of grid points.");
+
+  if constexpr (EvaluateSubtrees or EvaluateInChunks) {
     // Make sure the LHS tensor doesn't also appear in the RHS tensor expression
-    (~rhs_tensorexpression).assert_lhs_tensor_not_in_rhs_expression(lhs_tensor);
+    if constexpr (EvaluateSubtrees) {
+      (~rhs_tensorexpression)
+          .assert_lhs_tensor_not_in_rhs_expression(lhs_tensor);
+    }
     // If the LHS data type is a vector, size the LHS tensor components if their
-    // size does not match the size from a `Tensor` in the RHS expression
+    // size does not match the size from a `Tensor` in the RHS expression. When
+    // evaluating in chunks the LHS components are only assigned in parts, so
+    // they must be sized beforehand.
     if constexpr (is_derived_of_vector_impl_v<LhsDataType>) {
       const size_t rhs_component_size =
           (~rhs_tensorexpression).get_rhs_tensor_component_size();
@@ -269,25 +300,58 @@ void evaluate_impl(
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
-  for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
-    auto lhs_multi_index =
-        lhs_tensor_type::structure::get_canonical_tensor_index(i);
-    if (is_evaluated_lhs_multi_index(lhs_multi_index,
-                                     lhs_spatial_spacetime_index_positions,
-                                     lhs_time_index_positions)) {
-      for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(lhs_multi_index,
-                gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
-      }
-      auto rhs_multi_index =
-          transform_multi_index(lhs_multi_index, index_transformation);
-      for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(rhs_multi_index,
-                gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
-      }
-
+  // Calls `evaluate_component(i, rhs_multi_index)` for every LHS component
+  // `i` that is evaluated, where `rhs_multi_index` is the multi-index of the
+  // corresponding RHS component
+  const auto for_each_evaluated_component =
+      [&index_transformation, &lhs_spatial_spacetime_index_positions,
+       &lhs_time_index_positions, &rhs_spatial_spacetime_index_positions](
+          const auto& evaluate_component) {
+        for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+          auto lhs_multi_index =
+              lhs_tensor_type::structure::get_canonical_tensor_index(i);
+          if (is_evaluated_lhs_multi_index(
+                  lhs_multi_index, lhs_spatial_spacetime_index_positions,
+                  lhs_time_index_positions)) {
+            for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
+                 j++) {
+              gsl::at(lhs_multi_index,
+                      gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
+            }
+            auto rhs_multi_index =
+                transform_multi_index(lhs_multi_index, index_transformation);
+            for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
+                 j++) {
+              gsl::at(rhs_multi_index,
+                      gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
+            }
+            evaluate_component(i, rhs_multi_index);
+          }
+        }
+      };
+
+  if constexpr (EvaluateInChunks) {
+    // Every LHS component is computed for one chunk of grid points before
+    // moving on to the next chunk, so the RHS components shared between LHS
+    // components are still in cache when they are accessed again.
+    const size_t number_of_points = (*lhs_tensor)[0].size();
+    for (size_t offset = 0; offset < number_of_points;
+         offset += evaluate_in_chunks_size) {
+      const size_t points_in_chunk =
+          std::min(evaluate_in_chunks_size, number_of_points - offset);
+      for_each_evaluated_component([&lhs_tensor, offset, points_in_chunk,
+                                    &rhs_tensorexpression](
+                                       const size_t i,
+                                       const auto& rhs_multi_index) {
+        blaze::subvector((*lhs_tensor)[i], offset, points_in_chunk) =
+            blaze::subvector((~rhs_tensorexpression).get(rhs_multi_index),
+                             offset, points_in_chunk);
+      });
+    }
+  } else {
+    for_each_evaluated_component([&lhs_tensor, &rhs_tensorexpression](
+                                     const size_t i,
+                                     const auto& rhs_multi_index) {
       // The expression will either be evaluated as one whole expression
       // or it will be split up into subtrees that are evaluated one at a time.
       // See the section on splitting in the documentation for the
@@ -309,7 +373,7 @@ void evaluate_impl(
         // the expression is not split up, so evaluate full expression
         (*lhs_tensor)[i] = (~rhs_tensorexpression).get(rhs_multi_index);
       }
-    }
+    });
   }
 }
 
@@ -453,7 +517,49 @@ void evaluate(
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
   constexpr bool evaluate_subtrees =
       rhs_expression_type::primary_subtree_contains_primary_start;
-  detail::evaluate_impl<evaluate_subtrees,
+  detail::evaluate_impl<evaluate_subtrees, false,
+                        std::decay_t<decltype(LhsTensorIndices)>...>(
+      lhs_tensor, rhs_tensorexpression);
+}
+
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Assign the result of a RHS tensor expression to a tensor, evaluating
+ * all components on one chunk of grid points at a time
+ *
+ * \details This computes the same result as `tenex::evaluate`, but instead of
+ * evaluating one LHS component over all grid points before moving on to the
+ * next, the grid points are split into chunks of
+ * `tenex::detail::evaluate_in_chunks_size` points and all LHS components are
+ * evaluated on a chunk before moving on to the next. RHS components that
+ * contribute to several LHS components, e.g. the metric in a contraction, are
+ * then read from cache instead of memory for all but the first LHS component.
+ * This reduces the memory traffic of large expressions on many grid points,
+ * which are usually limited by memory bandwidth.
+ *
+ * The RHS expression is never split into subtrees (see the `TensorExpression`
+ * documentation), so the same caveats about the number of operations as for
+ * `tenex::update` apply. Only tensors holding vector data types, e.g.
+ * `DataVector`, are supported and the LHS `Tensor` cannot be part of the RHS
+ * expression.
+ *
+ * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
+ * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
+ * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
+ * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ */
+template <auto&... LhsTensorIndices, typename LhsDataType, typename LhsSymmetry,
+          typename LhsIndexList, typename Derived, typename RhsDataType,
+          typename RhsSymmetry, typename RhsIndexList,
+          typename... RhsTensorIndices>
+void evaluate_in_chunks(
+    const gsl::not_null<Tensor<LhsDataType, LhsSymmetry, LhsIndexList>*>
+        lhs_tensor,
+    const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
+                           tmpl::list<RhsTensorIndices...>>&
+        rhs_tensorexpression) {
+  (~rhs_tensorexpression).assert_lhs_tensor_not_in_rhs_expression(lhs_tensor);
+  detail::evaluate_impl<false, true,
                         std::decay_t<decltype(LhsTensorIndices)>...>(
       lhs_tensor, rhs_tensorexpression);
 }
@@ -625,7 +731,8 @@ void update(
       .template assert_lhs_tensorindices_same_in_rhs<lhs_tensorindex_list>(
           lhs_tensor);
 
-  detail::evaluate_impl<false, std::decay_t<decltype(LhsTensorIndices)>...>(
+  detail::evaluate_impl<false, false,
+                        std::decay_t<decltype(LhsTensorIndices)>...>(
       lhs_tensor, rhs_tensorexpression);
 }
 }  // namespace tenex
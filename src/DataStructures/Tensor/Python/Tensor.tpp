@@ -5,6 +5,7 @@
 
 #include "DataStructures/Tensor/Python/Tensor.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <pybind11/numpy.h>
 #include <pybind11/operators.h>
@@ -204,7 +205,71 @@ void bind_tensor_impl(py::module& m, const std::string& name) {  // NOLINT
                  return result;
                }
              }),
-             py::arg("buffer"), py::arg("copy") = true);
+             py::arg("buffer"), py::arg("copy") = true,
+             // Keep the buffer alive while non-owning components refer to it
+             py::keep_alive<1, 2>())
+        // Expose the components to Numpy without copying if they are equally
+        // spaced in memory, e.g. because the tensor was constructed from a
+        // Numpy array with `copy=False` or refers to a `Variables`. Otherwise
+        // (or if Numpy requests a copy) the components are copied.
+        .def(
+            "__array__",
+            [](const py::object& self, const py::object& dtype,
+               const py::object& copy) -> py::array {
+              const auto& t = self.cast<const TensorType&>();
+              const size_t num_points = t[0].size();
+              const auto offset = [&t](const size_t i) {
+                // NOLINTNEXTLINE
+                return t[i].data() - t[0].data();
+              };
+              const bool copy_requested =
+                  not copy.is_none() and copy.cast<bool>();
+              const bool copy_forbidden =
+                  not copy.is_none() and not copy.cast<bool>();
+              bool is_view = num_points > 0 and not copy_requested;
+              for (size_t i = 1; i < t.size() and is_view; ++i) {
+                is_view = t[i].size() == num_points and
+                          offset(i) == static_cast<std::ptrdiff_t>(i) *
+                                           offset(1);
+              }
+              py::array result{};
+              if (is_view) {
+                const auto stride = t.size() > 1
+                                        ? offset(1)
+                                        : static_cast<std::ptrdiff_t>(
+                                              num_points);
+                // Passing `self` as the base keeps the tensor alive while the
+                // array refers to its data
+                result = py::array(
+                    py::dtype::of<double>(),
+                    {static_cast<py::ssize_t>(t.size()),
+                     static_cast<py::ssize_t>(num_points)},
+                    {static_cast<py::ssize_t>(
+                         stride * static_cast<std::ptrdiff_t>(sizeof(double))),
+                     static_cast<py::ssize_t>(sizeof(double))},
+                    t[0].data(), self);
+              } else {
+                if (copy_forbidden) {
+                  throw py::value_error(
+                      "The tensor components are not equally spaced in "
+                      "memory, so they can't be viewed without copying.");
+                }
+                py::array_t<double> copied({t.size(), num_points});
+                auto copied_data = copied.template mutable_unchecked<2>();
+                for (size_t i = 0; i < t.size(); ++i) {
+                  for (size_t j = 0; j < num_points; ++j) {
+                    copied_data(i, j) = t[i][j];
+                  }
+                }
+                result = std::move(copied);
+              }
+              if (dtype.is_none()) {
+                return result;
+              }
+              return result.attr("astype")(dtype, py::arg("copy") = false)
+                  .cast<py::array>();
+            },
+            py::arg("dtype") = py::none(), py::arg("copy") = py::none());
   } else if constexpr (std::is_same_v<typename TensorType::type, double>) {
     tensor.def(py::init<double>(), py::arg("fill"));
   }
@@ -13,6 +13,7 @@
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/FloatDataVector.hpp"
 #include "DataStructures/ModalVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tensor/Expressions/AddSubtract.hpp"
@@ -108,6 +109,7 @@ class Tensor<X, Symm, IndexList<Indices...>> {
           std::is_same_v<X, ComplexDataVector> or
           std::is_same_v<X, ComplexModalVector> or
           std::is_same_v<X, DataVector> or std::is_same_v<X, ModalVector> or
+          std::is_same_v<X, FloatDataVector> or
           is_spin_weighted_of_v<ComplexDataVector, X> or
           is_spin_weighted_of_v<ComplexModalVector, X> or
           simd::is_batch<X>::value,
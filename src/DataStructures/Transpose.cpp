@@ -2,6 +2,9 @@
 // See LICENSE.txt for details.
 
 #include "DataStructures/Transpose.hpp"
+
+#include <algorithm>
+#include <cstdint>
 #include <type_traits>
 
 #if defined(__SSE2__)
@@ -322,32 +325,54 @@ void transpose_impl(double* __restrict__ matrix_transpose,  //
   const int32_t bound_on_rows = in_number_of_rows - RowExcess;
   const int32_t bound_on_columns = in_number_of_columns - ColumnExcess;
 
-  for (int32_t row_index = 0UL; row_index < bound_on_rows;
-       row_index += BlockSize) {
-    for (int32_t column_index = 0UL; column_index < bound_on_columns;
-         column_index += BlockSize) {
-      if constexpr (BlockSize != 1) {
-        transpose_block<BlockSize, BlockSize>(
-            matrix_transpose + row_index + in_number_of_rows * column_index,
-            matrix + column_index + in_number_of_columns * row_index,
-            in_number_of_columns, in_number_of_rows);
-      } else {
-        static_assert(BlockSize == 1);
-        static_assert(RowExcess == 0);
-        static_assert(ColumnExcess == 0);
-        transpose_block<1, 1>(
-            matrix_transpose + row_index + in_number_of_rows * column_index,
-            matrix + column_index + in_number_of_columns * row_index,
-            in_number_of_columns, in_number_of_rows);
+  // The blocks are visited in square tiles of `tile_size` so that the rows
+  // read from `matrix` and the columns written to `matrix_transpose` stay in
+  // the L1 cache while the tile is processed. Without this the writes for
+  // large matrices (e.g. many variables on a 3D mesh) stride over the entire
+  // output for every block row. The tile size must be a multiple of all
+  // block sizes.
+  constexpr int32_t tile_size = 32;
+  static_assert(tile_size % static_cast<int32_t>(BlockSize) == 0);
+  for (int32_t row_tile = 0; row_tile < bound_on_rows;
+       row_tile += tile_size) {
+    const int32_t row_tile_end = std::min(row_tile + tile_size, bound_on_rows);
+    for (int32_t column_tile = 0; column_tile < bound_on_columns;
+         column_tile += tile_size) {
+      const int32_t column_tile_end =
+          std::min(column_tile + tile_size, bound_on_columns);
+      for (int32_t row_index = row_tile; row_index < row_tile_end;
+           row_index += BlockSize) {
+        for (int32_t column_index = column_tile;
+             column_index < column_tile_end; column_index += BlockSize) {
+          if constexpr (BlockSize != 1) {
+            transpose_block<BlockSize, BlockSize>(
+                matrix_transpose + row_index +
+                    in_number_of_rows * column_index,
+                matrix + column_index + in_number_of_columns * row_index,
+                in_number_of_columns, in_number_of_rows);
+          } else {
+            static_assert(BlockSize == 1);
+            static_assert(RowExcess == 0);
+            static_assert(ColumnExcess == 0);
+            transpose_block<1, 1>(
+                matrix_transpose + row_index +
+                    in_number_of_rows * column_index,
+                matrix + column_index + in_number_of_columns * row_index,
+                in_number_of_columns, in_number_of_rows);
+          }
+        }
       }
     }
-    // Handle remainder in row, that is, deal with extra columns.
+    // Handle remainder in rows of the tile, that is, deal with extra columns.
     if constexpr (BlockSize > 1 and ColumnExcess != 0) {
       const int32_t column_index = bound_on_columns;
-      transpose_block<BlockSize, ColumnExcess>(
-          matrix_transpose + row_index + in_number_of_rows * column_index,
-          matrix + column_index + in_number_of_columns * row_index,
-          in_number_of_columns, in_number_of_rows);
+      for (int32_t row_index = row_tile; row_index < row_tile_end;
+           row_index += BlockSize) {
+        transpose_block<BlockSize, ColumnExcess>(
+            matrix_transpose + row_index + in_number_of_rows * column_index,
+            matrix + column_index + in_number_of_columns * row_index,
+            in_number_of_columns, in_number_of_rows);
+      }
     }
   }
 
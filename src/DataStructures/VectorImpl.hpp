@@ -470,7 +470,10 @@ void VectorImpl<T, VectorType, StaticSize>::pup(PUP::er& p) {  // NOLINT
   auto my_size = size();
   p | my_size;
   if (my_size > 0) {
-    if (p.isUnpacking()) {
+    // Reuse the existing allocation when unpacking into a vector of the same
+    // size, e.g. when deserializing into an existing object, so the data is
+    // copied straight into place
+    if (p.isUnpacking() and my_size != size()) {
       owning_ = true;
       owned_data_ = heap_alloc_if_necessary(my_size);
       reset_pointer_vector(my_size);
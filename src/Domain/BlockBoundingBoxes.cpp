@@ -0,0 +1,155 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockBoundingBoxes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// A uniform grid of `points_per_dimension` points in each dimension on each
+// face of the logical cube. Since the blocks are mapped by homeomorphisms,
+// the extremes of the mapped block lie on the mapped faces.
+template <size_t Dim>
+tnsr::I<DataVector, Dim, Frame::BlockLogical> logical_face_points(
+    const size_t points_per_dimension) {
+  size_t points_per_face = 1;
+  for (size_t d = 0; d < Dim - 1; ++d) {
+    points_per_face *= points_per_dimension;
+  }
+  tnsr::I<DataVector, Dim, Frame::BlockLogical> result(2 * Dim *
+                                                       points_per_face);
+  size_t s = 0;
+  for (size_t normal_dim = 0; normal_dim < Dim; ++normal_dim) {
+    for (const double side : {-1.0, 1.0}) {
+      for (size_t p = 0; p < points_per_face; ++p, ++s) {
+        size_t index = p;
+        for (size_t d = 0; d < Dim; ++d) {
+          if (d == normal_dim) {
+            result.get(d)[s] = side;
+            continue;
+          }
+          result.get(d)[s] =
+              -1.0 + 2.0 * static_cast<double>(index % points_per_dimension) /
+                         static_cast<double>(points_per_dimension - 1);
+          index /= points_per_dimension;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+template <typename Frame, size_t Dim, typename SourceFrame>
+tnsr::I<DataVector, Dim, Frame> change_frame(
+    tnsr::I<DataVector, Dim, SourceFrame> x) {
+  tnsr::I<DataVector, Dim, Frame> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    result.get(d) = std::move(x.get(d));
+  }
+  return result;
+}
+
+// Maps the logical points to `Frame`, or returns `std::nullopt` if the block
+// has no `Frame`. Follows the frame logic of
+// `block_logical_coordinates_single_point`.
+template <typename Frame, size_t Dim>
+std::optional<tnsr::I<DataVector, Dim, Frame>> map_to_frame(
+    const Block<Dim>& block,
+    const tnsr::I<DataVector, Dim, ::Frame::BlockLogical>& x_logical,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  if (not block.is_time_dependent()) {
+    return change_frame<Frame>(block.stationary_map()(x_logical));
+  }
+  auto x_grid = block.moving_mesh_logical_to_grid_map()(x_logical);
+  if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+    return block.moving_mesh_grid_to_inertial_map()(x_grid, time,
+                                                    functions_of_time);
+  } else if constexpr (std::is_same_v<Frame, ::Frame::Distorted>) {
+    if (not block.has_distorted_frame()) {
+      return std::nullopt;
+    }
+    return block.moving_mesh_grid_to_distorted_map()(x_grid, time,
+                                                     functions_of_time);
+  } else {
+    static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                  "Bounding boxes are only supported in the grid, distorted "
+                  "and inertial frames.");
+    (void)time;
+    (void)functions_of_time;
+    return x_grid;
+  }
+}
+}  // namespace
+
+namespace domain {
+template <size_t Dim, typename Frame>
+BlockBoundingBoxes<Dim, Frame>::BlockBoundingBoxes(
+    const Domain<Dim>& domain, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  const auto x_logical = logical_face_points<Dim>(points_per_dimension);
+  bounds_.reserve(domain.blocks().size());
+  for (const auto& block : domain.blocks()) {
+    const auto x = map_to_frame<Frame>(block, x_logical, time,
+                                       functions_of_time);
+    if (not x.has_value()) {
+      bounds_.emplace_back(std::nullopt);
+      continue;
+    }
+    std::array<std::array<double, 2>, Dim> bounds{};
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto [lower, upper] =
+          std::minmax_element(x->get(d).begin(), x->get(d).end());
+      const double pad = padding * (*upper - *lower);
+      gsl::at(bounds, d) = {{*lower - pad, *upper + pad}};
+    }
+    bounds_.emplace_back(bounds);
+  }
+}
+
+template <size_t Dim, typename Frame>
+bool BlockBoundingBoxes<Dim, Frame>::may_contain(
+    const size_t block_id, const tnsr::I<double, Dim, Frame>& x) const {
+  ASSERT(block_id < bounds_.size(),
+         "Block " << block_id << " is out of range, there are only "
+                  << bounds_.size() << " bounding boxes.");
+  const auto& bounds = bounds_[block_id];
+  if (not bounds.has_value()) {
+    return false;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& bounds_in_dim = gsl::at(*bounds, d);
+    if (x.get(d) < bounds_in_dim[0] or x.get(d) > bounds_in_dim[1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data) \
+  template class BlockBoundingBoxes<DIM(data), FRAME(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
+
+#undef FRAME
+#undef DIM
+#undef INSTANTIATE
+}  // namespace domain
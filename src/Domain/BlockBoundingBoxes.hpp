@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class Domain;
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Axis-aligned bounding boxes of all blocks of a `Domain` in the frame
+ * `Frame`, used to skip blocks that can't contain a point before inverting
+ * their maps.
+ *
+ * \details The boxes are computed by mapping a grid of points on the faces of
+ * each block to `Frame` and padding the extent of the mapped points by
+ * `padding` times the size of the box in each dimension, so curved block
+ * boundaries between the sampled points are covered. A block without a
+ * distorted frame has no box in `::Frame::Distorted` and never contains a
+ * point in that frame, consistent with `block_logical_coordinates`.
+ *
+ * For time-dependent maps the boxes are only valid at `time`, so they must be
+ * recomputed whenever the time or the functions of time change. Grid-frame
+ * boxes don't depend on time.
+ *
+ * The boxes only serve to order the search, so `block_logical_coordinates`
+ * returns the same result with and without them even if they are too small.
+ */
+template <size_t Dim, typename Frame>
+class BlockBoundingBoxes {
+ public:
+  /// The number of points per dimension sampled on each block face
+  static constexpr size_t points_per_dimension = 5;
+  /// The fraction of the size of the box it is padded by on each side
+  static constexpr double padding = 0.05;
+
+  BlockBoundingBoxes() = default;
+
+  explicit BlockBoundingBoxes(
+      const Domain<Dim>& domain,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const domain::FunctionsOfTimeMap& functions_of_time = {});
+
+  /// Whether the block with index `block_id` may contain the point `x`
+  bool may_contain(size_t block_id, const tnsr::I<double, Dim, Frame>& x) const;
+
+  size_t number_of_blocks() const { return bounds_.size(); }
+
+ private:
+  // The lower and upper bound in each dimension for each block, or
+  // `std::nullopt` if the block has no `Frame`
+  std::vector<std::optional<std::array<std::array<double, 2>, Dim>>>
+      bounds_{};
+};
+}  // namespace domain
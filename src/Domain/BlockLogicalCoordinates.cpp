@@ -3,17 +3,24 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <cmath>
 #include <cstddef>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Block.hpp"
+#include "Domain/BlockBoundingBoxes.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/Structure/BlockId.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
@@ -133,37 +140,327 @@ block_logical_coordinates_single_point(
   return logical_point;
 }
 
+namespace {
+// If `block_hint` is given it is tried first. If `bounding_boxes` is not
+// `nullptr` only the blocks whose bounding boxes contain the point are
+// searched next. Both only return a point strictly inside a block, so that
+// points on a shared boundary are still assigned to the block with the
+// smallest BlockId by the search over all blocks, which is also the fallback
+// if no block was found.
 template <size_t Dim, typename Frame>
-std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
-    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+BlockLogicalCoords<Dim> block_logical_coordinates_impl(
+    const Domain<Dim>& domain, const tnsr::I<double, Dim, Frame>& x_frame,
+    const BlockLogicalCoords<Dim>& block_hint,
+    const domain::BlockBoundingBoxes<Dim, Frame>* const bounding_boxes,
     const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
-  const size_t num_pts = get<0>(x).size();
-  std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
-    tnsr::I<double, Dim, Frame> x_frame(0.0);
-    for (size_t d = 0; d < Dim; ++d) {
-      x_frame.get(d) = x.get(d)[s];
+  const auto is_strictly_inside =
+      [](const tnsr::I<double, Dim, ::Frame::BlockLogical>& x_logical) {
+        return alg::all_of(x_logical,
+                           [](const double xi) { return abs(xi) < 1.0; });
+      };
+  if (block_hint.has_value()) {
+    const auto& block = domain.blocks()[block_hint->id.get_index()];
+    std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
+        block_logical_coordinates_single_point(x_frame, block, time,
+                                               functions_of_time);
+    if (x_logical.has_value() and is_strictly_inside(*x_logical)) {
+      return make_id_pair(domain::BlockId(block.id()),
+                          std::move(x_logical.value()));
     }
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
+  }
+  if (bounding_boxes != nullptr) {
+    ASSERT(bounding_boxes->number_of_blocks() == domain.blocks().size(),
+           "The bounding boxes are for "
+               << bounding_boxes->number_of_blocks()
+               << " blocks, but the domain has " << domain.blocks().size()
+               << " blocks.");
     for (const auto& block : domain.blocks()) {
+      if (not bounding_boxes->may_contain(block.id(), x_frame)) {
+        continue;
+      }
       std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
           block_logical_coordinates_single_point(x_frame, block, time,
                                                  functions_of_time);
-
       if (x_logical.has_value()) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
+        if (is_strictly_inside(*x_logical)) {
+          return make_id_pair(domain::BlockId(block.id()),
+                              std::move(x_logical.value()));
+        }
+        // The point is on a block boundary, so search all blocks below
+        break;
+      }
+    }
+  }
+  // Check which block this point is in. Each point will be in one
+  // and only one block, unless it is on a shared boundary.  In that
+  // case, choose the first matching block (and this block will have
+  // the smallest block_id).
+  for (const auto& block : domain.blocks()) {
+    std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
+        block_logical_coordinates_single_point(x_frame, block, time,
+                                               functions_of_time);
+
+    if (x_logical.has_value()) {
+      // Point is in this block.  Don't bother checking subsequent
+      // blocks.
+      return make_id_pair(domain::BlockId(block.id()),
+                          std::move(x_logical.value()));
+    }
+  }
+  return std::nullopt;
+}
+
+// Batched version of `block_logical_coordinates_single_point` that inverts
+// the maps for all points at once. Points that are not in the block are NaN.
+template <size_t Dim, typename Frame>
+tnsr::I<DataVector, Dim, ::Frame::BlockLogical> block_logical_coordinates_batch(
+    const tnsr::I<DataVector, Dim, Frame>& x, const Block<Dim>& block,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  tnsr::I<DataVector, Dim, ::Frame::BlockLogical> x_logical{};
+  if (block.is_time_dependent()) {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      x_logical = block.moving_mesh_logical_to_grid_map().inverse(
+          block.moving_mesh_grid_to_inertial_map().inverse(x, time,
+                                                           functions_of_time));
+    } else if constexpr (std::is_same_v<Frame, ::Frame::Distorted>) {
+      // See `block_logical_coordinates_single_point` for why blocks without
+      // a distorted frame are skipped
+      if (not block.has_distorted_frame()) {
+        return tnsr::I<DataVector, Dim, ::Frame::BlockLogical>(
+            get<0>(x).size(), std::numeric_limits<double>::quiet_NaN());
+      }
+      x_logical = block.moving_mesh_logical_to_grid_map().inverse(
+          block.moving_mesh_grid_to_distorted_map().inverse(x, time,
+                                                            functions_of_time));
+    } else {
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      x_logical = block.moving_mesh_logical_to_grid_map().inverse(x);
+    }
+  } else {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      x_logical = block.stationary_map().inverse(x);
+    } else {
+      static_assert(std::is_same_v<Frame, ::Frame::Grid> or
+                        std::is_same_v<Frame, ::Frame::Distorted>,
+                    "Cannot convert from given frame to Inertial frame");
+      tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+      for (size_t d = 0; d < Dim; ++d) {
+        x_inertial.get(d) = x.get(d);
+      }
+      x_logical = block.stationary_map().inverse(x_inertial);
+    }
+  }
+
+  // Clamp to [-1, 1] as in `block_logical_coordinates_single_point`
+  for (size_t s = 0; s < get<0>(x_logical).size(); ++s) {
+    for (size_t d = 0; d < Dim; ++d) {
+      double& xi = x_logical.get(d)[s];
+      if (equal_within_roundoff(xi, 1.0)) {
+        xi = 1.0;
+      } else if (equal_within_roundoff(xi, -1.0)) {
+        xi = -1.0;
+      } else if (not(abs(xi) <= 1.0)) {
+        for (size_t i = 0; i < Dim; ++i) {
+          x_logical.get(i)[s] = std::numeric_limits<double>::quiet_NaN();
+        }
+        break;
+      }
+    }
+  }
+  return x_logical;
+}
+
+// Same as the single-point `block_logical_coordinates_impl` for every point,
+// but the maps of each block are inverted for all points that are searched in
+// that block at once. The hints and the bounding boxes are therefore handled
+// in separate passes over the blocks before the search over all blocks.
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates_impl(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& block_hints,
+    const domain::BlockBoundingBoxes<Dim, Frame>* const bounding_boxes,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  const size_t num_pts = get<0>(x).size();
+  std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
+  // Inverts the maps of the block for the points with the given indices
+  const auto invert = [&x, &time, &functions_of_time](
+                          const Block<Dim>& block,
+                          const std::vector<size_t>& indices) {
+    tnsr::I<DataVector, Dim, Frame> x_subset(indices.size());
+    for (size_t d = 0; d < Dim; ++d) {
+      for (size_t i = 0; i < indices.size(); ++i) {
+        x_subset.get(d)[i] = x.get(d)[indices[i]];
+      }
+    }
+    return block_logical_coordinates_batch(x_subset, block, time,
+                                           functions_of_time);
+  };
+  const auto is_in_block =
+      [](const tnsr::I<DataVector, Dim, ::Frame::BlockLogical>& x_logical,
+         const size_t i) { return not std::isnan(get<0>(x_logical)[i]); };
+  // Only points strictly inside a block are accepted from the hints and the
+  // bounding boxes, so that points on a shared boundary are still assigned to
+  // the block with the smallest BlockId by the search over all blocks.
+  const auto is_strictly_inside =
+      [](const tnsr::I<DataVector, Dim, ::Frame::BlockLogical>& x_logical,
+         const size_t i) {
+        for (size_t d = 0; d < Dim; ++d) {
+          if (not(abs(x_logical.get(d)[i]) < 1.0)) {
+            return false;
+          }
+        }
+        return true;
+      };
+  const auto assign =
+      [&block_coord_holders](
+          const Block<Dim>& block, const size_t s,
+          const tnsr::I<DataVector, Dim, ::Frame::BlockLogical>& x_logical,
+          const size_t i) {
+        tnsr::I<double, Dim, ::Frame::BlockLogical> x_logical_point{};
+        for (size_t d = 0; d < Dim; ++d) {
+          x_logical_point.get(d) = x_logical.get(d)[i];
+        }
         block_coord_holders[s] = make_id_pair(domain::BlockId(block.id()),
-                                              std::move(x_logical.value()));
+                                              std::move(x_logical_point));
+      };
+
+  if (block_hints.size() == num_pts) {
+    std::vector<std::vector<size_t>> points_in_hinted_block(
+        domain.blocks().size());
+    for (size_t s = 0; s < num_pts; ++s) {
+      if (block_hints[s].has_value()) {
+        points_in_hinted_block[block_hints[s]->id.get_index()].push_back(s);
+      }
+    }
+    for (const auto& block : domain.blocks()) {
+      const auto& indices = points_in_hinted_block[block.id()];
+      if (indices.empty()) {
+        continue;
+      }
+      const auto x_logical = invert(block, indices);
+      for (size_t i = 0; i < indices.size(); ++i) {
+        if (is_in_block(x_logical, i) and is_strictly_inside(x_logical, i)) {
+          assign(block, indices[i], x_logical, i);
+        }
+      }
+    }
+  }
+
+  if (bounding_boxes != nullptr) {
+    ASSERT(bounding_boxes->number_of_blocks() == domain.blocks().size(),
+           "The bounding boxes are for "
+               << bounding_boxes->number_of_blocks()
+               << " blocks, but the domain has " << domain.blocks().size()
+               << " blocks.");
+    // A point that is found on a block boundary is left to the search over
+    // all blocks
+    std::vector<bool> on_block_boundary(num_pts, false);
+    std::vector<size_t> unlocated{};
+    for (size_t s = 0; s < num_pts; ++s) {
+      if (not block_coord_holders[s].has_value()) {
+        unlocated.push_back(s);
+      }
+    }
+    tnsr::I<double, Dim, Frame> x_frame{};
+    std::vector<size_t> indices{};
+    for (const auto& block : domain.blocks()) {
+      if (unlocated.empty()) {
         break;
       }
+      indices.clear();
+      for (const size_t s : unlocated) {
+        for (size_t d = 0; d < Dim; ++d) {
+          x_frame.get(d) = x.get(d)[s];
+        }
+        if (bounding_boxes->may_contain(block.id(), x_frame)) {
+          indices.push_back(s);
+        }
+      }
+      if (indices.empty()) {
+        continue;
+      }
+      const auto x_logical = invert(block, indices);
+      for (size_t i = 0; i < indices.size(); ++i) {
+        if (is_in_block(x_logical, i)) {
+          if (is_strictly_inside(x_logical, i)) {
+            assign(block, indices[i], x_logical, i);
+          } else {
+            on_block_boundary[indices[i]] = true;
+          }
+        }
+      }
+      std::erase_if(unlocated, [&block_coord_holders,
+                                &on_block_boundary](const size_t s) {
+        return block_coord_holders[s].has_value() or on_block_boundary[s];
+      });
     }
   }
+
+  // Check which block each remaining point is in. Each point will be in one
+  // and only one block, unless it is on a shared boundary.  In that case,
+  // choose the first matching block (and this block will have the smallest
+  // block_id).
+  std::vector<size_t> remaining{};
+  for (size_t s = 0; s < num_pts; ++s) {
+    if (not block_coord_holders[s].has_value()) {
+      remaining.push_back(s);
+    }
+  }
+  for (const auto& block : domain.blocks()) {
+    if (remaining.empty()) {
+      break;
+    }
+    const auto x_logical = invert(block, remaining);
+    for (size_t i = 0; i < remaining.size(); ++i) {
+      if (is_in_block(x_logical, i)) {
+        assign(block, remaining[i], x_logical, i);
+      }
+    }
+    std::erase_if(remaining, [&block_coord_holders](const size_t s) {
+      return block_coord_holders[s].has_value();
+    });
+  }
   return block_coord_holders;
 }
+}  // namespace
+
+template <size_t Dim, typename Frame>
+BlockLogicalCoords<Dim> block_logical_coordinates_single_point(
+    const Domain<Dim>& domain, const tnsr::I<double, Dim, Frame>& x,
+    const domain::BlockBoundingBoxes<Dim, Frame>& bounding_boxes,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  return block_logical_coordinates_impl(domain, x, {}, &bounding_boxes, time,
+                                        functions_of_time);
+}
+
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  return block_logical_coordinates_impl<Dim, Frame>(domain, x, {}, nullptr,
+                                                    time, functions_of_time);
+}
+
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& block_hints, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  return block_logical_coordinates_impl<Dim, Frame>(
+      domain, x, block_hints, nullptr, time, functions_of_time);
+}
+
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const domain::BlockBoundingBoxes<Dim, Frame>& bounding_boxes,
+    const std::vector<BlockLogicalCoords<Dim>>& block_hints, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  return block_logical_coordinates_impl(domain, x, block_hints,
+                                        &bounding_boxes, time,
+                                        functions_of_time);
+}
 
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -179,7 +476,28 @@ std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
   block_logical_coordinates(                                                   \
       const Domain<DIM(data)>& domain,                                         \
       const tnsr::I<DataVector, DIM(data), FRAME(data)>& x, const double time, \
-      const domain::FunctionsOfTimeMap& functions_of_time);
+      const domain::FunctionsOfTimeMap& functions_of_time);                    \
+  template std::vector<BlockLogicalCoords<DIM(data)>>                          \
+  block_logical_coordinates(                                                   \
+      const Domain<DIM(data)>& domain,                                         \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x,                    \
+      const std::vector<BlockLogicalCoords<DIM(data)>>& block_hints,           \
+      const double time, const domain::FunctionsOfTimeMap& functions_of_time); \
+  template std::vector<BlockLogicalCoords<DIM(data)>>                          \
+  block_logical_coordinates(                                                   \
+      const Domain<DIM(data)>& domain,                                         \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x,                    \
+      const domain::BlockBoundingBoxes<DIM(data), FRAME(data)>&                \
+          bounding_boxes,                                                      \
+      const std::vector<BlockLogicalCoords<DIM(data)>>& block_hints,           \
+      const double time, const domain::FunctionsOfTimeMap& functions_of_time); \
+  template BlockLogicalCoords<DIM(data)>                                       \
+  block_logical_coordinates_single_point(                                      \
+      const Domain<DIM(data)>& domain,                                         \
+      const tnsr::I<double, DIM(data), FRAME(data)>& x,                        \
+      const domain::BlockBoundingBoxes<DIM(data), FRAME(data)>&                \
+          bounding_boxes,                                                      \
+      const double time, const domain::FunctionsOfTimeMap& functions_of_time);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
                         (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
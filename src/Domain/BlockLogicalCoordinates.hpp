@@ -21,6 +21,10 @@ template <size_t VolumeDim>
 class Domain;
 template <size_t VolumeDim>
 class Block;
+namespace domain {
+template <size_t Dim, typename Frame>
+class BlockBoundingBoxes;
+}  // namespace domain
 /// \endcond
 
 template <size_t Dim>
@@ -43,10 +47,29 @@ using BlockLogicalCoords = std::optional<
 /// returned only once, and is considered to belong to the `Block`
 /// with the smaller `BlockId`.
 ///
+/// The overload taking `block_hints` first tries the block that `block_hints`
+/// holds for each point, which is typically the result of a previous call for
+/// points that have moved only slightly, e.g. the points on a horizon surface
+/// in consecutive horizon finds. This avoids inverting the maps of all blocks
+/// that precede the containing block. The hint is only accepted if the point
+/// lies strictly inside the hinted block, so the result is the same as
+/// without hints. Otherwise, and for points without a hint, all blocks are
+/// searched. If `block_hints` does not have one entry per point it is
+/// ignored.
+///
+/// The overloads taking `bounding_boxes` only invert the maps of the blocks
+/// whose `domain::BlockBoundingBoxes` contain a point, which avoids most map
+/// inversions in domains with many blocks. As for the hints, a block found
+/// this way is only accepted if the point lies strictly inside it, and all
+/// blocks are searched otherwise, so the result doesn't depend on the
+/// bounding boxes. They must be computed for the same `time` and
+/// `functions_of_time`.
+///
 /// The `block_logical_coordinates_single_point` function will search the passed
 /// in block for the passed in coordinate and return the logical coordinates of
 /// that point. It will return a `std::nullopt` if it can't find the point in
-/// that block.
+/// that block. The overload taking a `Domain` searches all blocks for a single
+/// point instead.
 ///
 /// \warning Since map inverses can involve numerical roundoff error, care must
 /// be taken with points on shared block boundaries. They will be assigned to
@@ -69,6 +92,30 @@ auto block_logical_coordinates(
     const domain::FunctionsOfTimeMap& functions_of_time = {})
     -> std::vector<BlockLogicalCoords<Dim>>;
 
+template <size_t Dim, typename Frame>
+auto block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& block_hints,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {})
+    -> std::vector<BlockLogicalCoords<Dim>>;
+
+template <size_t Dim, typename Frame>
+auto block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const domain::BlockBoundingBoxes<Dim, Frame>& bounding_boxes,
+    const std::vector<BlockLogicalCoords<Dim>>& block_hints,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {})
+    -> std::vector<BlockLogicalCoords<Dim>>;
+
+template <size_t Dim, typename Frame>
+BlockLogicalCoords<Dim> block_logical_coordinates_single_point(
+    const Domain<Dim>& domain, const tnsr::I<double, Dim, Frame>& x,
+    const domain::BlockBoundingBoxes<Dim, Frame>& bounding_boxes,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {});
+
 template <size_t Dim, typename Frame>
 std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>>
 block_logical_coordinates_single_point(
@@ -136,6 +136,11 @@ struct Composition<Frames, Dim, std::index_sequence<Is...>>
       double time = std::numeric_limits<double>::signaling_NaN(),
       const FuncOfTimeMap& functions_of_time = {}) const override;
 
+  tnsr::I<DataVector, Dim, SourceFrame> inverse(
+      const tnsr::I<DataVector, Dim, TargetFrame>& target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const FuncOfTimeMap& functions_of_time = {}) const override;
+
   InverseJacobian<double, Dim, SourceFrame, TargetFrame> inv_jacobian(
       tnsr::I<double, Dim, SourceFrame> source_point,
       double time = std::numeric_limits<double>::signaling_NaN(),
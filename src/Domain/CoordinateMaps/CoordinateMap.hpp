@@ -134,6 +134,26 @@ class CoordinateMapBase : public PUP::able {
       const = 0;
   /// @}
 
+  /// @{
+  /// Apply the inverse `Maps` to all points in `target_points` at once.
+  ///
+  /// All components of the points at which the map is not invertible are set
+  /// to NaN, and points that are NaN in `target_points` remain NaN. Maps that
+  /// implement a batched inverse (see `CoordinateMap`) invert all points
+  /// together, which avoids per-point work like evaluating the functions of
+  /// time. The other maps are inverted one point at a time.
+  virtual tnsr::I<DataVector, Dim, SourceFrame> inverse(
+      const tnsr::I<DataVector, Dim, TargetFrame>& target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const = 0;
+  /// @}
+
   /// @{
   /// Compute the inverse Jacobian of the `Maps` at the point(s)
   /// `source_point`
@@ -245,6 +265,22 @@ class CoordinateMapBase : public PUP::able {
  * that is equal to the dimensionality of the map. The Coordinatemap class
  * contains a member `static constexpr size_t dim`, a type alias `source_frame`,
  * a type alias `target_frame` and `typelist of the `Maps...`.
+ *
+ * A coordinate map may additionally provide a batched inverse
+ * `void inverse(gsl::not_null<std::array<DataVector, dim>*> coords) const`
+ * (with the additional `time` and `functions_of_time` arguments for
+ * time-dependent maps) that inverts all points in place. It must set all
+ * components of the points it can't invert to NaN and leave points that are
+ * NaN untouched. Maps without it are inverted one point at a time by the
+ * batched `inverse` of the `CoordinateMap`.
+ *
+ * A time-dependent map whose Jacobian doesn't depend on the coordinates, such
+ * as a rigid rotation or a uniform expansion, may provide
+ * `std::optional<tnsr::Ij<double, dim, Frame::NoFrame>> uniform_jacobian(time,
+ * functions_of_time) const` returning that Jacobian, or `std::nullopt` if it
+ * isn't uniform. `coords_frame_velocity_jacobians` then composes the Jacobians
+ * of the previous maps with a matrix of doubles and inverts it only once,
+ * instead of evaluating and inverting the Jacobian of the map at every point.
  */
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
 class CoordinateMap
@@ -347,6 +383,23 @@ class CoordinateMap
   }
   /// @}
 
+  /// @{
+  /// Apply the inverse `Maps...` to all points in `target_points` at once
+  tnsr::I<DataVector, dim, SourceFrame> inverse(
+      const tnsr::I<DataVector, dim, TargetFrame>& target_points,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const override {
+    return batched_inverse_impl(target_points, time, functions_of_time,
+                                std::make_index_sequence<sizeof...(Maps)>{});
+  }
+  /// @}
+
   /// @{
   /// Compute the inverse Jacobian of the `Maps...` at the point(s)
   /// `source_point`
@@ -535,6 +588,15 @@ class CoordinateMap
           functions_of_time,
       std::index_sequence<Is...> /*meta*/) const;
 
+  template <size_t... Is>
+  tnsr::I<DataVector, dim, SourceFrame> batched_inverse_impl(
+      const tnsr::I<DataVector, dim, TargetFrame>& target_points, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time,
+      std::index_sequence<Is...> /*meta*/) const;
+
   template <typename T>
   InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jacobian_impl(
       tnsr::I<T, dim, SourceFrame>&& source_point, double time,
@@ -7,8 +7,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <pup.h>
@@ -21,6 +23,8 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/CoordinateMapHelpers.hpp"
@@ -29,6 +33,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/Tuple.hpp"
@@ -40,6 +45,33 @@ namespace domain {
 namespace CoordinateMap_detail {
 CREATE_IS_CALLABLE(function_of_time_names)
 CREATE_IS_CALLABLE_V(function_of_time_names)
+CREATE_IS_CALLABLE(inverse)
+CREATE_IS_CALLABLE_V(inverse)
+CREATE_IS_CALLABLE(uniform_jacobian)
+CREATE_IS_CALLABLE_V(uniform_jacobian)
+
+// Inverts the points one at a time with `inverse`, which returns the inverted
+// point as a `std::optional<std::array<double, Dim>>`.
+template <size_t Dim, typename InverseFunction>
+void pointwise_inverse(const gsl::not_null<std::array<DataVector, Dim>*> coords,
+                       const InverseFunction& inverse) {
+  std::array<double, Dim> point{};
+  for (size_t s = 0; s < (*coords)[0].size(); ++s) {
+    if (std::isnan((*coords)[0][s])) {
+      continue;
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(point, d) = gsl::at(*coords, d)[s];
+    }
+    const std::optional<std::array<double, Dim>> inverted_point =
+        inverse(point);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(*coords, d)[s] = inverted_point.has_value()
+                                   ? gsl::at(*inverted_point, d)
+                                   : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+}
 
 template <typename T>
 struct map_type {
@@ -217,6 +249,70 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
              : std::optional<tnsr::I<T, dim, SourceFrame>>{};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+template <size_t... Is>
+tnsr::I<DataVector, CoordinateMap<SourceFrame, TargetFrame, Maps...>::dim,
+        SourceFrame>
+CoordinateMap<SourceFrame, TargetFrame, Maps...>::batched_inverse_impl(
+    const tnsr::I<DataVector, dim, TargetFrame>& target_points,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    std::index_sequence<Is...> /*meta*/) const {
+  check_functions_of_time(functions_of_time);
+  std::array<DataVector, dim> mapped_points{};
+  for (size_t d = 0; d < dim; ++d) {
+    gsl::at(mapped_points, d) = target_points.get(d);
+  }
+
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      [](const auto& the_map,
+         const gsl::not_null<std::array<DataVector, dim>*> points,
+         const double t,
+         const std::unordered_map<
+             std::string,
+             std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+             funcs_of_time) {
+        using map_type = std::decay_t<decltype(the_map)>;
+        if constexpr (domain::is_map_time_dependent_t<map_type>{}) {
+          if constexpr (CoordinateMap_detail::is_inverse_callable_v<
+                            map_type,
+                            gsl::not_null<std::array<DataVector, dim>*>,
+                            double, decltype(funcs_of_time)>) {
+            the_map.inverse(points, t, funcs_of_time);
+          } else {
+            CoordinateMap_detail::pointwise_inverse(
+                points,
+                [&the_map, &t, &funcs_of_time](
+                    const std::array<double, dim>& point) {
+                  return the_map.inverse(point, t, funcs_of_time);
+                });
+          }
+        } else {
+          (void)t;
+          (void)funcs_of_time;
+          if (LIKELY(not the_map.is_identity())) {
+            if constexpr (CoordinateMap_detail::is_inverse_callable_v<
+                              map_type,
+                              gsl::not_null<std::array<DataVector, dim>*>>) {
+              the_map.inverse(points);
+            } else {
+              CoordinateMap_detail::pointwise_inverse(
+                  points, [&the_map](const std::array<double, dim>& point) {
+                    return the_map.inverse(point);
+                  });
+            }
+          }
+        }
+        // this is the inverse function, so the iterator sequence below is
+        // reversed
+      }(std::get<sizeof...(Maps) - 1 - Is>(maps_),
+        make_not_null(&mapped_points), time, functions_of_time));
+
+  return tnsr::I<DataVector, dim, SourceFrame>(std::move(mapped_points));
+}
+
 namespace detail {
 template <typename T, typename Map, size_t Dim>
 void get_jacobian(
@@ -270,10 +366,11 @@ void get_inv_jacobian(
   *no_frame_inv_jac = the_map.inv_jacobian(point, t, funcs_of_time);
 }
 
-template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame,
+          typename NoFrameType>
 void multiply_jacobian(
     const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> jac,
-    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_jac) {
+    const tnsr::Ij<NoFrameType, Dim, Frame::NoFrame>& noframe_jac) {
   std::array<T, Dim> temp{};
   for (size_t source = 0; source < Dim; ++source) {
     for (size_t target = 0; target < Dim; ++target) {
@@ -289,10 +386,11 @@ void multiply_jacobian(
   }
 }
 
-template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame,
+          typename NoFrameType>
 void multiply_inv_jacobian(
     const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> inv_jac,
-    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_inv_jac) {
+    const tnsr::Ij<NoFrameType, Dim, Frame::NoFrame>& noframe_inv_jac) {
   std::array<T, Dim> temp{};
   for (size_t source = 0; source < Dim; ++source) {
     for (size_t target = 0; target < Dim; ++target) {
@@ -424,6 +522,44 @@ std::array<T, Dim> get_frame_velocity(
         funcs_of_time) {
   return the_map.frame_velocity(point, t, funcs_of_time);
 }
+
+// Composes the Jacobians and frame velocity of the previous maps with a map
+// whose Jacobian `uniform_jac` is the same at all points. The Jacobian is
+// applied as a matrix of doubles and inverted only once instead of at every
+// point. `map_frame_velocity` is the frame velocity of the map itself.
+template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+void apply_uniform_jacobian(
+    const gsl::not_null<InverseJacobian<T, Dim, SourceFrame, TargetFrame>*>
+        inv_jac,
+    const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> jac,
+    const gsl::not_null<tnsr::I<T, Dim, TargetFrame>*> frame_velocity,
+    const tnsr::Ij<double, Dim, Frame::NoFrame>& uniform_jac,
+    std::array<T, Dim> map_frame_velocity, const bool is_first_map) {
+  const auto uniform_inv_jac = determinant_and_inverse(uniform_jac).second;
+  if (is_first_map) {
+    for (size_t target = 0; target < Dim; ++target) {
+      for (size_t source = 0; source < Dim; ++source) {
+        jac->get(target, source) = make_with_value<T>(
+            map_frame_velocity[0], uniform_jac.get(target, source));
+        inv_jac->get(source, target) = make_with_value<T>(
+            map_frame_velocity[0], uniform_inv_jac.get(source, target));
+      }
+    }
+  } else {
+    multiply_inv_jacobian(inv_jac, uniform_inv_jac);
+    multiply_jacobian(jac, uniform_jac);
+    for (size_t target = 0; target < Dim; ++target) {
+      for (size_t source = 0; source < Dim; ++source) {
+        gsl::at(map_frame_velocity, target) +=
+            uniform_jac.get(target, source) * frame_velocity->get(source);
+      }
+    }
+  }
+  for (size_t target = 0; target < Dim; ++target) {
+    frame_velocity->get(target) =
+        std::move(gsl::at(map_frame_velocity, target));
+  }
+}
 }  // namespace detail
 
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
@@ -453,6 +589,24 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
         constexpr size_t count = decltype(index)::value;
         using Map = std::decay_t<decltype(map)>;
 
+        if constexpr (CoordinateMap_detail::is_uniform_jacobian_callable_v<
+                          Map, double, decltype(functions_of_time)>) {
+          const std::optional<tnsr::Ij<double, dim, Frame::NoFrame>>
+              uniform_jac = map.uniform_jacobian(time, functions_of_time);
+          if (uniform_jac.has_value()) {
+            detail::apply_uniform_jacobian(
+                make_not_null(&inv_jac), make_not_null(&jac),
+                make_not_null(&frame_velocity), *uniform_jac,
+                detail::get_frame_velocity(map, mapped_point, time,
+                                           functions_of_time),
+                count == 0);
+            CoordinateMap_detail::apply_map(
+                make_not_null(&mapped_point), map, time, functions_of_time,
+                domain::is_map_time_dependent_t<decltype(map)>{});
+            return;
+          }
+        }
+
         tnsr::Ij<T, dim, Frame::NoFrame> noframe_jac{};
         tnsr::Ij<T, dim, Frame::NoFrame> noframe_inv_jac{};
 
@@ -872,6 +872,42 @@ RotScaleTrans<Dim>::inv_jacobian(
       .second;
 }
 
+template <size_t Dim>
+std::optional<tnsr::Ij<double, Dim, Frame::NoFrame>>
+RotScaleTrans<Dim>::uniform_jacobian(
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  // In the transition region the expansion and translation depend on the
+  // radius, only the rotation is the same everywhere.
+  if (region_ == BlockRegion::Transition and
+      (scale_f_of_t_a_.has_value() or trans_f_of_t_.has_value())) {
+    return std::nullopt;
+  }
+  auto result = identity<Dim>(0.0);
+  if (rot_f_of_t_.has_value()) {
+    const Matrix rot_matrix = rotation_matrix<Dim>(
+        time, *(functions_of_time.at(rot_f_of_t_.value())));
+    for (size_t i = 0; i < Dim; i++) {
+      for (size_t j = 0; j < Dim; j++) {
+        result.get(i, j) = rot_matrix(i, j);
+      }
+    }
+  }
+  if (scale_f_of_t_a_.has_value()) {
+    const double scale_of_t =
+        functions_of_time
+            .at(region_ == BlockRegion::Inner ? scale_f_of_t_a_.value()
+                                              : scale_f_of_t_b_.value())
+            ->func(time)[0][0];
+    for (auto& component : result) {
+      component *= scale_of_t;
+    }
+  }
+  return result;
+}
+
 template <size_t Dim>
 double RotScaleTrans<Dim>::root_helper(
     const std::optional<std::array<double, 2>> roots) const {
@@ -329,6 +329,17 @@ class RotScaleTrans {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const;
 
+  /// The Jacobian if it is the same at all points of the block, i.e. outside
+  /// the transition region or for a pure rotation, and `std::nullopt`
+  /// otherwise. `domain::CoordinateMap` then applies it as a matrix of doubles
+  /// instead of evaluating and inverting the Jacobian at every point.
+  std::optional<tnsr::Ij<double, Dim, Frame::NoFrame>> uniform_jacobian(
+      double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time) const;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <pup.h>
@@ -132,6 +133,39 @@ std::optional<std::array<double, 3>> Shape::inverse(
   return center_ + centered_coords * original_radius_over_radius.value();
 }
 
+void Shape::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> target_coords,
+    const double time, const FunctionsOfTimeMap& functions_of_time) const {
+  const std::array<DataVector, 3> centered_coords =
+      center_coordinates(*target_coords);
+  const std::array<DataVector, 2> theta_phis =
+      cartesian_to_spherical(centered_coords);
+  DataVector coefs = functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
+  check_size(make_not_null(&coefs), functions_of_time, time, false);
+  check_coefficients(coefs);
+  const DataVector distorted_radii =
+      ylm_.interpolate_from_coefs(coefs, theta_phis);
+  std::array<double, 3> centered_point{};
+  for (size_t s = 0; s < distorted_radii.size(); ++s) {
+    if (std::isnan(centered_coords[0][s])) {
+      continue;
+    }
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(centered_point, d) = gsl::at(centered_coords, d)[s];
+    }
+    const std::optional<double> original_radius_over_radius =
+        transition_func_->original_radius_over_radius(centered_point,
+                                                      distorted_radii[s]);
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(*target_coords, d)[s] =
+          original_radius_over_radius.has_value()
+              ? gsl::at(center_, d) + gsl::at(centered_point, d) *
+                                          original_radius_over_radius.value()
+              : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+}
+
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::frame_velocity(
     const std::array<T, 3>& source_coords, const double time,
@@ -226,6 +226,12 @@ class Shape {
       const std::array<double, 3>& target_coords, double time,
       const FunctionsOfTimeMap& functions_of_time) const;
 
+  /// Inverts all points at once, which evaluates the functions of time and
+  /// the spherical harmonic expansion of the distorted radii only once. See
+  /// `domain::CoordinateMap` for the semantics of the batched inverse.
+  void inverse(gsl::not_null<std::array<DataVector, 3>*> target_coords,
+               double time, const FunctionsOfTimeMap& functions_of_time) const;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, 3> frame_velocity(
       const std::array<T, 3>& source_coords, double time,
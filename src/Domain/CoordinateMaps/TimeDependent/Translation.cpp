@@ -4,6 +4,7 @@
 #include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
 
 #include <cmath>
+#include <limits>
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>
@@ -96,10 +97,6 @@ std::optional<std::array<double, Dim>> Translation<Dim>::inverse(
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time) const {
-  std::array<double, Dim> result{};
-  for (size_t i = 0; i < Dim; i++) {
-    gsl::at(result, i) = gsl::at(target_coords, i);
-  }
   const DataVector function_of_time =
       functions_of_time.at(f_of_t_name_)->func(time)[0];
   ASSERT(function_of_time.size() == Dim,
@@ -107,6 +104,49 @@ std::optional<std::array<double, Dim>> Translation<Dim>::inverse(
              << function_of_time.size()
              << ") does not match the dimension of the translation map (" << Dim
              << ").");
+  return inverse_impl(target_coords, function_of_time);
+}
+
+template <size_t Dim>
+void Translation<Dim>::inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  const DataVector function_of_time =
+      functions_of_time.at(f_of_t_name_)->func(time)[0];
+  ASSERT(function_of_time.size() == Dim,
+         "The dimension of the function of time ("
+             << function_of_time.size()
+             << ") does not match the dimension of the translation map (" << Dim
+             << ").");
+  std::array<double, Dim> target_point{};
+  for (size_t s = 0; s < (*target_coords)[0].size(); ++s) {
+    if (std::isnan((*target_coords)[0][s])) {
+      continue;
+    }
+    for (size_t i = 0; i < Dim; i++) {
+      gsl::at(target_point, i) = gsl::at(*target_coords, i)[s];
+    }
+    const std::optional<std::array<double, Dim>> source_point =
+        inverse_impl(target_point, function_of_time);
+    for (size_t i = 0; i < Dim; i++) {
+      gsl::at(*target_coords, i)[s] =
+          source_point.has_value() ? gsl::at(*source_point, i)
+                                   : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+}
+
+template <size_t Dim>
+std::optional<std::array<double, Dim>> Translation<Dim>::inverse_impl(
+    const std::array<double, Dim>& target_coords,
+    const DataVector& function_of_time) const {
+  std::array<double, Dim> result{};
+  for (size_t i = 0; i < Dim; i++) {
+    gsl::at(result, i) = gsl::at(target_coords, i);
+  }
   // If an inner radius specified then take the inverse of the
   // piecewise specific translation.
   if (inner_radius_.has_value()) {
@@ -288,6 +328,19 @@ Translation<Dim>::inv_jacobian(
   }
 }
 
+template <size_t Dim>
+std::optional<tnsr::Ij<double, Dim, Frame::NoFrame>>
+Translation<Dim>::uniform_jacobian(
+    const double /*time*/,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+    /*functions_of_time*/) const {
+  if (f_of_r_ == nullptr and not inner_radius_.has_value()) {
+    return identity<Dim>(0.0);
+  }
+  return std::nullopt;
+}
+
 template <size_t Dim>
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, Dim>
@@ -13,6 +13,7 @@
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "PointwiseFunctions/MathFunctions/MathFunction.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
@@ -191,6 +192,15 @@ class Translation {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const;
 
+  /// Inverts all points at once, evaluating the function of time only once.
+  /// See `domain::CoordinateMap` for the semantics of the batched inverse.
+  void inverse(gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+               double time,
+               const std::unordered_map<
+                   std::string,
+                   std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+                   functions_of_time) const;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, Dim> frame_velocity(
       const std::array<T, Dim>& source_coords, double time,
@@ -215,6 +225,16 @@ class Translation {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const;
 
+  /// The identity if the translation is the same at all points, and
+  /// `std::nullopt` if it has a radial falloff. See
+  /// `domain::CoordinateMap` for how uniform Jacobians are used.
+  std::optional<tnsr::Ij<double, Dim, Frame::NoFrame>> uniform_jacobian(
+      double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time) const;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
@@ -250,6 +270,10 @@ class Translation {
           functions_of_time,
       size_t function_or_deriv_index) const;
 
+  std::optional<std::array<double, Dim>> inverse_impl(
+      const std::array<double, Dim>& target_coords,
+      const DataVector& function_of_time) const;
+
   double root_finder(const std::array<double, Dim>& distance_to_center,
                      const DataVector& function_of_time) const;
 
@@ -3,10 +3,12 @@
 
 #include "Domain/ElementDistribution.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -15,14 +17,17 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Block.hpp"
 #include "Domain/CreateInitialElement.hpp"
 #include "Domain/ElementMap.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Domain/Structure/CreateInitialMesh.hpp"
+#include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/Neighbors.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -55,19 +60,15 @@ namespace {
 // spacing in the denominator of the cost is that it was found experimentally
 // that using the square root yielded faster BBH simulation runtimes when using
 // local time stepping.
+//
+// All initial elements of a block share the same `mesh`, so the caller
+// computes it and its `logical_coords` once per block.
 template <size_t Dim>
 double get_num_points_and_grid_spacing_cost(
     const ElementId<Dim>& element_id, const Block<Dim>& block,
-    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
-    const std::vector<std::array<size_t, Dim>>& initial_extents,
-    const Spectral::Quadrature quadrature) {
-  Mesh<Dim> mesh = ::domain::Initialization::create_initial_mesh(
-      initial_extents, element_id, quadrature);
-  Element<Dim> element = ::domain::Initialization::create_initial_element(
-      element_id, block, initial_refinement_levels);
-  ElementMap<Dim, Frame::Grid> element_map{element_id, block};
-  const tnsr::I<DataVector, Dim, Frame::ElementLogical> logical_coords =
-      logical_coordinates(mesh);
+    const Mesh<Dim>& mesh,
+    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& logical_coords) {
+  const ElementMap<Dim, Frame::Grid> element_map{element_id, block};
   const tnsr::I<DataVector, Dim, Frame::Grid> grid_coords =
       element_map(logical_coords);
   const double min_grid_spacing =
@@ -75,6 +76,47 @@ double get_num_points_and_grid_spacing_cost(
 
   return mesh.number_of_grid_points() / sqrt(min_grid_spacing);
 }
+
+// The index of the point `x` with `bits` bits per coordinate along the Hilbert
+// curve, using the algorithm of Skilling, AIP Conf. Proc. 707, 381 (2004). The
+// coordinates are first transformed to the "transposed" Hilbert index, whose
+// bits are then interleaved into the index.
+template <size_t Dim>
+size_t hilbert_curve_index(std::array<size_t, Dim> x, const size_t bits) {
+  // Undo the excess work of the inverse transform
+  for (size_t q = 1_st << (bits - 1); q > 1; q >>= 1) {
+    const size_t p = q - 1;
+    for (size_t i = 0; i < Dim; ++i) {
+      if ((gsl::at(x, i) & q) != 0) {
+        x[0] ^= p;
+      } else {
+        const size_t t = (x[0] ^ gsl::at(x, i)) & p;
+        x[0] ^= t;
+        gsl::at(x, i) ^= t;
+      }
+    }
+  }
+  // Gray encode
+  for (size_t i = 1; i < Dim; ++i) {
+    gsl::at(x, i) ^= gsl::at(x, i - 1);
+  }
+  size_t t = 0;
+  for (size_t q = 1_st << (bits - 1); q > 1; q >>= 1) {
+    if ((x[Dim - 1] & q) != 0) {
+      t ^= q - 1;
+    }
+  }
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(x, i) ^= t;
+  }
+  size_t index = 0;
+  for (size_t bit = bits; bit-- > 0;) {
+    for (size_t i = 0; i < Dim; ++i) {
+      index = (index << 1) | ((gsl::at(x, i) >> bit) & 1);
+    }
+  }
+  return index;
+}
 }  //  namespace
 
 std::ostream& operator<<(std::ostream& os, ElementWeight weight) {
@@ -106,6 +148,20 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
         initial_element_ids(block.id(), initial_ref_levs);
     const size_t grid_points_per_element = alg::accumulate(
         initial_extents[block_number], 1_st, std::multiplies<size_t>());
+    element_costs.reserve(element_costs.size() + element_ids.size());
+
+    std::optional<Mesh<Dim>> mesh{};
+    std::optional<tnsr::I<DataVector, Dim, Frame::ElementLogical>>
+        logical_coords{};
+    if (element_weight == ElementWeight::NumGridPointsAndGridSpacing) {
+      ASSERT(quadrature.has_value(),
+             "Since element_weight is "
+             "ElementWeight::NumGridPointsAndGridSpacing, quadrature must "
+             "have a value");
+      mesh = ::domain::Initialization::create_initial_mesh(
+          initial_extents, element_ids.front(), quadrature.value());
+      logical_coords = logical_coordinates(*mesh);
+    }
 
     for (const auto& element_id : element_ids) {
       if (element_weight == ElementWeight::Uniform) {
@@ -115,15 +171,9 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
       } else {
         ASSERT(element_weight == ElementWeight::NumGridPointsAndGridSpacing,
                "Unknown element_weight");
-        ASSERT(quadrature.has_value(),
-               "Since element_weight is "
-               "ElementWeight::NumGridPointsAndGridSpacing, quadrature must "
-               "have a value");
-
         element_costs.insert(
             {element_id, get_num_points_and_grid_spacing_cost(
-                             element_id, block, initial_refinement_levels,
-                             initial_extents, quadrature.value())});
+                             element_id, block, *mesh, *logical_coords)});
       }
     }
   }
@@ -138,7 +188,8 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     const std::vector<Block<Dim>>& blocks,
     const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
-    const std::unordered_set<size_t>& global_procs_to_ignore) {
+    const std::unordered_set<size_t>& global_procs_to_ignore,
+    const bool order_blocks_along_hilbert_curve) {
   const size_t num_blocks = blocks.size();
 
   ASSERT(
@@ -184,6 +235,14 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     total_cost += element_id_and_cost.second;
   }
 
+  // The `current_block_num` below counts blocks in this order
+  std::vector<size_t> block_order(num_blocks);
+  if (order_blocks_along_hilbert_curve) {
+    block_order = hilbert_curve_block_order(blocks);
+  } else {
+    alg::iota(block_order, 0_st);
+  }
+
   size_t current_block_num = 0;
   size_t element_num_of_block = 0;
   double cost_remaining = total_cost;
@@ -213,14 +272,14 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     // allowed on the proc
     while (add_more_elements_to_proc and (current_block_num < num_blocks)) {
       const size_t num_elements_current_block =
-          num_elements_by_block[current_block_num];
+          num_elements_by_block[block_order[current_block_num]];
       size_t num_elements_distributed_to_proc = 0;
       // while we still have elements left on the block to distribute and we
       // still have cost allowed on the proc
       while (add_more_elements_to_proc and
              (element_num_of_block < num_elements_current_block)) {
         const ElementId<Dim>& element_id =
-            initial_element_ids_by_block[current_block_num]
+            initial_element_ids_by_block[block_order[current_block_num]]
                                         [element_num_of_block];
         const double element_cost = element_costs.at(element_id);
 
@@ -258,7 +317,7 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
       }
 
       // add a proc and its element allowance for the current block
-      block_element_distribution_.at(current_block_num)
+      block_element_distribution_.at(block_order[current_block_num])
           .emplace_back(std::make_pair(global_proc_number,
                                        num_elements_distributed_to_proc));
       if (element_num_of_block >= num_elements_current_block) {
@@ -281,18 +340,19 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
 
   // distribute remaining Elements of Block we left off on
   if (current_block_num < num_blocks) {
-    block_element_distribution_.at(current_block_num)
+    block_element_distribution_.at(block_order[current_block_num])
         .emplace_back(std::make_pair(
             global_proc_number,
-            num_elements_by_block[current_block_num] - element_num_of_block));
+            num_elements_by_block[block_order[current_block_num]] -
+                element_num_of_block));
   }
 
   // distribute any Blocks that still remain after the Block we left off on
   current_block_num++;
   while (current_block_num < num_blocks) {
     const size_t num_elements_current_block =
-        num_elements_by_block[current_block_num];
-    block_element_distribution_.at(current_block_num)
+        num_elements_by_block[block_order[current_block_num]];
+    block_element_distribution_.at(block_order[current_block_num])
         .emplace_back(
             std::make_pair(global_proc_number, num_elements_current_block));
     current_block_num++;
@@ -317,6 +377,199 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
       "of BlockZCurveProcDistribution.");
 }
 
+template <size_t Dim>
+std::vector<size_t> hilbert_curve_block_order(
+    const std::vector<Block<Dim>>& blocks) {
+  const size_t num_blocks = blocks.size();
+  const tnsr::I<double, Dim, Frame::BlockLogical> logical_center{0.0};
+  std::vector<std::array<double, Dim>> centers(num_blocks);
+  std::array<double, Dim> lower{};
+  std::array<double, Dim> upper{};
+  lower.fill(std::numeric_limits<double>::max());
+  upper.fill(std::numeric_limits<double>::lowest());
+  for (size_t block_id = 0; block_id < num_blocks; ++block_id) {
+    const auto& block = blocks[block_id];
+    const auto center =
+        block.is_time_dependent()
+            ? block.moving_mesh_logical_to_grid_map()(logical_center)
+            : block.stationary_map()(logical_center);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(centers[block_id], d) = center.get(d);
+      gsl::at(lower, d) = std::min(gsl::at(lower, d), center.get(d));
+      gsl::at(upper, d) = std::max(gsl::at(upper, d), center.get(d));
+    }
+  }
+
+  const size_t bits = 63 / Dim;
+  const double max_coordinate = static_cast<double>((1_st << bits) - 1);
+  std::vector<size_t> indices(num_blocks);
+  for (size_t block_id = 0; block_id < num_blocks; ++block_id) {
+    std::array<size_t, Dim> quantized_center{};
+    for (size_t d = 0; d < Dim; ++d) {
+      const double extent = gsl::at(upper, d) - gsl::at(lower, d);
+      if (extent > 0.0) {
+        gsl::at(quantized_center, d) = static_cast<size_t>(
+            std::round((gsl::at(centers[block_id], d) - gsl::at(lower, d)) /
+                       extent * max_coordinate));
+      }
+    }
+    indices[block_id] = hilbert_curve_index(quantized_center, bits);
+  }
+
+  std::vector<size_t> block_order(num_blocks);
+  alg::iota(block_order, 0_st);
+  std::stable_sort(block_order.begin(), block_order.end(),
+                   [&indices](const size_t lhs, const size_t rhs) {
+                     return indices[lhs] < indices[rhs];
+                   });
+  return block_order;
+}
+
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, size_t> minimize_inter_node_communication(
+    const BlockZCurveProcDistribution<Dim>& initial_distribution,
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const std::vector<size_t>& node_of_proc, const double cost_tolerance,
+    const size_t max_number_of_passes) {
+  ASSERT(not node_of_proc.empty(), "Must have at least one processor.");
+  ASSERT(cost_tolerance >= 0.0,
+         "The cost tolerance must be non-negative, not " << cost_tolerance);
+
+  // Traverse the elements in a fixed order so that every processor computing
+  // the distribution arrives at the same result
+  std::vector<ElementId<Dim>> element_ids{};
+  element_ids.reserve(element_costs.size());
+  std::unordered_map<ElementId<Dim>, size_t> index_of_element{};
+  for (const auto& block : blocks) {
+    for (const auto& element_id : initial_element_ids(
+             block.id(), initial_refinement_levels[block.id()])) {
+      index_of_element.emplace(element_id, element_ids.size());
+      element_ids.push_back(element_id);
+    }
+  }
+  const size_t num_elements = element_ids.size();
+  ASSERT(element_costs.size() == num_elements,
+         "`element_costs` is not the same size as the total number of elements "
+         "computed from `initial_refinement_levels`");
+
+  // Each side of a face contributes the number of grid points it sends across
+  // the mortar, so the edge weights are symmetric
+  std::vector<std::unordered_map<size_t, double>> edges(num_elements);
+  for (size_t i = 0; i < num_elements; ++i) {
+    const ElementId<Dim>& element_id = element_ids[i];
+    const auto& extents = initial_extents[element_id.block_id()];
+    const size_t grid_points_per_element =
+        alg::accumulate(extents, 1_st, std::multiplies<size_t>());
+    const Element<Dim> element = Initialization::create_initial_element(
+        element_id, blocks[element_id.block_id()], initial_refinement_levels);
+    for (const auto& [direction, neighbors] : element.neighbors()) {
+      const auto face_grid_points = static_cast<double>(
+          grid_points_per_element / gsl::at(extents, direction.dimension()));
+      for (const auto& neighbor_id : neighbors.ids()) {
+        const size_t j = index_of_element.at(neighbor_id);
+        edges[i][j] += face_grid_points;
+        edges[j][i] += face_grid_points;
+      }
+    }
+  }
+
+  const size_t num_procs = node_of_proc.size();
+  const size_t num_nodes = *alg::max_element(node_of_proc) + 1;
+  std::vector<size_t> proc_of_element(num_elements);
+  std::vector<double> cost_on_proc(num_procs, 0.0);
+  std::vector<size_t> elements_on_proc(num_procs, 0);
+  double total_cost = 0.0;
+  for (size_t i = 0; i < num_elements; ++i) {
+    const size_t proc =
+        initial_distribution.get_proc_for_element(element_ids[i]);
+    ASSERT(proc < num_procs, "Processor " << proc
+                                          << " is not in `node_of_proc`, which "
+                                             "only has "
+                                          << num_procs << " entries.");
+    const double cost = element_costs.at(element_ids[i]);
+    proc_of_element[i] = proc;
+    cost_on_proc[proc] += cost;
+    ++elements_on_proc[proc];
+    total_cost += cost;
+  }
+
+  // Only processors that were given elements by the initial distribution may
+  // receive elements, so ignored processors stay empty
+  std::vector<std::vector<size_t>> procs_on_node(num_nodes);
+  size_t number_of_procs_with_elements = 0;
+  double maximum_cost_on_proc = 0.0;
+  for (size_t proc = 0; proc < num_procs; ++proc) {
+    if (elements_on_proc[proc] > 0) {
+      procs_on_node[node_of_proc[proc]].push_back(proc);
+      ++number_of_procs_with_elements;
+      maximum_cost_on_proc = std::max(maximum_cost_on_proc, cost_on_proc[proc]);
+    }
+  }
+  maximum_cost_on_proc = std::max(
+      maximum_cost_on_proc,
+      (1.0 + cost_tolerance) * total_cost /
+          static_cast<double>(number_of_procs_with_elements));
+
+  std::vector<double> weight_to_node(num_nodes);
+  for (size_t pass = 0; pass < max_number_of_passes; ++pass) {
+    bool moved_an_element = false;
+    for (size_t i = 0; i < num_elements; ++i) {
+      const size_t current_proc = proc_of_element[i];
+      if (elements_on_proc[current_proc] == 1) {
+        continue;
+      }
+      const size_t current_node = node_of_proc[current_proc];
+      std::fill(weight_to_node.begin(), weight_to_node.end(), 0.0);
+      for (const auto& [neighbor, weight] : edges[i]) {
+        weight_to_node[node_of_proc[proc_of_element[neighbor]]] += weight;
+      }
+
+      const double cost = element_costs.at(element_ids[i]);
+      double best_gain = 0.0;
+      std::optional<size_t> best_proc{};
+      for (size_t node = 0; node < num_nodes; ++node) {
+        const double gain = weight_to_node[node] - weight_to_node[current_node];
+        if (node == current_node or gain <= best_gain) {
+          continue;
+        }
+        std::optional<size_t> least_loaded_proc{};
+        for (const size_t proc : procs_on_node[node]) {
+          if (cost_on_proc[proc] + cost <= maximum_cost_on_proc and
+              (not least_loaded_proc.has_value() or
+               cost_on_proc[proc] < cost_on_proc[*least_loaded_proc])) {
+            least_loaded_proc = proc;
+          }
+        }
+        if (least_loaded_proc.has_value()) {
+          best_gain = gain;
+          best_proc = least_loaded_proc;
+        }
+      }
+
+      if (best_proc.has_value()) {
+        cost_on_proc[current_proc] -= cost;
+        --elements_on_proc[current_proc];
+        cost_on_proc[*best_proc] += cost;
+        ++elements_on_proc[*best_proc];
+        proc_of_element[i] = *best_proc;
+        moved_an_element = true;
+      }
+    }
+    if (not moved_an_element) {
+      break;
+    }
+  }
+
+  std::unordered_map<ElementId<Dim>, size_t> result{};
+  for (size_t i = 0; i < num_elements; ++i) {
+    result.emplace(element_ids[i], proc_of_element[i]);
+  }
+  return result;
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                               \
@@ -335,7 +588,21 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
           initial_refinement_levels,                                         \
       const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
       ElementWeight element_weight,                                          \
-      const std::optional<Spectral::Quadrature>& quadrature);
+      const std::optional<Spectral::Quadrature>& quadrature);                \
+  template std::unordered_map<ElementId<GET_DIM(data)>, size_t>              \
+  minimize_inter_node_communication(                                         \
+      const BlockZCurveProcDistribution<GET_DIM(data)>&                      \
+          initial_distribution,                                              \
+      const std::unordered_map<ElementId<GET_DIM(data)>, double>&            \
+          element_costs,                                                     \
+      const std::vector<Block<GET_DIM(data)>>& blocks,                       \
+      const std::vector<std::array<size_t, GET_DIM(data)>>&                  \
+          initial_refinement_levels,                                         \
+      const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
+      const std::vector<size_t>& node_of_proc, double cost_tolerance,        \
+      size_t max_number_of_passes);                                          \
+  template std::vector<size_t> hilbert_curve_block_order(                    \
+      const std::vector<Block<GET_DIM(data)>>& blocks);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -117,6 +117,14 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
  * by guaranteeing that all elements within each block form a single
  * orthogonally connected cluster.
  *
+ * By default the `Block`s are traversed in order of their block id, so
+ * neighboring blocks can end up on distant processors in domains with many
+ * blocks. Setting `order_blocks_along_hilbert_curve` traverses the `Block`s
+ * instead along a Hilbert curve through their centers (see
+ * `hilbert_curve_block_order()`), so consecutive blocks, and hence the
+ * processors they are assigned to, are spatially close. The `Element`s within
+ * each block are still ordered by their Z-curve index.
+ *
  * The assignment of portions of blocks to processors may use partial blocks,
  * and/or multiple blocks to ensure an even distribution of elements to
  * processors.
@@ -152,7 +160,8 @@ struct BlockZCurveProcDistribution {
       const std::vector<Block<Dim>>& blocks,
       const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
       const std::vector<std::array<size_t, Dim>>& initial_extents,
-      const std::unordered_set<size_t>& global_procs_to_ignore = {});
+      const std::unordered_set<size_t>& global_procs_to_ignore = {},
+      bool order_blocks_along_hilbert_curve = false);
 
   /// Gets the suggested processor number for a particular `ElementId`,
   /// determined by the Morton curve weighted element assignment described in
@@ -174,6 +183,66 @@ struct BlockZCurveProcDistribution {
   std::vector<std::vector<std::pair<size_t, size_t>>>
       block_element_distribution_;
 };
+
+/*!
+ * \brief The block ids of the `blocks` ordered along a Hilbert curve through
+ * their centers
+ *
+ * \details The center of each `Block` is the image of its logical origin in
+ * the inertial frame, or in the grid frame if the `Block` is time-dependent
+ * (which coincides with the inertial frame at the initial time for most
+ * domains). The centers are rescaled to their bounding box and quantized to
+ * \f$2^{\lfloor 63 / \mathrm{Dim} \rfloor}\f$ points per dimension before
+ * computing their index along the Hilbert curve with the algorithm of
+ * \cite Skilling2004.
+ * Unlike a Morton curve, consecutive points along a Hilbert curve are always
+ * adjacent, so consecutive blocks in this order are spatially close. Blocks
+ * with the same index keep their order by block id.
+ */
+template <size_t Dim>
+std::vector<size_t> hilbert_curve_block_order(
+    const std::vector<Block<Dim>>& blocks);
+
+/*!
+ * \brief Improve an element distribution by moving `Element`s between nodes
+ * so that fewer mortars cross node boundaries
+ *
+ * \details The `BlockZCurveProcDistribution` balances cost but treats
+ * processors on the same node and on different nodes alike, so a portion of the
+ * mortars on the boundaries of each node's region end up crossing the
+ * interconnect even though the same number of elements could be arranged to
+ * keep them local. This function starts from the `initial_distribution` and
+ * performs greedy boundary-refinement passes (in the spirit of
+ * Fiduccia-Mattheyses) on the graph whose vertices are the `Element`s and whose
+ * edges are the shared faces, weighted by the number of grid points exchanged
+ * across the face in both directions. In each pass every `Element` is visited
+ * in a fixed order and moved to the node it shares the most face grid points
+ * with, provided this strictly reduces the total weight of the edges cut by
+ * node boundaries. The `Element` is placed on the least-loaded
+ * processor of the target node, and a move is only allowed if the cost on that
+ * processor stays below the larger of the initial maximum cost per processor
+ * and `1 + cost_tolerance` times the average cost per processor. No processor
+ * is ever emptied. Passes stop once no `Element` moves or after
+ * `max_number_of_passes`.
+ *
+ * A multilevel graph partitioner would produce smaller cuts for domains with
+ * many blocks, but since the Z-curve distribution already produces compact
+ * regions within each block, refining the boundaries between nodes captures
+ * most of the gain without needing an external partitioning library.
+ *
+ * `node_of_proc` maps every global processor (including ignored ones) to its
+ * node. The result maps every `ElementId` to its processor and is identical on
+ * every processor that computes it.
+ */
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, size_t> minimize_inter_node_communication(
+    const BlockZCurveProcDistribution<Dim>& initial_distribution,
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const std::vector<size_t>& node_of_proc, double cost_tolerance = 0.05,
+    size_t max_number_of_passes = 10);
 }  // namespace domain
 
 namespace element_weight_detail {
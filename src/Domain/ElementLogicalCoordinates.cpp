@@ -69,47 +69,62 @@ element_logical_coordinates(
       element_ids.size());
   std::vector<std::vector<size_t>> offsets(element_ids.size());
 
-  // Loop over points
+  // Adds the point at `offset` to the element at `index` if the element
+  // contains it
+  const auto add_if_contained = [&x_element_logical, &offsets, &element_ids](
+                                    const size_t index, const size_t offset,
+                                    const BlockLogicalCoords<Dim>& point) {
+    const auto& element_id = element_ids[index];
+    if (element_id.block_id() != point.value().id.get_index()) {
+      return false;
+    }
+    // This element is in this block; now check if the point is in
+    // this element.
+    const auto& x_block_logical = point.value().data;
+    const auto x_elem =
+        element_logical_coordinates(x_block_logical, element_id);
+    if (not x_elem.has_value()) {
+      return false;
+    }
+    // Disambiguate points on shared element boundaries
+    for (size_t d = 0; d < Dim; ++d) {
+      const double up = element_id.segment_id(d).endpoint(Side::Upper);
+      const double lo = element_id.segment_id(d).endpoint(Side::Lower);
+      if (not segment_contains(x_block_logical.get(d), lo, up)) {
+        return false;
+      }
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(x_element_logical[index], d).push_back(x_elem->get(d));
+    }
+    offsets[index].push_back(offset);
+    return true;
+  };
+
+  // Loop over points. Consecutive points (e.g. on a surface) are usually in
+  // the same element, so we check the element that contained the previous
+  // point first. Since elements don't overlap and points on shared
+  // boundaries are assigned to a unique element, the result doesn't depend
+  // on the order in which we check the elements.
+  size_t previous_index = 0;
   for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
     // Skip points that are not in any block.
     if (not block_coord_holders[offset].has_value()) {
       continue;
     }
-
-    const auto& block_id = block_coord_holders[offset].value().id;
-    const auto& x_block_logical = block_coord_holders[offset].value().data;
+    const auto& point = block_coord_holders[offset];
+    if (previous_index < element_ids.size() and
+        add_if_contained(previous_index, offset, point)) {
+      continue;
+    }
     // Need to loop over elements, because the block doesn't know
     // things like the refinement_level of each element.
     for (size_t index = 0; index < element_ids.size(); ++index) {
-      const auto& element_id = element_ids[index];
-      if (element_id.block_id() == block_id.get_index()) {
-        // This element is in this block; now check if the point is in
-        // this element.
-        const auto x_elem =
-            element_logical_coordinates(x_block_logical, element_id);
-        if (not x_elem.has_value()) {
-          continue;
-        }
-        // Disambiguate points on shared element boundaries
-        bool is_contained = true;
-        for (size_t d = 0; d < Dim; ++d) {
-          const double up = element_id.segment_id(d).endpoint(Side::Upper);
-          const double lo = element_id.segment_id(d).endpoint(Side::Lower);
-          const double x_block_log = x_block_logical.get(d);
-          if (not segment_contains(x_block_log, lo, up)) {
-            is_contained = false;
-            break;
-          }
-        }
-        if (is_contained) {
-          for (size_t d = 0; d < Dim; ++d) {
-            gsl::at(x_element_logical[index], d).push_back(x_elem->get(d));
-          }
-          offsets[index].push_back(offset);
-          // Found a matching element, so we don't need to check other
-          // elements.
-          break;
-        }
+      if (index != previous_index and add_if_contained(index, offset, point)) {
+        // Found a matching element, so we don't need to check other
+        // elements.
+        previous_index = index;
+        break;
       }
     }
   }
@@ -36,6 +36,23 @@
 #include "Utilities/StdHelpers.hpp"
 
 namespace domain::FunctionsOfTime {
+namespace {
+// The quaternion obtained by integrating from the start of the interval
+// beginning at `update` to `time` in the list identified by `list_id`.
+struct CachedIntegration {
+  std::uint64_t list_id = 0;
+  double update = std::numeric_limits<double>::signaling_NaN();
+  double time = std::numeric_limits<double>::signaling_NaN();
+  boost::math::quaternion<double> quaternion{};
+};
+
+CachedIntegration& cached_integration(const std::uint64_t list_id) {
+  constexpr size_t number_of_entries = 4;
+  thread_local std::array<CachedIntegration, number_of_entries> cache{};
+  return cache[list_id % number_of_entries];
+}
+}  // namespace
+
 template <size_t MaxDeriv>
 QuaternionFunctionOfTime<MaxDeriv>::QuaternionFunctionOfTime() = default;
 
@@ -277,6 +294,17 @@ boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
     const double t) const {
   // Get quaternion and time at closest time before t
   const auto stored_info_at_t0 = stored_quaternions_and_times_(t);
+
+  // Every element on a thread evaluates the rotation at the same times, so
+  // remember the last few integrations. Stored intervals are never modified,
+  // so a result is valid as long as the list still holds the same intervals.
+  const std::uint64_t list_id = stored_quaternions_and_times_.id();
+  auto& cached = cached_integration(list_id);
+  if (cached.list_id == list_id and
+      cached.update == stored_info_at_t0.update and cached.time == t) {
+    return cached.quaternion;
+  }
+
   boost::math::quaternion<double> quat_to_integrate = stored_info_at_t0.data;
 
   // Solve the ode and store the result in quat_to_integrate
@@ -286,6 +314,7 @@ boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
   // Make unit quaternion
   normalize_quaternion(make_not_null(&quat_to_integrate));
 
+  cached = {list_id, stored_info_at_t0.update, t, quat_to_integrate};
   return quat_to_integrate;
 }
 
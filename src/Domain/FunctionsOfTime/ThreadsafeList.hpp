@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 #include <memory>
@@ -20,6 +21,14 @@ namespace domain::FunctionsOfTime::FunctionOfTimeHelpers {
 namespace ThreadsafeList_detail {
 template <typename T>
 struct Interval;
+
+// A new identifier for the contents of a list.  Lookups cache the last
+// interval they found per thread, keyed by this identifier, so it changes
+// whenever intervals are removed.
+inline std::uint64_t new_list_id() {
+  static std::atomic<std::uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
 }  // namespace ThreadsafeList_detail
 
 /// A list of time intervals that allows safe access to existing
@@ -29,6 +38,10 @@ struct Interval;
 /// operations except for serialization can be safely performed in
 /// parallel with each other and with `insert` and will return a
 /// consistent state.
+///
+/// Lookups of the most recent interval are fast.  For lookups of
+/// older intervals, each thread remembers the last few intervals it
+/// found, so repeated lookups at nearby times don't walk the list.
 template <typename T>
 class ThreadsafeList {
  private:
@@ -85,6 +98,12 @@ class ThreadsafeList {
   /// interval boundary, the one after it is returned.
   double expiration_after(double time) const;
 
+  /// An identifier for the intervals in the list.  It is unique among
+  /// all lists and changes whenever intervals are removed or the list
+  /// is assigned to, so it can be used to key caches of values derived
+  /// from the stored data.
+  std::uint64_t id() const;
+
   /// Remove the oldest data in the list, leaving at least \p length
   /// entries.
   ///
@@ -178,11 +197,12 @@ class ThreadsafeList {
   char unused_padding_initial_time_[64 - (sizeof(initial_time_) % 64)] = {};
   std::unique_ptr<Interval> interval_list_{};
   alignas(64) std::atomic<Interval*> most_recent_interval_{};
+  // Identifies the intervals in the list for the per-thread lookup cache
+  std::atomic<std::uint64_t> id_{ThreadsafeList_detail::new_list_id()};
   // Pad memory to avoid false-sharing when accessing most_recent_interval_
   // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  char
-      unused_padding_most_recent_interval_[64 - (sizeof(most_recent_interval_) %
-                                                 64)] = {};
+  char unused_padding_most_recent_interval_
+      [64 - ((sizeof(most_recent_interval_) + sizeof(id_)) % 64)] = {};
 };
 
 template <typename T>
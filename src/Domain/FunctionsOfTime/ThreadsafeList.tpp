@@ -5,7 +5,11 @@
 
 #include "Domain/FunctionsOfTime/ThreadsafeList.hpp"
 
+#include <array>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <pup.h>
 #include <pup_stl.h>
@@ -32,6 +36,33 @@ void Interval<T>::pup(PUP::er& p) {
   p | data;
   p | previous;
 }
+
+// An interval found by a lookup in the list identified by `list_id`,
+// covering the times from `lower` to `upper`.
+template <typename T>
+struct Cursor {
+  std::uint64_t list_id = 0;
+  const Interval<T>* interval = nullptr;
+  double lower = std::numeric_limits<double>::signaling_NaN();
+  double upper = std::numeric_limits<double>::signaling_NaN();
+};
+
+// The cursor of the calling thread for the list identified by `list_id`.
+// A few cursors are kept so maps looking up several functions of time
+// don't evict each other's entries.
+template <typename T>
+Cursor<T>& cursor(const std::uint64_t list_id) {
+  constexpr size_t number_of_cursors = 8;
+  thread_local std::array<Cursor<T>, number_of_cursors> cursors{};
+  return cursors[list_id % number_of_cursors];
+}
+
+inline bool interval_contains(const double time, const double lower,
+                              const double upper,
+                              const bool interval_after_boundary) {
+  return interval_after_boundary ? lower <= time and time < upper
+                                 : lower < time and time <= upper;
+}
 }  // namespace ThreadsafeList_detail
 
 template <typename T>
@@ -54,9 +85,12 @@ auto ThreadsafeList<T>::operator=(ThreadsafeList&& other) -> ThreadsafeList& {
   }
   initial_time_.store(other.initial_time_.load(std::memory_order_acquire),
                       std::memory_order_release);
+  id_.store(ThreadsafeList_detail::new_list_id(), std::memory_order_release);
   interval_list_ = std::move(other.interval_list_);
   most_recent_interval_.store(interval_list_.get(), std::memory_order_release);
   other.most_recent_interval_.store(nullptr, std::memory_order_release);
+  other.id_.store(ThreadsafeList_detail::new_list_id(),
+                  std::memory_order_release);
   return *this;
 }
 
@@ -68,6 +102,7 @@ auto ThreadsafeList<T>::operator=(const ThreadsafeList& other)
   }
   initial_time_.store(other.initial_time_.load(std::memory_order_acquire),
                       std::memory_order_release);
+  id_.store(ThreadsafeList_detail::new_list_id(), std::memory_order_release);
 
   std::unique_ptr<Interval>* previous_pointer = &interval_list_;
   for (auto&& entry : other) {
@@ -135,6 +170,11 @@ double ThreadsafeList<T>::initial_time() const {
   return initial_time_.load(std::memory_order_acquire);
 }
 
+template <typename T>
+std::uint64_t ThreadsafeList<T>::id() const {
+  return id_.load(std::memory_order_acquire);
+}
+
 template <typename T>
 double ThreadsafeList<T>::expiration_time() const {
   auto* interval = most_recent_interval_.load(std::memory_order_acquire);
@@ -166,6 +206,7 @@ void ThreadsafeList<T>::truncate_to_length(const size_t length) {
   }
 
   initial_time_.store(last_interval->previous->expiration);
+  id_.store(ThreadsafeList_detail::new_list_id(), std::memory_order_release);
   last_interval->previous.reset();
 }
 
@@ -192,6 +233,7 @@ void ThreadsafeList<T>::truncate_at_time(const double time) {
   }
 
   initial_time_.store(last_interval->previous->expiration);
+  id_.store(ThreadsafeList_detail::new_list_id(), std::memory_order_release);
   last_interval->previous.reset();
 }
 
@@ -204,6 +246,7 @@ void ThreadsafeList<T>::clear() {
   }
   initial_time_.store(interval_list_->expiration);
   most_recent_interval_.store(nullptr, std::memory_order_release);
+  id_.store(ThreadsafeList_detail::new_list_id(), std::memory_order_release);
   interval_list_.reset();
 }
 
@@ -223,6 +266,7 @@ void ThreadsafeList<T>::pup(PUP::er& p) {
   if (p.isUnpacking()) {
     bool empty{};
     p | empty;
+    id_.store(ThreadsafeList_detail::new_list_id(), std::memory_order_release);
     interval_list_.reset();
     if (not empty) {
       interval_list_ = std::make_unique<Interval>();
@@ -298,10 +342,32 @@ auto ThreadsafeList<T>::find_interval(const double time,
   }
   // Loop over the intervals until we find the one containing `time`,
   // possibly at the endpoint determined by `interval_after_boundary`.
+  // Most lookups are in the most recent interval, so only check the
+  // cursor of this thread once that has failed.
+  const auto is_in_interval = [&time, &interval_after_boundary](
+                                  const Interval* const previous_interval) {
+    return previous_interval == nullptr or
+           time > previous_interval->expiration or
+           (interval_after_boundary and time == previous_interval->expiration);
+  };
+  if (is_in_interval(interval->previous.get())) {
+    return *interval;
+  }
+  const std::uint64_t list_id = id_.load(std::memory_order_acquire);
+  auto& cursor = ThreadsafeList_detail::cursor<T>(list_id);
+  if (cursor.list_id == list_id and
+      ThreadsafeList_detail::interval_contains(
+          time, cursor.lower, cursor.upper, interval_after_boundary)) {
+    return *cursor.interval;
+  }
   for (;;) {
     auto* const previous_interval = interval->previous.get();
-    if (previous_interval == nullptr or time > previous_interval->expiration or
-        (interval_after_boundary and time == previous_interval->expiration)) {
+    if (is_in_interval(previous_interval)) {
+      cursor = {list_id, interval,
+                previous_interval == nullptr
+                    ? -std::numeric_limits<double>::infinity()
+                    : previous_interval->expiration,
+                interval->expiration};
       return *interval;
     }
     interval = previous_interval;
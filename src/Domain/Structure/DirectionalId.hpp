@@ -4,6 +4,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iosfwd>
 
 #include "Domain/Structure/Direction.hpp"
@@ -44,6 +46,24 @@ struct hash<DirectionalId<VolumeDim>> {
 };
 }  // namespace std
 
+/// \ingroup ComputationalDomainGroup
+/// An inline hash for the table in a `DirectionalIdMap`.
+///
+/// The 64 bits of the `DirectionalId` (see `hash_value`) are mixed with a
+/// multiplicative hash so that neighbors that differ only in the direction or
+/// in the low bits of a segment index land in different buckets of the small
+/// fixed-size table, and so that a lookup doesn't have to call the
+/// out-of-line `std::hash`.
+template <size_t VolumeDim>
+struct DirectionalIdHash {
+  size_t operator()(const DirectionalId<VolumeDim>& id) const {
+    static_assert(sizeof(DirectionalId<VolumeDim>) == sizeof(uint64_t));
+    uint64_t bits = 0;
+    std::memcpy(&bits, &id, sizeof(bits));
+    return static_cast<size_t>((bits * 0x9E3779B97F4A7C15ULL) >> 32);
+  }
+};
+
 template <size_t VolumeDim>
 bool operator==(const DirectionalId<VolumeDim>& lhs,
                 const DirectionalId<VolumeDim>& rhs);
@@ -12,11 +12,12 @@
 
 /// An optimized map with DirectionalId keys
 template <size_t Dim, typename T>
-class DirectionalIdMap : public FixedHashMap<maximum_number_of_neighbors(Dim),
-                                             DirectionalId<Dim>, T> {
+class DirectionalIdMap
+    : public FixedHashMap<maximum_number_of_neighbors(Dim), DirectionalId<Dim>,
+                          T, DirectionalIdHash<Dim>> {
  public:
-  using base =
-      FixedHashMap<maximum_number_of_neighbors(Dim), DirectionalId<Dim>, T>;
+  using base = FixedHashMap<maximum_number_of_neighbors(Dim),
+                            DirectionalId<Dim>, T, DirectionalIdHash<Dim>>;
   using base::base;
 };
 
@@ -5,7 +5,12 @@
 
 #include <algorithm>
 #include <array>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -293,6 +298,39 @@ std::vector<size_t> oriented_offset_on_slice(
       neighbor_second_axis_is_aligned, neighbor_axes_are_transposed);
 }
 
+// Encodes the orientation of the neighbor along each of the logical axes, so
+// it can be part of a cache key
+template <size_t VolumeDim>
+std::array<size_t, VolumeDim> orientation_key(
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) {
+  std::array<size_t, VolumeDim> key{};
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    const auto neighbor_axis =
+        orientation_of_neighbor(Direction<VolumeDim>(d, Side::Upper));
+    gsl::at(key, d) = 2 * neighbor_axis.dimension() +
+                      (neighbor_axis.side() == Side::Upper ? 1 : 0);
+  }
+  return key;
+}
+
+// The offset permutations only depend on the extents and the orientation of
+// the neighbor, and the same few combinations are reoriented over and over on
+// block boundaries, so they are computed once and kept until the end of
+// execution. The cache is a node-based map that never erases entries, so the
+// returned references remain valid.
+template <typename Key, typename Generator>
+const std::vector<size_t>& cached_oriented_offset(const Key& key,
+                                                  const Generator& generator) {
+  static std::mutex cache_mutex{};
+  static std::map<Key, std::vector<size_t>> cache{};
+  const std::lock_guard lock(cache_mutex);
+  const auto [it, inserted] = cache.try_emplace(key);
+  if (inserted) {
+    it->second = generator();
+  }
+  return it->second;
+}
+
 template <typename T>
 void orient_each_component(
     const gsl::not_null<gsl::span<T>*> oriented_variables,
@@ -334,8 +372,12 @@ void orient_variables(
     return;
   }
 
-  const auto oriented_extents =
-      oriented_offset(extents, orientation_of_neighbor);
+  const auto& oriented_extents = cached_oriented_offset(
+      std::make_pair(extents.indices(),
+                     orientation_key(orientation_of_neighbor)),
+      [&extents, &orientation_of_neighbor]() {
+        return oriented_offset(extents, orientation_of_neighbor);
+      });
   auto oriented_vars_view = gsl::make_span(result->data(), result->size());
   orient_each_component(make_not_null(&oriented_vars_view),
                         gsl::make_span(variables.data(), variables.size()),
@@ -363,8 +405,13 @@ void orient_variables_on_slice(
     return;
   }
 
-  const auto oriented_offset = oriented_offset_on_slice(
-      slice_extents, sliced_dim, orientation_of_neighbor);
+  const auto& oriented_offset = cached_oriented_offset(
+      std::make_tuple(slice_extents.indices(), sliced_dim,
+                      orientation_key(orientation_of_neighbor)),
+      [&slice_extents, &sliced_dim, &orientation_of_neighbor]() {
+        return oriented_offset_on_slice(slice_extents, sliced_dim,
+                                        orientation_of_neighbor);
+      });
 
   auto oriented_vars_view = gsl::make_span(result->data(), result->size());
   orient_each_component(
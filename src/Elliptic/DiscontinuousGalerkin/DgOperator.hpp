@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SliceVariables.hpp"
@@ -40,6 +41,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -618,14 +620,45 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       // Here, `w` are the quadrature weights (the diagonal logical mass matrix
       // with mass-lumping) and det(J) is the Jacobian determinant. The
       // quantities are evaluated at the grid point `p`.
+      // The sources are added directly to the operator wherever possible, so
+      // they don't need a separate buffer. The sources computer is passed to
+      // this lambda as a type so it is only instantiated for systems that
+      // have sources.
+      constexpr bool has_sources = not std::is_same_v<SourcesComputer, void>;
+      [[maybe_unused]] const auto add_sources =
+          [&primal_vars, &primal_fluxes, &sources_args](
+              const auto result, const auto sources_computer_v) {
+            using LocalSourcesComputer =
+                tmpl::type_from<std::decay_t<decltype(sources_computer_v)>>;
+            std::apply(
+                [&result, &primal_vars,
+                 &primal_fluxes](const auto&... expanded_sources_args) {
+                  LocalSourcesComputer::apply(
+                      make_not_null(&get<OperatorTags>(*result))...,
+                      expanded_sources_args...,
+                      get<PrimalVars>(primal_vars)...,
+                      get<PrimalFluxesVars>(primal_fluxes)...);
+                },
+                sources_args);
+          };
       if (formulation == ::dg::Formulation::StrongInertial) {
         // Compute strong divergence:
         //   div(F) = (J^\hat{i}_i)_p \sum_q (D_\hat{i})_pq (F^i)_q.
+        // With sources, the factor det(J) of the massive operator is applied
+        // after adding the sources, so it multiplies both terms at once.
         divergence(operator_applied_to_vars, primal_fluxes, mesh,
-                   massive ? det_times_inv_jacobian : inv_jacobian);
+                   (massive and not has_sources) ? det_times_inv_jacobian
+                                                 : inv_jacobian);
         // This is the sign flip that makes the operator _minus_ the Laplacian
         // for a Poisson system
         *operator_applied_to_vars *= -1.;
+        if constexpr (has_sources) {
+          add_sources(operator_applied_to_vars,
+                      tmpl::type_<SourcesComputer>{});
+          if (massive) {
+            *operator_applied_to_vars *= get(det_jacobian);
+          }
+        }
       } else {
         // Compute weak divergence:
         //   F^i \partial_i \phi = 1/w_p \sum_q
@@ -634,23 +667,17 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
                         det_times_inv_jacobian);
         if (not massive) {
           *operator_applied_to_vars *= get(det_inv_jacobian);
-        }
-      }
-      if constexpr (not std::is_same_v<SourcesComputer, void>) {
-        Variables<tmpl::list<OperatorTags...>> sources{num_points, 0.};
-        std::apply(
-            [&sources, &primal_vars,
-             &primal_fluxes](const auto&... expanded_sources_args) {
-              SourcesComputer::apply(
-                  make_not_null(&get<OperatorTags>(sources))...,
-                  expanded_sources_args..., get<PrimalVars>(primal_vars)...,
-                  get<PrimalFluxesVars>(primal_fluxes)...);
-            },
-            sources_args);
-        if (massive) {
+          if constexpr (has_sources) {
+            add_sources(operator_applied_to_vars,
+                        tmpl::type_<SourcesComputer>{});
+          }
+        } else if constexpr (has_sources) {
+          Variables<tmpl::list<OperatorTags...>> sources{num_points, 0.};
+          add_sources(make_not_null(&sources),
+                      tmpl::type_<SourcesComputer>{});
           sources *= get(det_jacobian);
+          *operator_applied_to_vars += sources;
         }
-        *operator_applied_to_vars += sources;
       }
     }
     if (massive) {
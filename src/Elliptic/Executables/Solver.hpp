@@ -327,7 +327,8 @@ struct Solver {
               nonlinear_solver_iteration_id>,
           // Reset Schwarz subdomain solver
           LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
-              typename schwarz_smoother::options_group>,
+              typename schwarz_smoother::options_group,
+              typename nonlinear_solver::options_group>,
           // Linear solve for correction
           linear_solve_actions<tmpl::list<>>>,
       StepActions>;
@@ -382,6 +383,11 @@ struct Solver {
       typename linear_solver::amr_projectors,
       typename multigrid::amr_projectors,
       typename schwarz_smoother::amr_projectors,
+      tmpl::conditional_t<
+          is_linear, tmpl::list<>,
+          LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
+              typename schwarz_smoother::options_group,
+              typename nonlinear_solver::options_group>>,
       ::amr::projectors::DefaultInitialize<tmpl::append<
           tmpl::list<domain::Tags::InitialExtents<volume_dim>,
                      domain::Tags::InitialRefinementLevels<volume_dim>>,
@@ -6,6 +6,8 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Elliptic/Systems/Elasticity/Equations.hpp"
 #include "Elliptic/Systems/Poisson/Equations.hpp"
@@ -14,10 +16,40 @@
 #include "PointwiseFunctions/Xcts/LongitudinalOperator.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
-
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace Xcts {
+namespace {
+// Combine the background and excess shift into the quantities that the
+// sources of the full XCTS equations need, without allocating the full shift.
+void full_shift_terms(
+    const gsl::not_null<Scalar<DataVector>*>
+        shift_dot_deriv_extrinsic_curvature_trace,
+    const gsl::not_null<tnsr::II<DataVector, 3>*>
+        longitudinal_shift_minus_dt_conformal_metric,
+    const tnsr::I<DataVector, 3>& shift_background,
+    const tnsr::I<DataVector, 3>& shift_excess,
+    const tnsr::i<DataVector, 3>& extrinsic_curvature_trace_gradient,
+    const tnsr::II<DataVector, 3>&
+        longitudinal_shift_background_minus_dt_conformal_metric,
+    const tnsr::II<DataVector, 3>& longitudinal_shift_excess) {
+  get(*shift_dot_deriv_extrinsic_curvature_trace) =
+      (get<0>(shift_background) + get<0>(shift_excess)) *
+      get<0>(extrinsic_curvature_trace_gradient);
+  for (size_t i = 1; i < 3; ++i) {
+    get(*shift_dot_deriv_extrinsic_curvature_trace) +=
+        (shift_background.get(i) + shift_excess.get(i)) *
+        extrinsic_curvature_trace_gradient.get(i);
+  }
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j <= i; ++j) {
+      longitudinal_shift_minus_dt_conformal_metric->get(i, j) =
+          longitudinal_shift_background_minus_dt_conformal_metric.get(i, j) +
+          longitudinal_shift_excess.get(i, j);
+    }
+  }
+}
+}  // namespace
 
 void Fluxes<Equations::Hamiltonian, Geometry::FlatCartesian>::apply(
     const gsl::not_null<tnsr::I<DataVector, 3>*> flux_for_conformal_factor,
@@ -365,25 +397,25 @@ void Sources<Equations::HamiltonianLapseAndShift, Geometry::FlatCartesian,
           const tnsr::I<DataVector, 3>& conformal_factor_flux,
           const tnsr::I<DataVector, 3>& lapse_times_conformal_factor_flux,
           const tnsr::II<DataVector, 3>& longitudinal_shift_excess) {
-  auto shift = shift_background;
-  for (size_t i = 0; i < 3; ++i) {
-    shift.get(i) += shift_excess.get(i);
-  }
-  auto longitudinal_shift_minus_dt_conformal_metric =
-      longitudinal_shift_background_minus_dt_conformal_metric;
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j <= i; ++j) {
-      longitudinal_shift_minus_dt_conformal_metric.get(i, j) +=
-          longitudinal_shift_excess.get(i, j);
-    }
-  }
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempII<1, 3>>> buffer{
+      get(conformal_factor_minus_one).size()};
+  auto& shift_dot_deriv_extrinsic_curvature_trace =
+      get<::Tags::TempScalar<0>>(buffer);
+  auto& longitudinal_shift_minus_dt_conformal_metric =
+      get<::Tags::TempII<1, 3>>(buffer);
+  full_shift_terms(
+      make_not_null(&shift_dot_deriv_extrinsic_curvature_trace),
+      make_not_null(&longitudinal_shift_minus_dt_conformal_metric),
+      shift_background, shift_excess, extrinsic_curvature_trace_gradient,
+      longitudinal_shift_background_minus_dt_conformal_metric,
+      longitudinal_shift_excess);
   add_hamiltonian_sources<ConformalMatterScale>(
       hamiltonian_constraint, conformal_energy_density,
       extrinsic_curvature_trace, conformal_factor_minus_one);
   add_lapse_sources<ConformalMatterScale>(
       lapse_equation, conformal_energy_density, conformal_stress_trace,
       extrinsic_curvature_trace, dt_extrinsic_curvature_trace,
-      dot_product(shift, extrinsic_curvature_trace_gradient),
+      shift_dot_deriv_extrinsic_curvature_trace,
       conformal_factor_minus_one, lapse_times_conformal_factor_minus_one);
   add_flat_cartesian_momentum_sources<ConformalMatterScale>(
       hamiltonian_constraint, lapse_equation, momentum_constraint,
@@ -423,18 +455,18 @@ void Sources<Equations::HamiltonianLapseAndShift, Geometry::Curved,
           const tnsr::I<DataVector, 3>& conformal_factor_flux,
           const tnsr::I<DataVector, 3>& lapse_times_conformal_factor_flux,
           const tnsr::II<DataVector, 3>& longitudinal_shift_excess) {
-  auto shift = shift_background;
-  for (size_t i = 0; i < 3; ++i) {
-    shift.get(i) += shift_excess.get(i);
-  }
-  auto longitudinal_shift_minus_dt_conformal_metric =
-      longitudinal_shift_background_minus_dt_conformal_metric;
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j <= i; ++j) {
-      longitudinal_shift_minus_dt_conformal_metric.get(i, j) +=
-          longitudinal_shift_excess.get(i, j);
-    }
-  }
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempII<1, 3>>> buffer{
+      get(conformal_factor_minus_one).size()};
+  auto& shift_dot_deriv_extrinsic_curvature_trace =
+      get<::Tags::TempScalar<0>>(buffer);
+  auto& longitudinal_shift_minus_dt_conformal_metric =
+      get<::Tags::TempII<1, 3>>(buffer);
+  full_shift_terms(
+      make_not_null(&shift_dot_deriv_extrinsic_curvature_trace),
+      make_not_null(&longitudinal_shift_minus_dt_conformal_metric),
+      shift_background, shift_excess, extrinsic_curvature_trace_gradient,
+      longitudinal_shift_background_minus_dt_conformal_metric,
+      longitudinal_shift_excess);
   add_hamiltonian_sources<ConformalMatterScale>(
       hamiltonian_constraint, conformal_energy_density,
       extrinsic_curvature_trace, conformal_factor_minus_one);
@@ -447,7 +479,7 @@ void Sources<Equations::HamiltonianLapseAndShift, Geometry::Curved,
   add_lapse_sources<ConformalMatterScale>(
       lapse_equation, conformal_energy_density, conformal_stress_trace,
       extrinsic_curvature_trace, dt_extrinsic_curvature_trace,
-      dot_product(shift, extrinsic_curvature_trace_gradient),
+      shift_dot_deriv_extrinsic_curvature_trace,
       conformal_factor_minus_one, lapse_times_conformal_factor_minus_one);
   add_curved_hamiltonian_or_lapse_sources(
       lapse_equation, conformal_ricci_scalar,
@@ -637,18 +669,18 @@ void LinearizedSources<Equations::HamiltonianLapseAndShift,
           const tnsr::I<DataVector, 3>&
               lapse_times_conformal_factor_flux_correction,
           const tnsr::II<DataVector, 3>& longitudinal_shift_excess_correction) {
-  auto shift = shift_background;
-  for (size_t i = 0; i < 3; ++i) {
-    shift.get(i) += shift_excess.get(i);
-  }
-  auto longitudinal_shift_minus_dt_conformal_metric =
-      longitudinal_shift_background_minus_dt_conformal_metric;
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j <= i; ++j) {
-      longitudinal_shift_minus_dt_conformal_metric.get(i, j) +=
-          longitudinal_shift_excess.get(i, j);
-    }
-  }
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempII<1, 3>>> buffer{
+      get(conformal_factor_minus_one).size()};
+  auto& shift_dot_deriv_extrinsic_curvature_trace =
+      get<::Tags::TempScalar<0>>(buffer);
+  auto& longitudinal_shift_minus_dt_conformal_metric =
+      get<::Tags::TempII<1, 3>>(buffer);
+  full_shift_terms(
+      make_not_null(&shift_dot_deriv_extrinsic_curvature_trace),
+      make_not_null(&longitudinal_shift_minus_dt_conformal_metric),
+      shift_background, shift_excess, extrinsic_curvature_trace_gradient,
+      longitudinal_shift_background_minus_dt_conformal_metric,
+      longitudinal_shift_excess);
   add_linearized_hamiltonian_sources<ConformalMatterScale>(
       linearized_hamiltonian_constraint, conformal_energy_density,
       extrinsic_curvature_trace, conformal_factor_minus_one,
@@ -657,7 +689,7 @@ void LinearizedSources<Equations::HamiltonianLapseAndShift,
       linearized_lapse_equation, conformal_energy_density,
       conformal_stress_trace, extrinsic_curvature_trace,
       dt_extrinsic_curvature_trace,
-      dot_product(shift, extrinsic_curvature_trace_gradient),
+      shift_dot_deriv_extrinsic_curvature_trace,
       conformal_factor_minus_one, lapse_times_conformal_factor_minus_one,
       conformal_factor_correction, lapse_times_conformal_factor_correction);
   add_flat_cartesian_linearized_momentum_sources<ConformalMatterScale>(
@@ -711,18 +743,18 @@ void LinearizedSources<Equations::HamiltonianLapseAndShift, Geometry::Curved,
           const tnsr::I<DataVector, 3>&
               lapse_times_conformal_factor_flux_correction,
           const tnsr::II<DataVector, 3>& longitudinal_shift_excess_correction) {
-  auto shift = shift_background;
-  for (size_t i = 0; i < 3; ++i) {
-    shift.get(i) += shift_excess.get(i);
-  }
-  auto longitudinal_shift_minus_dt_conformal_metric =
-      longitudinal_shift_background_minus_dt_conformal_metric;
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j <= i; ++j) {
-      longitudinal_shift_minus_dt_conformal_metric.get(i, j) +=
-          longitudinal_shift_excess.get(i, j);
-    }
-  }
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempII<1, 3>>> buffer{
+      get(conformal_factor_minus_one).size()};
+  auto& shift_dot_deriv_extrinsic_curvature_trace =
+      get<::Tags::TempScalar<0>>(buffer);
+  auto& longitudinal_shift_minus_dt_conformal_metric =
+      get<::Tags::TempII<1, 3>>(buffer);
+  full_shift_terms(
+      make_not_null(&shift_dot_deriv_extrinsic_curvature_trace),
+      make_not_null(&longitudinal_shift_minus_dt_conformal_metric),
+      shift_background, shift_excess, extrinsic_curvature_trace_gradient,
+      longitudinal_shift_background_minus_dt_conformal_metric,
+      longitudinal_shift_excess);
   add_linearized_hamiltonian_sources<ConformalMatterScale>(
       linearized_hamiltonian_constraint, conformal_energy_density,
       extrinsic_curvature_trace, conformal_factor_minus_one,
@@ -737,7 +769,7 @@ void LinearizedSources<Equations::HamiltonianLapseAndShift, Geometry::Curved,
       linearized_lapse_equation, conformal_energy_density,
       conformal_stress_trace, extrinsic_curvature_trace,
       dt_extrinsic_curvature_trace,
-      dot_product(shift, extrinsic_curvature_trace_gradient),
+      shift_dot_deriv_extrinsic_curvature_trace,
       conformal_factor_minus_one, lapse_times_conformal_factor_minus_one,
       conformal_factor_correction, lapse_times_conformal_factor_correction);
   add_curved_hamiltonian_or_lapse_sources(
@@ -3,15 +3,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/NeighborWaits.hpp"
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/OutputInbox.hpp"
@@ -45,6 +51,14 @@ namespace deadlock {
  * DataBox tags are printed with nice indenting for easy readability in the
  * stdout file.
  *
+ * When SpECTRE is configured with `-D SPECTRE_PROFILE_ACTIONS=ON`, this also
+ * prints the time each element spent waiting on the boundary data of each of
+ * its neighbors (see `evolution::dg::record_blocked_on_neighbor`) and the
+ * chain of slowest neighbors starting at the element (see
+ * `evolution::dg::slowest_neighbor_chain`), also for elements that
+ * terminated. Following the chains leads to the elements that hold up the
+ * run.
+ *
  * This can be generalized in the future to other dimensions if needed.
  */
 struct PrintElementInfo {
@@ -138,6 +152,30 @@ struct PrintElementInfo {
       ss << "\n";
     }
 
+#ifdef SPECTRE_PROFILE_ACTIONS
+    if constexpr (std::is_same_v<ArrayIndex, ElementId<3>>) {
+      ss << " Waits on neighbors:\n";
+      std::vector<std::pair<ElementId<3>, evolution::dg::NeighborWait>> waits{};
+      for (const auto& wait : evolution::dg::neighbor_waits(array_index)) {
+        waits.push_back(wait);
+      }
+      std::sort(waits.begin(), waits.end(),
+                [](const auto& lhs, const auto& rhs) {
+                  return lhs.second.time > rhs.second.time;
+                });
+      for (const auto& [neighbor, wait] : waits) {
+        ss << "  " << neighbor << ": " << wait.time << "s in " << wait.count
+           << " steps\n";
+      }
+      ss << " Slowest neighbor chain:";
+      for (const auto& element_in_chain :
+           evolution::dg::slowest_neighbor_chain(array_index)) {
+        ss << " " << element_in_chain;
+      }
+      ss << "\n";
+    }
+#endif  // SPECTRE_PROFILE_ACTIONS
+
     Parallel::printf("%s", ss.str());
   }
 };
@@ -147,11 +147,11 @@ struct SendDataForReconstruction {
         db::get<evolution::dg::subcell::Tags::Reconstructor>(box)
             .ghost_zone_size();
 
-    // Optimization note: could save a copy+allocation if we moved
-    // all_sliced_data when possible before sending.
-    //
-    // Note: RDMP size doesn't help here since we need to slice data after
-    // anyway, so no way to save an allocation through that.
+    // The RDMP TCI data is appended to the sliced data, so the data is
+    // packed into the buffer that is sent exactly once.
+    const RdmpTciData& rdmp_tci_data = db::get<Tags::DataForRdmpTci>(box);
+    const size_t rdmp_size = rdmp_tci_data.max_variables_values.size() +
+                             rdmp_tci_data.min_variables_values.size();
     const auto& cell_centered_flux =
         db::get<Tags::CellCenteredFlux<flux_variables, Dim>>(box);
     DataVector volume_data_to_slice = db::mutate_apply(
@@ -169,16 +169,15 @@ struct SendDataForReconstruction {
               static_cast<std::ptrdiff_t>(volume_data_to_slice.size() -
                                           cell_centered_flux.value().size())));
     }
-    const DirectionMap<Dim, DataVector> all_sliced_data = slice_data(
+    DirectionMap<Dim, DataVector> all_sliced_data = slice_data(
         volume_data_to_slice, subcell_mesh.extents(), ghost_zone_size,
-        element.internal_boundaries(), 0,
+        element.internal_boundaries(), rdmp_size,
         db::get<
             evolution::dg::subcell::Tags::InterpolatorsFromFdToNeighborFd<Dim>>(
             box));
 
     auto& receiver_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
-    const RdmpTciData& rdmp_tci_data = db::get<Tags::DataForRdmpTci>(box);
     const TimeStepId& time_step_id = db::get<::Tags::TimeStepId>(box);
     const TimeStepId& next_time_step_id = [&box]() {
       if (LocalTimeStepping) {
@@ -201,12 +200,9 @@ struct SendDataForReconstruction {
              "evolution is using DG without any changes to subcell.");
 
       for (const ElementId<Dim>& neighbor : neighbors_in_direction) {
-        const size_t rdmp_size = rdmp_tci_data.max_variables_values.size() +
-                                 rdmp_tci_data.min_variables_values.size();
-        const auto& sliced_data_in_direction = all_sliced_data.at(direction);
-        // Allocate with subcell data and rdmp data
-        DataVector subcell_data_to_send{sliced_data_in_direction.size() +
-                                        rdmp_size};
+        // There is only one neighbor in each direction, so the sliced data,
+        // which already has space for the rdmp data, can be sent directly.
+        DataVector& subcell_data_to_send = all_sliced_data.at(direction);
         // Note: Currently we interpolate our solution to our neighbor FD grid
         // even when grid points align but are oriented differently. There's a
         // possible optimization for the rare (almost never?) edge case where
@@ -221,6 +217,8 @@ struct SendDataForReconstruction {
         //     gsl::at(slice_extents, d) = subcell_mesh.extents(d);
         //   }
         //   gsl::at(slice_extents, direction.dimension()) = ghost_zone_size;
+        //   // Orienting can't be done in place
+        //   const DataVector sliced_data_in_direction = subcell_data_to_send;
         //   // Need a view so we only get the subcell data and not the rdmp
         //   // data
         //   DataVector subcell_data_to_send_view{
@@ -229,11 +227,10 @@ struct SendDataForReconstruction {
         //   orient_variables(make_not_null(&subcell_data_to_send_view),
         //                  sliced_data_in_direction, Index<Dim>{slice_extents},
         //                  orientation);
-        // } else { std::copy(...); }
+        // }
+        //
+        // The sliced data is already oriented from interpolation.
         //
-        // Copy over data since it's already oriented from interpolation
-        std::copy(sliced_data_in_direction.begin(),
-                  sliced_data_in_direction.end(), subcell_data_to_send.begin());
         // Copy rdmp data to end of subcell_data_to_send
         std::copy(
             rdmp_tci_data.max_variables_values.cbegin(),
@@ -252,6 +249,9 @@ struct SendDataForReconstruction {
             std::nullopt,
             next_time_step_id,
             tci_decision};
+        data.serialize_in_single_precision =
+            evolution::dg::single_precision_boundary_communication_v<
+                Metavariables>;
 
         Parallel::receive_data<
             evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>>(
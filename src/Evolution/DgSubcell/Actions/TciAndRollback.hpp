@@ -39,6 +39,7 @@
 #include "Evolution/DgSubcell/Tags/Interpolators.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
+#include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
@@ -50,6 +51,8 @@
 #include "Time/Actions/SelfStartActions.hpp"
 #include "Time/History.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/TMPL.hpp"
@@ -81,6 +84,18 @@ namespace evolution::dg::subcell::Actions {
  * condition. Note that the evolved variables are projected to the subcells
  * _after_ the TCI is called and marks the cell as troubled.
  *
+ * For systems without primitive variables the TciMutator only needs to be
+ * called every `subcell_options.number_of_steps_between_dg_tci_calls()` time
+ * steps on elements whose last TCI call found them to be admissible. On the
+ * steps in between, the TciMutator is skipped, the RDMP TCI data from the last
+ * call is kept, and the element stays on DG. The TCI is never skipped if the
+ * element would be marked as troubled anyway or if any neighbor reported a
+ * nonzero TCI decision, so troubled regions moving onto the element are still
+ * caught immediately. The decision is made on the first substep of a step and
+ * reused on the remaining substeps, and the TCI is always called during
+ * self-start. Systems with primitive variables always call the TciMutator
+ * since it also recovers the primitive variables.
+ *
  * After rollback, the subcell scheme must project the DG boundary corrections
  * \f$G\f$ to the subcells for the scheme to be conservative. The subcell
  * actions know if a rollback was done because the local mortar data would
@@ -164,6 +179,39 @@ struct TciAndRollback {
                                element.id().block_id()) and
         not bordering_dg_block;
 
+    if constexpr (not Metavariables::system::
+                      has_primitive_and_conservative_vars) {
+      const TimeStepId& time_step_id = db::get<::Tags::TimeStepId>(box);
+      const size_t steps_since_tci_call = db::get<Tags::StepsSinceTciCall>(box);
+      // On the first substep we decide whether the TCI is due, on the later
+      // substeps we follow that decision.
+      const bool tci_call_not_due =
+          time_step_id.slab_number() >= 0 and
+          (time_step_id.substep() == 0
+               ? steps_since_tci_call + 1 <
+                     subcell_options.number_of_steps_between_dg_tci_calls()
+               : steps_since_tci_call > 0);
+      if (tci_call_not_due and not cell_is_troubled and
+          db::get<Tags::TciDecision>(box) == 0 and
+          alg::none_of(
+              db::get<Tags::NeighborTciDecisions<Dim>>(box),
+              [](const auto& id_and_decision) {
+                return id_and_decision.second != 0;
+              })) {
+        db::mutate<subcell::Tags::GhostDataForReconstruction<Dim>,
+                   Tags::StepsSinceTciCall>(
+            [&time_step_id](const auto neighbor_data_ptr,
+                            const gsl::not_null<size_t*> steps_ptr) {
+              neighbor_data_ptr->clear();
+              if (time_step_id.substep() == 0) {
+                ++(*steps_ptr);
+              }
+            },
+            make_not_null(&box));
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
+    }
+
     // The reason we pass in the persson_exponent explicitly instead of
     // leaving it to the user is because the value of the exponent that
     // should be used to decide if it is safe to switch back to DG should be
@@ -177,9 +225,11 @@ struct TciAndRollback {
         not subcell_allowed_in_element);
 
     const int tci_decision = std::get<0>(tci_result);
-    db::mutate<Tags::TciDecision>(
-        [&tci_decision](const gsl::not_null<int*> tci_decision_ptr) {
+    db::mutate<Tags::TciDecision, Tags::StepsSinceTciCall>(
+        [&tci_decision](const gsl::not_null<int*> tci_decision_ptr,
+                        const gsl::not_null<size_t*> steps_ptr) {
           *tci_decision_ptr = tci_decision;
+          *steps_ptr = 0;
         },
         make_not_null(&box));
 
@@ -240,6 +290,9 @@ struct TciAndRollback {
               [&dg_mesh, &subcell_mesh](const auto entry) {
                 *entry = fd::project(*entry, dg_mesh, subcell_mesh.extents());
               });
+          // The history's cached allocations are sized for the DG grid and
+          // would only be reallocated on reuse, so release them now.
+          active_history_ptr->shrink_to_fit();
           *active_grid_ptr = ActiveGrid::Subcell;
           *did_rollback_ptr = true;
           // Project the neighbor data we were sent for reconstruction since
@@ -333,6 +333,9 @@ struct TciAndSwitchToDg {
                       fd::reconstruct(*entry, dg_mesh, subcell_mesh.extents(),
                                       subcell_options.reconstruction_method());
                 });
+            // The history's cached allocations are sized for the subcell
+            // grid and would only be reallocated on reuse, so release them.
+            active_history_ptr->shrink_to_fit();
             *active_grid_ptr = ActiveGrid::Dg;
 
             // Clear the neighbor data needed for subcell reconstruction since
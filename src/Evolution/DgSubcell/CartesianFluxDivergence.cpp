@@ -33,21 +33,19 @@ void add_cartesian_flux_divergence(const gsl::not_null<DataVector*> dt_var,
                                    const size_t dimension) {
   ASSERT(dimension == 0 or dimension == 1,
          "dimension must be 0 or 1 but is " << dimension);
-  Index<2> subcell_face_extents = subcell_extents;
-  ++subcell_face_extents[dimension];
+  // The upper face of a cell is a fixed stride away from its lower face, so
+  // the innermost loop runs over contiguous memory in all three buffers.
+  const size_t face_extent_0 = subcell_extents[0] + (dimension == 0 ? 1 : 0);
+  const size_t stride = dimension == 0 ? 1 : subcell_extents[0];
   for (size_t j = 0; j < subcell_extents[1]; ++j) {
+    const size_t volume_offset = j * subcell_extents[0];
+    const size_t face_offset = j * face_extent_0;
     for (size_t i = 0; i < subcell_extents[0]; ++i) {
-      Index<2> index(i, j);
-      const size_t volume_index = collapsed_index(index, subcell_extents);
-      const size_t boundary_correction_lower_index =
-          collapsed_index(index, subcell_face_extents);
-      ++index[dimension];
-      const size_t boundary_correction_upper_index =
-          collapsed_index(index, subcell_face_extents);
-      (*dt_var)[volume_index] +=
-          one_over_delta * inv_jacobian[volume_index] *
-          (boundary_correction[boundary_correction_upper_index] -
-           boundary_correction[boundary_correction_lower_index]);
+      const size_t face_index = face_offset + i;
+      (*dt_var)[volume_offset + i] +=
+          one_over_delta * inv_jacobian[volume_offset + i] *
+          (boundary_correction[face_index + stride] -
+           boundary_correction[face_index]);
     }
   }
 }
@@ -62,20 +60,22 @@ void add_cartesian_flux_divergence(const gsl::not_null<DataVector*> dt_var,
          "dimension must be 0, 1, or 2 but is " << dimension);
   Index<3> subcell_face_extents = subcell_extents;
   ++subcell_face_extents[dimension];
+  size_t stride = 1;
+  for (size_t d = 0; d < dimension; ++d) {
+    stride *= subcell_extents[d];
+  }
   for (size_t k = 0; k < subcell_extents[2]; ++k) {
     for (size_t j = 0; j < subcell_extents[1]; ++j) {
+      const size_t volume_offset =
+          subcell_extents[0] * (j + subcell_extents[1] * k);
+      const size_t face_offset =
+          subcell_face_extents[0] * (j + subcell_face_extents[1] * k);
       for (size_t i = 0; i < subcell_extents[0]; ++i) {
-        Index<3> index(i, j, k);
-        const size_t volume_index = collapsed_index(index, subcell_extents);
-        const size_t boundary_correction_lower_index =
-            collapsed_index(index, subcell_face_extents);
-        ++index[dimension];
-        const size_t boundary_correction_upper_index =
-            collapsed_index(index, subcell_face_extents);
-        (*dt_var)[volume_index] +=
-            one_over_delta * inv_jacobian[volume_index] *
-            (boundary_correction[boundary_correction_upper_index] -
-             boundary_correction[boundary_correction_lower_index]);
+        const size_t face_index = face_offset + i;
+        (*dt_var)[volume_offset + i] +=
+            one_over_delta * inv_jacobian[volume_offset + i] *
+            (boundary_correction[face_index + stride] -
+             boundary_correction[face_index]);
       }
     }
   }
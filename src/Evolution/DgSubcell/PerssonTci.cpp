@@ -6,14 +6,16 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <iterator>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "NumericalAlgorithms/Spectral/Filtering.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
-#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -21,21 +23,33 @@
 
 namespace evolution::dg::subcell::detail {
 template <size_t Dim>
-bool persson_tci_impl(const gsl::not_null<DataVector*> filtered_component,
-                      const DataVector& component, const Mesh<Dim>& dg_mesh,
-                      const double alpha, const size_t num_highest_modes) {
-  ASSERT(component.size() == dg_mesh.number_of_grid_points(),
-         "The tensor components being checked must have the same number of "
-         "grid points as the DG mesh. The tensor has "
-             << component.size() << " grid points while the DG mesh has "
-             << dg_mesh.number_of_grid_points() << " grid points.");
+bool persson_tci_impl(const double* const components,
+                      const size_t number_of_components,
+                      const Mesh<Dim>& dg_mesh, const double alpha,
+                      const size_t num_highest_modes) {
+  const size_t num_pts = dg_mesh.number_of_grid_points();
+  const size_t size = number_of_components * num_pts;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const DataVector view_components{const_cast<double*>(components), size};
+
+  // The filter matrices are square, so applying them needs twice the size of
+  // the data as scratch space.
+  ScratchArena arena{};
+  const gsl::span<double> buffer =
+      arena.allocate(3 * size + number_of_components);
+  DataVector filtered_components{buffer.data(), size};
+  DataVector scratch{
+      std::next(buffer.data(), static_cast<std::ptrdiff_t>(size)), 2 * size};
+  double* const component_energies =
+      std::next(buffer.data(), static_cast<std::ptrdiff_t>(3 * size));
 
   const Matrix identity{};
   for (size_t d = 0; d < Dim; ++d) {
     auto matrices = make_array<Dim>(std::cref(identity));
     gsl::at(matrices, d) = Spectral::filtering::zero_lowest_modes(
         dg_mesh.slice_through(d), dg_mesh.extents(d) - num_highest_modes);
-    apply_matrices(filtered_component, matrices, component, dg_mesh.extents());
+    apply_matrices(make_not_null(&filtered_components), matrices,
+                   view_components, dg_mesh.extents(), make_not_null(&scratch));
 
     //
     // Note by Yoonsoo Kim, Oct 2021 :
@@ -75,12 +89,34 @@ bool persson_tci_impl(const gsl::not_null<DataVector*> filtered_component,
     // would be sufficient to stick to the case 2 for now.
     //
 
-    const double component_norm{l2Norm(component)};
-
-    if (pow(dg_mesh.extents(d) - num_highest_modes, alpha) *
-            l2Norm(*filtered_component) >
-        component_norm) {
-      return true;
+    // We compare the squares of the norms so that the energy of the highest
+    // modes and the total energy of each component are accumulated in a
+    // single pass over the data.
+    const double threshold =
+        pow(dg_mesh.extents(d) - num_highest_modes, 2.0 * alpha);
+    for (size_t component = 0; component < number_of_components;
+         ++component) {
+      const double* const u = std::next(
+          components, static_cast<std::ptrdiff_t>(component * num_pts));
+      const double* const u_filtered =
+          std::next(filtered_components.data(),
+                    static_cast<std::ptrdiff_t>(component * num_pts));
+      double filtered_energy = 0.0;
+      if (d == 0) {
+        double energy = 0.0;
+        for (size_t i = 0; i < num_pts; ++i) {
+          energy += square(u[i]);
+          filtered_energy += square(u_filtered[i]);
+        }
+        component_energies[component] = energy;
+      } else {
+        for (size_t i = 0; i < num_pts; ++i) {
+          filtered_energy += square(u_filtered[i]);
+        }
+      }
+      if (threshold * filtered_energy > component_energies[component]) {
+        return true;
+      }
     }
   }
   return false;
@@ -88,11 +124,10 @@ bool persson_tci_impl(const gsl::not_null<DataVector*> filtered_component,
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(r, data)                                     \
-  template bool persson_tci_impl(                                  \
-      gsl::not_null<DataVector*> filtered_component,               \
-      const DataVector& component, const Mesh<DIM(data)>& dg_mesh, \
-      double alpha, size_t num_highest_modes);
+#define INSTANTIATION(r, data)                                              \
+  template bool persson_tci_impl(                                           \
+      const double* components, size_t number_of_components,                \
+      const Mesh<DIM(data)>& dg_mesh, double alpha, size_t num_highest_modes);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -5,19 +5,22 @@
 
 #include <cstddef>
 
+#include <type_traits>
+
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Index.hpp"
-#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
-#include "Utilities/Gsl.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 
 namespace evolution::dg::subcell {
 namespace detail {
+// Checks the `number_of_components` components stored contiguously at
+// `components`, each on all grid points of `dg_mesh`.
 template <size_t Dim>
-bool persson_tci_impl(gsl::not_null<DataVector*> filtered_component,
-                      const DataVector& component, const Mesh<Dim>& dg_mesh,
-                      double alpha, size_t num_highest_modes);
+bool persson_tci_impl(const double* components, size_t number_of_components,
+                      const Mesh<Dim>& dg_mesh, double alpha,
+                      size_t num_highest_modes);
 }  // namespace detail
 
 /*!
@@ -66,20 +69,45 @@ bool persson_tci_impl(gsl::not_null<DataVector*> filtered_component,
  *
  * Typically, \f$\alpha=4.0\f$ and $M=1$ is a good choice.
  *
+ * The overload taking a `Variables` checks all its components at once, which
+ * applies the filter to all components together and avoids the per-tensor
+ * overhead when no per-tensor TCI decision is needed. No memory is allocated
+ * in either overload beyond the thread's `ScratchArena`.
  */
 template <size_t Dim, typename SymmList, typename IndexList>
 bool persson_tci(const Tensor<DataVector, SymmList, IndexList>& tensor,
                  const Mesh<Dim>& dg_mesh, const double alpha,
                  const size_t num_highest_modes) {
-  DataVector filtered_component(dg_mesh.number_of_grid_points());
   for (size_t component_index = 0; component_index < tensor.size();
        ++component_index) {
-    if (detail::persson_tci_impl(make_not_null(&filtered_component),
-                                 tensor[component_index], dg_mesh, alpha,
-                                 num_highest_modes)) {
+    ASSERT(tensor[component_index].size() == dg_mesh.number_of_grid_points(),
+           "The tensor components being checked must have the same number of "
+           "grid points as the DG mesh. The tensor has "
+               << tensor[component_index].size()
+               << " grid points while the DG mesh has "
+               << dg_mesh.number_of_grid_points() << " grid points.");
+    if (detail::persson_tci_impl(tensor[component_index].data(), 1, dg_mesh,
+                                 alpha, num_highest_modes)) {
       return true;
     }
   }
   return false;
 }
+
+template <size_t Dim, typename TagsList>
+bool persson_tci(const Variables<TagsList>& vars, const Mesh<Dim>& dg_mesh,
+                 const double alpha, const size_t num_highest_modes) {
+  static_assert(
+      std::is_same_v<typename Variables<TagsList>::value_type, double>,
+      "The Persson TCI can only be applied to real-valued Variables.");
+  ASSERT(vars.number_of_grid_points() == dg_mesh.number_of_grid_points(),
+         "The Variables being checked must have the same number of grid points "
+         "as the DG mesh. The Variables have "
+             << vars.number_of_grid_points()
+             << " grid points while the DG mesh has "
+             << dg_mesh.number_of_grid_points() << " grid points.");
+  return detail::persson_tci_impl(vars.data(),
+                                  vars.number_of_independent_components,
+                                  dg_mesh, alpha, num_highest_modes);
+}
 }  // namespace evolution::dg::subcell
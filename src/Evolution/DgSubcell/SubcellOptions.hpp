@@ -189,11 +189,36 @@ class SubcellOptions {
     using group = FdToDgTci;
   };
 
+  struct DgToFdTci {
+    static constexpr Options::String help =
+        "Options related to how often we check if we need to switch from DG "
+        "to FD.";
+    using group = TroubledCellIndicator;
+  };
+  /// The number of time steps taken between calls to the TCI on elements
+  /// using DG whose last TCI call found them not troubled and whose neighbors
+  /// are not troubled. A value of `1` means every time step.
+  ///
+  /// \note The TCI is only skipped for systems without primitive variables,
+  /// since for the others the TCI also recovers the primitive variables.
+  struct NumberOfStepsBetweenDgTciCalls {
+    static std::string name() { return "NumberOfStepsBetweenTciCalls"; }
+    static constexpr Options::String help{
+        "The number of time steps taken between calls to the TCI on DG "
+        "elements that were not troubled at the last TCI call and whose "
+        "neighbors are not troubled. A value of `1` means every time step. "
+        "Only systems without primitive variables skip TCI calls."};
+    using type = size_t;
+    static constexpr type lower_bound() { return 1; }
+    using group = DgToFdTci;
+  };
+
   using options = tmpl::list<
       PerssonExponent, PerssonNumHighestModes, RdmpDelta0, RdmpEpsilon,
       AlwaysUseSubcells, SubcellToDgReconstructionMethod, UseHalo,
       OnlyDgBlocksAndGroups, FiniteDifferenceDerivativeOrder,
-      NumberOfStepsBetweenTciCalls, MinTciCallsAfterRollback, MinimumClearTcis>;
+      NumberOfStepsBetweenTciCalls, MinTciCallsAfterRollback, MinimumClearTcis,
+      NumberOfStepsBetweenDgTciCalls>;
 
   static constexpr Options::String help{
       "System-agnostic options for the DG-subcell method."};
@@ -206,7 +231,8 @@ class SubcellOptions {
       std::optional<std::vector<std::string>> only_dg_block_and_group_names,
       ::fd::DerivativeOrder finite_difference_derivative_order,
       size_t number_of_steps_between_tci_calls,
-      size_t min_tci_calls_after_rollback, size_t min_clear_tci_before_dg);
+      size_t min_tci_calls_after_rollback, size_t min_clear_tci_before_dg,
+      size_t number_of_steps_between_dg_tci_calls = 1);
 
   /// \brief Given an existing SubcellOptions that was created from block and
   /// group names, create one that stores block IDs.
@@ -276,6 +302,13 @@ class SubcellOptions {
   /// `0 means
   size_t min_clear_tci_before_dg() const { return min_clear_tci_before_dg_; }
 
+  /// The number of time steps between TCI calls on elements using DG that
+  /// were not troubled at the last TCI call and whose neighbors are not
+  /// troubled.
+  size_t number_of_steps_between_dg_tci_calls() const {
+    return number_of_steps_between_dg_tci_calls_;
+  }
+
  private:
   friend bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs);
 
@@ -294,6 +327,7 @@ class SubcellOptions {
   size_t number_of_steps_between_tci_calls_{1};
   size_t min_tci_calls_after_rollback_{1};
   size_t min_clear_tci_before_dg_{0};
+  size_t number_of_steps_between_dg_tci_calls_{1};
 };
 
 bool operator!=(const SubcellOptions& lhs, const SubcellOptions& rhs);
@@ -8,8 +8,11 @@
 #include "DataStructures/DataBox/Tag.hpp"
 
 namespace evolution::dg::subcell::Tags {
-/// \brief Keeps track of the number of steps since the TCI was called on the
-/// FD grid. This is not used on the DG grid.
+/// \brief Keeps track of the number of steps since the TCI was called.
+///
+/// On the FD grid this counts towards
+/// `SubcellOptions::number_of_steps_between_tci_calls()`, on the DG grid
+/// towards `SubcellOptions::number_of_steps_between_dg_tci_calls()`.
 struct StepsSinceTciCall : db::SimpleTag {
   using type = size_t;
 };
@@ -32,6 +32,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarDataHolder.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/NeighborWaits.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/UsingSubcell.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
@@ -45,6 +46,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/KernelTimings.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/SelfStart.hpp"
@@ -211,10 +213,12 @@ bool receive_boundary_data_global_time_stepping(
   using InboxMapValueType =
       std::pair<typename InboxMap::key_type, typename InboxMap::mapped_type>;
   using NodeType = typename InboxMap::node_type;
+  // The neighbor whose data is still missing, for the wait diagnostics
+  std::optional<ElementId<volume_dim>> missing_neighbor{};
   auto get_temporal_id_and_data_node =
-      [&temporal_id](const gsl::not_null<InboxMap*> map_ptr,
-                     const Element<volume_dim>& element,
-                     const auto&&...) -> NodeType {
+      [&missing_neighbor, &temporal_id](const gsl::not_null<InboxMap*> map_ptr,
+                                        const Element<volume_dim>& element,
+                                        const auto&&...) -> NodeType {
     const auto received_temporal_id_and_data = map_ptr->find(temporal_id);
     if (received_temporal_id_and_data == map_ptr->end()) {
       return NodeType{};
@@ -225,6 +229,7 @@ bool receive_boundary_data_global_time_stepping(
         const auto neighbor_received =
             received_neighbor_data.find(Key{direction, neighbor});
         if (neighbor_received == received_neighbor_data.end()) {
+          missing_neighbor = neighbor;
           return NodeType{};
         }
       }
@@ -247,10 +252,14 @@ bool receive_boundary_data_global_time_stepping(
                 const auto inbox_ptr, const Element<volume_dim>& element)
                 -> std::pair<typename NodeType::key_type,
                              typename NodeType::mapped_type> {
+#ifndef SPECTRE_PROFILE_ACTIONS
+              // When profiling, retrieve the data anyway to find out which
+              // neighbor is missing
               if (inbox_ptr->message_count.load(std::memory_order_relaxed) <
                   element.number_of_neighbors()) {
                 return {};
               }
+#endif  // SPECTRE_PROFILE_ACTIONS
               detail::retrieve_boundary_data_spsc(boundary_data_ptr, inbox_ptr,
                                                   element);
 
@@ -279,6 +288,11 @@ bool receive_boundary_data_global_time_stepping(
                         volume_dim>>(*inboxes)),
             db::get<domain::Tags::Element<volume_dim>>(*box));
     if (not have_all_data) {
+#ifdef SPECTRE_PROFILE_ACTIONS
+      record_blocked_on_neighbor(
+          db::get<domain::Tags::Element<volume_dim>>(*box).id(),
+          missing_neighbor);
+#endif  // SPECTRE_PROFILE_ACTIONS
       return false;
     }
   } else {
@@ -290,11 +304,20 @@ bool receive_boundary_data_global_time_stepping(
                 *inboxes)),
         db::get<domain::Tags::Element<volume_dim>>(*box));
     if (node.empty()) {
+#ifdef SPECTRE_PROFILE_ACTIONS
+      record_blocked_on_neighbor(
+          db::get<domain::Tags::Element<volume_dim>>(*box).id(),
+          missing_neighbor);
+#endif  // SPECTRE_PROFILE_ACTIONS
       return false;
     }
     received_temporal_id_and_data.first = std::move(node.key());
     received_temporal_id_and_data.second = std::move(node.mapped());
   }
+#ifdef SPECTRE_PROFILE_ACTIONS
+  record_received_neighbor_data(
+      db::get<domain::Tags::Element<volume_dim>>(*box).id());
+#endif  // SPECTRE_PROFILE_ACTIONS
 
   // Move inbox contents into the DataBox
   if constexpr (using_subcell_v<Metavariables>) {
@@ -667,6 +690,7 @@ struct ApplyBoundaryCorrections {
       const TimeDelta& time_step, const double dense_output_time,
       const Scalar<DataVector>& gts_det_inv_jacobian,
       const VolumeArgs&... volume_args) {
+    SPECTRE_KERNEL_TIMER("dg::ApplyBoundaryCorrections");
     tuples::tagged_tuple_from_typelist<db::wrap_tags_in<
         detail::TemporaryReference, volume_tags_for_dg_boundary_terms>>
         volume_args_tuple{volume_args...};
@@ -715,12 +739,17 @@ struct ApplyBoundaryCorrections {
           // Variables for reusing allocations.  The actual values are
           // not reused.
           DtVariables dt_boundary_correction_on_mortar{};
+          DtVariables dt_boundary_correction_on_face{};
           DtVariables volume_dt_correction{};
           // These variables may change size for each mortar and require
           // a new memory allocation, but they may also happen to need
           // to be the same size twice in a row, in which case holding
           // on to the allocation is a win.
           Scalar<DataVector> face_det_jacobian{};
+          // With global time stepping the determinant of the Jacobian on a
+          // face only depends on the direction, so it is projected once for
+          // all mortars of an h-refined face.
+          DirectionMap<volume_dim, Scalar<DataVector>> face_det_jacobians{};
           Variables<mortar_tags_list> local_data_on_mortar{};
           Variables<mortar_tags_list> neighbor_data_on_mortar{};
 
@@ -745,8 +774,10 @@ struct ApplyBoundaryCorrections {
 
             const auto compute_correction_coupling =
                 [&typed_boundary_correction, &direction, dg_formulation,
+                 &dt_boundary_correction_on_face,
                  &dt_boundary_correction_on_mortar, &face_det_jacobian,
-                 &face_mesh, &face_normal_covector_and_magnitude,
+                 &face_det_jacobians, &face_mesh,
+                 &face_normal_covector_and_magnitude,
                  &local_data_on_mortar, &mortar_id, &mortar_meshes,
                  &mortar_sizes, &neighbor_data_on_mortar,
                  using_gauss_lobatto_points, &volume_args_tuple,
@@ -799,20 +830,22 @@ struct ApplyBoundaryCorrections {
               const std::array<Spectral::MortarSize, volume_dim - 1>&
                   mortar_size = mortar_sizes.at(mortar_id);
 
-              // This cannot reuse an allocation because it is initialized
-              // via move-assignment.  (If it is used at all.)
-              DtVariables dt_boundary_correction_projected_onto_face{};
+              // The projection is written into a buffer that is reused
+              // across mortars, so only a change in the face size requires
+              // a new allocation.
               auto& dt_boundary_correction =
-                  [&dt_boundary_correction_on_mortar,
-                   &dt_boundary_correction_projected_onto_face, &face_mesh,
+                  [&dt_boundary_correction_on_face,
+                   &dt_boundary_correction_on_mortar, &face_mesh,
                    &mortar_mesh, &mortar_size]() -> DtVariables& {
                 if (Spectral::needs_projection(face_mesh, mortar_mesh,
                                                mortar_size)) {
-                  dt_boundary_correction_projected_onto_face =
-                      ::dg::project_from_mortar(
-                          dt_boundary_correction_on_mortar, face_mesh,
-                          mortar_mesh, mortar_size);
-                  return dt_boundary_correction_projected_onto_face;
+                  dt_boundary_correction_on_face.initialize(
+                      face_mesh.number_of_grid_points());
+                  ::dg::project_from_mortar(
+                      make_not_null(&dt_boundary_correction_on_face),
+                      dt_boundary_correction_on_mortar, face_mesh,
+                      mortar_mesh, mortar_size);
+                  return dt_boundary_correction_on_face;
                 }
                 return dt_boundary_correction_on_mortar;
               }();
@@ -821,6 +854,7 @@ struct ApplyBoundaryCorrections {
               Scalar<DataVector> magnitude_of_face_normal{};
               if constexpr (local_time_stepping) {
                 (void)face_normal_covector_and_magnitude;
+                (void)face_det_jacobians;
                 get(magnitude_of_face_normal)
                     .set_data_ref(make_not_null(&const_cast<DataVector&>(
                         get(local_mortar_data.face_normal_magnitude.value()))));
@@ -869,22 +903,31 @@ struct ApplyBoundaryCorrections {
                           get(local_mortar_data.face_det_jacobian.value()))));
                 } else {
                   // Project the determinant of the Jacobian to the face. This
-                  // could be optimized by caching in the time-independent case.
+                  // could be optimized further by caching across steps in the
+                  // time-independent case.
+                  auto& cached_face_det_jacobian =
+                      face_det_jacobians[direction];
+                  if (get(cached_face_det_jacobian).size() !=
+                      face_mesh.number_of_grid_points()) {
+                    get(cached_face_det_jacobian)
+                        .destructive_resize(face_mesh.number_of_grid_points());
+                    const Matrix identity{};
+                    auto interpolation_matrices =
+                        make_array<volume_dim>(std::cref(identity));
+                    const std::pair<Matrix, Matrix>& matrices =
+                        Spectral::boundary_interpolation_matrices(
+                            volume_mesh.slice_through(direction.dimension()));
+                    gsl::at(interpolation_matrices, direction.dimension()) =
+                        direction.side() == Side::Upper ? matrices.second
+                                                        : matrices.first;
+                    apply_matrices(
+                        make_not_null(&get(cached_face_det_jacobian)),
+                        interpolation_matrices, get(volume_det_jacobian),
+                        volume_mesh.extents());
+                  }
                   get(face_det_jacobian)
-                      .destructive_resize(face_mesh.number_of_grid_points());
-                  const Matrix identity{};
-                  auto interpolation_matrices =
-                      make_array<volume_dim>(std::cref(identity));
-                  const std::pair<Matrix, Matrix>& matrices =
-                      Spectral::boundary_interpolation_matrices(
-                          volume_mesh.slice_through(direction.dimension()));
-                  gsl::at(interpolation_matrices, direction.dimension()) =
-                      direction.side() == Side::Upper ? matrices.second
-                                                      : matrices.first;
-                  apply_matrices(make_not_null(&get(face_det_jacobian)),
-                                 interpolation_matrices,
-                                 get(volume_det_jacobian),
-                                 volume_mesh.extents());
+                      .set_data_ref(
+                          make_not_null(&get(cached_face_det_jacobian)));
                 }
 
                 volume_dt_correction.initialize(
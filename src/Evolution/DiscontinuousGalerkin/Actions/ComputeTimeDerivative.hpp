@@ -14,6 +14,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -53,6 +54,7 @@
 #include "Parallel/ArrayCollection/SendDataToElement.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/KernelTimings.hpp"
 #include "Time/Actions/SelfStartActions.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
@@ -60,6 +62,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 /// \cond
 namespace Tags {
@@ -87,6 +90,21 @@ class TaggedTuple;
 }  // namespace tuples
 /// \endcond
 
+namespace evolution::dg {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(overlap_boundary_communication)
+}  // namespace detail
+
+/// \brief Whether the metavariables opted into sending the boundary data
+/// before computing the flux divergence in
+/// `evolution::dg::Actions::ComputeTimeDerivative` by setting
+/// `static constexpr bool overlap_boundary_communication = true;`
+template <typename Metavariables>
+constexpr bool overlap_boundary_communication_v =
+    detail::get_overlap_boundary_communication_or_default_v<Metavariables,
+                                                            false>;
+}  // namespace evolution::dg
+
 namespace evolution::dg::Actions {
 namespace detail {
 template <typename T>
@@ -344,6 +362,19 @@ struct get_primitive_tags_for_face {
  * - Removes: nothing
  * - Modifies:
  *   - `evolution::dg::Tags::MortarData<Dim>`
+ *
+ * ### Overlapping Communication
+ *
+ * By default the boundary data is sent to the neighbors after all volume terms
+ * and the external boundary conditions have been computed. If the
+ * metavariables opt into `evolution::dg::overlap_boundary_communication_v`
+ * and global time stepping is used, the boundary data is instead sent as soon
+ * as the fluxes are known. The flux divergence and the external boundary
+ * conditions are then computed while the data is in flight, which hides part
+ * of the latency of the neighbor communication when there are few elements
+ * per core. The time derivative is identical in both cases. With local time
+ * stepping the complete time derivative is needed to choose the next step
+ * before sending, so the option has no effect.
  */
 template <size_t Dim, typename EvolutionSystem, typename DgStepChoosers,
           bool LocalTimeStepping>
@@ -501,7 +532,10 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       (VarsFaceTemporaries::number_of_independent_components +
        DgPackagedDataVarsOnFace::number_of_independent_components) *
           num_face_temporary_grid_points;
-  auto buffer = cpp20::make_unique_for_overwrite<double[]>(buffer_size);
+  // The buffer is drawn from the thread's scratch memory, so that no memory is
+  // allocated once the first step has been taken.
+  ScratchArena arena{};
+  double* const buffer = arena.allocate(buffer_size).data();
 #ifdef SPECTRE_DEBUG
   std::fill(&buffer[0], &buffer[buffer_size],
             std::numeric_limits<double>::signaling_NaN());
@@ -558,32 +592,47 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
           box);
     }
   }
-  db::mutate_apply<
-      tmpl::list<dt_variables_tag>,
-      typename compute_volume_time_derivative_terms::argument_tags>(
-      [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
-       &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
-       &evolved_variables = db::get<variables_tag>(box),
-       &inertial_coordinates =
-           db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
-       &logical_to_inertial_inv_jacobian =
-           db::get<::domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
-                                                   Frame::Inertial>>(box),
-       &mesh, &mesh_velocity = db::get<::domain::Tags::MeshVelocity<Dim>>(box),
-       &partial_derivs, &temporaries, &volume_fluxes](
-          const gsl::not_null<Variables<
-              db::wrap_tags_in<::Tags::dt, typename variables_tag::tags_list>>*>
-              dt_vars_ptr,
-          const auto&... time_derivative_args) {
-        detail::volume_terms<compute_volume_time_derivative_terms>(
-            dt_vars_ptr, make_not_null(&volume_fluxes),
-            make_not_null(&partial_derivs), make_not_null(&temporaries),
-            make_not_null(&div_fluxes), evolved_variables, dg_formulation, mesh,
-            inertial_coordinates, logical_to_inertial_inv_jacobian,
-            det_inverse_jacobian, mesh_velocity, div_mesh_velocity,
-            time_derivative_args...);
-      },
-      make_not_null(&box));
+  // If the boundary data is sent before the flux divergence is computed, the
+  // neighbors can receive it while this element finishes its volume terms.
+  constexpr bool overlap_communication =
+      overlap_boundary_communication_v<Metavariables> and
+      not LocalTimeStepping;
+  const auto compute_volume_terms =
+      [&box, &dg_formulation, &div_fluxes, &det_inverse_jacobian, &mesh,
+       &partial_derivs, &temporaries,
+       &volume_fluxes](const detail::VolumeTermsStage stage) {
+        SPECTRE_KERNEL_TIMER("dg::VolumeTerms");
+        db::mutate_apply<
+            tmpl::list<dt_variables_tag>,
+            typename compute_volume_time_derivative_terms::argument_tags>(
+            [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
+             &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
+             &evolved_variables = db::get<variables_tag>(box),
+             &inertial_coordinates =
+                 db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
+             &logical_to_inertial_inv_jacobian =
+                 db::get<::domain::Tags::InverseJacobian<
+                     Dim, Frame::ElementLogical, Frame::Inertial>>(box),
+             &mesh,
+             &mesh_velocity = db::get<::domain::Tags::MeshVelocity<Dim>>(box),
+             &partial_derivs, &stage, &temporaries, &volume_fluxes](
+                const gsl::not_null<Variables<db::wrap_tags_in<
+                    ::Tags::dt, typename variables_tag::tags_list>>*>
+                    dt_vars_ptr,
+                const auto&... time_derivative_args) {
+              detail::volume_terms<compute_volume_time_derivative_terms>(
+                  dt_vars_ptr, make_not_null(&volume_fluxes),
+                  make_not_null(&partial_derivs), make_not_null(&temporaries),
+                  make_not_null(&div_fluxes), evolved_variables, stage,
+                  dg_formulation, mesh, inertial_coordinates,
+                  logical_to_inertial_inv_jacobian, det_inverse_jacobian,
+                  mesh_velocity, div_mesh_velocity, time_derivative_args...);
+            },
+            make_not_null(&box));
+      };
+  compute_volume_terms(overlap_communication
+                           ? detail::VolumeTermsStage::FluxesAndSources
+                           : detail::VolumeTermsStage::All);
 
   const Variables<detail::get_primitive_vars_tags_from_system<EvolutionSystem>>*
       primitive_vars{nullptr};
@@ -597,8 +646,8 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       "All createable classes for boundary corrections must be marked "
       "final.");
   tmpl::for_each<derived_boundary_corrections>(
-      [&boundary_correction, &box, &partial_derivs, &primitive_vars,
-       &temporaries, &volume_fluxes, &packaged_data_buffer,
+      [&boundary_correction, &box, &primitive_vars, &temporaries,
+       &volume_fluxes, &packaged_data_buffer,
        &face_temporaries](auto derived_correction_v) {
         using DerivedCorrection =
             tmpl::type_from<decltype(derived_correction_v)>;
@@ -616,15 +665,39 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
               db::get<variables_tag>(box), volume_fluxes, temporaries,
               primitive_vars,
               typename DerivedCorrection::dg_package_data_volume_tags{});
-
-          detail::apply_boundary_conditions_on_all_external_faces<
-              EvolutionSystem, Dim>(
-              make_not_null(&box),
-              dynamic_cast<const DerivedCorrection&>(boundary_correction),
-              temporaries, volume_fluxes, partial_derivs, primitive_vars);
         }
       });
 
+  // The boundary conditions may use the time derivative, so they must be
+  // applied after all volume terms are computed.
+  const auto apply_boundary_conditions = [&boundary_correction, &box,
+                                          &partial_derivs, &primitive_vars,
+                                          &temporaries, &volume_fluxes]() {
+    tmpl::for_each<derived_boundary_corrections>(
+        [&boundary_correction, &box, &partial_derivs, &primitive_vars,
+         &temporaries, &volume_fluxes](auto derived_correction_v) {
+          using DerivedCorrection =
+              tmpl::type_from<decltype(derived_correction_v)>;
+          if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
+            detail::apply_boundary_conditions_on_all_external_faces<
+                EvolutionSystem, Dim>(
+                make_not_null(&box),
+                dynamic_cast<const DerivedCorrection&>(boundary_correction),
+                temporaries, volume_fluxes, partial_derivs, primitive_vars);
+          }
+        });
+  };
+
+  if constexpr (overlap_communication) {
+    send_data_for_fluxes<ParallelComponent>(
+        make_not_null(&cache), make_not_null(&box), volume_fluxes);
+    compute_volume_terms(detail::VolumeTermsStage::FluxDivergence);
+    apply_boundary_conditions();
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+
+  apply_boundary_conditions();
+
   if constexpr (LocalTimeStepping) {
     take_step<EvolutionSystem, LocalTimeStepping, DgStepChoosers>(
         make_not_null(&box));
@@ -726,7 +799,9 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                         {std::move(neighbor_boundary_data_on_mortar)},
                         next_time_step_id,
                         tci_decision,
-                        integration_order};
+                        integration_order,
+                        single_precision_boundary_communication_v<
+                            Metavariables>};
       } else {
         data = SendData{ghost_data_mesh,
                         face_mesh_for_neighbor,
@@ -734,7 +809,9 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                         {std::move(neighbor_boundary_data_on_mortar)},
                         next_time_step_id,
                         tci_decision,
-                        integration_order};
+                        integration_order,
+                        single_precision_boundary_communication_v<
+                            Metavariables>};
       }
 
       // Send mortar data (the `std::tuple` named `data`) to neighbor
@@ -19,6 +19,18 @@
 #include "Utilities/TMPL.hpp"
 
 namespace evolution::dg::Actions::detail {
+/// The parts of `volume_terms()` to compute.
+enum class VolumeTermsStage {
+  /// Compute everything
+  All,
+  /// Compute the partial derivatives, the fluxes, and the source terms, but
+  /// not the flux divergence
+  FluxesAndSources,
+  /// Only add the flux divergence to the time derivative, which must follow a
+  /// call with `FluxesAndSources`
+  FluxDivergence
+};
+
 /*
  * Computes the volume terms for a discontinuous Galerkin scheme.
  *
@@ -58,6 +70,11 @@ namespace evolution::dg::Actions::detail {
  *    Note that the computation of the flux divergence and adding that to the
  *    time derivative must be done *after* the mesh velocity is subtracted
  *    from the fluxes.
+ *
+ * The `stage` selects whether all of the above is done, only steps 1-3, or
+ * only step 4. Splitting the work allows sending the boundary data to the
+ * neighbors as soon as the fluxes are known, and computing the flux
+ * divergence while the data is in flight.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -80,7 +97,8 @@ void volume_terms(
             FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>>...>>*>
         div_fluxes,
     const Variables<tmpl::list<VariablesTags...>>& evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<Dim>& mesh,
+    const VolumeTermsStage stage, const ::dg::Formulation dg_formulation,
+    const Mesh<Dim>& mesh,
     [[maybe_unused]] const tnsr::I<DataVector, Dim, Frame::Inertial>&
         inertial_coordinates,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
@@ -3,20 +3,64 @@
 
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
 
+#include <algorithm>
+#include <optional>
 #include <pup.h>
 #include <pup_stl.h>
+#include <vector>
 
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/StdHelpers.hpp"
 
 namespace evolution::dg {
+namespace {
+// NOLINTNEXTLINE(google-runtime-references)
+void pup_in_single_precision(PUP::er& p,
+                             const gsl::not_null<std::optional<DataVector>*>
+                                 data) {
+  bool has_value = data->has_value();
+  p | has_value;
+  if (not has_value) {
+    if (p.isUnpacking()) {
+      data->reset();
+    }
+    return;
+  }
+  size_t size = p.isUnpacking() ? 0 : (*data)->size();
+  p | size;
+  // Reused between calls so that converting the data doesn't allocate
+  thread_local std::vector<float> buffer{};
+  buffer.resize(size);
+  if (p.isUnpacking()) {
+    p(buffer.data(), size);
+    data->emplace(size);
+    std::copy(buffer.begin(), buffer.end(), (*data)->begin());
+  } else {
+    if (not p.isSizing()) {
+      std::transform((*data)->begin(), (*data)->end(), buffer.begin(),
+                     [](const double value) {
+                       return static_cast<float>(value);
+                     });
+    }
+    p(buffer.data(), size);
+  }
+}
+}  // namespace
+
 template <size_t Dim>
 void BoundaryData<Dim>::pup(PUP::er& p) {
   p | volume_mesh_ghost_cell_data;
   p | interface_mesh;
-  p | ghost_cell_data;
-  p | boundary_correction_data;
+  p | serialize_in_single_precision;
+  if (serialize_in_single_precision) {
+    pup_in_single_precision(p, make_not_null(&ghost_cell_data));
+    pup_in_single_precision(p, make_not_null(&boundary_correction_data));
+  } else {
+    p | ghost_cell_data;
+    p | boundary_correction_data;
+  }
   p | validity_range;
   p | tci_status;
   p | integration_order;
@@ -10,8 +10,24 @@
 #include "DataStructures/DataVector.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace evolution::dg {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(
+    single_precision_boundary_communication)
+}  // namespace detail
+
+/// \brief Whether the metavariables opted into serializing the ghost cell and
+/// boundary correction data of `BoundaryData` in single precision by setting
+/// `static constexpr bool single_precision_boundary_communication = true;`
+///
+/// See `BoundaryData::serialize_in_single_precision`.
+template <typename Metavariables>
+constexpr bool single_precision_boundary_communication_v =
+    detail::get_single_precision_boundary_communication_or_default_v<
+        Metavariables, false>;
+
 /*!
  * \brief The data communicated between neighber elements.
  *
@@ -29,6 +45,15 @@ namespace evolution::dg {
  * 6. the troubled cell indicator status used for determining halos around
  *    troubled cells.
  * 7. the integration order of the time-stepper
+ * 8. whether the ghost cell data and the boundary correction data are sent in
+ *    single precision
+ *
+ * If `serialize_in_single_precision` is `true`, `pup()` converts the ghost
+ * cell data and the boundary correction data to `float`, which halves the size
+ * of the message sent between nodes. The received data is converted back to
+ * `double` and is accurate only to single precision. Data that is not
+ * serialized, e.g. when it is moved between elements on the same node, is not
+ * affected. The flag is not compared by `operator==`.
  */
 template <size_t Dim>
 struct BoundaryData {
@@ -42,6 +67,7 @@ struct BoundaryData {
   ::TimeStepId validity_range{};
   int tci_status{};
   size_t integration_order{std::numeric_limits<size_t>::max()};
+  bool serialize_in_single_precision{false};
 };
 
 template <size_t Dim>
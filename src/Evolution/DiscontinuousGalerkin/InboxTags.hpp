@@ -166,12 +166,15 @@ struct BoundaryCorrectionAndGhostCellsInbox {
     if (auto it = current_inbox.find(data.first); it != current_inbox.end()) {
       auto& [volume_mesh_of_ghost_cell_data, face_mesh, ghost_cell_data,
              boundary_data, boundary_data_validity_range, boundary_tci_status,
-             integration_order] = data.second;
+             integration_order, single_precision] = data.second;
       (void)ghost_cell_data;
+      (void)single_precision;
       auto& [current_volume_mesh_of_ghost_cell_data, current_face_mesh,
              current_ghost_cell_data, current_boundary_data,
              current_boundary_data_validity_range, current_tci_status,
-             current_integration_order] = it->second;
+             current_integration_order, current_single_precision] =
+          it->second;
+      (void)current_single_precision;
       (void)current_volume_mesh_of_ghost_cell_data;  // Need to use when
                                                      // optimizing subcell
       // We have already received some data at this time. Receiving data twice
@@ -5,8 +5,10 @@
 
 #include <boost/functional/hash.hpp>
 #include <cstddef>
+#include <numeric>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Variables.hpp"
@@ -57,48 +59,45 @@ void reconstruct_from_weighted_sum(
   }
 #endif  // ifdef SPECTRE_DEBUG
 
-  // Store linear weights in `local_weights` and `neighbor_weights`
-  // These weights will have to be generalized for multiple neighbors per
-  // face for use with h-refinement and AMR.
-  double local_weight = 1.;
-  std::unordered_map<DirectionalId<VolumeDim>, double,
-                     boost::hash<DirectionalId<VolumeDim>>>
-      neighbor_weights;
+  // Compute the oscillation indicators of the local and all neighbor
+  // polynomials at once. The local polynomial is stored first, followed by the
+  // neighbor polynomials in the iteration order of `neighbor_polynomials`.
+  std::vector<const DataVector*> polynomials{};
+  polynomials.reserve(neighbor_polynomials.size() + 1);
+  polynomials.push_back(local_polynomial.get());
   for (const auto& kv : neighbor_polynomials) {
-    local_weight -= neighbor_linear_weight;
-    neighbor_weights[kv.first] = neighbor_linear_weight;
+    polynomials.push_back(&kv.second);
   }
-
-  // Update `local_weights` and `neighbor_weights` to hold the unnormalized
-  // nonlinear weights.
-  local_weight = unnormalized_nonlinear_weight(
-      local_weight,
-      oscillation_indicator(derivative_weight, *local_polynomial, mesh));
-  for (const auto& kv : neighbor_polynomials) {
-    const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
-    neighbor_weights[key] = unnormalized_nonlinear_weight(
-        neighbor_weights[key],
-        oscillation_indicator(derivative_weight, neighbor_polynomial, mesh));
+  std::vector<double> weights{};
+  oscillation_indicators(make_not_null(&weights), derivative_weight,
+                         polynomials, mesh);
+
+  // Update `weights` to hold the unnormalized nonlinear weights. The linear
+  // weights will have to be generalized for multiple neighbors per face for
+  // use with h-refinement and AMR.
+  const double local_linear_weight =
+      1. - static_cast<double>(neighbor_polynomials.size()) *
+               neighbor_linear_weight;
+  weights[0] = unnormalized_nonlinear_weight(local_linear_weight, weights[0]);
+  for (size_t i = 1; i < weights.size(); ++i) {
+    weights[i] =
+        unnormalized_nonlinear_weight(neighbor_linear_weight, weights[i]);
   }
 
-  // Update `local_weights` and `neighbor_weights` to hold the normalized
-  // weights; these are the final weights of the WENO reconstruction.
-  double normalization = local_weight;
-  for (const auto& kv : neighbor_weights) {
-    normalization += kv.second;
-  }
-  local_weight /= normalization;
-  for (auto& kv : neighbor_weights) {
-    kv.second /= normalization;
+  // Update `weights` to hold the normalized weights; these are the final
+  // weights of the WENO reconstruction.
+  const double normalization =
+      std::accumulate(weights.begin(), weights.end(), 0.);
+  for (double& weight : weights) {
+    weight /= normalization;
   }
 
   // Perform reconstruction by combining the local and neighbor polynomials.
-  *local_polynomial *= local_weight;
+  *local_polynomial *= weights[0];
+  size_t neighbor_index = 1;
   for (const auto& kv : neighbor_polynomials) {
-    const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
-    *local_polynomial += neighbor_weights.at(key) * neighbor_polynomial;
+    *local_polynomial += weights[neighbor_index] * kv.second;
+    ++neighbor_index;
   }
 }
 
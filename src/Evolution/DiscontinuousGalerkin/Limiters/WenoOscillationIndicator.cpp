@@ -3,20 +3,23 @@
 
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoOscillationIndicator.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <numeric>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/ModalVector.hpp"
-#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -93,22 +96,21 @@ double compute_sum_of_legendre_derivs(
 //
 // Note that we compute the product using derivatives 0...N in each dimension.
 // We then subtract off the term with 0 derivatives in all dimensions, because
-// that term is just the original data and should be omitted.
+// that term is just the original data and should be omitted. Because the mean
+// value of the data does not contribute to its oscillation content, any matrix
+// element associated with the basis functions m == 0 or n == 0 vanishes.
 //
-// Note also that because the mean value of the data does not contribute to its
-// oscillation content, any matrix element associated with basis functions
-// m == 0 or n == 0 vanishes. We thus slightly reduce the necessary storage by
-// computing only the (N-1)^2 matrix where we start at m, n >= 1.
-//
-// Finally, note that the matrix measures the oscillation content in modes of
-// a Legendre basis. Therefore, the matrix must be multiplied by ModalVectors
-// of Legendre modes to compute the oscillation indicator.
+// Finally, note that the matrix is transformed from the Legendre modes to the
+// nodal values on the grid, i.e., the result is Q = T^T A T where A is the
+// modal indicator matrix and T is the (tensor-product) nodal-to-modal matrix.
+// The oscillation indicator of nodal data u is then simply u^T Q u, which
+// avoids the modal transform (and its allocation) each time an indicator is
+// computed. Both the modal indicator matrix and the transformation factor
+// across dimensions, so Q is assembled from 1D pieces.
 template <size_t VolumeDim>
 Matrix compute_indicator_matrix(
     const Limiters::Weno_detail::DerivativeWeight derivative_weight,
-    const Index<VolumeDim>& extents) {
-  Matrix result(extents.product() - 1, extents.product() - 1);
-
+    const Spectral::Quadrature quadrature, const Index<VolumeDim>& extents) {
   const std::array<
       double, Spectral::maximum_number_of_points<Spectral::Basis::Legendre>>
       weights_for_derivatives = [&derivative_weight]() {
@@ -129,40 +131,51 @@ Matrix compute_indicator_matrix(
         return weights;
       }();
 
-  for (IndexIterator<VolumeDim> m(extents); m; ++m) {
-    if (m.collapsed_index() == 0) {
-      // Skip the terms associated with the cell average of the data
-      continue;
-    }
-    for (IndexIterator<VolumeDim> n(extents); n; ++n) {
-      if (n.collapsed_index() == 0) {
-        // Skip the terms associated with the cell average of the data
-        continue;
-      }
-      // Compute each indicator matrix term by tensor-product of 1D Legendre
-      // polynomial math
-      auto& result_mn =
-          result(m.collapsed_index() - 1, n.collapsed_index() - 1);
-      result_mn = compute_sum_of_legendre_derivs(extents[0], m()[0], n()[0],
-                                                 weights_for_derivatives);
-      for (size_t dim = 1; dim < VolumeDim; ++dim) {
-        result_mn *= compute_sum_of_legendre_derivs(
-            extents[dim], m()[dim], n()[dim], weights_for_derivatives);
+  // In each dimension, compute the nodal representation of the 1D sums over
+  // all derivatives, and of the 1D term with no derivatives.
+  std::array<Matrix, VolumeDim> sum_of_derivs{};
+  std::array<Matrix, VolumeDim> no_derivs{};
+  for (size_t dim = 0; dim < VolumeDim; ++dim) {
+    const size_t num_points = extents[dim];
+    Matrix modal_sum_of_derivs(num_points, num_points);
+    Matrix modal_no_derivs(num_points, num_points, 0.);
+    for (size_t m = 0; m < num_points; ++m) {
+      for (size_t n = 0; n < num_points; ++n) {
+        modal_sum_of_derivs(m, n) = compute_sum_of_legendre_derivs(
+            num_points, m, n, weights_for_derivatives);
       }
-    }
-    // Subtract the tensor-product term that has no derivatives
-    double term_with_no_derivs =
-        weights_for_derivatives[0] *
-        Spectral::compute_basis_function_normalization_square<
-            Spectral::Basis::Legendre>(m()[0]);
-    for (size_t dim = 1; dim < VolumeDim; ++dim) {
-      term_with_no_derivs *=
+      modal_no_derivs(m, m) =
           weights_for_derivatives[0] *
           Spectral::compute_basis_function_normalization_square<
-              Spectral::Basis::Legendre>(m()[dim]);
+              Spectral::Basis::Legendre>(m);
+    }
+    const Matrix& nodal_to_modal =
+        quadrature == Spectral::Quadrature::Gauss
+            ? Spectral::nodal_to_modal_matrix<Spectral::Basis::Legendre,
+                                              Spectral::Quadrature::Gauss>(
+                  num_points)
+            : Spectral::nodal_to_modal_matrix<
+                  Spectral::Basis::Legendre,
+                  Spectral::Quadrature::GaussLobatto>(num_points);
+    gsl::at(sum_of_derivs, dim) =
+        Matrix(blaze::trans(nodal_to_modal) * modal_sum_of_derivs *
+               nodal_to_modal);
+    gsl::at(no_derivs, dim) = Matrix(blaze::trans(nodal_to_modal) *
+                                     modal_no_derivs * nodal_to_modal);
+  }
+
+  Matrix result(extents.product(), extents.product());
+  for (IndexIterator<VolumeDim> i(extents); i; ++i) {
+    for (IndexIterator<VolumeDim> j(extents); j; ++j) {
+      double product_of_sums = sum_of_derivs[0](i()[0], j()[0]);
+      double product_of_no_derivs = no_derivs[0](i()[0], j()[0]);
+      for (size_t dim = 1; dim < VolumeDim; ++dim) {
+        product_of_sums *= gsl::at(sum_of_derivs, dim)(i()[dim], j()[dim]);
+        product_of_no_derivs *= gsl::at(no_derivs, dim)(i()[dim], j()[dim]);
+      }
+      result(i.collapsed_index(), j.collapsed_index()) =
+          product_of_sums - product_of_no_derivs;
     }
-    result(m.collapsed_index() - 1, m.collapsed_index() - 1) -=
-        term_with_no_derivs;
   }
   return result;
 }
@@ -174,43 +187,51 @@ Matrix compute_indicator_matrix(
 template <size_t VolumeDim>
 const Matrix& cached_indicator_matrix_from_mesh_index(
     const Limiters::Weno_detail::DerivativeWeight derivative_weight,
-    const Index<VolumeDim>& extents) {
+    const Spectral::Quadrature quadrature, const Index<VolumeDim>& extents) {
   using CacheEnumerationDerivativeWeight = CacheEnumeration<
       Limiters::Weno_detail::DerivativeWeight,
       Limiters::Weno_detail::DerivativeWeight::Unity,
       Limiters::Weno_detail::DerivativeWeight::PowTwoEll,
       Limiters::Weno_detail::DerivativeWeight::PowTwoEllOverEllFactorial>;
+  using CacheEnumerationQuadrature =
+      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                       Spectral::Quadrature::GaussLobatto>;
   // Oscillation indicator needs at least two grid points
   constexpr size_t min = 2;
   constexpr size_t max =
       Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
   if constexpr (VolumeDim == 1) {
-    const auto cache = make_static_cache<CacheEnumerationDerivativeWeight,
-                                         CacheRange<min, max>>(
-        [](const Limiters::Weno_detail::DerivativeWeight dw,
-           const size_t nx) -> Matrix {
-          return compute_indicator_matrix(dw, Index<1>(nx));
-        });
-    return cache(derivative_weight, extents[0]);
+    const auto cache =
+        make_static_cache<CacheEnumerationDerivativeWeight,
+                          CacheEnumerationQuadrature, CacheRange<min, max>>(
+            [](const Limiters::Weno_detail::DerivativeWeight dw,
+               const Spectral::Quadrature q, const size_t nx) -> Matrix {
+              return compute_indicator_matrix(dw, q, Index<1>(nx));
+            });
+    return cache(derivative_weight, quadrature, extents[0]);
   } else if constexpr (VolumeDim == 2) {
     const auto cache =
         make_static_cache<CacheEnumerationDerivativeWeight,
-                          CacheRange<min, max>, CacheRange<min, max>>(
+                          CacheEnumerationQuadrature, CacheRange<min, max>,
+                          CacheRange<min, max>>(
             [](const Limiters::Weno_detail::DerivativeWeight dw,
-               const size_t nx, const size_t ny) -> Matrix {
-              return compute_indicator_matrix(dw, Index<2>(nx, ny));
+               const Spectral::Quadrature q, const size_t nx,
+               const size_t ny) -> Matrix {
+              return compute_indicator_matrix(dw, q, Index<2>(nx, ny));
             });
-    return cache(derivative_weight, extents[0], extents[1]);
+    return cache(derivative_weight, quadrature, extents[0], extents[1]);
   } else {
     const auto cache =
         make_static_cache<CacheEnumerationDerivativeWeight,
-                          CacheRange<min, max>, CacheRange<min, max>,
-                          CacheRange<min, max>>(
+                          CacheEnumerationQuadrature, CacheRange<min, max>,
+                          CacheRange<min, max>, CacheRange<min, max>>(
             [](const Limiters::Weno_detail::DerivativeWeight dw,
-               const size_t nx, const size_t ny, const size_t nz) -> Matrix {
-              return compute_indicator_matrix(dw, Index<3>(nx, ny, nz));
+               const Spectral::Quadrature q, const size_t nx, const size_t ny,
+               const size_t nz) -> Matrix {
+              return compute_indicator_matrix(dw, q, Index<3>(nx, ny, nz));
             });
-    return cache(derivative_weight, extents[0], extents[1], extents[2]);
+    return cache(derivative_weight, quadrature, extents[0], extents[1],
+                 extents[2]);
   }
 }
 
@@ -232,9 +253,10 @@ std::ostream& operator<<(std::ostream& os, DerivativeWeight derivative_weight) {
 }
 
 template <size_t VolumeDim>
-double oscillation_indicator(const DerivativeWeight derivative_weight,
-                             const DataVector& data,
-                             const Mesh<VolumeDim>& mesh) {
+void oscillation_indicators(
+    const gsl::not_null<std::vector<double>*> indicators,
+    const DerivativeWeight derivative_weight,
+    const std::vector<const DataVector*>& data, const Mesh<VolumeDim>& mesh) {
   ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
          "Unsupported basis: " << mesh);
   ASSERT(mesh.quadrature() ==
@@ -247,29 +269,56 @@ double oscillation_indicator(const DerivativeWeight derivative_weight,
   ASSERT(*alg::min_element(mesh.extents().indices()) > 1,
          "Unsupported extents: " << mesh);
 
+  const size_t num_points = mesh.number_of_grid_points();
+  const size_t num_vectors = data.size();
+  indicators->resize(num_vectors);
+  if (num_vectors == 0) {
+    return;
+  }
+
   const Matrix& indicator_matrix = cached_indicator_matrix_from_mesh_index(
-      derivative_weight, mesh.extents());
-  const ModalVector coeffs = to_modal_coefficients(data, mesh);
+      derivative_weight, mesh.quadrature(0), mesh.extents());
 
-  double result = 0.;
-  // Note: because the 0'th modal coefficient encodes the mean of the data and
-  // does not contribute to the oscillation, it is safe to exclude it from the
-  // sum and start summing at m == 1, n == 1. Note also that the indicator
-  // matrix is computed excluding the m == 0, n == 0 elements, so the indexing
-  // is offset by 1.
-  for (size_t m = 1; m < mesh.number_of_grid_points(); ++m) {
-    for (size_t n = 1; n < mesh.number_of_grid_points(); ++n) {
-      result += coeffs[m] * coeffs[n] * indicator_matrix(m - 1, n - 1);
-    }
+  // Pack the data as the columns of one matrix, so all indicators are computed
+  // with a single matrix-matrix multiplication. The second half of the buffer
+  // holds the product of the indicator matrix with the data.
+  DataVector buffer(2 * num_points * num_vectors);
+  double* const packed_data = buffer.data();
+  double* const product = buffer.data() + num_points * num_vectors;
+  for (size_t k = 0; k < num_vectors; ++k) {
+    ASSERT(data[k]->size() == num_points,
+           "Data has size " << data[k]->size() << " but mesh has "
+                            << num_points << " grid points");
+    std::copy(data[k]->begin(), data[k]->end(), packed_data + k * num_points);
   }
-  return result;
+  dgemm_<true>('N', 'N', num_points, num_vectors, num_points, 1.0,
+               indicator_matrix.data(), indicator_matrix.spacing(),
+               packed_data, num_points, 0.0, product, num_points);
+  for (size_t k = 0; k < num_vectors; ++k) {
+    (*indicators)[k] = std::inner_product(
+        packed_data + k * num_points, packed_data + (k + 1) * num_points,
+        product + k * num_points, 0.);
+  }
+}
+
+template <size_t VolumeDim>
+double oscillation_indicator(const DerivativeWeight derivative_weight,
+                             const DataVector& data,
+                             const Mesh<VolumeDim>& mesh) {
+  std::vector<double> result{};
+  oscillation_indicators(make_not_null(&result), derivative_weight, {&data},
+                         mesh);
+  return result[0];
 }
 
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                        \
-  template double oscillation_indicator<DIM(data)>( \
+#define INSTANTIATE(_, data)                                          \
+  template void oscillation_indicators<DIM(data)>(                    \
+      gsl::not_null<std::vector<double>*>, DerivativeWeight,          \
+      const std::vector<const DataVector*>&, const Mesh<DIM(data)>&); \
+  template double oscillation_indicator<DIM(data)>(                   \
       DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
@@ -5,6 +5,9 @@
 
 #include <cstddef>
 #include <ostream>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -42,4 +45,16 @@ double oscillation_indicator(DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh);
 
+// Compute the WENO oscillation indicators of several DataVectors on the same
+// mesh, e.g. the local and all neighbor polynomials of a WENO reconstruction.
+//
+// The indicator matrix is cached in its nodal representation, so the
+// indicators of all the `data` are computed with a single matrix-matrix
+// multiplication and without any transformation to modal coefficients.
+template <size_t VolumeDim>
+void oscillation_indicators(gsl::not_null<std::vector<double>*> indicators,
+                            DerivativeWeight derivative_weight,
+                            const std::vector<const DataVector*>& data,
+                            const Mesh<VolumeDim>& mesh);
+
 }  // namespace Limiters::Weno_detail
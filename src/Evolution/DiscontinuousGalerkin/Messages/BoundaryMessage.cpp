@@ -3,9 +3,13 @@
 
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.hpp"
 
+#include <cstring>
 #include <ios>
+#include <new>
 #include <pup.h>
 
+#include "DataStructures/DataVector.hpp"
+
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
@@ -49,6 +53,43 @@ size_t BoundaryMessage<Dim>::total_bytes_with_data(const size_t subcell_size,
   return totalsize;
 }
 
+template <size_t Dim>
+BoundaryMessage<Dim>* BoundaryMessage<Dim>::allocate(
+    const bool enable_if_disabled_in, const size_t sender_node_in,
+    const size_t sender_core_in, const int tci_status_in,
+    const size_t integration_order_in,
+    const ::TimeStepId& current_time_step_id_in,
+    const ::TimeStepId& next_time_step_id_in,
+    const Direction<Dim>& neighbor_direction_in,
+    const ElementId<Dim>& element_id_in,
+    const Mesh<Dim>& volume_or_ghost_mesh_in,
+    const Mesh<Dim - 1>& interface_mesh_in,
+    const gsl::span<const double> subcell_ghost_data_in,
+    const gsl::span<const double> dg_flux_data_in) {
+  const size_t subcell_size = subcell_ghost_data_in.size();
+  const size_t dg_size = dg_flux_data_in.size();
+  void* const buffer = CkAllocMsg(
+      base::__idx,
+      static_cast<int>(total_bytes_with_data(subcell_size, dg_size)), 0);
+  auto* const message = ::new (buffer) BoundaryMessage<Dim>(
+      subcell_size, dg_size, true, enable_if_disabled_in, sender_node_in,
+      sender_core_in, tci_status_in, integration_order_in,
+      current_time_step_id_in, next_time_step_id_in, neighbor_direction_in,
+      element_id_in, volume_or_ghost_mesh_in, interface_mesh_in, nullptr,
+      nullptr);
+  // Sets the data pointers to the same locations pack() would use
+  unpack(static_cast<void*>(message));
+  if (subcell_size != 0) {
+    std::memcpy(message->subcell_ghost_data, subcell_ghost_data_in.data(),
+                subcell_size * sizeof(double));
+  }
+  if (dg_size != 0) {
+    std::memcpy(message->dg_flux_data, dg_flux_data_in.data(),
+                dg_size * sizeof(double));
+  }
+  return message;
+}
+
 template <size_t Dim>
 void* BoundaryMessage<Dim>::pack(BoundaryMessage<Dim>* in_msg) {
   // If this is the case, then in_msg is already in the correct memory layout
@@ -148,6 +189,28 @@ BoundaryMessage<Dim>* BoundaryMessage<Dim>::unpack(void* in_buf) {
   return buffer;
 }
 
+template <size_t Dim>
+BoundaryData<Dim> boundary_data_view(
+    const gsl::not_null<BoundaryMessage<Dim>*> message) {
+  BoundaryData<Dim> result{};
+  result.volume_mesh_ghost_cell_data = message->volume_or_ghost_mesh;
+  result.interface_mesh = message->interface_mesh;
+  if (message->subcell_ghost_data != nullptr) {
+    result.ghost_cell_data = DataVector{};
+    result.ghost_cell_data->set_data_ref(message->subcell_ghost_data,
+                                         message->subcell_ghost_data_size);
+  }
+  if (message->dg_flux_data != nullptr) {
+    result.boundary_correction_data = DataVector{};
+    result.boundary_correction_data->set_data_ref(message->dg_flux_data,
+                                                  message->dg_flux_data_size);
+  }
+  result.validity_range = message->next_time_step_id;
+  result.tci_status = message->tci_status;
+  result.integration_order = message->integration_order;
+  return result;
+}
+
 template <size_t Dim>
 bool operator==(const BoundaryMessage<Dim>& lhs,
                 const BoundaryMessage<Dim>& rhs) {
@@ -233,6 +296,8 @@ std::ostream& operator<<(std::ostream& os,
 
 #define INSTANTIATE(_, data)                                       \
   template struct BoundaryMessage<DIM(data)>;                      \
+  template BoundaryData<DIM(data)> boundary_data_view(             \
+      gsl::not_null<BoundaryMessage<DIM(data)>*> message);         \
   template bool operator==(const BoundaryMessage<DIM(data)>& lhs,  \
                            const BoundaryMessage<DIM(data)>& rhs); \
   template bool operator!=(const BoundaryMessage<DIM(data)>& lhs,  \
@@ -9,9 +9,11 @@
 
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.decl.h"
@@ -26,6 +28,12 @@ namespace evolution::dg {
  *
  * If this message is to be sent across nodes, the `pack()` and `unpack()`
  * methods will be called on the sending and receiving node, respectively.
+ *
+ * A message created with `allocate()` stores the ghost zone and boundary
+ * correction data directly after the header in a single buffer. Such a message
+ * is owning from the start, so `pack()` sends it as is without copying the
+ * data, and on the receiving side `unpack()` only resets the data pointers.
+ * The data can then be read in place with `boundary_data_view()`.
  */
 template <size_t Dim>
 struct BoundaryMessage : public CMessage_BoundaryMessage<Dim> {
@@ -81,10 +89,40 @@ struct BoundaryMessage : public CMessage_BoundaryMessage<Dim> {
    */
   static size_t total_bytes_with_data(size_t subcell_size, size_t dg_size);
 
+  /*!
+   * \brief Allocates an owning message in one contiguous buffer of
+   * `total_bytes_with_data()` bytes and copies the data into it.
+   *
+   * An empty span means that type of data isn't sent, and the corresponding
+   * pointer is set to `nullptr`.
+   */
+  static BoundaryMessage* allocate(
+      bool enable_if_disabled_in, size_t sender_node_in, size_t sender_core_in,
+      int tci_status_in, size_t integration_order_in,
+      const ::TimeStepId& current_time_step_id_in,
+      const ::TimeStepId& next_time_step_id_in,
+      const Direction<Dim>& neighbor_direction_in,
+      const ElementId<Dim>& element_id_in,
+      const Mesh<Dim>& volume_or_ghost_mesh_in,
+      const Mesh<Dim - 1>& interface_mesh_in,
+      gsl::span<const double> subcell_ghost_data_in,
+      gsl::span<const double> dg_flux_data_in);
+
   static void* pack(BoundaryMessage*);
   static BoundaryMessage* unpack(void*);
 };
 
+/*!
+ * \brief The data of a `BoundaryMessage` as a `BoundaryData` whose
+ * `DataVector`s are non-owning views into the message.
+ *
+ * No data is copied, so the returned object must not outlive the message. The
+ * `BoundaryData::validity_range` is the `next_time_step_id` of the message.
+ */
+template <size_t Dim>
+BoundaryData<Dim> boundary_data_view(
+    gsl::not_null<BoundaryMessage<Dim>*> message);
+
 template <size_t Dim>
 bool operator==(const BoundaryMessage<Dim>& lhs,
                 const BoundaryMessage<Dim>& rhs);
@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/NeighborWaits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace evolution::dg {
+namespace {
+template <size_t Dim>
+struct ElementWaits {
+  std::optional<double> blocked_since{};
+  std::optional<ElementId<Dim>> last_missing_neighbor{};
+  std::unordered_map<ElementId<Dim>, NeighborWait> waits{};
+};
+
+template <size_t Dim>
+struct NeighborWaitsRegistry {
+  std::mutex mutex{};
+  std::unordered_map<ElementId<Dim>, ElementWaits<Dim>> elements{};
+};
+
+template <size_t Dim>
+NeighborWaitsRegistry<Dim>& registry() {
+  static NeighborWaitsRegistry<Dim> registry{};
+  return registry;
+}
+}  // namespace
+
+template <size_t Dim>
+void record_blocked_on_neighbor(
+    const ElementId<Dim>& element_id,
+    const std::optional<ElementId<Dim>>& missing_neighbor) {
+  auto& all_waits = registry<Dim>();
+  const std::lock_guard lock(all_waits.mutex);
+  auto& element_waits = all_waits.elements[element_id];
+  if (not element_waits.blocked_since.has_value()) {
+    element_waits.blocked_since = sys::wall_time();
+  }
+  if (missing_neighbor.has_value()) {
+    element_waits.last_missing_neighbor = missing_neighbor;
+  }
+}
+
+template <size_t Dim>
+void record_received_neighbor_data(const ElementId<Dim>& element_id) {
+  auto& all_waits = registry<Dim>();
+  const std::lock_guard lock(all_waits.mutex);
+  const auto element_waits = all_waits.elements.find(element_id);
+  if (element_waits == all_waits.elements.end() or
+      not element_waits->second.blocked_since.has_value()) {
+    return;
+  }
+  auto& [blocked_since, last_missing_neighbor, waits] = element_waits->second;
+  if (last_missing_neighbor.has_value()) {
+    NeighborWait& wait = waits[*last_missing_neighbor];
+    ++wait.count;
+    wait.time += sys::wall_time() - *blocked_since;
+  }
+  blocked_since.reset();
+  last_missing_neighbor.reset();
+}
+
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, NeighborWait> neighbor_waits(
+    const ElementId<Dim>& element_id) {
+  auto& all_waits = registry<Dim>();
+  const std::lock_guard lock(all_waits.mutex);
+  const auto element_waits = all_waits.elements.find(element_id);
+  if (element_waits == all_waits.elements.end()) {
+    return {};
+  }
+  return element_waits->second.waits;
+}
+
+template <size_t Dim>
+std::vector<ElementId<Dim>> slowest_neighbor_chain(
+    const ElementId<Dim>& element_id) {
+  auto& all_waits = registry<Dim>();
+  const std::lock_guard lock(all_waits.mutex);
+  std::vector<ElementId<Dim>> chain{element_id};
+  std::unordered_set<ElementId<Dim>> visited{element_id};
+  for (;;) {
+    const auto element_waits = all_waits.elements.find(chain.back());
+    if (element_waits == all_waits.elements.end() or
+        element_waits->second.waits.empty()) {
+      break;
+    }
+    const auto& waits = element_waits->second.waits;
+    const auto slowest = std::max_element(
+        waits.begin(), waits.end(), [](const auto& lhs, const auto& rhs) {
+          return lhs.second.time < rhs.second.time;
+        });
+    if (not visited.insert(slowest->first).second) {
+      break;
+    }
+    chain.push_back(slowest->first);
+  }
+  return chain;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                                \
+  template void record_blocked_on_neighbor(                                   \
+      const ElementId<DIM(data)>& element_id,                                 \
+      const std::optional<ElementId<DIM(data)>>& missing_neighbor);           \
+  template void record_received_neighbor_data(                                \
+      const ElementId<DIM(data)>& element_id);                                \
+  template std::unordered_map<ElementId<DIM(data)>, NeighborWait>             \
+  neighbor_waits(const ElementId<DIM(data)>& element_id);                     \
+  template std::vector<ElementId<DIM(data)>> slowest_neighbor_chain(          \
+      const ElementId<DIM(data)>& element_id);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg
@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+
+namespace evolution::dg {
+/// \brief The time an element spent blocked on the boundary data of one
+/// neighbor.
+///
+/// \see record_blocked_on_neighbor
+struct NeighborWait {
+  /// The number of steps for which this neighbor's data arrived last
+  size_t count{0};
+  /// The total wallclock time in seconds spent waiting in those steps
+  double time{0.0};
+};
+
+/*!
+ * \brief Record that the element `element_id` could not proceed because the
+ * boundary data of `missing_neighbor` has not arrived yet.
+ *
+ * The wait of the element starts at the first call after it last received all
+ * its boundary data. The wait and the most recently missing neighbor are
+ * recorded in a map shared by all threads of this process, so this should
+ * only be called when SpECTRE is configured with
+ * `-D SPECTRE_PROFILE_ACTIONS=ON`. Pass `std::nullopt` if the missing
+ * neighbor is not known.
+ */
+template <size_t Dim>
+void record_blocked_on_neighbor(
+    const ElementId<Dim>& element_id,
+    const std::optional<ElementId<Dim>>& missing_neighbor);
+
+/// \brief Record that the element `element_id` received all its boundary
+/// data, attributing the time since it first blocked to the neighbor whose
+/// data arrived last.
+template <size_t Dim>
+void record_received_neighbor_data(const ElementId<Dim>& element_id);
+
+/// \brief The waits of the element `element_id` on each of its neighbors
+/// since the start of the run.
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, NeighborWait> neighbor_waits(
+    const ElementId<Dim>& element_id);
+
+/*!
+ * \brief Follow the neighbor each element spent the most time waiting on,
+ * starting at `element_id`.
+ *
+ * The first entry is `element_id`. The chain ends at an element that never
+ * waited, whose waits were recorded in a different process, or when it would
+ * loop. The last element of a long chain is a good candidate for the element
+ * dragging down the run.
+ */
+template <size_t Dim>
+std::vector<ElementId<Dim>> slowest_neighbor_chain(
+    const ElementId<Dim>& element_id);
+}  // namespace evolution::dg
@@ -244,7 +244,7 @@ struct EvolutionMetavars {
   static constexpr bool use_filtering = true;
 
   using step_actions = tmpl::flatten<tmpl::list<
-      CurvedScalarWave::Actions::CalculateGrVars<system, true>,
+      CurvedScalarWave::Actions::CalculateGrVars<system, true, true>,
       CurvedScalarWave::Worldtube::Actions::SendToWorldtube,
       CurvedScalarWave::Worldtube::Actions::IteratePunctureField,
       CurvedScalarWave::Worldtube::Actions::ReceiveWorldtubeData,
@@ -121,6 +121,7 @@
 #include "ParallelAlgorithms/ApparentHorizonFinder/ObserveCenters.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
+#include "ParallelAlgorithms/Events/ObserveKernelTimings.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStepVolume.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
@@ -246,6 +247,9 @@ struct EvolutionMetavars {
 
   static constexpr bool local_time_stepping =
       TimeStepperBase::local_time_stepping;
+  // The many blocks of the binary domain are distributed along a Hilbert
+  // curve so neighboring blocks stay on nearby processors
+  static constexpr bool order_blocks_along_hilbert_curve = true;
 
   using initialize_initial_data_dependent_quantities_actions = tmpl::list<
       Actions::MutateApply<gh::gauges::SetPiAndPhiFromConstraints<volume_dim>>,
@@ -467,7 +471,8 @@ struct EvolutionMetavars {
                     3, ExcisionBoundaryA, interpolator_source_vars>,
                 intrp::Events::InterpolateWithoutInterpComponent<
                     3, ExcisionBoundaryB, interpolator_source_vars>,
-                Events::MonitorMemory<3>, Events::Completion,
+                Events::MonitorMemory<3>, Events::ObserveKernelTimings<3>,
+                Events::Completion,
                 dg::Events::field_observations<volume_dim, observe_fields,
                                                non_tensor_compute_tags>,
                 control_system::metafunctions::control_system_events<
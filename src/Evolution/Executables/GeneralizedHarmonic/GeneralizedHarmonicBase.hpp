@@ -84,6 +84,7 @@
 #include "ParallelAlgorithms/ApparentHorizonFinder/InterpolationTarget.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
+#include "ParallelAlgorithms/Events/ObserveKernelTimings.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStepVolume.hpp"
 #include "ParallelAlgorithms/Events/Tags.hpp"
@@ -285,6 +286,7 @@ struct FactoryCreation : tt::ConformsTo<Options::protocols::FactoryCreation> {
           Event,
           tmpl::flatten<tmpl::list<
               Events::Completion, Events::MonitorMemory<volume_dim>,
+              Events::ObserveKernelTimings<volume_dim>,
               typename detail::ObserverTags<volume_dim>::field_observations,
               Events::time_events<system>,
               dg::Events::ObserveTimeStepVolume<volume_dim>>>>,
@@ -344,6 +344,9 @@ struct GhValenciaDivCleanTemplateBase<
   using temporal_id = typename defaults::temporal_id;
   using TimeStepperBase = typename defaults::TimeStepperBase;
   static constexpr bool local_time_stepping = defaults::local_time_stepping;
+  // The many blocks of the binary domains are distributed along a Hilbert
+  // curve so neighboring blocks stay on nearby processors
+  static constexpr bool order_blocks_along_hilbert_curve = true;
   using system = typename defaults::system;
   using analytic_variables_tags = typename defaults::analytic_variables_tags;
   using analytic_solution_fields = typename defaults::analytic_solution_fields;
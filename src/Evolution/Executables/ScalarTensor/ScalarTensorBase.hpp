@@ -306,6 +306,7 @@ struct ObserverTags {
       ylm::Tags::RhatCompute<::Frame::Inertial>,
       ylm::Tags::InvJacobianCompute<::Frame::Inertial>,
       ylm::Tags::JacobianCompute<::Frame::Inertial>,
+      ylm::Tags::AngularGradientOfRadiusCompute<::Frame::Inertial>,
       ylm::Tags::DxRadiusCompute<::Frame::Inertial>,
       ylm::Tags::NormalOneFormCompute<::Frame::Inertial>,
       ylm::Tags::OneOverOneFormMagnitudeCompute<DataVector, volume_dim,
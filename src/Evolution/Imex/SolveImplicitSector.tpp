@@ -6,6 +6,7 @@
 #include "Evolution/Imex/SolveImplicitSector.hpp"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <tuple>
 #include <type_traits>
@@ -479,6 +480,23 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
       }
       switch (implicit_solve_mode) {
         case Mode::Implicit: {
+          // Skip the nonlinear solve, which allocates and evaluates
+          // the jacobian, if the initial guess already satisfies the
+          // stopping condition.  This is common where the implicit
+          // sources are negligible.  The evaluated source is reused
+          // by the solver if the guess is not good enough.
+          {
+            const std::array<double, solve_dimension> initial_residual =
+                solver(initial_guess);
+            double residual_norm = 0.0;
+            for (const double residual : initial_residual) {
+              residual_norm += std::abs(residual);
+            }
+            if (residual_norm < implicit_solve_tolerance) {
+              pointwise_vars_array = initial_guess;
+              break;
+            }
+          }
           const size_t max_iterations = 100;
           try {
             pointwise_vars_array = RootFinder::gsl_multiroot(
@@ -3,6 +3,11 @@
 
 #include "Evolution/Particles/MonteCarlo/Packet.hpp"
 
+#include <algorithm>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
 namespace Particles::MonteCarlo {
 
 void Packet::renormalize_momentum(
@@ -38,4 +43,15 @@ double compute_fluid_frame_energy(
   return fluid_frame_energy;
 }
 
+void sort_packets_by_cell(const gsl::not_null<std::vector<Packet>*> packets) {
+  std::stable_sort(packets->begin(), packets->end(),
+                   [](const Packet& lhs, const Packet& rhs) {
+                     return lhs.index_of_closest_grid_point !=
+                                    rhs.index_of_closest_grid_point
+                                ? lhs.index_of_closest_grid_point <
+                                      rhs.index_of_closest_grid_point
+                                : lhs.species < rhs.species;
+                   });
+}
+
 }  // namespace Particles::MonteCarlo
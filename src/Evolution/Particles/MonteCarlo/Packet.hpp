@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -85,4 +86,15 @@ double compute_fluid_frame_energy(
     const Scalar<DataVector>& lapse,
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric);
 
+/*!
+ * Sort packets by the index of their closest grid point, and then by species.
+ *
+ * Evolving packets in this order makes the reads of the fluid variables and
+ * of the interaction tables (which are stored per species and grid point)
+ * access memory nearly sequentially rather than at random. The sort is
+ * stable, so the order of the packets (and hence the sequence of random
+ * numbers they draw) is reproducible.
+ */
+void sort_packets_by_cell(gsl::not_null<std::vector<Packet>*> packets);
+
 }  // namespace Particles::MonteCarlo
@@ -216,7 +216,9 @@ void TemplatedLocalFunctions<EnergyBins, NeutrinoSpecies>::
       lorentz_factor, lower_spatial_four_velocity, inertial_to_fluid_jacobian,
       inertial_to_fluid_inverse_jacobian, cell_proper_four_volume);
 
-  // Propagate packets
+  // Propagate packets. Sorting them by cell first keeps the reads of the
+  // opacities and fluid variables during the evolution close in memory.
+  sort_packets_by_cell(packets);
   evolve_packets(
       packets, random_number_generator,
       &coupling_tilde_tau, &coupling_tilde_s, &coupling_rho_ye,
@@ -32,6 +32,7 @@ template void volume_terms<::Burgers::TimeDerivativeTerms>(
         div_fluxes,
     const Variables<typename ::Burgers::System::variables_tag::tags_list>&
         evolved_vars,
+    const evolution::dg::Actions::detail::VolumeTermsStage stage,
     const ::dg::Formulation dg_formulation, const Mesh<1>& mesh,
     [[maybe_unused]] const tnsr::I<DataVector, 1, Frame::Inertial>&
         inertial_coordinates,
@@ -13,6 +13,7 @@
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Evolution/Systems/Cce/OptionTags.hpp"
+#include "Evolution/Systems/Cce/Threading.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshInterpolation.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -21,6 +22,7 @@
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace Cce {
 /// \brief The set of actions for use in the CCE evolution system
@@ -30,6 +32,7 @@ namespace detail {
 CREATE_HAS_TYPE_ALIAS(compute_tags)
 CREATE_HAS_TYPE_ALIAS_V(compute_tags)
 CREATE_GET_TYPE_ALIAS_OR_DEFAULT(compute_tags)
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(cce_number_of_threads)
 }  // namespace detail
 
 /*!
@@ -66,6 +69,10 @@ CREATE_GET_TYPE_ALIAS_OR_DEFAULT(compute_tags)
  *  - `Spectral::Swsh::Tags::SwshInterpolator< Tags::CauchyAngularCoords>`
  *  - `Spectral::Swsh::Tags::SwshInterpolator<Tags::PartiallyFlatAngularCoords>`
  * - Removes: nothing
+ *
+ * If the metavariables define `static constexpr size_t cce_number_of_threads`,
+ * the hypersurface computations of this process are split across that many
+ * threads (see `Cce::set_number_of_threads`).
  */
 template <typename Metavariables>
 struct InitializeCharacteristicEvolutionVariables {
@@ -126,6 +133,9 @@ struct InitializeCharacteristicEvolutionVariables {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    set_number_of_threads(
+        detail::get_cce_number_of_threads_or_default_v<Metavariables,
+                                                       size_t{1}>);
     initialize_impl(make_not_null(&box));
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
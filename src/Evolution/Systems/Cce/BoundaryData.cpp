@@ -3,9 +3,13 @@
 
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 
+#include <algorithm>
+#include <array>
+#include <complex>
 #include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -13,13 +17,83 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshDerivatives.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/CaptureForError.hpp"
 #include "Utilities/Math.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace Cce {
+namespace detail {
+void real_inverse_swsh_transforms(
+    const gsl::span<DataVector* const> results,
+    const gsl::span<const ComplexModalVector* const> coefficients,
+    const size_t l_max) {
+  ASSERT(results.size() == coefficients.size(),
+         "Expected as many results as coefficients, not "
+             << results.size() << " and " << coefficients.size());
+  const size_t number_of_transforms = results.size();
+  const size_t number_of_coefficients =
+      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
+  const size_t number_of_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  SpinWeighted<ComplexModalVector, 0> all_coefficients{
+      number_of_transforms * number_of_coefficients};
+  for (size_t i = 0; i < number_of_transforms; ++i) {
+    ASSERT(coefficients[i]->size() == number_of_coefficients,
+           "Expected " << number_of_coefficients << " coefficients, not "
+                       << coefficients[i]->size());
+    std::copy(coefficients[i]->begin(), coefficients[i]->end(),
+              all_coefficients.data().begin() +
+                  static_cast<std::ptrdiff_t>(i * number_of_coefficients));
+  }
+  SpinWeighted<ComplexDataVector, 0> all_values{number_of_transforms *
+                                                number_of_points};
+  Spectral::Swsh::inverse_swsh_transform(l_max, number_of_transforms,
+                                         make_not_null(&all_values),
+                                         all_coefficients);
+  for (size_t i = 0; i < number_of_transforms; ++i) {
+    const ComplexDataVector values_view{
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        all_values.data().data() + i * number_of_points, number_of_points};
+    *results[i] = real(values_view);
+  }
+}
+
+void real_angular_gradients(
+    const gsl::span<const std::array<DataVector*, 2>> results,
+    const gsl::span<const DataVector* const> values, const size_t l_max) {
+  ASSERT(results.size() == values.size(),
+         "Expected as many results as values, not " << results.size()
+                                                    << " and "
+                                                    << values.size());
+  const size_t number_of_fields = values.size();
+  const size_t number_of_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  SpinWeighted<ComplexDataVector, 0> all_values{number_of_fields *
+                                                number_of_points};
+  for (size_t i = 0; i < number_of_fields; ++i) {
+    ComplexDataVector values_view{
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        all_values.data().data() + i * number_of_points, number_of_points};
+    values_view = std::complex<double>(1.0, 0.0) * *values[i];
+  }
+  SpinWeighted<ComplexDataVector, 1> all_eth{number_of_fields *
+                                             number_of_points};
+  Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
+      l_max, number_of_fields, make_not_null(&all_eth), all_values);
+  for (size_t i = 0; i < number_of_fields; ++i) {
+    const ComplexDataVector eth_view{
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        all_eth.data().data() + i * number_of_points, number_of_points};
+    *results[i][0] = -real(eth_view);
+    *results[i][1] = -imag(eth_view);
+  }
+}
+}  // namespace detail
 
 void trigonometric_functions_on_swsh_collocation(
     const gsl::not_null<Scalar<DataVector>*> cos_phi,
@@ -127,53 +201,45 @@ void cartesian_spatial_metric_and_derivatives_from_modes(
   // Allocation
   SphericaliCartesianjj spherical_d_cartesian_spatial_metric{size};
 
+  // Transform all components of the metric and its derivatives at once
+  std::array<DataVector*, 18> transformed{};
+  std::array<const ComplexModalVector*, 18> coefficients{};
+  size_t transform_index = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // copy the modes to a spin-weighted type for interpolation
-      get(*interpolation_modal_buffer).data() =
-          spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dt_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      dt_cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dr_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      spherical_d_cartesian_spatial_metric.get(0, i, j) =
-          real(get(*interpolation_buffer).data());
+      gsl::at(transformed, transform_index) =
+          &cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, transform_index++) =
+          &spatial_metric_coefficients.get(i, j);
+      gsl::at(transformed, transform_index) =
+          &dt_cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, transform_index++) =
+          &dt_spatial_metric_coefficients.get(i, j);
+      gsl::at(transformed, transform_index) =
+          &spherical_d_cartesian_spatial_metric.get(0, i, j);
+      gsl::at(coefficients, transform_index++) =
+          &dr_spatial_metric_coefficients.get(i, j);
     }
   }
+  detail::real_inverse_swsh_transforms(transformed, coefficients, l_max);
 
   *inverse_cartesian_spatial_metric =
       determinant_and_inverse(*cartesian_spatial_metric).second;
 
+  std::array<std::array<DataVector*, 2>, 6> angular_derivatives{};
+  std::array<const DataVector*, 6> metric_components{};
+  size_t derivative_index = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // reusing the interpolation buffer for taking the angular derivatives
-      get(*interpolation_buffer) =
-          std::complex<double>(1.0, 0.0) * cartesian_spatial_metric->get(i, j);
-      Spectral::Swsh::angular_derivatives<
-          tmpl::list<Spectral::Swsh::Tags::Eth>>(
-          l_max, 1, make_not_null(&get(*eth_buffer)),
-          get(*interpolation_buffer));
-      spherical_d_cartesian_spatial_metric.get(1, i, j) =
-          -real(get(*eth_buffer).data());
-      spherical_d_cartesian_spatial_metric.get(2, i, j) =
-          -imag(get(*eth_buffer).data());
+      gsl::at(angular_derivatives, derivative_index) = {
+          {&spherical_d_cartesian_spatial_metric.get(1, i, j),
+           &spherical_d_cartesian_spatial_metric.get(2, i, j)}};
+      gsl::at(metric_components, derivative_index++) =
+          &cartesian_spatial_metric->get(i, j);
     }
   }
+  detail::real_angular_gradients(angular_derivatives, metric_components,
+                                 l_max);
 
   // convert derivatives to cartesian form
   for (size_t i = 0; i < 3; ++i) {
@@ -218,37 +284,25 @@ void cartesian_shift_and_derivatives_from_modes(
   // Allocation
   SphericaliCartesianJ spherical_d_cartesian_shift{size};
 
+  // Transform all components of the shift and its derivatives at once
+  std::array<DataVector*, 9> transformed{};
+  std::array<const ComplexModalVector*, 9> coefficients{};
+  std::array<std::array<DataVector*, 2>, 3> angular_derivatives{};
+  std::array<const DataVector*, 3> shift_components{};
   for (size_t i = 0; i < 3; ++i) {
-    // copy the modes to a spin-weighted type for interpolation
-    get(*interpolation_modal_buffer).data() = shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dt_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    dt_cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dr_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    spherical_d_cartesian_shift.get(0, i) =
-        real(get(*interpolation_buffer).data());
-  }
-
-  for (size_t i = 0; i < 3; ++i) {
-    // reusing the interpolation buffer for taking the angular derivatives
-    get(*interpolation_buffer) =
-        std::complex<double>(1.0, 0.0) * cartesian_shift->get(i);
-    Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
-        l_max, 1, make_not_null(&get(*eth_buffer)), get(*interpolation_buffer));
-    spherical_d_cartesian_shift.get(1, i) = -real(get(*eth_buffer).data());
-    spherical_d_cartesian_shift.get(2, i) = -imag(get(*eth_buffer).data());
-  }
+    gsl::at(transformed, 3 * i) = &cartesian_shift->get(i);
+    gsl::at(coefficients, 3 * i) = &shift_coefficients.get(i);
+    gsl::at(transformed, 3 * i + 1) = &dt_cartesian_shift->get(i);
+    gsl::at(coefficients, 3 * i + 1) = &dt_shift_coefficients.get(i);
+    gsl::at(transformed, 3 * i + 2) = &spherical_d_cartesian_shift.get(0, i);
+    gsl::at(coefficients, 3 * i + 2) = &dr_shift_coefficients.get(i);
+    gsl::at(angular_derivatives, i) = {
+        {&spherical_d_cartesian_shift.get(1, i),
+         &spherical_d_cartesian_shift.get(2, i)}};
+    gsl::at(shift_components, i) = &cartesian_shift->get(i);
+  }
+  detail::real_inverse_swsh_transforms(transformed, coefficients, l_max);
+  detail::real_angular_gradients(angular_derivatives, shift_components, l_max);
 
   // convert derivatives to cartesian form
   for (size_t i = 0; i < 3; ++i) {
@@ -290,32 +344,20 @@ void cartesian_lapse_and_derivatives_from_modes(
 
   // Allocation
   tnsr::i<DataVector, 3> spherical_d_cartesian_lapse{size};
-  // copy the modes to a spin-weighted type for interpolation
-  get(*interpolation_modal_buffer).data() = get(lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dt_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*dt_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dr_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get<0>(spherical_d_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  // reusing the interpolation buffer for taking the angular derivatives
-  get(*interpolation_buffer) =
-      std::complex<double>(1.0, 0.0) * get(*cartesian_lapse);
-  Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
-      l_max, 1, make_not_null(&get(*eth_buffer)), get(*interpolation_buffer));
-  spherical_d_cartesian_lapse.get(1) = -real(get(*eth_buffer).data());
-  spherical_d_cartesian_lapse.get(2) = -imag(get(*eth_buffer).data());
+
+  const std::array<DataVector*, 3> transformed{
+      {&get(*cartesian_lapse), &get(*dt_cartesian_lapse),
+       &get<0>(spherical_d_cartesian_lapse)}};
+  const std::array<const ComplexModalVector*, 3> coefficients{
+      {&get(lapse_coefficients), &get(dt_lapse_coefficients),
+       &get(dr_lapse_coefficients)}};
+  detail::real_inverse_swsh_transforms(transformed, coefficients, l_max);
+  const std::array<std::array<DataVector*, 2>, 1> angular_derivatives{
+      {{{&get<1>(spherical_d_cartesian_lapse),
+         &get<2>(spherical_d_cartesian_lapse)}}}};
+  const std::array<const DataVector*, 1> lapse_components{
+      {&get(*cartesian_lapse)}};
+  detail::real_angular_gradients(angular_derivatives, lapse_components, l_max);
 
   // convert derivatives to cartesian form
   for (size_t k = 0; k < 3; ++k) {
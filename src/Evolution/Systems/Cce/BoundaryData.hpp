@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -30,9 +31,25 @@
 /// \cond
 class DataVector;
 class ComplexDataVector;
+class ComplexModalVector;
 /// \endcond
 
 namespace Cce {
+namespace detail {
+// Inverse transforms the spin-weight 0 `coefficients` in a single batched
+// libsharp call, which is considerably cheaper than separate transforms, and
+// stores the real part of each in the corresponding `results`.
+void real_inverse_swsh_transforms(
+    gsl::span<DataVector* const> results,
+    gsl::span<const ComplexModalVector* const> coefficients, size_t l_max);
+
+// Computes the angular derivatives of the real `values` with a single batched
+// eth, storing the two angular components of the spherical gradient of each
+// in the corresponding pair of `results`.
+void real_angular_gradients(gsl::span<const std::array<DataVector*, 2>> results,
+                            gsl::span<const DataVector* const> values,
+                            size_t l_max);
+}  // namespace detail
 
 /*!
  * \brief Constructs the collocation values for \f$\cos(\phi)\f$,
@@ -101,6 +101,9 @@ struct CceEvolutionLabelTag {};
 template <class Metavariables>
 struct CharacteristicEvolution {
   using chare_type = Parallel::Algorithms::Singleton;
+  // The CCE evolution must keep up with the worldtube data it receives, so
+  // reserve a proc for it unless its resources are specified explicitly.
+  static constexpr bool exclusive_by_default = true;
   using metavariables = Metavariables;
   static constexpr bool evolve_ccm = Metavariables::evolve_ccm;
   using cce_system = Cce::System<evolve_ccm>;
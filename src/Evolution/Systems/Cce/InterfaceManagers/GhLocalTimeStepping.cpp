@@ -10,6 +10,7 @@
 #include <tuple>
 #include <utility>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
@@ -61,38 +62,39 @@ bool interpolate_to_time(
       return false;
     }
   }
-  DataVector time_points{
-      2 * interpolator->required_number_of_points_before_and_after()};
-  DataVector tensor_component_values{
-      2 * interpolator->required_number_of_points_before_and_after()};
+  const size_t number_of_time_points =
+      2 * interpolator->required_number_of_points_before_and_after();
+  DataVector time_points{number_of_time_points};
   for (auto [i, map_it] = std::make_tuple(0_st, iterator_start);
        i < time_points.size(); ++i, ++map_it) {
     time_points[i] = map_it->first.id;
   }
+  // The source times are the same for every grid point, and the
+  // interpolation is linear in the values, so we compute the weight of each
+  // source time once by interpolating the unit vectors instead of
+  // interpolating each grid point separately.
+  DataVector weights{number_of_time_points};
+  DataVector unit_values{number_of_time_points, 0.0};
+  for (size_t time_index = 0; time_index < number_of_time_points;
+       ++time_index) {
+    unit_values[time_index] = 1.0;
+    weights[time_index] = interpolator->interpolate(
+        gsl::span<const double>{time_points.data(), time_points.size()},
+        gsl::span<const double>{unit_values.data(), unit_values.size()},
+        target_time);
+    unit_values[time_index] = 0.0;
+  }
   tmpl::for_each<typename VarsToInterpolate::tags_list>(
-      [&vars_to_interpolate, &interpolator, &time_points,
-       &tensor_component_values, &target_time,
-       &iterator_start](auto tensor_tag_v) {
+      [&vars_to_interpolate, &weights, &iterator_start](auto tensor_tag_v) {
         using tensor_tag = typename decltype(tensor_tag_v)::type;
         auto& tensor = get<tensor_tag>(*vars_to_interpolate);
         for (size_t i = 0; i < tensor.size(); ++i) {
-          for (size_t offset = 0;
-               offset < vars_to_interpolate->number_of_grid_points();
-               ++offset) {
-            // assemble data into easily interpolated structures
-            for (auto [time_index, gh_data_it] =
-                     std::make_tuple(0_st, iterator_start);
-                 time_index <
-                 2 * interpolator->required_number_of_points_before_and_after();
-                 ++time_index, ++gh_data_it) {
-              tensor_component_values[time_index] =
-                  get<tensor_tag>(gh_data_it->second)[i][offset];
-            }
-            tensor[i][offset] = interpolator->interpolate(
-                gsl::span<const double>{time_points.data(), time_points.size()},
-                gsl::span<const double>{tensor_component_values.data(),
-                                        tensor_component_values.size()},
-                target_time);
+          tensor[i] = weights[0] * get<tensor_tag>(iterator_start->second)[i];
+          for (auto [time_index, gh_data_it] =
+                   std::make_tuple(1_st, std::next(iterator_start));
+               time_index < weights.size(); ++time_index, ++gh_data_it) {
+            tensor[i] +=
+                weights[time_index] * get<tensor_tag>(gh_data_it->second)[i];
           }
         }
       });
@@ -21,6 +21,7 @@
 #include "Options/String.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Utilities/PrettyType.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace Cce {
 namespace OptionTags {
@@ -250,6 +251,10 @@ struct ScriOutputDensity : db::SimpleTag {
 }  // namespace InitializationTags
 
 namespace Tags {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(cce_prefetch_worldtube_data)
+}  // namespace detail
+
 struct ExtractionRadius : db::BaseTag {};
 
 struct ExtractionRadiusSimple : ExtractionRadius, db::SimpleTag {
@@ -309,6 +314,11 @@ struct CceEvolutionPrefix : Tag {
 
 /// A tag that constructs a `MetricWorldtubeDataManager` or
 /// `BondiWorldtubeDataManager` from options
+///
+/// The managers read the next buffer window on a background thread if the
+/// metavariables define `static constexpr bool cce_prefetch_worldtube_data =
+/// true`. This requires an HDF5 library that is safe to call from several
+/// threads, since the reads may overlap with other file access of the process.
 struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
   using type = std::unique_ptr<WorldtubeDataManager<
       Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>>;
@@ -318,13 +328,28 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
                  OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
-  static constexpr bool pass_metavariables = false;
+  static constexpr bool pass_metavariables = true;
+  template <typename Metavariables>
   static type create_from_options(
       const size_t l_max, const std::string& filename,
       const size_t number_of_lookahead_times,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) {
+    return create_from_options(
+        l_max, filename, number_of_lookahead_times, interpolator,
+        h5_is_bondi_data, fix_spec_normalization, extraction_radius,
+        detail::get_cce_prefetch_worldtube_data_or_default_v<Metavariables,
+                                                             false>);
+  }
+
+  static type create_from_options(
+      const size_t l_max, const std::string& filename,
+      const size_t number_of_lookahead_times,
+      const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
+      const bool h5_is_bondi_data, const bool fix_spec_normalization,
+      const std::optional<double> extraction_radius,
+      const bool prefetch = false) {
     if (h5_is_bondi_data) {
       if (static_cast<bool>(extraction_radius)) {
         Parallel::printf(
@@ -338,18 +363,22 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       return std::make_unique<BondiWorldtubeDataManager>(
           std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
                                                           extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch);
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
           std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
                                                            extraction_radius),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch);
     }
   }
 };
 
 /// A tag that constructs a `KleinGordonWorldtubeDataManager` from options
+///
+/// Prefetching is enabled the same way as for
+/// `Cce::Tags::H5WorldtubeBoundaryDataManager`.
 struct KleinGordonH5WorldtubeBoundaryDataManager : db::SimpleTag {
   using type = std::unique_ptr<
       WorldtubeDataManager<Tags::klein_gordon_worldtube_boundary_tags>>;
@@ -358,16 +387,31 @@ struct KleinGordonH5WorldtubeBoundaryDataManager : db::SimpleTag {
                  OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
                  OptionTags::StandaloneExtractionRadius>;
 
-  static constexpr bool pass_metavariables = false;
+  static constexpr bool pass_metavariables = true;
+  template <typename Metavariables>
   static type create_from_options(
       const size_t l_max, const std::string& filename,
       const size_t number_of_lookahead_times,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const std::optional<double> extraction_radius) {
+    return create_from_options(
+        l_max, filename, number_of_lookahead_times, interpolator,
+        extraction_radius,
+        detail::get_cce_prefetch_worldtube_data_or_default_v<Metavariables,
+                                                             false>);
+  }
+
+  static type create_from_options(
+      const size_t l_max, const std::string& filename,
+      const size_t number_of_lookahead_times,
+      const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
+      const std::optional<double> extraction_radius,
+      const bool prefetch = false) {
     return std::make_unique<KleinGordonWorldtubeDataManager>(
         std::make_unique<KleinGordonWorldtubeH5BufferUpdater>(
             filename, extraction_radius),
-        l_max, number_of_lookahead_times, interpolator->get_clone());
+        l_max, number_of_lookahead_times, interpolator->get_clone(),
+        prefetch);
   }
 };
 
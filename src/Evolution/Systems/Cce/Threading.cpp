@@ -0,0 +1,26 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/Threading.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace Cce {
+namespace {
+std::atomic<size_t> cce_threads{1};
+}  // namespace
+
+void set_number_of_threads(const size_t number_of_threads) {
+  ASSERT(number_of_threads > 0, "CCE needs at least one thread.");
+  cce_threads.store(number_of_threads, std::memory_order_relaxed);
+  Spectral::Swsh::set_number_of_transform_threads(number_of_threads);
+}
+
+size_t number_of_threads() {
+  return cce_threads.load(std::memory_order_relaxed);
+}
+}  // namespace Cce
@@ -0,0 +1,54 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Cce {
+/*!
+ * \brief Set the number of threads that the CCE hypersurface computations of
+ * this process are split across.
+ *
+ * \details This splits the independent radial linear solves for each angular
+ * collocation point in the `Tags::BondiH` integration, and the
+ * spin-weighted spherical harmonic transforms (see
+ * `Spectral::Swsh::set_number_of_transform_threads`). The default is a single
+ * thread, i.e. no additional threads are started. The threads are not bound to
+ * cores, so this should only be increased when cores are otherwise idle, and
+ * the LAPACK implementation must support concurrent calls.
+ */
+void set_number_of_threads(size_t number_of_threads);
+
+/// The number of threads set by `set_number_of_threads()`
+size_t number_of_threads();
+
+namespace detail {
+// Calls `function(begin, end)` for contiguous, disjoint ranges that together
+// cover the indices [0, size), on up to `number_of_threads()` threads
+// including the calling one.
+template <typename Function>
+void for_each_range_in_parallel(const size_t size, const Function& function) {
+  const size_t threads = std::min(number_of_threads(), size);
+  if (threads <= 1) {
+    function(size_t{0}, size);
+    return;
+  }
+  const size_t range_size = (size + threads - 1) / threads;
+  std::vector<std::thread> workers{};
+  workers.reserve(threads - 1);
+  for (size_t thread = 1; thread < threads; ++thread) {
+    const size_t begin = std::min(thread * range_size, size);
+    const size_t end = std::min(begin + range_size, size);
+    workers.emplace_back([&function, begin, end]() { function(begin, end); });
+  }
+  function(size_t{0}, range_size);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+}  // namespace detail
+}  // namespace Cce
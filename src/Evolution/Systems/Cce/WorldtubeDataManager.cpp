@@ -5,6 +5,7 @@
 
 #include <complex>
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -25,8 +26,106 @@
 #include "Utilities/TMPL.hpp"
 
 namespace Cce {
+namespace {
+// Every mode is interpolated from the same time points to the same time, and
+// the interpolation is linear in the values, so we compute the weight of each
+// time point once by interpolating the unit vectors and then interpolate each
+// mode with a dot product.
+DataVector interpolation_weights(const intrp::SpanInterpolator& interpolator,
+                                 const DataVector& time_points,
+                                 const double time) {
+  DataVector weights{time_points.size()};
+  DataVector unit_values{time_points.size(), 0.0};
+  for (size_t i = 0; i < time_points.size(); ++i) {
+    unit_values[i] = 1.0;
+    weights[i] = interpolator.interpolate(
+        gsl::span<const double>(time_points.data(), time_points.size()),
+        gsl::span<const double>(unit_values.data(), unit_values.size()),
+        time);
+    unit_values[i] = 0.0;
+  }
+  return weights;
+}
+
+std::complex<double> apply_interpolation_weights(
+    const DataVector& weights, const std::complex<double>* const values) {
+  std::complex<double> result = 0.0;
+  for (size_t i = 0; i < weights.size(); ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    result += weights[i] * values[i];
+  }
+  return result;
+}
+}  // namespace
 
 namespace detail {
+template <typename InputTags>
+WorldtubeBufferPrefetcher<InputTags>::~WorldtubeBufferPrefetcher() {
+  if (pending_read_.valid()) {
+    pending_read_.wait();
+  }
+}
+
+template <typename InputTags>
+void WorldtubeBufferPrefetcher<InputTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<InputTags>*> coefficients_buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
+    const gsl::not_null<WorldtubeBufferUpdater<InputTags>*> buffer_updater,
+    const size_t l_max, const size_t interpolator_length,
+    const size_t buffer_depth) {
+  const DataVector& time_buffer = buffer_updater->get_time_buffer();
+  // the same criterion the buffer updaters use to decide whether a window
+  // must be replaced
+  const auto window_covers_time = [&time, &time_buffer, &interpolator_length](
+                                      const size_t span_end) {
+    return span_end >= time_buffer.size() or
+           (span_end > interpolator_length and
+            time_buffer[span_end - interpolator_length] > time);
+  };
+  if (pending_read_.valid() and not window_covers_time(*time_span_end)) {
+    pending_read_.get();
+    // The prefetched window only has the full stencil before `time_` so it
+    // can't be used if the time went backwards.
+    if (time_ <= time and window_covers_time(time_span_end_)) {
+      std::swap(*coefficients_buffers, buffers_);
+      *time_span_start = time_span_start_;
+      *time_span_end = time_span_end_;
+    }
+  }
+  {
+    // this is a no-op unless the prefetched window is missing or insufficient
+    const std::lock_guard hold_lock(*hdf5_lock);
+    buffer_updater->update_buffers_for_time(
+        coefficients_buffers, time_span_start, time_span_end, time, l_max,
+        interpolator_length, buffer_depth);
+  }
+  if (pending_read_.valid() or *time_span_end >= time_buffer.size() or
+      *time_span_end <= interpolator_length) {
+    return;
+  }
+  if (buffer_updater_ == nullptr) {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    buffer_updater_ = buffer_updater->get_clone();
+    buffers_ =
+        Variables<InputTags>{coefficients_buffers->number_of_grid_points()};
+  }
+  // the first time for which the current window will need to be replaced
+  time_ = time_buffer[*time_span_end - interpolator_length];
+  pending_read_ = std::async(
+      std::launch::async,
+      [this, hdf5_lock, l_max, interpolator_length, buffer_depth]() {
+        time_span_start_ = 0;
+        time_span_end_ = 0;
+        const std::lock_guard hold_lock(*hdf5_lock);
+        buffer_updater_->update_buffers_for_time(
+            make_not_null(&buffers_), make_not_null(&time_span_start_),
+            make_not_null(&time_span_end_), time_, l_max, interpolator_length,
+            buffer_depth);
+      });
+}
+
 template <typename InputTags>
 void set_non_pupped_members(
     const gsl::not_null<size_t*> time_span_start,
@@ -82,8 +181,15 @@ void populate_hypersurface_boundary_data(
     const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
-    const size_t l_max, const size_t buffer_depth) {
-  {
+    const size_t l_max, const size_t buffer_depth,
+    const std::unique_ptr<WorldtubeBufferPrefetcher<InputTags>>& prefetcher) {
+  if (prefetcher != nullptr) {
+    prefetcher->update_buffers_for_time(
+        coefficients_buffers, time_span_start, time_span_end, hdf5_lock, time,
+        buffer_updater.get(), l_max,
+        interpolator->required_number_of_points_before_and_after(),
+        buffer_depth);
+  } else {
     const std::lock_guard hold_lock(*hdf5_lock);
     buffer_updater->update_buffers_for_time(
         coefficients_buffers, time_span_start, time_span_end, time, l_max,
@@ -108,18 +214,14 @@ void populate_hypersurface_boundary_data(
       buffer_updater->get_time_buffer().data() + interpolation_time_span.first,
       interpolation_span_size};
 
-  auto interpolate_from_column = [&time, &time_points, &buffer_span_size,
+  const DataVector weights =
+      interpolation_weights(*interpolator, time_points, time);
+  auto interpolate_from_column = [&weights, &buffer_span_size,
                                   &interpolation_time_span,
-                                  &interpolation_span_size, &time_span_start,
-                                  &interpolator](auto data, size_t column) {
-    const auto interp_val = interpolator->interpolate(
-        gsl::span<const double>(time_points.data(), time_points.size()),
-        gsl::span<const std::complex<double>>(
-            data + column * (buffer_span_size) +
-                (interpolation_time_span.first - (*time_span_start)),
-            interpolation_span_size),
-        time);
-    return interp_val;
+                                  &time_span_start](auto data, size_t column) {
+    return apply_interpolation_weights(
+        weights, data + column * (buffer_span_size) +
+                     (interpolation_time_span.first - (*time_span_start)));
   };
 
   // the ComplexModalVectors should be provided from the buffer_updater_ in
@@ -166,7 +268,7 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization)
+    const bool fix_spec_normalization, const bool prefetch)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
@@ -174,6 +276,9 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
       interpolator_{std::move(interpolator)} {
+  if (prefetch) {
+    prefetcher_ = std::make_unique<decltype(prefetcher_)::element_type>();
+  }
   detail::initialize_buffers<cce_metric_input_tags>(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
@@ -189,7 +294,13 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
+  if (prefetcher_ != nullptr) {
+    prefetcher_->update_buffers_for_time(
+        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+        make_not_null(&time_span_end_), hdf5_lock, time, buffer_updater_.get(),
+        l_max_, interpolator_->required_number_of_points_before_and_after(),
+        buffer_depth_);
+  } else {
     const std::lock_guard hold_lock(*hdf5_lock);
     buffer_updater_->update_buffers_for_time(
         make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
@@ -214,18 +325,14 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
       buffer_updater_->get_time_buffer().data() + interpolation_time_span.first,
       interpolation_span_size};
 
-  auto interpolate_from_column = [&time, &time_points, &buffer_span_size,
+  const DataVector weights =
+      interpolation_weights(*interpolator_, time_points, time);
+  auto interpolate_from_column = [&weights, &buffer_span_size,
                                   &interpolation_time_span,
-                                  &interpolation_span_size,
                                   this](auto data, const size_t column) {
-    auto interp_val = interpolator_->interpolate(
-        gsl::span<const double>(time_points.data(), time_points.size()),
-        gsl::span<const std::complex<double>>(
-            data + column * buffer_span_size +
-                (interpolation_time_span.first - time_span_start_),
-            interpolation_span_size),
-        time);
-    return interp_val;
+    return apply_interpolation_weights(
+        weights, data + column * buffer_span_size +
+                     (interpolation_time_span.first - time_span_start_));
   };
 
   // the ComplexModalVectors should be provided from the buffer_updater_ in
@@ -351,7 +458,8 @@ std::unique_ptr<WorldtubeDataManager<
 MetricWorldtubeDataManager::get_clone() const {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      prefetcher_ != nullptr);
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span() const {
@@ -366,12 +474,17 @@ void MetricWorldtubeDataManager::pup(PUP::er& p) {
   p | buffer_depth_;
   p | interpolator_;
   p | fix_spec_normalization_;
+  bool prefetch = prefetcher_ != nullptr;
+  p | prefetch;
   if (p.isUnpacking()) {
     detail::set_non_pupped_members<cce_metric_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
         make_not_null(&interpolated_coefficients_), buffer_depth_,
         interpolator_->required_number_of_points_before_and_after(), l_max_);
+    if (prefetch) {
+      prefetcher_ = std::make_unique<decltype(prefetcher_)::element_type>();
+    }
   }
 }
 
@@ -379,13 +492,17 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
       interpolator_{std::move(interpolator)} {
+  if (prefetch) {
+    prefetcher_ = std::make_unique<decltype(prefetcher_)::element_type>();
+  }
   detail::initialize_buffers<cce_bondi_input_tags>(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
@@ -408,7 +525,7 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, l_max_, buffer_depth_, prefetcher_);
 
   const auto& du_r = get(get<Tags::BoundaryValue<Tags::Du<Tags::BondiR>>>(
       *boundary_data_variables));
@@ -447,7 +564,8 @@ std::unique_ptr<WorldtubeDataManager<
 BondiWorldtubeDataManager::get_clone() const {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(),
+      prefetcher_ != nullptr);
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span() const {
@@ -461,12 +579,17 @@ void BondiWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  bool prefetch = prefetcher_ != nullptr;
+  p | prefetch;
   if (p.isUnpacking()) {
     detail::set_non_pupped_members<cce_bondi_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
         make_not_null(&interpolated_coefficients_), buffer_depth_,
         interpolator_->required_number_of_points_before_and_after(), l_max_);
+    if (prefetch) {
+      prefetcher_ = std::make_unique<decltype(prefetcher_)::element_type>();
+    }
   }
 }
 
@@ -474,13 +597,17 @@ KleinGordonWorldtubeDataManager::KleinGordonWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
       interpolator_{std::move(interpolator)} {
+  if (prefetch) {
+    prefetcher_ = std::make_unique<decltype(prefetcher_)::element_type>();
+  }
   detail::initialize_buffers<klein_gordon_input_tags>(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
@@ -501,7 +628,7 @@ bool KleinGordonWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, l_max_, buffer_depth_, prefetcher_);
 
   return true;
 }
@@ -511,7 +638,8 @@ std::unique_ptr<
 KleinGordonWorldtubeDataManager::get_clone() const {
   return std::make_unique<KleinGordonWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(),
+      prefetcher_ != nullptr);
 }
 
 std::pair<size_t, size_t> KleinGordonWorldtubeDataManager::get_time_span()
@@ -526,15 +654,24 @@ void KleinGordonWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  bool prefetch = prefetcher_ != nullptr;
+  p | prefetch;
   if (p.isUnpacking()) {
     detail::set_non_pupped_members<klein_gordon_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
         make_not_null(&interpolated_coefficients_), buffer_depth_,
         interpolator_->required_number_of_points_before_and_after(), l_max_);
+    if (prefetch) {
+      prefetcher_ = std::make_unique<decltype(prefetcher_)::element_type>();
+    }
   }
 }
 
+template class detail::WorldtubeBufferPrefetcher<cce_metric_input_tags>;
+template class detail::WorldtubeBufferPrefetcher<cce_bondi_input_tags>;
+template class detail::WorldtubeBufferPrefetcher<klein_gordon_input_tags>;
+
 PUP::able::PUP_ID MetricWorldtubeDataManager::my_PUP_ID = 0;
 PUP::able::PUP_ID BondiWorldtubeDataManager::my_PUP_ID = 0;
 PUP::able::PUP_ID KleinGordonWorldtubeDataManager::my_PUP_ID = 0;  // NOLINT
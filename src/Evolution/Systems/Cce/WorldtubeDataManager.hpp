@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <future>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -22,6 +24,54 @@ namespace Cce {
 
 namespace detail {
 
+/*!
+ * \brief Reads the buffer window that follows the one in use by a worldtube
+ * data manager on a background thread.
+ *
+ * \details `update_buffers_for_time()` replaces the synchronous
+ * `WorldtubeBufferUpdater::update_buffers_for_time()` call of the managers.
+ * When the window in use no longer covers the requested time, the prefetched
+ * window is swapped in, waiting for the read to finish if necessary, so the
+ * buffer updater only touches the data source itself if the time jumped past
+ * the prefetched window. Afterwards the read of the window that follows the
+ * new one is started on a clone of the buffer updater, holding `hdf5_lock`.
+ * The prefetched window has the same size as the one in use, so its
+ * look-ahead is the `buffer_depth` of the manager.
+ *
+ * The prefetched window starts at the first time for which the window in use
+ * needs to be replaced, so the interpolation stencils, and therefore the
+ * boundary data, are the same as without prefetching.
+ */
+template <typename InputTags>
+class WorldtubeBufferPrefetcher {
+ public:
+  WorldtubeBufferPrefetcher() = default;
+  WorldtubeBufferPrefetcher(const WorldtubeBufferPrefetcher&) = delete;
+  WorldtubeBufferPrefetcher& operator=(const WorldtubeBufferPrefetcher&) =
+      delete;
+  WorldtubeBufferPrefetcher(WorldtubeBufferPrefetcher&&) = delete;
+  WorldtubeBufferPrefetcher& operator=(WorldtubeBufferPrefetcher&&) = delete;
+  /// Waits for a read that is still in progress.
+  ~WorldtubeBufferPrefetcher();
+
+  void update_buffers_for_time(
+      gsl::not_null<Variables<InputTags>*> coefficients_buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end,
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
+      gsl::not_null<WorldtubeBufferUpdater<InputTags>*> buffer_updater,
+      size_t l_max, size_t interpolator_length, size_t buffer_depth);
+
+ private:
+  std::unique_ptr<WorldtubeBufferUpdater<InputTags>> buffer_updater_{};
+  Variables<InputTags> buffers_{};
+  size_t time_span_start_ = 0;
+  size_t time_span_end_ = 0;
+  double time_ = std::numeric_limits<double>::signaling_NaN();
+  // declared last so that it is destroyed before the buffers it writes to
+  std::future<void> pending_read_{};
+};
+
 template <typename InputTags>
 void set_non_pupped_members(
     gsl::not_null<size_t*> time_span_start,
@@ -46,7 +96,8 @@ void populate_hypersurface_boundary_data(
     gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
-    size_t l_max, size_t buffer_depth);
+    size_t l_max, size_t buffer_depth,
+    const std::unique_ptr<WorldtubeBufferPrefetcher<InputTags>>& prefetcher);
 }  // namespace detail
 
 /// \cond
@@ -110,6 +161,10 @@ class WorldtubeDataManager : public PUP::able {
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
+ *
+ * If `prefetch` is `true`, the next buffer window is read on a background
+ * thread while the current one is in use, see
+ * `detail::WorldtubeBufferPrefetcher`.
  */
 class MetricWorldtubeDataManager
     : public WorldtubeDataManager<
@@ -123,7 +178,7 @@ class MetricWorldtubeDataManager
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization);
+      bool fix_spec_normalization, bool prefetch = false);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -187,6 +242,9 @@ class MetricWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+  // reads the next buffer window in the background if prefetching is enabled
+  std::unique_ptr<detail::WorldtubeBufferPrefetcher<cce_metric_input_tags>>
+      prefetcher_;
 };
 
 /*!
@@ -205,6 +263,10 @@ class MetricWorldtubeDataManager
  * `cce_bondi_input_tags`, rather than direct metric components
  * handled by `WorldtubeDataManager`. The set of 9 scalars is a far leaner
  * (factor of ~4) data storage format.
+ *
+ * If `prefetch` is `true`, the next buffer window is read on a background
+ * thread while the current one is in use, see
+ * `detail::WorldtubeBufferPrefetcher`.
  */
 class BondiWorldtubeDataManager
     : public WorldtubeDataManager<
@@ -217,7 +279,8 @@ class BondiWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch = false);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -278,6 +341,9 @@ class BondiWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+  // reads the next buffer window in the background if prefetching is enabled
+  std::unique_ptr<detail::WorldtubeBufferPrefetcher<cce_bondi_input_tags>>
+      prefetcher_;
 };
 
 class KleinGordonWorldtubeDataManager
@@ -290,7 +356,8 @@ class KleinGordonWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch = false);
 
   WRAPPED_PUPable_decl_template(KleinGordonWorldtubeDataManager);  // NOLINT
 
@@ -349,5 +416,8 @@ class KleinGordonWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+  // reads the next buffer window in the background if prefetching is enabled
+  std::unique_ptr<detail::WorldtubeBufferPrefetcher<klein_gordon_input_tags>>
+      prefetcher_;
 };
 }  // namespace Cce
@@ -27,6 +27,10 @@ void spatial_ricci_tensor(
     const tnsr::I<DataType, Dim, Frame>& contracted_field_d_up,
     const tnsr::i<DataType, Dim, Frame>& field_p,
     const tnsr::ij<DataType, Dim, Frame>& d_field_p) {
+  // \partial_i P_j + \partial_j P_i, which appears in all the \partial_{(i}
+  // P_{j)} type terms below
+  const auto twice_symmetrized_d_field_p = tenex::evaluate<ti::i, ti::j>(
+      d_field_p(ti::i, ti::j) + d_field_p(ti::j, ti::i));
   tenex::evaluate<ti::i, ti::j>(
       result,
       contracted_d_conformal_christoffel_difference(ti::i, ti::j) +
@@ -48,20 +52,18 @@ void spatial_ricci_tensor(
                      (field_d(ti::j, ti::m, ti::l) * field_p(ti::i) +
                       field_d(ti::j, ti::i, ti::l) * field_p(ti::m) -
                       field_d(ti::j, ti::i, ti::m) * field_p(ti::l))) -
-          // Add \partial_{(i} P_{j)} type terms
+          // Add \partial_{(i} P_{j)} type terms. The terms
+          // \gamma_{il} (\partial_{(m} P_{j)} - \partial_{(j} P_{m)}) cancel
+          // and are omitted.
           0.5 * inverse_conformal_spatial_metric(ti::M, ti::L) *
               (conformal_spatial_metric(ti::j, ti::l) *
-                   (d_field_p(ti::m, ti::i) + d_field_p(ti::i, ti::m)) +
-               conformal_spatial_metric(ti::i, ti::l) *
-                   (d_field_p(ti::m, ti::j) + d_field_p(ti::j, ti::m)) -
+                   twice_symmetrized_d_field_p(ti::m, ti::i) -
                conformal_spatial_metric(ti::i, ti::j) *
-                   (d_field_p(ti::m, ti::l) + d_field_p(ti::l, ti::m)) -
+                   twice_symmetrized_d_field_p(ti::m, ti::l) -
                conformal_spatial_metric(ti::m, ti::l) *
-                   (d_field_p(ti::j, ti::i) + d_field_p(ti::i, ti::j)) -
-               conformal_spatial_metric(ti::i, ti::l) *
-                   (d_field_p(ti::j, ti::m) + d_field_p(ti::m, ti::j)) +
+                   twice_symmetrized_d_field_p(ti::j, ti::i) +
                conformal_spatial_metric(ti::i, ti::m) *
-                   (d_field_p(ti::j, ti::l) + d_field_p(ti::l, ti::j))) +
+                   twice_symmetrized_d_field_p(ti::j, ti::l)) +
           // Add last two terms for R_{ij}
           christoffel_second_kind(ti::L, ti::i, ti::j) *
               contracted_christoffel_second_kind(ti::l) -
@@ -475,40 +475,38 @@ void TimeDerivative<Dim>::apply(
                    (*contracted_field_b)() -
                (*inv_conformal_spatial_metric)(ti::J, ti::K) *
                    field_b(ti::k, ti::I)) +
-          // terms with lapse but not s
+          // terms with lapse but not s, where all terms contracted with the
+          // inverse conformal metric or with the inverse of A tilde are
+          // collected so that each contraction is only computed once
           2.0 * (*lapse)() *
-              (-2.0 * one_third *
-                   (*inv_conformal_spatial_metric)(ti::I, ti::J) *
-                   d_trace_extrinsic_curvature(ti::j) +
-               (*inv_conformal_spatial_metric)(ti::K, ti::I) * d_theta(ti::k) +
+              ((*inv_conformal_spatial_metric)(ti::I, ti::K) *
+                   (d_theta(ti::k) -
+                    2.0 * one_third * d_trace_extrinsic_curvature(ti::k) -
+                    theta() * field_a(ti::k) -
+                    2.0 * one_third * trace_extrinsic_curvature() *
+                        (*spatial_z4_constraint)(ti::k) -
+                    kappa_1 * (*spatial_z4_constraint)(ti::k)) +
                (*conformal_christoffel_second_kind)(ti::I, ti::j, ti::k) *
                    (*inv_a_tilde)(ti::J, ti::K) -
-               3.0 * (*inv_a_tilde)(ti::I, ti::J) * field_p(ti::j) -
-               (*inv_conformal_spatial_metric)(ti::K, ti::I) *
-                   (theta() * field_a(ti::k) +
-                    2.0 * one_third * trace_extrinsic_curvature() *
-                        (*spatial_z4_constraint)(ti::k)) -
-               (*inv_a_tilde)(ti::I, ti::J) * field_a(ti::j) -
-               kappa_1 * (*inv_conformal_spatial_metric)(ti::I, ti::J) *
-                   (*spatial_z4_constraint)(ti::j)));
+               (*inv_a_tilde)(ti::I, ti::J) *
+                   (3.0 * field_p(ti::j) + field_a(ti::j))));
   // now, if s == 1, also add terms with s
   if (static_cast<bool>(evolve_shift)) {
     ::tenex::update<ti::I>(
         dt_gamma_hat,
         (*dt_gamma_hat)(ti::I) +
-            // terms with lapse and s
-            2.0 * (*lapse)() *
-                ((*inv_conformal_spatial_metric)(ti::I, ti::K) *
-                     (*inv_conformal_spatial_metric)(ti::N, ti::M) *
-                     d_a_tilde(ti::k, ti::n, ti::m) -
-                 2.0 * (*inv_conformal_spatial_metric)(ti::I, ti::K) *
-                     (*field_d_up)(ti::k, ti::N, ti::M) *
-                     a_tilde(ti::n, ti::m)) +
-            // terms with s but not not lapse
+            // terms with lapse and s, and terms with s but not lapse. The
+            // contractions of d_a_tilde and a_tilde with the inverse conformal
+            // metric and field_d_up are the ones already computed for
+            // dt_field_a, and all terms contracted with the inverse conformal
+            // metric on the free index are collected into a single contraction.
+            (*inv_conformal_spatial_metric)(ti::I, ti::K) *
+                (2.0 * (*lapse)() *
+                     ((*inv_conformal_metric_times_d_a_tilde)(ti::k) -
+                      2.0 * (*field_d_up_times_a_tilde)(ti::k)) +
+                 one_third * (*contracted_symmetrized_d_field_b)(ti::k)) +
             (*inv_conformal_spatial_metric)(ti::K, ti::L) *
-                (*symmetrized_d_field_b)(ti::k, ti::l, ti::I) +
-            one_third * (*inv_conformal_spatial_metric)(ti::I, ti::K) *
-                (*contracted_symmetrized_d_field_b)(ti::k));
+                (*symmetrized_d_field_b)(ti::k, ti::l, ti::I));
   }
 
   // eq. (12i) : time derivative b^i
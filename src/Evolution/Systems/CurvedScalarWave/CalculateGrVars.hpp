@@ -3,10 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <optional>
+#include <type_traits>
 
+#include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/Tags.hpp"
 #include "Evolution/Initialization/InitialData.hpp"
@@ -16,14 +23,144 @@
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "PointwiseFunctions/AnalyticData/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
+#include "Utilities/TMPL.hpp"
 
 /// \cond
 namespace Tags {
 struct Time;
 }  // namespace Tags
+namespace gr::Solutions {
+class KerrSchild;
+template <size_t Dim>
+class Minkowski;
+}  // namespace gr::Solutions
 /// \endcond
 
-namespace CurvedScalarWave::Actions {
+namespace CurvedScalarWave {
+namespace Tags {
+/// \brief The background spacetime variables evaluated at the grid
+/// coordinates (interpreted as inertial coordinates), together with the grid
+/// coordinates they were evaluated at.
+///
+/// Used by `CurvedScalarWave::Actions::CalculateGrVars` to obtain the
+/// background in a rigidly rotating element without re-evaluating it.
+template <typename SpacetimeTagList, size_t Dim>
+struct BackgroundInGridFrame : db::SimpleTag {
+  using type = Variables<tmpl::push_back<
+      SpacetimeTagList, domain::Tags::Coordinates<Dim, Frame::Grid>>>;
+};
+}  // namespace Tags
+
+namespace detail {
+// Whether the background spacetime is invariant under rotations about the
+// z-axis, so its variables at rotated points are the rotated variables.
+template <typename BackgroundSpacetime>
+bool is_invariant_under_rotations_about_z(
+    const BackgroundSpacetime& background_spacetime) {
+  if constexpr (std::is_same_v<BackgroundSpacetime,
+                               gr::Solutions::Minkowski<3>>) {
+    (void)background_spacetime;
+    return true;
+  } else if constexpr (std::is_same_v<BackgroundSpacetime,
+                                      gr::Solutions::KerrSchild>) {
+    const auto on_z_axis = [](const std::array<double, 3>& vector) {
+      return vector[0] == 0.0 and vector[1] == 0.0;
+    };
+    return on_z_axis(background_spacetime.center()) and
+           on_z_axis(background_spacetime.dimensionless_spin()) and
+           on_z_axis(background_spacetime.boost_velocity());
+  } else {
+    (void)background_spacetime;
+    return false;
+  }
+}
+
+// Returns the cosine and sine of the angle by which the inertial coordinates
+// are rotated about the z-axis relative to the grid coordinates, or
+// `std::nullopt` if the grid-to-inertial map is not such a rotation on these
+// points.
+inline std::optional<std::array<double, 2>> rotation_about_z(
+    const tnsr::I<DataVector, 3, Frame::Grid>& grid_coords,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& inertial_coords) {
+  const size_t num_points = get<0>(grid_coords).size();
+  const DataVector cylindrical_radius_squared =
+      square(get<0>(grid_coords)) + square(get<1>(grid_coords));
+  const size_t reference_point = static_cast<size_t>(std::distance(
+      cylindrical_radius_squared.begin(),
+      std::max_element(cylindrical_radius_squared.begin(),
+                       cylindrical_radius_squared.end())));
+  double cos_angle = 1.0;
+  double sin_angle = 0.0;
+  if (num_points > 0 and cylindrical_radius_squared[reference_point] > 0.0) {
+    const double x_grid = get<0>(grid_coords)[reference_point];
+    const double y_grid = get<1>(grid_coords)[reference_point];
+    const double x_inertial = get<0>(inertial_coords)[reference_point];
+    const double y_inertial = get<1>(inertial_coords)[reference_point];
+    const double angle = std::atan2(x_grid * y_inertial - y_grid * x_inertial,
+                                    x_grid * x_inertial + y_grid * y_inertial);
+    cos_angle = std::cos(angle);
+    sin_angle = std::sin(angle);
+  }
+  const double tolerance =
+      1.0e-12 * std::max(1.0, std::sqrt(max(cylindrical_radius_squared +
+                                       square(get<2>(grid_coords)))));
+  if (max(abs(cos_angle * get<0>(grid_coords) -
+              sin_angle * get<1>(grid_coords) - get<0>(inertial_coords))) >
+          tolerance or
+      max(abs(sin_angle * get<0>(grid_coords) +
+              cos_angle * get<1>(grid_coords) - get<1>(inertial_coords))) >
+          tolerance or
+      max(abs(get<2>(grid_coords) - get<2>(inertial_coords))) > tolerance) {
+    return std::nullopt;
+  }
+  return std::array{cos_angle, sin_angle};
+}
+
+// Sets `result` to `tensor` with every index rotated by `rotation`. All
+// indices transform the same way because rotations are orthogonal.
+template <typename TensorType>
+void rotate_tensor(const gsl::not_null<TensorType*> result,
+                   const TensorType& tensor,
+                   const std::array<std::array<double, 3>, 3>& rotation) {
+  constexpr size_t rank = TensorType::rank();
+  static_assert(rank <= 2, "Only tensors up to rank 2 can be rotated.");
+  set_number_of_grid_points(result, tensor);
+  if constexpr (rank == 0) {
+    *result = tensor;
+  } else if constexpr (rank == 1) {
+    for (size_t i = 0; i < 3; ++i) {
+      result->get(i) = 0.0;
+      for (size_t k = 0; k < 3; ++k) {
+        if (gsl::at(gsl::at(rotation, i), k) != 0.0) {
+          result->get(i) += gsl::at(gsl::at(rotation, i), k) * tensor.get(k);
+        }
+      }
+    }
+  } else {
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        result->get(i, j) = 0.0;
+        for (size_t k = 0; k < 3; ++k) {
+          const double r_ik = gsl::at(gsl::at(rotation, i), k);
+          if (r_ik == 0.0) {
+            continue;
+          }
+          for (size_t l = 0; l < 3; ++l) {
+            const double r_jl = gsl::at(gsl::at(rotation, j), l);
+            if (r_jl != 0.0) {
+              result->get(i, j) += r_ik * r_jl * tensor.get(k, l);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace detail
+
+namespace Actions {
 
 /// \ingroup ActionsGroup
 /// \brief Action that initializes or updates items related to the
@@ -35,15 +172,37 @@ namespace CurvedScalarWave::Actions {
 /// independent. Note that this assumes that the background spacetime is also
 /// time independent.
 ///
+/// If `RotateCachedBackground` is `true` (only in 3D), then in elements where
+/// the grid-to-inertial map is a rotation about the z-axis and the background
+/// spacetime is invariant under such rotations (Minkowski, or a Kerr-Schild
+/// black hole with center, spin and boost along the z-axis), the background is
+/// evaluated at the grid coordinates only once and stored in
+/// `CurvedScalarWave::Tags::BackgroundInGridFrame`. At later times its tensor
+/// components are rotated to the inertial frame instead of being re-evaluated.
+/// The cache is recomputed whenever the grid coordinates of the element
+/// change, e.g. after refinement. Everywhere else the background is evaluated
+/// at the inertial coordinates as usual. This also assumes that the background
+/// spacetime is time independent.
+///
 /// DataBox changes:
 /// - Adds:
 ///   * `CurvedScalarWave::System::spacetime_tag_list`
+///   * `CurvedScalarWave::Tags::BackgroundInGridFrame` if
+///     `RotateCachedBackground` is `true`
 /// - Removes: nothing
 /// - Modifies: nothing
-template <typename System, bool SkipForStaticDomains>
+template <typename System, bool SkipForStaticDomains,
+          bool RotateCachedBackground = false>
 struct CalculateGrVars {
   static constexpr size_t Dim = System::volume_dim;
-  using simple_tags = db::AddSimpleTags<typename System::spacetime_tag_list>;
+  static_assert(Dim == 3 or not RotateCachedBackground,
+                "Rotating the cached background is only implemented in 3D.");
+  using spacetime_tag_list = typename System::spacetime_tag_list;
+  using cache_tag = Tags::BackgroundInGridFrame<spacetime_tag_list, Dim>;
+  using simple_tags = tmpl::conditional_t<
+      RotateCachedBackground,
+      db::AddSimpleTags<spacetime_tag_list, cache_tag>,
+      db::AddSimpleTags<spacetime_tag_list>>;
   using compute_tags = db::AddComputeTags<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -61,12 +220,49 @@ struct CalculateGrVars {
         return {Parallel::AlgorithmExecution::Continue, std::nullopt};
       }
     }
-    auto initial_data = evolution::Initialization::initial_data(
+    const auto& background_spacetime =
         db::get<CurvedScalarWave::Tags::BackgroundSpacetime<
-            typename Metavariables::background_spacetime>>(box),
+            typename Metavariables::background_spacetime>>(box);
+    if constexpr (RotateCachedBackground) {
+      if (detail::is_invariant_under_rotations_about_z(background_spacetime)) {
+        const auto& grid_coords =
+            db::get<domain::Tags::Coordinates<Dim, Frame::Grid>>(box);
+        const auto rotation = detail::rotation_about_z(
+            grid_coords,
+            db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box));
+        if (rotation.has_value()) {
+          update_cache(make_not_null(&box), background_spacetime,
+                       grid_coords);
+          const auto& [cos_angle, sin_angle] = *rotation;
+          const std::array<std::array<double, 3>, 3> rotation_matrix{
+              {{{cos_angle, -sin_angle, 0.0}},
+               {{sin_angle, cos_angle, 0.0}},
+               {{0.0, 0.0, 1.0}}}};
+          const auto& background_in_grid_frame = db::get<cache_tag>(box);
+          tmpl::for_each<spacetime_tag_list>(
+              [&box, &background_in_grid_frame,
+               &rotation_matrix](auto spacetime_tag_v) {
+                using spacetime_tag =
+                    tmpl::type_from<decltype(spacetime_tag_v)>;
+                db::mutate<spacetime_tag>(
+                    [&background_in_grid_frame,
+                     &rotation_matrix](const auto spacetime_tag_ptr) {
+                      detail::rotate_tensor(
+                          spacetime_tag_ptr,
+                          get<spacetime_tag>(background_in_grid_frame),
+                          rotation_matrix);
+                    },
+                    make_not_null(&box));
+              });
+          return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+        }
+      }
+    }
+    auto initial_data = evolution::Initialization::initial_data(
+        background_spacetime,
         db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
-        db::get<::Tags::Time>(box), typename System::spacetime_tag_list{});
-    tmpl::for_each<typename System::spacetime_tag_list>(
+        db::get<::Tags::Time>(box), spacetime_tag_list{});
+    tmpl::for_each<spacetime_tag_list>(
         [&box, &initial_data](auto spacetime_tag_v) {
           using spacetime_tag = tmpl::type_from<decltype(spacetime_tag_v)>;
           db::mutate<spacetime_tag>(
@@ -79,5 +275,46 @@ struct CalculateGrVars {
 
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
+
+ private:
+  // Evaluates the background at the grid coordinates unless it was already
+  // evaluated there.
+  template <typename DbTagsList, typename BackgroundSpacetime>
+  static void update_cache(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      const BackgroundSpacetime& background_spacetime,
+      const tnsr::I<DataVector, Dim, Frame::Grid>& grid_coords) {
+    const auto& background_in_grid_frame = db::get<cache_tag>(*box);
+    if (background_in_grid_frame.number_of_grid_points() ==
+            get<0>(grid_coords).size() and
+        get<domain::Tags::Coordinates<Dim, Frame::Grid>>(
+            background_in_grid_frame) == grid_coords) {
+      return;
+    }
+    tnsr::I<DataVector, Dim, Frame::Inertial> coords_as_inertial{};
+    for (size_t d = 0; d < Dim; ++d) {
+      coords_as_inertial.get(d).set_data_ref(
+          make_not_null(&const_cast<DataVector&>(grid_coords.get(d))));
+    }
+    auto background = evolution::Initialization::initial_data(
+        background_spacetime, coords_as_inertial, db::get<::Tags::Time>(*box),
+        spacetime_tag_list{});
+    db::mutate<cache_tag>(
+        [&background, &grid_coords](const auto background_in_grid_frame_ptr) {
+          background_in_grid_frame_ptr->initialize(get<0>(grid_coords).size());
+          tmpl::for_each<spacetime_tag_list>(
+              [&background,
+               &background_in_grid_frame_ptr](auto spacetime_tag_v) {
+                using spacetime_tag =
+                    tmpl::type_from<decltype(spacetime_tag_v)>;
+                get<spacetime_tag>(*background_in_grid_frame_ptr) =
+                    std::move(get<spacetime_tag>(background));
+              });
+          get<domain::Tags::Coordinates<Dim, Frame::Grid>>(
+              *background_in_grid_frame_ptr) = grid_coords;
+        },
+        box);
+  }
 };
-}  // namespace CurvedScalarWave::Actions
+}  // namespace Actions
+}  // namespace CurvedScalarWave
@@ -0,0 +1,114 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/ForceFree/Imex/ParallelCurrentSector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/ForceFree/ElectricCurrentDensity.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace ForceFree::Imex {
+namespace {
+// Root s > 1 of the function f(s) documented in ParallelCurrentSector. Since f
+// is increasing and concave and f(1) < 0, the Newton iterates increase
+// monotonically towards the root.
+double electric_dominance_factor(const double lapse_eta_weight,
+                                 const double b_squared,
+                                 const double x_parallel_squared,
+                                 const double x_perp_squared) {
+  const double inverse_k = b_squared / lapse_eta_weight;
+  double s = 1.0;
+  for (size_t iteration = 0; iteration < 100; ++iteration) {
+    const double f = (s - 1.0) * inverse_k + b_squared -
+                     x_parallel_squared / square(s + lapse_eta_weight) -
+                     x_perp_squared / square(s);
+    const double df = inverse_k +
+                      2.0 * x_parallel_squared / cube(s + lapse_eta_weight) +
+                      2.0 * x_perp_squared / cube(s);
+    const double delta = -f / df;
+    s += delta;
+    if (delta <= 1.0e-14 * s) {
+      break;
+    }
+  }
+  return s;
+}
+}  // namespace
+
+std::vector<imex::GuessResult> ParallelCurrentSector::initial_guess::apply(
+    const gsl::not_null<tnsr::I<DataVector, 3>*> tilde_e,
+    const tnsr::I<DataVector, 3>& tilde_b, const double parallel_conductivity,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const Variables<tmpl::list<Tags::TildeE>>& inhomogeneous_terms,
+    const double implicit_weight) {
+  const auto& x = get<Tags::TildeE>(inhomogeneous_terms);
+  const size_t num_points = get(lapse).size();
+
+  Variables<tmpl::list<::Tags::Tempi<0, 3>, ::Tags::TempScalar<0>,
+                       ::Tags::TempScalar<1>, ::Tags::TempScalar<2>,
+                       ::Tags::TempScalar<3>>>
+      buffer{num_points};
+  auto& tilde_b_one_form = get<::Tags::Tempi<0, 3>>(buffer);
+  auto& b_squared = get<::Tags::TempScalar<0>>(buffer);
+  auto& x_dot_b = get<::Tags::TempScalar<1>>(buffer);
+  auto& x_squared = get<::Tags::TempScalar<2>>(buffer);
+  auto& s = get(get<::Tags::TempScalar<3>>(buffer));
+  raise_or_lower_index(make_not_null(&tilde_b_one_form), tilde_b,
+                       spatial_metric);
+  dot_product(make_not_null(&b_squared), tilde_b, tilde_b_one_form);
+  dot_product(make_not_null(&x_dot_b), x, tilde_b_one_form);
+  dot_product(make_not_null(&x_squared), x, x, spatial_metric);
+
+  // Only electrically dominated points need a (scalar) iteration, everything
+  // else is done in bulk
+  const double weight_eta = implicit_weight * parallel_conductivity;
+  s = 1.0;
+  for (size_t p = 0; p < num_points; ++p) {
+    const double lapse_eta_weight = weight_eta * get(lapse)[p];
+    const double x_parallel_squared =
+        square(get(x_dot_b)[p]) / get(b_squared)[p];
+    const double x_perp_squared =
+        std::max(get(x_squared)[p] - x_parallel_squared, 0.0);
+    if (lapse_eta_weight > 0.0 and
+        x_parallel_squared / square(1.0 + lapse_eta_weight) + x_perp_squared >
+            get(b_squared)[p]) {
+      s[p] = electric_dominance_factor(lapse_eta_weight, get(b_squared)[p],
+                                       x_parallel_squared, x_perp_squared);
+    }
+  }
+
+  // Reuse x_dot_b for the coefficient of tilde_b
+  get(x_dot_b) *= (1.0 / (s + weight_eta * get(lapse)) - 1.0 / s) /
+                  get(b_squared);
+  for (size_t i = 0; i < 3; ++i) {
+    tilde_e->get(i) = x.get(i) / s + get(x_dot_b) * tilde_b.get(i);
+  }
+  return {num_points, imex::GuessResult::ExactSolution};
+}
+
+void ParallelCurrentSector::SolveAttempt::source::apply(
+    const gsl::not_null<tnsr::I<DataVector, 3>*> source_tilde_e,
+    const Scalar<DataVector>& tilde_q, const tnsr::I<DataVector, 3>& tilde_e,
+    const tnsr::I<DataVector, 3>& tilde_b, const double parallel_conductivity,
+    const Scalar<DataVector>& lapse,
+    const Scalar<DataVector>& sqrt_det_spatial_metric,
+    const tnsr::ii<DataVector, 3>& spatial_metric) {
+  ComputeParallelTildeJ::apply(source_tilde_e, tilde_q, tilde_e, tilde_b,
+                               parallel_conductivity, lapse,
+                               sqrt_det_spatial_metric, spatial_metric);
+  for (size_t i = 0; i < 3; ++i) {
+    source_tilde_e->get(i) *= -1.0;
+  }
+}
+}  // namespace ForceFree::Imex
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <vector>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Imex/GuessResult.hpp"
+#include "Evolution/Imex/Protocols/ImplicitSector.hpp"
+#include "Evolution/Systems/ForceFree/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+namespace ForceFree::Imex {
+/*!
+ * \brief The implicit sector evolving \f$\tilde{E}^i\f$ with the stiff
+ * parallel current \f$\tilde{J}^i_\mathrm{parallel}\f$ (see
+ * `ForceFree::ComputeParallelTildeJ`) as its source.
+ *
+ * \details The implicit equation \f$\tilde{E}^i = X^i - w
+ * \tilde{J}^i_\mathrm{parallel}(\tilde{E})\f$ is solved analytically for all
+ * points at once, so the generic pointwise Newton solve is never needed.
+ * Writing \f$c = w\alpha\eta\f$ and decomposing \f$X^i\f$ into the components
+ * \f$X_\parallel\f$ along and \f$X_\perp\f$ normal to \f$\tilde{B}^i\f$, the
+ * solution is
+ *
+ * \f{align*}
+ *  \tilde{E}^i = \frac{X^i}{s} + \left(\frac{1}{s + c} - \frac{1}{s}\right)
+ *    \frac{X_l\tilde{B}^l}{\tilde{B}^2} \tilde{B}^i.
+ * \f}
+ *
+ * If \f$X_\parallel^2 / (1 + c)^2 + X_\perp^2 \leq \tilde{B}^2\f$ the
+ * solution is not electrically dominated and \f$s = 1\f$. Otherwise \f$s>1\f$
+ * is the root of
+ *
+ * \f{align*}
+ *  f(s) = \frac{(s - 1)\tilde{B}^2}{c} + \tilde{B}^2
+ *    - \frac{X_\parallel^2}{(s + c)^2} - \frac{X_\perp^2}{s^2},
+ * \f}
+ *
+ * which is increasing and concave, so Newton's method started from \f$s=1\f$
+ * converges monotonically. Only these points need an iteration, and it is
+ * a scalar one.
+ */
+struct ParallelCurrentSector
+    : tt::ConformsTo<imex::protocols::ImplicitSector> {
+  using tensors = tmpl::list<Tags::TildeE>;
+
+  struct initial_guess {
+    using return_tags = tmpl::list<Tags::TildeE>;
+    using argument_tags =
+        tmpl::list<Tags::TildeB, Tags::ParallelConductivity,
+                   gr::Tags::Lapse<DataVector>,
+                   gr::Tags::SpatialMetric<DataVector, 3>>;
+
+    static std::vector<imex::GuessResult> apply(
+        gsl::not_null<tnsr::I<DataVector, 3>*> tilde_e,
+        const tnsr::I<DataVector, 3>& tilde_b, double parallel_conductivity,
+        const Scalar<DataVector>& lapse,
+        const tnsr::ii<DataVector, 3>& spatial_metric,
+        const Variables<tmpl::list<Tags::TildeE>>& inhomogeneous_terms,
+        double implicit_weight);
+  };
+
+  struct SolveAttempt {
+    struct source {
+      using return_tags = tmpl::list<::Tags::Source<Tags::TildeE>>;
+      using argument_tags =
+          tmpl::list<Tags::TildeQ, Tags::TildeE, Tags::TildeB,
+                     Tags::ParallelConductivity, gr::Tags::Lapse<DataVector>,
+                     gr::Tags::SqrtDetSpatialMetric<DataVector>,
+                     gr::Tags::SpatialMetric<DataVector, 3>>;
+
+      static void apply(
+          gsl::not_null<tnsr::I<DataVector, 3>*> source_tilde_e,
+          const Scalar<DataVector>& tilde_q,
+          const tnsr::I<DataVector, 3>& tilde_e,
+          const tnsr::I<DataVector, 3>& tilde_b, double parallel_conductivity,
+          const Scalar<DataVector>& lapse,
+          const Scalar<DataVector>& sqrt_det_spatial_metric,
+          const tnsr::ii<DataVector, 3>& spatial_metric);
+    };
+
+    using jacobian = imex::NoJacobianBecauseSolutionIsAnalytic;
+
+    using tags_from_evolution = tmpl::list<
+        Tags::TildeQ, Tags::TildeB, Tags::ParallelConductivity,
+        gr::Tags::Lapse<DataVector>, gr::Tags::SqrtDetSpatialMetric<DataVector>,
+        gr::Tags::SpatialMetric<DataVector, 3>>;
+    using simple_tags = tmpl::list<>;
+    using compute_tags = tmpl::list<>;
+    using source_prep = tmpl::list<>;
+    using jacobian_prep = tmpl::list<>;
+  };
+
+  using solve_attempts = tmpl::list<SolveAttempt>;
+};
+}  // namespace ForceFree::Imex
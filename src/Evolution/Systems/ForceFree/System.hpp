@@ -194,7 +194,8 @@ namespace ForceFree {
  * \alpha\sqrt{\gamma}J^i_\mathrm{drift}\f$ and \f$\tilde{J}^i_\mathrm{parallel}
  * \equiv \alpha\sqrt{\gamma}J^i_\mathrm{parallel}\f$ as two separate Tags
  * since the latter term is stiff and needs to be evolved in conjunction with
- * implicit time steppers.
+ * implicit time steppers. The implicit solve for the latter is provided by
+ * `ForceFree::Imex::ParallelCurrentSector`.
  *
  */
 struct System {
@@ -32,6 +32,7 @@ template void volume_terms<::ForceFree::TimeDerivativeTerms>(
         div_fluxes,
     const Variables<typename ::ForceFree::System::variables_tag::tags_list>&
         evolved_vars,
+    const evolution::dg::Actions::detail::VolumeTermsStage stage,
     const ::dg::Formulation dg_formulation, const Mesh<3>& mesh,
     [[maybe_unused]] const tnsr::I<DataVector, 3, Frame::Inertial>&
         inertial_coordinates,
@@ -123,6 +123,28 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
     const tnsr::iaa<DataVector, Dim, Frame::Inertial>& d_spacetime_metric,
     const tnsr::iaa<DataVector, Dim, Frame::Inertial>& d_pi,
     const tnsr::ijaa<DataVector, Dim, Frame::Inertial>& d_phi) const {
+  // The char speeds only depend on the gauge and the face geometry, so compute
+  // them first and skip all other work if no point on the boundary has any
+  // incoming characteristic
+  typename Tags::CharacteristicSpeeds<DataVector, Dim>::type char_speeds;
+  characteristic_speeds(make_not_null(&char_speeds), gamma1, lapse, shift,
+                        normal_covector, face_mesh_velocity);
+  std::optional<Scalar<DataVector>> radial_mesh_velocity{};
+  if (face_mesh_velocity.has_value()) {
+    // Account for moving mesh: char speeds -> char speeds - n_i v^i_g
+    radial_mesh_velocity = dot_product(normal_covector, *face_mesh_velocity);
+    for (size_t a = 0; a < 4; ++a) {
+      char_speeds.at(a) -= get(*radial_mesh_velocity);
+    }
+  }
+  if (min_characteristic_speed(char_speeds) >= 0.) {
+    std::fill(dt_spacetime_metric_correction->begin(),
+              dt_spacetime_metric_correction->end(), 0.);
+    std::fill(dt_pi_correction->begin(), dt_pi_correction->end(), 0.);
+    std::fill(dt_phi_correction->begin(), dt_phi_correction->end(), 0.);
+    return {};
+  }
+
   TempBuffer<tmpl::list<::Tags::TempI<0, Dim, Frame::Inertial, DataVector>,
                         ::Tags::Tempiaa<1, Dim, Frame::Inertial, DataVector>,
                         ::Tags::TempII<0, Dim, Frame::Inertial, DataVector>,
@@ -248,8 +270,6 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
   auto& constraint_char_zero_minus =
       get<::Tags::Tempa<3, Dim, Frame::Inertial, DataVector>>(local_buffer);
 
-  typename Tags::CharacteristicSpeeds<DataVector, Dim>::type char_speeds;
-
   auto& bc_dt_v_psi =
       get<::Tags::Tempaa<4, Dim, Frame::Inertial, DataVector>>(local_buffer);
   auto& bc_dt_v_zero =
@@ -274,30 +294,12 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
       make_not_null(&char_projected_rhs_dt_v_plus),
       make_not_null(&char_projected_rhs_dt_v_minus),
       make_not_null(&constraint_char_zero_plus),
-      make_not_null(&constraint_char_zero_minus), make_not_null(&char_speeds),
-      face_mesh_velocity, normal_covector, pi, phi, spacetime_metric, coords,
-      gamma1, gamma2, lapse, shift, inverse_spacetime_metric,
-      spacetime_unit_normal_vector, spacetime_unit_normal_one_form,
-      three_index_constraint, gauge_source, spacetime_deriv_gauge_source, dt_pi,
-      dt_phi, dt_spacetime_metric, d_pi, d_phi, d_spacetime_metric);
-
-  // Account for moving mesh: char speeds -> cher speeds - n_i v^i_g
-  if (face_mesh_velocity.has_value()) {
-    const auto radial_mesh_velocity =
-        get(dot_product(normal_covector, *face_mesh_velocity));
-    for (size_t a = 0; a < 4; ++a) {
-      char_speeds.at(a) -= radial_mesh_velocity;
-    }
-  }
-
-  // If no point on the boundary has any incoming characteristic, return here
-  if (min_characteristic_speed(char_speeds) >= 0.) {
-    std::fill(dt_spacetime_metric_correction->begin(),
-              dt_spacetime_metric_correction->end(), 0.);
-    std::fill(dt_pi_correction->begin(), dt_pi_correction->end(), 0.);
-    std::fill(dt_phi_correction->begin(), dt_phi_correction->end(), 0.);
-    return {};
-  }
+      make_not_null(&constraint_char_zero_minus), normal_covector, pi, phi,
+      spacetime_metric, coords, gamma1, gamma2, lapse, shift,
+      inverse_spacetime_metric, spacetime_unit_normal_vector,
+      spacetime_unit_normal_one_form, three_index_constraint, gauge_source,
+      spacetime_deriv_gauge_source, dt_pi, dt_phi, dt_spacetime_metric, d_pi,
+      d_phi, d_spacetime_metric);
 
   Bjorhus::constraint_preserving_bjorhus_corrections_dt_v_psi(
       make_not_null(&bc_dt_v_psi), unit_interface_normal_vector,
@@ -365,13 +367,11 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
   *dt_spacetime_metric_correction =
       get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(dt_evolved_vars);
 
-  if (face_mesh_velocity.has_value()) {
-    const auto radial_mesh_velocity =
-        get(dot_product(normal_covector, *face_mesh_velocity));
+  if (radial_mesh_velocity.has_value()) {
     // we use 1e-10 instead of 0 below to allow for purely tangentially
     // moving grids, eg a rotating sphere, with some leeway for
     // floating-point errors.
-    if (max(radial_mesh_velocity) > 1.e-10) {
+    if (max(get(*radial_mesh_velocity)) > 1.e-10) {
       return {
           "We found the radial mesh velocity points in the direction "
           "of the outward normal, i.e. we possibly have an expanding "
@@ -419,16 +419,12 @@ void ConstraintPreservingBjorhus<Dim>::compute_intermediate_vars(
         constraint_char_zero_plus,
     const gsl::not_null<tnsr::a<DataVector, Dim, Frame::Inertial>*>
         constraint_char_zero_minus,
-    const gsl::not_null<std::array<DataVector, 4>*> char_speeds,
-
-    const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
-        face_mesh_velocity,
     const tnsr::i<DataVector, Dim, Frame::Inertial>& normal_covector,
     const tnsr::aa<DataVector, Dim, Frame::Inertial>& pi,
     const tnsr::iaa<DataVector, Dim, Frame::Inertial>& phi,
     const tnsr::aa<DataVector, Dim, Frame::Inertial>& spacetime_metric,
     const tnsr::I<DataVector, Dim, Frame::Inertial>& /* coords */,
-    const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2,
+    const Scalar<DataVector>& /*gamma1*/, const Scalar<DataVector>& gamma2,
     const Scalar<DataVector>& lapse,
     const tnsr::I<DataVector, Dim, Frame::Inertial>& shift,
     const tnsr::AA<DataVector, Dim, Frame::Inertial>& inverse_spacetime_metric,
@@ -539,9 +535,6 @@ void ConstraintPreservingBjorhus<Dim>::compute_intermediate_vars(
           unit_interface_normal_vector->get(i) * two_index_constraint.get(i, a);
     }
   }
-
-  characteristic_speeds(char_speeds, gamma1, lapse, shift, normal_covector,
-                        face_mesh_velocity);
 }
 
 template <size_t Dim>
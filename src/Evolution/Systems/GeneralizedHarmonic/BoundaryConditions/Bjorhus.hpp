@@ -243,10 +243,6 @@ class ConstraintPreservingBjorhus final : public BoundaryCondition<Dim> {
           constraint_char_zero_plus,
       gsl::not_null<tnsr::a<DataVector, Dim, Frame::Inertial>*>
           constraint_char_zero_minus,
-      gsl::not_null<std::array<DataVector, 4>*> char_speeds,
-
-      const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
-          face_mesh_velocity,
       const tnsr::i<DataVector, Dim, Frame::Inertial>& normal_covector,
       const tnsr::aa<DataVector, Dim, Frame::Inertial>& pi,
       const tnsr::iaa<DataVector, Dim, Frame::Inertial>& phi,
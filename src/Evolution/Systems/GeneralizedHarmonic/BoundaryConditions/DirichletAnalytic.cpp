@@ -7,6 +7,7 @@
 #include <memory>
 #include <pup.h>
 #include <type_traits>
+#include <utility>
 
 #include "Evolution/Systems/GeneralizedHarmonic/AllSolutions.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
@@ -15,9 +16,27 @@
 #include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "Utilities/CallWithDynamicType.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace gh::BoundaryConditions {
+namespace {
+// Whether or not the `SolutionOrData` lists all `RequestedTags` in its `tags`
+template <typename SolutionOrData, typename RequestedTags,
+          typename = std::void_t<>>
+struct provides_tags : std::false_type {};
+
+template <typename SolutionOrData, typename... RequestedTags>
+struct provides_tags<
+    SolutionOrData, tmpl::list<RequestedTags...>,
+    std::void_t<typename SolutionOrData::template tags<DataVector>>>
+    : std::bool_constant<(
+          tmpl::list_contains_v<
+              typename SolutionOrData::template tags<DataVector>,
+              RequestedTags> and
+          ...)> {};
+}  // namespace
+
 template <size_t Dim>
 DirichletAnalytic<Dim>::DirichletAnalytic(const DirichletAnalytic& rhs)
     : BoundaryCondition<Dim>{dynamic_cast<const BoundaryCondition<Dim>&>(rhs)},
@@ -78,31 +97,52 @@ std::optional<std::string> DirichletAnalytic<Dim>::dg_ghost(
   ASSERT(analytic_prescription_ != nullptr,
          "The analytic prescription must be set.");
   using evolved_vars_tags = typename System<Dim>::variables_tag::tags_list;
-  auto boundary_values = call_with_dynamic_type<
-      tuples::tagged_tuple_from_typelist<evolved_vars_tags>,
-      solutions_including_matter<Dim>>(
+  using gr_vars_tags =
+      tmpl::list<gr::Tags::Lapse<DataVector>,
+                 gr::Tags::Shift<DataVector, Dim>,
+                 gr::Tags::InverseSpatialMetric<DataVector, Dim>>;
+  call_with_dynamic_type<void, solutions_including_matter<Dim>>(
       analytic_prescription_.get(),
-      [&coords, &time](const auto* const analytic_solution_or_data) {
-        if constexpr (is_analytic_solution_v<
-                          std::decay_t<decltype(*analytic_solution_or_data)>>) {
-          return analytic_solution_or_data->variables(coords, time,
-                                                      evolved_vars_tags{});
-
+      [this, &spacetime_metric, &pi, &phi, &lapse, &shift,
+       &inv_spatial_metric, &coords,
+       &time](const auto* const analytic_solution_or_data) {
+        using SolutionOrData =
+            std::decay_t<decltype(*analytic_solution_or_data)>;
+        // Request the lapse, shift and inverse spatial metric along with the
+        // evolved variables if the solution provides them, so they are
+        // computed in the same call instead of from the spacetime metric
+        constexpr bool request_gr_vars =
+            provides_tags<SolutionOrData, gr_vars_tags>::value;
+        using requested_tags = tmpl::append<
+            evolved_vars_tags,
+            tmpl::conditional_t<request_gr_vars, gr_vars_tags, tmpl::list<>>>;
+        auto boundary_values = [&analytic_solution_or_data, &coords,
+                                &time]() {
+          if constexpr (is_analytic_solution_v<SolutionOrData>) {
+            return analytic_solution_or_data->variables(coords, time,
+                                                        requested_tags{});
+          } else {
+            (void)time;
+            return analytic_solution_or_data->variables(coords,
+                                                        requested_tags{});
+          }
+        }();
+        *spacetime_metric = std::move(
+            get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(boundary_values));
+        *pi = std::move(get<gh::Tags::Pi<DataVector, Dim>>(boundary_values));
+        *phi = std::move(get<gh::Tags::Phi<DataVector, Dim>>(boundary_values));
+        if constexpr (request_gr_vars) {
+          *lapse = std::move(get<gr::Tags::Lapse<DataVector>>(boundary_values));
+          *shift = std::move(
+              get<gr::Tags::Shift<DataVector, Dim>>(boundary_values));
+          *inv_spatial_metric = std::move(
+              get<gr::Tags::InverseSpatialMetric<DataVector, Dim>>(
+                  boundary_values));
         } else {
-          (void)time;
-          return analytic_solution_or_data->variables(coords,
-                                                      evolved_vars_tags{});
+          lapse_shift_and_inv_spatial_metric(lapse, shift, inv_spatial_metric,
+                                             *spacetime_metric);
         }
       });
-
-  *spacetime_metric =
-      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(boundary_values);
-  *pi = get<gh::Tags::Pi<DataVector, Dim>>(boundary_values);
-  *phi = get<gh::Tags::Phi<DataVector, Dim>>(boundary_values);
-
-  // Now compute lapse and shift...
-  lapse_shift_and_inv_spatial_metric(lapse, shift, inv_spatial_metric,
-                                     *spacetime_metric);
   return {};
 }
 
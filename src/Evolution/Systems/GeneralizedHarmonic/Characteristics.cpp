@@ -5,11 +5,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
@@ -190,9 +190,21 @@ void Tags::ComputeLargestCharacteristicSpeed<Dim, Frame>::function(
     const Scalar<DataVector>& lapse,
     const tnsr::I<DataVector, Dim, Frame>& shift,
     const tnsr::ii<DataVector, Dim, Frame>& spatial_metric) {
-  const auto shift_magnitude = magnitude(shift, spatial_metric);
-  *speed = std::max(max(abs(1. + get(gamma_1)) * get(shift_magnitude)),
-                    max(get(shift_magnitude) + get(lapse)));
+  double max_speed = 0.0;
+  for (size_t s = 0; s < get(lapse).size(); ++s) {
+    double shift_magnitude_squared = 0.0;
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t j = 0; j < Dim; ++j) {
+        shift_magnitude_squared +=
+            spatial_metric.get(i, j)[s] * shift.get(i)[s] * shift.get(j)[s];
+      }
+    }
+    const double shift_magnitude = std::sqrt(shift_magnitude_squared);
+    max_speed =
+        std::max({max_speed, std::abs(1. + get(gamma_1)[s]) * shift_magnitude,
+                  shift_magnitude + get(lapse)[s]});
+  }
+  *speed = max_speed;
 }
 }  // namespace gh
 
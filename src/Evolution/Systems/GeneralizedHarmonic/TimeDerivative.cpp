@@ -339,22 +339,33 @@ void TimeDerivative<Dim>::apply(
         dt_pi->get(mu, nu) -= spacetime_deriv_gauge_function->get(mu, nu) +
                               spacetime_deriv_gauge_function->get(nu, mu);
       }
+      // Each update below is a separate pass over the grid points, so
+      // products are grouped into as few updates as possible. The
+      // Christoffel sum over (alpha, delta) adds the terms with alpha = delta
+      // together with the pi and phi terms and the terms with alpha != delta
+      // in pairs.
       for (size_t delta = 0; delta < Dim + 1; ++delta) {
-        dt_pi->get(mu, nu) -= 2 * pi.get(mu, delta) * pi_2_up->get(nu, delta);
+        dt_pi->get(mu, nu) -=
+            2. * (pi.get(mu, delta) * pi_2_up->get(nu, delta) +
+                  christoffel_first_kind_3_up->get(mu, delta, delta) *
+                      christoffel_first_kind_3_up->get(nu, delta, delta) -
+                  phi_1_up->get(0, mu, delta) * phi_3_up->get(0, nu, delta));
         if (not using_harmonic_gauge) {
-          dt_pi->get(mu, nu) += 2 *
+          dt_pi->get(mu, nu) += 2. *
                                 christoffel_second_kind->get(delta, mu, nu) *
                                 gauge_function->get(delta);
         }
-        for (size_t n = 0; n < Dim; ++n) {
+        for (size_t n = 1; n < Dim; ++n) {
           dt_pi->get(mu, nu) +=
-              2 * phi_1_up->get(n, mu, delta) * phi_3_up->get(n, nu, delta);
+              2. * phi_1_up->get(n, mu, delta) * phi_3_up->get(n, nu, delta);
         }
 
-        for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
+        for (size_t alpha = delta + 1; alpha < Dim + 1; ++alpha) {
           dt_pi->get(mu, nu) -=
-              2. * christoffel_first_kind_3_up->get(mu, alpha, delta) *
-              christoffel_first_kind_3_up->get(nu, delta, alpha);
+              2. * (christoffel_first_kind_3_up->get(mu, alpha, delta) *
+                        christoffel_first_kind_3_up->get(nu, delta, alpha) +
+                    christoffel_first_kind_3_up->get(mu, delta, alpha) *
+                        christoffel_first_kind_3_up->get(nu, alpha, delta));
         }
       }
 
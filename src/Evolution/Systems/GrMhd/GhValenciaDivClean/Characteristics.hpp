@@ -3,11 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/Gsl.hpp"
@@ -36,8 +37,19 @@ struct ComputeLargestCharacteristicSpeed : db::ComputeTag,
                        const Scalar<DataVector>& lapse,
                        const tnsr::I<DataVector, 3, Frame>& shift,
                        const tnsr::ii<DataVector, 3, Frame>& spatial_metric) {
-    const auto shift_magnitude = magnitude(shift, spatial_metric);
-    *speed = max(get(shift_magnitude) + get(lapse));
+    double max_speed = 0.0;
+    for (size_t s = 0; s < get(lapse).size(); ++s) {
+      double shift_magnitude_squared = 0.0;
+      for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+          shift_magnitude_squared +=
+              spatial_metric.get(i, j)[s] * shift.get(i)[s] * shift.get(j)[s];
+        }
+      }
+      const double shift_magnitude = std::sqrt(shift_magnitude_squared);
+      max_speed = std::max(max_speed, shift_magnitude + get(lapse)[s]);
+    }
+    *speed = max_speed;
   }
 };
 }  // namespace grmhd::GhValenciaDivClean::Tags
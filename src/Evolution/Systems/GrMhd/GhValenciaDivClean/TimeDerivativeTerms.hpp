@@ -106,24 +106,30 @@ struct TimeDerivativeTermsImpl<
     const auto& inv_spatial_metric =
         get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(*temps_ptr);
     const auto& shift = get<gr::Tags::Shift<DataVector, 3>>(*temps_ptr);
+    // d_i beta^j = gamma^{jl} (Phi_{i0l} - beta^k Phi_{ilk}). The bracket does
+    // not depend on j, so compute it once per i and contract afterwards.
+    const size_t number_of_points = shift.get(0).size();
+    DataVector projected_phi_buffer{3 * number_of_points};
+    tnsr::i<DataVector, 3> projected_phi{};
+    for (size_t l = 0; l < 3; ++l) {
+      projected_phi.get(l).set_data_ref(
+          &projected_phi_buffer[l * number_of_points], number_of_points);
+    }
+    auto& deriv_shift =
+        get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
+                          Frame::Inertial>>(*temps_ptr);
     for (size_t i = 0; i < 3; ++i) {
+      for (size_t l = 0; l < 3; ++l) {
+        projected_phi.get(l) = phi.get(i, 0, l + 1) -
+                               shift.get(0) * phi.get(i, l + 1, 1) -
+                               shift.get(1) * phi.get(i, l + 1, 2) -
+                               shift.get(2) * phi.get(i, l + 1, 3);
+      }
       for (size_t j = 0; j < 3; ++j) {
-        get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
-                          Frame::Inertial>>(*temps_ptr)
-            .get(i, j) = inv_spatial_metric.get(j, 0) * phi.get(i, 0, 1);
-        for (size_t k = 1; k < 3; ++k) {
-          get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
-                            Frame::Inertial>>(*temps_ptr)
-              .get(i, j) += inv_spatial_metric.get(j, k) * phi.get(i, 0, k + 1);
-        }
-        for (size_t k = 0; k < 3; ++k) {
-          for (size_t l = 0; l < 3; ++l) {
-            get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
-                              Frame::Inertial>>(*temps_ptr)
-                .get(i, j) -= shift.get(k) * inv_spatial_metric.get(j, l) *
-                              phi.get(i, l + 1, k + 1);
-          }
-        }
+        deriv_shift.get(i, j) =
+            inv_spatial_metric.get(j, 0) * projected_phi.get(0) +
+            inv_spatial_metric.get(j, 1) * projected_phi.get(1) +
+            inv_spatial_metric.get(j, 2) * projected_phi.get(2);
       }
     }
 
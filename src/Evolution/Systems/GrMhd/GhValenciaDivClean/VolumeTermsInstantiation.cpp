@@ -38,6 +38,7 @@ template void volume_terms<::grmhd::GhValenciaDivClean::TimeDerivativeTerms>(
     const Variables<
         typename ::grmhd::GhValenciaDivClean::System::variables_tag::tags_list>&
         evolved_vars,
+    const evolution::dg::Actions::detail::VolumeTermsStage stage,
     const ::dg::Formulation dg_formulation, const Mesh<3>& mesh,
     [[maybe_unused]] const tnsr::I<DataVector, 3, Frame::Inertial>&
         inertial_coordinates,
@@ -4,10 +4,12 @@
 #pragma once
 
 #include <array>
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 
 #include "DataStructures/DataBox/Tag.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/FaceNormal.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
@@ -180,8 +182,21 @@ struct ComputeLargestCharacteristicSpeed : db::ComputeTag,
                        const Scalar<DataVector>& lapse,
                        const tnsr::I<DataVector, 3>& shift,
                        const tnsr::ii<DataVector, 3>& spatial_metric) {
-    const auto shift_magnitude = magnitude(shift, spatial_metric);
-    *speed = max(get(shift_magnitude) + get(lapse));
+    // Single pass without temporaries, since this is evaluated whenever
+    // the metric changes, i.e. on every step with a dynamic spacetime.
+    double max_speed = 0.0;
+    for (size_t s = 0; s < get(lapse).size(); ++s) {
+      double shift_magnitude_squared = 0.0;
+      for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+          shift_magnitude_squared +=
+              spatial_metric.get(i, j)[s] * shift.get(i)[s] * shift.get(j)[s];
+        }
+      }
+      const double shift_magnitude = std::sqrt(shift_magnitude_squared);
+      max_speed = std::max(max_speed, shift_magnitude + get(lapse)[s]);
+    }
+    *speed = max_speed;
   }
 };
 }  // namespace Tags
@@ -94,10 +94,8 @@ void compute_conservatives_for_reconstruction(
     pressure = eos.pressure_from_density_and_energy(rest_mass_density,
                                                     specific_internal_energy);
   } else if constexpr (ThermodynamicDim == 3) {
-    specific_internal_energy =
-        eos.specific_internal_energy_from_density_and_temperature(
-            rest_mass_density, temperature, electron_fraction);
-    pressure = eos.pressure_from_density_and_temperature(
+    eos.pressure_and_energy_from_density_and_temperature(
+        make_not_null(&pressure), make_not_null(&specific_internal_energy),
         rest_mass_density, temperature, electron_fraction);
   } else {
     ERROR("EOS Must be 1, 2, or 3d");
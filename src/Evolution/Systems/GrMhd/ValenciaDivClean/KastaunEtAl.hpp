@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <optional>
 #include <string>
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 namespace EquationsOfState {
@@ -62,6 +64,36 @@ class KastaunEtAl {
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
           primitive_from_conservative_options);
 
+#ifdef SPECTRE_USE_XSIMD
+  /// The number of points recovered by one call to the vectorized `apply`
+  static constexpr size_t simd_width = simd::size<simd::batch<double>>();
+
+  /*!
+   * \brief Recover the primitive variables at `simd_width` points at once.
+   *
+   * The bracket of the master function is computed pointwise, after which
+   * the master function is solved for all points simultaneously with the
+   * vectorized TOMS748 root finder. Points that have converged are masked off
+   * while the remaining points iterate. Only the equation of state is
+   * evaluated pointwise inside the master function.
+   *
+   * Points for which no bracket can be found are returned as
+   * `std::nullopt`, exactly as the pointwise `apply` would. If the vectorized
+   * root find fails, the points of the batch are recovered pointwise instead.
+   */
+  template <bool EnforcePhysicality, typename EosType>
+  static std::array<std::optional<PrimitiveRecoveryData>, simd_width> apply(
+      const simd::batch<double>& tau,
+      const simd::batch<double>& momentum_density_squared,
+      const simd::batch<double>& momentum_density_dot_magnetic_field,
+      const simd::batch<double>& magnetic_field_squared,
+      const simd::batch<double>& rest_mass_density_times_lorentz_factor,
+      const simd::batch<double>& electron_fraction,
+      const EosType& equation_of_state,
+      const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+          primitive_from_conservative_options);
+#endif
+
   static const std::string name() { return "KastaunEtAl"; }
 
  private:
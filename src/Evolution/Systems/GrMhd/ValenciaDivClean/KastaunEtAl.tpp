@@ -5,6 +5,8 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <exception>
 #include <limits>
@@ -19,25 +21,25 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
 
 namespace KastaunEtAl_detail {
 // GCC warns without forward decls
-double compute_x(double mu, double b_squared);
-double compute_r_bar_squared(double mu, double x, double r_squared,
-                             double r_dot_b_squared);
 double compute_v_0_squared(double r_squared, double h_0, double lorentz_max);
 
 // Equation (26)
-double compute_x(const double mu, const double b_squared) {
+template <typename T>
+T compute_x(const T& mu, const T& b_squared) {
   return 1.0 / (1.0 + mu * b_squared);
 }
 
 // Equation (38)
-double compute_r_bar_squared(const double mu, const double x,
-                             const double r_squared,
-                             const double r_dot_b_squared) {
+template <typename T>
+T compute_r_bar_squared(const T& mu, const T& x, const T& r_squared,
+                        const T& r_dot_b_squared) {
   return x * (r_squared * x + mu * (1.0 + x) * r_dot_b_squared);
 }
 
@@ -173,6 +175,14 @@ class FunctionOfMu {
 
   bool state_is_unphysical() const { return state_is_unphysical_; }
 
+  // The parameters of the master function after they have been limited to
+  // the physical range, used to set up `BatchedFunctionOfMu`
+  double q() const { return q_; }
+  double r_squared() const { return r_squared_; }
+  double b_squared() const { return b_squared_; }
+  double r_dot_b_squared() const { return r_dot_b_squared_; }
+  double v_0_squared() const { return v_0_squared_; }
+
  private:
   double q_;
   double r_squared_;
@@ -336,6 +346,148 @@ double FunctionOfMu<EnforcePhysicality, EosType>::operator()(
   // Equations (44) - (45)
   return mu - 1.0 / (nu_hat + mu * r_bar_squared);
 }
+
+#ifdef SPECTRE_USE_XSIMD
+// The master function evaluated at `simd_width` points at once. Only the
+// equation of state is evaluated pointwise. Points that are not `active` are
+// given parameters for which the master function is `mu - 1`, which has its
+// root at the upper end of the bracket `[0, 1]` so that the points do not
+// produce floating point exceptions while they are masked off in the root
+// find.
+template <typename EosType>
+class BatchedFunctionOfMu {
+ public:
+  using SimdType = simd::batch<double>;
+  static constexpr size_t simd_width = simd::size<SimdType>();
+
+  struct Primitives {
+    SimdType rest_mass_density;
+    SimdType lorentz_factor;
+    SimdType pressure;
+    SimdType specific_internal_energy;
+    SimdType q_bar;
+    SimdType r_bar_squared;
+  };
+
+  BatchedFunctionOfMu(const SimdType& q, const SimdType& r_squared,
+                      const SimdType& b_squared,
+                      const SimdType& r_dot_b_squared,
+                      const SimdType& rest_mass_density_times_lorentz_factor,
+                      const SimdType& electron_fraction,
+                      const SimdType& v_0_squared,
+                      const std::array<bool, simd_width>& active,
+                      const EosType& equation_of_state)
+      : q_(q),
+        r_squared_(r_squared),
+        b_squared_(b_squared),
+        r_dot_b_squared_(r_dot_b_squared),
+        rest_mass_density_times_lorentz_factor_(
+            rest_mass_density_times_lorentz_factor),
+        v_0_squared_(v_0_squared),
+        active_(active),
+        equation_of_state_(equation_of_state),
+        rho_min_(equation_of_state_.rest_mass_density_lower_bound()),
+        rho_max_(equation_of_state_.rest_mass_density_upper_bound()) {
+    simd::store_unaligned(electron_fraction_.data(), electron_fraction);
+  }
+
+  Primitives primitives(const SimdType& mu) const;
+
+  SimdType operator()(const SimdType& mu) const;
+
+ private:
+  const SimdType q_;
+  const SimdType r_squared_;
+  const SimdType b_squared_;
+  const SimdType r_dot_b_squared_;
+  const SimdType rest_mass_density_times_lorentz_factor_;
+  const SimdType v_0_squared_;
+  const std::array<bool, simd_width> active_;
+  std::array<double, simd_width> electron_fraction_{};
+  const EosType& equation_of_state_;
+  const double rho_min_;
+  const double rho_max_;
+};
+
+template <typename EosType>
+auto BatchedFunctionOfMu<EosType>::primitives(const SimdType& mu) const
+    -> Primitives {
+  // See `FunctionOfMu::primitives` for the equations
+  const SimdType x = compute_x(mu, b_squared_);
+  const SimdType r_bar_squared =
+      compute_r_bar_squared(mu, x, r_squared_, r_dot_b_squared_);
+  const SimdType v_hat_squared =
+      simd::min(square(mu) * r_bar_squared, v_0_squared_);
+  const SimdType w_hat = 1.0 / simd::sqrt(1.0 - v_hat_squared);
+  const SimdType rho_hat =
+      simd::clip(rest_mass_density_times_lorentz_factor_ / w_hat,
+                 SimdType(rho_min_), SimdType(rho_max_));
+  const SimdType q_bar =
+      q_ - 0.5 * b_squared_ -
+      0.5 * square(mu * x) * (r_squared_ * b_squared_ - r_dot_b_squared_);
+  const SimdType unbounded_epsilon_hat =
+      w_hat * (q_bar - mu * r_bar_squared) +
+      v_hat_squared * square(w_hat) / (1.0 + w_hat);
+
+  std::array<double, simd_width> rho_hat_values{};
+  std::array<double, simd_width> epsilon_hat_values{};
+  std::array<double, simd_width> p_hat_values{};
+  simd::store_unaligned(rho_hat_values.data(), rho_hat);
+  simd::store_unaligned(epsilon_hat_values.data(), unbounded_epsilon_hat);
+  for (size_t i = 0; i < simd_width; ++i) {
+    if (not gsl::at(active_, i)) {
+      gsl::at(epsilon_hat_values, i) = 0.0;
+      gsl::at(p_hat_values, i) = 0.0;
+      continue;
+    }
+    const double rho = gsl::at(rho_hat_values, i);
+    double& epsilon = gsl::at(epsilon_hat_values, i);
+    if constexpr (EosType::thermodynamic_dim == 3) {
+      const double electron_fraction = gsl::at(electron_fraction_, i);
+      epsilon = std::clamp(
+          epsilon,
+          equation_of_state_.specific_internal_energy_lower_bound(
+              rho, electron_fraction),
+          equation_of_state_.specific_internal_energy_upper_bound(
+              rho, electron_fraction));
+      gsl::at(p_hat_values, i) =
+          get(equation_of_state_.pressure_from_density_and_energy(
+              Scalar<double>(rho), Scalar<double>(epsilon),
+              Scalar<double>(electron_fraction)));
+    } else {
+      epsilon = std::clamp(
+          epsilon, equation_of_state_.specific_internal_energy_lower_bound(rho),
+          equation_of_state_.specific_internal_energy_upper_bound(rho));
+      if constexpr (EosType::thermodynamic_dim == 1) {
+        gsl::at(p_hat_values, i) = get(
+            equation_of_state_.pressure_from_density(Scalar<double>(rho)));
+      } else {
+        gsl::at(p_hat_values, i) =
+            get(equation_of_state_.pressure_from_density_and_energy(
+                Scalar<double>(rho), Scalar<double>(epsilon)));
+      }
+    }
+  }
+  return Primitives{rho_hat,
+                    w_hat,
+                    simd::load_unaligned(p_hat_values.data()),
+                    simd::load_unaligned(epsilon_hat_values.data()),
+                    q_bar,
+                    r_bar_squared};
+}
+
+template <typename EosType>
+auto BatchedFunctionOfMu<EosType>::operator()(const SimdType& mu) const
+    -> SimdType {
+  const auto [rho_hat, w_hat, p_hat, epsilon_hat, q_bar, r_bar_squared] =
+      primitives(mu);
+  const SimdType a_hat = p_hat / (rho_hat * (1.0 + epsilon_hat));
+  const SimdType h_hat = (1.0 + epsilon_hat) * (1.0 + a_hat);
+  const SimdType nu_hat = simd::max(
+      h_hat / w_hat, (1.0 + a_hat) * (1.0 + q_bar - mu * r_bar_squared));
+  return mu - 1.0 / (nu_hat + mu * r_bar_squared);
+}
+#endif
 }  // namespace KastaunEtAl_detail
 
 template <bool EnforcePhysicality, typename EosType>
@@ -398,4 +550,149 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
           one_over_specific_enthalpy_times_lorentz_factor,
       electron_fraction};
 }
+
+#ifdef SPECTRE_USE_XSIMD
+template <bool EnforcePhysicality, typename EosType>
+std::array<std::optional<PrimitiveRecoveryData>, KastaunEtAl::simd_width>
+KastaunEtAl::apply(
+    const simd::batch<double>& tau,
+    const simd::batch<double>& momentum_density_squared,
+    const simd::batch<double>& momentum_density_dot_magnetic_field,
+    const simd::batch<double>& magnetic_field_squared,
+    const simd::batch<double>& rest_mass_density_times_lorentz_factor,
+    const simd::batch<double>& electron_fraction,
+    const EosType& equation_of_state,
+    const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+        primitive_from_conservative_options) {
+  using SimdType = simd::batch<double>;
+  using Values = std::array<double, simd_width>;
+  const auto to_array = [](const SimdType& batch) {
+    Values values{};
+    simd::store_unaligned(values.data(), batch);
+    return values;
+  };
+  const Values tau_values = to_array(tau);
+  const Values momentum_density_squared_values =
+      to_array(momentum_density_squared);
+  const Values momentum_density_dot_magnetic_field_values =
+      to_array(momentum_density_dot_magnetic_field);
+  const Values magnetic_field_squared_values = to_array(magnetic_field_squared);
+  const Values rest_mass_density_times_lorentz_factor_values =
+      to_array(rest_mass_density_times_lorentz_factor);
+  const Values electron_fraction_values = to_array(electron_fraction);
+
+  // Points that are not active keep these values, see `BatchedFunctionOfMu`
+  Values lower_bound{};
+  Values upper_bound{};
+  upper_bound.fill(1.0);
+  Values q{};
+  Values r_squared{};
+  Values b_squared{};
+  Values r_dot_b_squared{};
+  Values v_0_squared{};
+  Values rest_mass_density_times_lorentz_factor_or_default{};
+  rest_mass_density_times_lorentz_factor_or_default.fill(1.0);
+  Values inactive{};
+  inactive.fill(1.0);
+  std::array<bool, simd_width> active{};
+
+  std::array<std::optional<PrimitiveRecoveryData>, simd_width> result{};
+  for (size_t i = 0; i < simd_width; ++i) {
+    const auto f_of_mu =
+        KastaunEtAl_detail::FunctionOfMu<EnforcePhysicality, EosType>{
+            gsl::at(tau_values, i),
+            gsl::at(momentum_density_squared_values, i),
+            gsl::at(momentum_density_dot_magnetic_field_values, i),
+            gsl::at(magnetic_field_squared_values, i),
+            gsl::at(rest_mass_density_times_lorentz_factor_values, i),
+            gsl::at(electron_fraction_values, i),
+            equation_of_state,
+            primitive_from_conservative_options.kastaun_max_lorentz_factor()};
+    if (f_of_mu.state_is_unphysical()) {
+      continue;
+    }
+    try {
+      const auto [lower, upper] = f_of_mu.root_bracket(
+          gsl::at(rest_mass_density_times_lorentz_factor_values, i),
+          absolute_tolerance_, relative_tolerance_, max_iterations_);
+      gsl::at(lower_bound, i) = lower;
+      gsl::at(upper_bound, i) = upper;
+    } catch (std::exception& exception) {
+      continue;
+    }
+    gsl::at(q, i) = f_of_mu.q();
+    gsl::at(r_squared, i) = f_of_mu.r_squared();
+    gsl::at(b_squared, i) = f_of_mu.b_squared();
+    gsl::at(r_dot_b_squared, i) = f_of_mu.r_dot_b_squared();
+    gsl::at(v_0_squared, i) = f_of_mu.v_0_squared();
+    gsl::at(rest_mass_density_times_lorentz_factor_or_default, i) =
+        gsl::at(rest_mass_density_times_lorentz_factor_values, i);
+    gsl::at(inactive, i) = 0.0;
+    gsl::at(active, i) = true;
+  }
+  if (std::none_of(active.begin(), active.end(),
+                   [](const bool is_active) { return is_active; })) {
+    return result;
+  }
+
+  const auto f_of_mu = KastaunEtAl_detail::BatchedFunctionOfMu<EosType>{
+      simd::load_unaligned(q.data()),
+      simd::load_unaligned(r_squared.data()),
+      simd::load_unaligned(b_squared.data()),
+      simd::load_unaligned(r_dot_b_squared.data()),
+      simd::load_unaligned(
+          rest_mass_density_times_lorentz_factor_or_default.data()),
+      electron_fraction,
+      simd::load_unaligned(v_0_squared.data()),
+      active,
+      equation_of_state};
+
+  SimdType one_over_specific_enthalpy_times_lorentz_factor{};
+  try {
+    one_over_specific_enthalpy_times_lorentz_factor = RootFinder::toms748(
+        f_of_mu, simd::load_unaligned(lower_bound.data()),
+        simd::load_unaligned(upper_bound.data()), absolute_tolerance_,
+        relative_tolerance_, max_iterations_,
+        simd::load_unaligned(inactive.data()) != 0.0);
+  } catch (std::exception& exception) {
+    // The root finder does not report which point failed, so recover all the
+    // points of the batch pointwise.
+    for (size_t i = 0; i < simd_width; ++i) {
+      if (gsl::at(active, i)) {
+        gsl::at(result, i) = apply<EnforcePhysicality>(
+            0.0, gsl::at(tau_values, i),
+            gsl::at(momentum_density_squared_values, i),
+            gsl::at(momentum_density_dot_magnetic_field_values, i),
+            gsl::at(magnetic_field_squared_values, i),
+            gsl::at(rest_mass_density_times_lorentz_factor_values, i),
+            gsl::at(electron_fraction_values, i), equation_of_state,
+            primitive_from_conservative_options);
+      }
+    }
+    return result;
+  }
+
+  const auto primitives =
+      f_of_mu.primitives(one_over_specific_enthalpy_times_lorentz_factor);
+  const Values rest_mass_density = to_array(primitives.rest_mass_density);
+  const Values lorentz_factor = to_array(primitives.lorentz_factor);
+  const Values pressure = to_array(primitives.pressure);
+  const Values specific_internal_energy =
+      to_array(primitives.specific_internal_energy);
+  const Values mu = to_array(one_over_specific_enthalpy_times_lorentz_factor);
+  for (size_t i = 0; i < simd_width; ++i) {
+    if (gsl::at(active, i)) {
+      gsl::at(result, i) = PrimitiveRecoveryData{
+          gsl::at(rest_mass_density, i),
+          gsl::at(lorentz_factor, i),
+          gsl::at(pressure, i),
+          gsl::at(specific_internal_energy, i),
+          gsl::at(rest_mass_density_times_lorentz_factor_values, i) /
+              gsl::at(mu, i),
+          gsl::at(electron_fraction_values, i)};
+    }
+  }
+  return result;
+}
+#endif
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
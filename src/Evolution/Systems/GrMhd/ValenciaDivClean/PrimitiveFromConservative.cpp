@@ -25,6 +25,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.tpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Parallel/KernelTimings.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
@@ -33,6 +34,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace grmhd::ValenciaDivClean {
@@ -62,6 +64,7 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
           const EquationsOfState::EquationOfState<true, 3>& equation_of_state,
           const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
               primitive_from_conservative_options) {
+  SPECTRE_KERNEL_TIMER("grmhd::ValenciaDivClean::PrimitiveFromConservative");
   return call_with_dynamic_type<
       bool, typename EquationsOfState::detail::DerivedClasses<true, 3>::type>(
       &equation_of_state, [&](const auto* const derived_eos) {
@@ -157,15 +160,57 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
 
   // This may need bounds
   // limit Ye to table bounds once that is implemented
-  for (size_t s = 0; s < number_of_points; ++s) {
+  const auto compute_electron_fraction = [&electron_fraction, &tilde_ye,
+                                          &tilde_d](const size_t s) {
     get(*electron_fraction)[s] =
         std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
+  };
 
+  // Quick exit from inversion in low-density regions where we will
+  // apply atmosphere corrections anyways.
+  const auto is_atmosphere = [&rest_mass_density_times_lorentz_factor,
+                              &cutoffD](const size_t s) {
+    return rest_mass_density_times_lorentz_factor[s] < cutoffD;
+  };
+
+  const auto uses_hydro_optimization = [&magnetic_field_squared,
+                                        &tau](const size_t s) {
+    return use_hydro_optimization and
+           (get(magnetic_field_squared)[s] <
+            100.0 * std::numeric_limits<double>::epsilon() * tau[s]);
+  };
+
+  // Applies the primitive recovery schemes in `Schemes` at point `s` until
+  // one succeeds, unless `primitive_data` already holds a result.
+  const auto apply_schemes =
+      [&pressure, &tau, &momentum_density_squared,
+       &momentum_density_dot_magnetic_field, &magnetic_field_squared,
+       &rest_mass_density_times_lorentz_factor, &equation_of_state,
+       &electron_fraction, &primitive_from_conservative_options](
+          const gsl::not_null<
+              std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>*>
+              primitive_data,
+          const size_t s, auto schemes_v) {
+        using Schemes = tmpl::type_from<decltype(schemes_v)>;
+        tmpl::for_each<Schemes>([&](auto scheme) {
+          using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
+          if (not primitive_data->has_value()) {
+            *primitive_data =
+                primitive_recovery_scheme::template apply<EnforcePhysicality>(
+                    get(*pressure)[s], tau[s], get(momentum_density_squared)[s],
+                    get(momentum_density_dot_magnetic_field)[s],
+                    get(magnetic_field_squared)[s],
+                    rest_mass_density_times_lorentz_factor[s],
+                    get(*electron_fraction)[s], equation_of_state,
+                    primitive_from_conservative_options);
+          }
+        });
+      };
+
+  const auto recover_at_point = [&](const size_t s) {
     std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
         primitive_data = std::nullopt;
-    // Quick exit from inversion in low-density regions where we will
-    // apply atmosphere corrections anyways.
-    if (rest_mass_density_times_lorentz_factor[s] < cutoffD) {
+    if (is_atmosphere(s)) {
       double specific_energy_at_point =
           equation_of_state.specific_internal_energy_lower_bound(
               floorD, get(*electron_fraction)[s]);
@@ -189,84 +234,134 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
           specific_energy_at_point,
           enthalpy_density_at_point,
           get(*electron_fraction)[s]};
+    } else if (uses_hydro_optimization(s)) {
+      // Check consistency
+      apply_schemes(make_not_null(&primitive_data), s,
+                    tmpl::type_<tmpl::list<
+                        PrimitiveRecoverySchemes::KastaunEtAlHydro>>{});
     } else {
       // not in atmosphere.
-      auto apply_scheme = [&pressure, &primitive_data, &tau,
-                           &momentum_density_squared,
-                           &momentum_density_dot_magnetic_field,
-                           &magnetic_field_squared,
-                           &rest_mass_density_times_lorentz_factor,
-                           &equation_of_state, &s, &electron_fraction,
-                           &primitive_from_conservative_options](auto scheme) {
-        using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
-        if (not primitive_data.has_value()) {
-          primitive_data =
-              primitive_recovery_scheme::template apply<EnforcePhysicality>(
-                  get(*pressure)[s], tau[s], get(momentum_density_squared)[s],
-                  get(momentum_density_dot_magnetic_field)[s],
-                  get(magnetic_field_squared)[s],
-                  rest_mass_density_times_lorentz_factor[s],
-                  get(*electron_fraction)[s], equation_of_state,
-                  primitive_from_conservative_options);
+      apply_schemes(make_not_null(&primitive_data), s,
+                    tmpl::type_<OrderedListOfPrimitiveRecoverySchemes>{});
+    }
+    return primitive_data;
+  };
+
+  // Sets the primitives at point `s` from `primitive_data`. Returns `false` if
+  // the recovery failed and `ErrorOnFailure` is `false`.
+  const auto set_primitives =
+      [&](const size_t s,
+          const std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>&
+              primitive_data) {
+        if (primitive_data.has_value()) {
+          get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
+          const double coefficient_of_b =
+              get(momentum_density_dot_magnetic_field)[s] /
+              (primitive_data.value().rho_h_w_squared *
+               (primitive_data.value().rho_h_w_squared +
+                get(magnetic_field_squared)[s]));
+          const double coefficient_of_s =
+              1.0 / (get(sqrt_det_spatial_metric)[s] *
+                     (primitive_data.value().rho_h_w_squared +
+                      get(magnetic_field_squared)[s]));
+          for (size_t i = 0; i < 3; ++i) {
+            spatial_velocity->get(i)[s] =
+                coefficient_of_b * magnetic_field->get(i)[s] +
+                coefficient_of_s * tilde_s_upper.get(i)[s];
+          }
+          get(*lorentz_factor)[s] = primitive_data.value().lorentz_factor;
+          get(*pressure)[s] = primitive_data.value().pressure;
+          if constexpr (not eos_is_barotropic) {
+            get(*specific_internal_energy)[s] =
+                primitive_data.value().specific_internal_energy;
+          }
+          return true;
+        }
+        if constexpr (ErrorOnFailure) {
+          ERROR("All primitive inversion schemes failed at s = "
+                << s << ".\n"
+                << std::setprecision(17) << "tau = " << tau[s] << "\n"
+                << "rest_mass_density_times_lorentz_factor = "
+                << rest_mass_density_times_lorentz_factor[s] << "\n"
+                << "momentum_density_squared = "
+                << get(momentum_density_squared)[s] << "\n"
+                << "momentum_density_dot_magnetic_field = "
+                << get(momentum_density_dot_magnetic_field)[s] << "\n"
+                << "magnetic_field_squared = "
+                << get(magnetic_field_squared)[s] << "\n"
+                << "rest_mass_density_times_lorentz_factor = "
+                << rest_mass_density_times_lorentz_factor[s] << "\n"
+                << "previous_rest_mass_density = "
+                << get(*rest_mass_density)[s] << "\n"
+                << "previous_pressure = " << get(*pressure)[s] << "\n"
+                << "previous_lorentz_factor = " << get(*lorentz_factor)[s]
+                << "\n");
+        } else {
+          return false;
         }
       };
-      // Check consistency
-      if (use_hydro_optimization and
-          (get(magnetic_field_squared)[s] <
-           100.0 * std::numeric_limits<double>::epsilon() * tau[s])) {
-        tmpl::for_each<
-            tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
-                           KastaunEtAlHydro>>(apply_scheme);
-      } else {
-        tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(apply_scheme);
-      }
-    }
 
-    if (primitive_data.has_value()) {
-      get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
-      const double coefficient_of_b =
-          get(momentum_density_dot_magnetic_field)[s] /
-          (primitive_data.value().rho_h_w_squared *
-           (primitive_data.value().rho_h_w_squared +
-            get(magnetic_field_squared)[s]));
-      const double coefficient_of_s =
-          1.0 / (get(sqrt_det_spatial_metric)[s] *
-                 (primitive_data.value().rho_h_w_squared +
-                  get(magnetic_field_squared)[s]));
-      for (size_t i = 0; i < 3; ++i) {
-        spatial_velocity->get(i)[s] =
-            coefficient_of_b * magnetic_field->get(i)[s] +
-            coefficient_of_s * tilde_s_upper.get(i)[s];
+  size_t s = 0;
+#ifdef SPECTRE_USE_XSIMD
+  // When the first scheme is KastaunEtAl, batches of consecutive points that
+  // all need the full recovery are solved simultaneously with the vectorized
+  // scheme. The remaining schemes are only applied pointwise at the points
+  // where it failed.
+  if constexpr (std::is_same_v<
+                    tmpl::front<OrderedListOfPrimitiveRecoverySchemes>,
+                    PrimitiveRecoverySchemes::KastaunEtAl>) {
+    using fallback_schemes =
+        tmpl::pop_front<OrderedListOfPrimitiveRecoverySchemes>;
+    constexpr size_t simd_width =
+        PrimitiveRecoverySchemes::KastaunEtAl::simd_width;
+    const auto batch_is_recoverable = [&is_atmosphere,
+                                       &uses_hydro_optimization](
+                                          const size_t first_point) {
+      for (size_t i = first_point; i < first_point + simd_width; ++i) {
+        if (is_atmosphere(i) or uses_hydro_optimization(i)) {
+          return false;
+        }
       }
-      get(*lorentz_factor)[s] = primitive_data.value().lorentz_factor;
-      get(*pressure)[s] = primitive_data.value().pressure;
-      if constexpr (not eos_is_barotropic) {
-        get(*specific_internal_energy)[s] =
-            primitive_data.value().specific_internal_energy;
+      return true;
+    };
+    while (s + simd_width <= number_of_points) {
+      for (size_t i = s; i < s + simd_width; ++i) {
+        compute_electron_fraction(i);
       }
-    } else {
-      if constexpr (ErrorOnFailure) {
-        ERROR("All primitive inversion schemes failed at s = "
-              << s << ".\n"
-              << std::setprecision(17) << "tau = " << tau[s] << "\n"
-              << "rest_mass_density_times_lorentz_factor = "
-              << rest_mass_density_times_lorentz_factor[s] << "\n"
-              << "momentum_density_squared = "
-              << get(momentum_density_squared)[s] << "\n"
-              << "momentum_density_dot_magnetic_field = "
-              << get(momentum_density_dot_magnetic_field)[s] << "\n"
-              << "magnetic_field_squared = " << get(magnetic_field_squared)[s]
-              << "\n"
-              << "rest_mass_density_times_lorentz_factor = "
-              << rest_mass_density_times_lorentz_factor[s] << "\n"
-              << "previous_rest_mass_density = " << get(*rest_mass_density)[s]
-              << "\n"
-              << "previous_pressure = " << get(*pressure)[s] << "\n"
-              << "previous_lorentz_factor = " << get(*lorentz_factor)[s]
-              << "\n");
-      } else {
-        return false;
+      if (not batch_is_recoverable(s)) {
+        for (size_t i = s; i < s + simd_width; ++i) {
+          if (not set_primitives(i, recover_at_point(i))) {
+            return false;
+          }
+        }
+        s += simd_width;
+        continue;
       }
+      auto batch_primitive_data = PrimitiveRecoverySchemes::KastaunEtAl::apply<
+          EnforcePhysicality>(
+          simd::load_unaligned(&tau[s]),
+          simd::load_unaligned(&get(momentum_density_squared)[s]),
+          simd::load_unaligned(&get(momentum_density_dot_magnetic_field)[s]),
+          simd::load_unaligned(&get(magnetic_field_squared)[s]),
+          simd::load_unaligned(&rest_mass_density_times_lorentz_factor[s]),
+          simd::load_unaligned(&get(*electron_fraction)[s]), equation_of_state,
+          primitive_from_conservative_options);
+      for (size_t i = 0; i < simd_width; ++i) {
+        auto& primitive_data = gsl::at(batch_primitive_data, i);
+        apply_schemes(make_not_null(&primitive_data), s + i,
+                      tmpl::type_<fallback_schemes>{});
+        if (not set_primitives(s + i, primitive_data)) {
+          return false;
+        }
+      }
+      s += simd_width;
+    }
+  }
+#endif
+  for (; s < number_of_points; ++s) {
+    compute_electron_fraction(s);
+    if (not set_primitives(s, recover_at_point(s))) {
+      return false;
     }
   }
   if constexpr (eos_is_barotropic) {
@@ -245,7 +245,7 @@ struct TimeDerivative {
           Variables<dg_package_field_tags> lower_packaged_data{
               reconstructed_num_pts};
 
-          // Compute fluxes on faces
+          // Compute fluxes on faces and package the data
           for (size_t i = 0; i < 3; ++i) {
             // Build extents of mesh shifted by half a grid cell in direction i
             const unsigned long& num_subcells_1d = subcell_mesh.extents(0);
@@ -255,12 +255,7 @@ struct TimeDerivative {
 
             auto& vars_upper_face = gsl::at(package_data_argvars_upper_face, i);
             auto& vars_lower_face = gsl::at(package_data_argvars_lower_face, i);
-            grmhd::ValenciaDivClean::subcell::compute_fluxes(
-                make_not_null(&vars_upper_face));
-            grmhd::ValenciaDivClean::subcell::compute_fluxes(
-                make_not_null(&vars_lower_face));
 
-            // Add moving mesh corrections to the fluxes, if needed
             std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>
                 mesh_velocity_on_face = {};
             if (mesh_velocity_dg.has_value()) {
@@ -276,34 +271,6 @@ struct TimeDerivative {
                         mesh_velocity_dg.value().get(j), dg_mesh,
                         face_mesh_extents, i);
               }
-              tmpl::for_each<evolved_vars_tags>([&vars_upper_face,
-                                                 &vars_lower_face,
-                                                 &mesh_velocity_on_face](
-                                                    auto tag_v) {
-                using tag = tmpl::type_from<decltype(tag_v)>;
-                using flux_tag =
-                    ::Tags::Flux<tag, tmpl::size_t<3>, Frame::Inertial>;
-                using FluxTensor = typename flux_tag::type;
-                const auto& var_upper = get<tag>(vars_upper_face);
-                const auto& var_lower = get<tag>(vars_lower_face);
-                auto& flux_upper = get<flux_tag>(vars_upper_face);
-                auto& flux_lower = get<flux_tag>(vars_lower_face);
-                for (size_t storage_index = 0; storage_index < var_upper.size();
-                     ++storage_index) {
-                  const auto tensor_index =
-                      var_upper.get_tensor_index(storage_index);
-                  for (size_t j = 0; j < 3; j++) {
-                    const auto flux_storage_index =
-                        FluxTensor::get_storage_index(prepend(tensor_index, j));
-                    flux_upper[flux_storage_index] -=
-                        mesh_velocity_on_face.value().get(j) *
-                        var_upper[storage_index];
-                    flux_lower[flux_storage_index] -=
-                        mesh_velocity_on_face.value().get(j) *
-                        var_lower[storage_index];
-                  }
-                }
-              });
             }
 
             // Normal vectors in curved spacetime normalized by inverse
@@ -348,21 +315,59 @@ struct TimeDerivative {
             // the co-vector. Not a huge issue since we'll get an FPE right now
             // if it's used by a Riemann solver.
 
-            // Compute the packaged data
+            // The fluxes on one face are packaged right after they are
+            // computed, while the face data is still in cache, instead of
+            // sweeping over the large face Variables once for each step.
             using dg_package_data_projected_tags = tmpl::append<
                 evolved_vars_tags, fluxes_tags, dg_package_data_temporary_tags,
                 typename DerivedCorrection::dg_package_data_primitive_tags>;
-            evolution::dg::Actions::detail::dg_package_data<System>(
-                make_not_null(&upper_packaged_data), *derived_correction,
-                vars_upper_face, upper_outward_conormal, mesh_velocity_on_face,
-                *box, typename DerivedCorrection::dg_package_data_volume_tags{},
-                dg_package_data_projected_tags{});
-
-            evolution::dg::Actions::detail::dg_package_data<System>(
-                make_not_null(&lower_packaged_data), *derived_correction,
-                vars_lower_face, lower_outward_conormal, mesh_velocity_on_face,
-                *box, typename DerivedCorrection::dg_package_data_volume_tags{},
-                dg_package_data_projected_tags{});
+            const auto compute_fluxes_and_package_data =
+                [&box, &derived_correction, &mesh_velocity_on_face](
+                    const auto packaged_data_ptr, auto& vars_on_face,
+                    const tnsr::i<DataVector, 3, Frame::Inertial>&
+                        outward_conormal) {
+                  grmhd::ValenciaDivClean::subcell::compute_fluxes(
+                      make_not_null(&vars_on_face));
+
+                  // Add moving mesh corrections to the fluxes, if needed
+                  if (mesh_velocity_on_face.has_value()) {
+                    tmpl::for_each<evolved_vars_tags>([&vars_on_face,
+                                                       &mesh_velocity_on_face](
+                                                          auto tag_v) {
+                      using tag = tmpl::type_from<decltype(tag_v)>;
+                      using flux_tag =
+                          ::Tags::Flux<tag, tmpl::size_t<3>, Frame::Inertial>;
+                      using FluxTensor = typename flux_tag::type;
+                      const auto& var = get<tag>(vars_on_face);
+                      auto& flux = get<flux_tag>(vars_on_face);
+                      for (size_t storage_index = 0;
+                           storage_index < var.size(); ++storage_index) {
+                        const auto tensor_index =
+                            var.get_tensor_index(storage_index);
+                        for (size_t j = 0; j < 3; j++) {
+                          const auto flux_storage_index =
+                              FluxTensor::get_storage_index(
+                                  prepend(tensor_index, j));
+                          flux[flux_storage_index] -=
+                              mesh_velocity_on_face.value().get(j) *
+                              var[storage_index];
+                        }
+                      }
+                    });
+                  }
+
+                  evolution::dg::Actions::detail::dg_package_data<System>(
+                      packaged_data_ptr, *derived_correction, vars_on_face,
+                      outward_conormal, mesh_velocity_on_face, *box,
+                      typename DerivedCorrection::dg_package_data_volume_tags{},
+                      dg_package_data_projected_tags{});
+                };
+            compute_fluxes_and_package_data(make_not_null(&upper_packaged_data),
+                                            vars_upper_face,
+                                            upper_outward_conormal);
+            compute_fluxes_and_package_data(make_not_null(&lower_packaged_data),
+                                            vars_lower_face,
+                                            lower_outward_conormal);
 
             // Now need to check if any of our neighbors are doing DG,
             // because if so then we need to use whatever boundary data
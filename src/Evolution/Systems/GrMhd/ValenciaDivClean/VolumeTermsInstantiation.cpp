@@ -36,6 +36,7 @@ template void volume_terms<::grmhd::ValenciaDivClean::TimeDerivativeTerms>(
     const Variables<
         typename ::grmhd::ValenciaDivClean::System::variables_tag::tags_list>&
         evolved_vars,
+    const evolution::dg::Actions::detail::VolumeTermsStage stage,
     const ::dg::Formulation dg_formulation, const Mesh<3>& mesh,
     [[maybe_unused]] const tnsr::I<DataVector, 3, Frame::Inertial>&
         inertial_coordinates,
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <pup.h>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -18,6 +19,8 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace NewtonianEuler::BoundaryCorrections {
 template <size_t Dim>
@@ -194,106 +197,114 @@ void Hllc<Dim>::dg_boundary_terms(
       (lambda_max + get(normal_dot_velocity_ext)) / (lambda_max - lambda_star);
   const DataVector& prefactor_ext = get(get<::Tags::TempScalar<4>>(temps));
 
-  for (size_t i = 0; i < vector_size; ++i) {
-    // check if lambda_star falls in the correct range [lambda_min,lambda_max]
-    ASSERT(
-        (lambda_star[i] <= lambda_max[i]) and (lambda_star[i] >= lambda_min[i]),
-        "lambda_star in HLLC boundary correction is not consistent : "
-            << "\n lambda_min  = " << lambda_min[i] << "\n lambda_*    = "
-            << lambda_star[i] << "\n lambda_max  = " << lambda_max[i]);
-
-    if (dg_formulation == dg::Formulation::WeakInertial) {
-      // Compute intermediate flux F_star (cf. Eq 10.71 - 10.73 of Toro2009)
-      if (lambda_star[i] >= 0.0) {
-        get(*boundary_correction_mass_density)[i] =
-            get(normal_dot_flux_mass_density_int)[i] +
-            lambda_min[i] * (prefactor_int[i] - 1.0) * get(mass_density_int)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              normal_dot_flux_momentum_density_int.get(spatial_index)[i] +
-              lambda_min[i] *
-                  (get(mass_density_int)[i] * prefactor_int[i] *
-                       (lambda_star[i] - get(normal_dot_velocity_int)[i]) *
-                       interface_unit_normal_int.get(spatial_index)[i] +
-                   momentum_density_int.get(spatial_index)[i] *
-                       (prefactor_int[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            get(normal_dot_flux_energy_density_int)[i] +
-            lambda_min[i] *
-                ((prefactor_int[i] - 1.0) *
-                     (get(energy_density_int)[i] + get(pressure_int)[i]) +
-                 prefactor_int[i] * get(mass_density_int)[i] * lambda_star[i] *
-                     (lambda_star[i] - get(normal_dot_velocity_int)[i]));
+  const bool weak_formulation = dg_formulation == dg::Formulation::WeakInertial;
+
+  // The upwind side is chosen per point from the sign of lambda_star, so the
+  // state in the star region is evaluated on both sides and blended with a
+  // mask. This lets the loop run over SIMD batches without branching.
+  const auto hllc_impl = [&](const size_t i, auto use_simd) {
+    using SimdType =
+        tmpl::conditional_t<std::decay_t<decltype(use_simd)>::value,
+                            simd::batch<double>, double>;
+    const auto load = [i](const DataVector& data_vector) -> SimdType {
+      if constexpr (std::is_same_v<SimdType, double>) {
+        return data_vector[i];
       } else {
-        get(*boundary_correction_mass_density)[i] =
-            -get(normal_dot_flux_mass_density_ext)[i] +
-            lambda_max[i] * (prefactor_ext[i] - 1.0) * get(mass_density_ext)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              -normal_dot_flux_momentum_density_ext.get(spatial_index)[i] +
-              lambda_max[i] *
-                  (get(mass_density_ext)[i] * prefactor_ext[i] *
-                       (lambda_star[i] + get(normal_dot_velocity_ext)[i]) *
-                       (-interface_unit_normal_ext.get(spatial_index)[i]) +
-                   momentum_density_ext.get(spatial_index)[i] *
-                       (prefactor_ext[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            -get(normal_dot_flux_energy_density_ext)[i] +
-            lambda_max[i] *
-                ((prefactor_ext[i] - 1.0) *
-                     (get(energy_density_ext)[i] + get(pressure_ext)[i]) +
-                 prefactor_ext[i] * get(mass_density_ext)[i] * lambda_star[i] *
-                     (lambda_star[i] + get(normal_dot_velocity_ext)[i]));
+        return simd::load_unaligned(&data_vector[i]);
       }
-    } else {
-      // Compute boundary correction for strong formulation
-      if (lambda_star[i] >= 0.0) {
-        get(*boundary_correction_mass_density)[i] =
-            lambda_min[i] * (prefactor_int[i] - 1.0) * get(mass_density_int)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              lambda_min[i] *
-              (get(mass_density_int)[i] * prefactor_int[i] *
-                   (lambda_star[i] - get(normal_dot_velocity_int)[i]) *
-                   interface_unit_normal_int.get(spatial_index)[i] +
-               momentum_density_int.get(spatial_index)[i] *
-                   (prefactor_int[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            lambda_min[i] *
-            ((prefactor_int[i] - 1.0) *
-                 (get(energy_density_int)[i] + get(pressure_int)[i]) +
-             prefactor_int[i] * get(mass_density_int)[i] * lambda_star[i] *
-                 (lambda_star[i] - get(normal_dot_velocity_int)[i]));
+    };
+    const auto store = [i](const gsl::not_null<DataVector*> data_vector,
+                           const SimdType& value) {
+      if constexpr (std::is_same_v<SimdType, double>) {
+        (*data_vector)[i] = value;
       } else {
-        get(*boundary_correction_mass_density)[i] =
-            -get(normal_dot_flux_mass_density_int)[i] -
-            get(normal_dot_flux_mass_density_ext)[i] +
-            lambda_max[i] * (prefactor_ext[i] - 1.0) * get(mass_density_ext)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              -normal_dot_flux_momentum_density_int.get(spatial_index)[i] -
-              normal_dot_flux_momentum_density_ext.get(spatial_index)[i] +
-              lambda_max[i] *
-                  (get(mass_density_ext)[i] * prefactor_ext[i] *
-                       (lambda_star[i] + get(normal_dot_velocity_ext)[i]) *
-                       (-interface_unit_normal_ext.get(spatial_index)[i]) +
-                   momentum_density_ext.get(spatial_index)[i] *
-                       (prefactor_ext[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            -get(normal_dot_flux_energy_density_int)[i] -
-            get(normal_dot_flux_energy_density_ext)[i] +
-            lambda_max[i] *
-                ((prefactor_ext[i] - 1.0) *
-                     (get(energy_density_ext)[i] + get(pressure_ext)[i]) +
-                 prefactor_ext[i] * get(mass_density_ext)[i] * lambda_star[i] *
-                     (lambda_star[i] + get(normal_dot_velocity_ext)[i]));
+        simd::store_unaligned(&(*data_vector)[i], value);
+      }
+    };
+
+    const SimdType l_min = load(lambda_min);
+    const SimdType l_max = load(lambda_max);
+    const SimdType l_star = load(lambda_star);
+    // check if lambda_star falls in the correct range [lambda_min,lambda_max]
+    ASSERT(simd::all(l_star <= l_max) and simd::all(l_star >= l_min),
+           "lambda_star in HLLC boundary correction is not consistent : "
+               << "\n lambda_min  = " << l_min << "\n lambda_*    = "
+               << l_star << "\n lambda_max  = " << l_max);
+    const auto use_interior = l_star >= 0.0;
+
+    // Compute intermediate flux F_star (cf. Eq 10.71 - 10.73 of Toro2009).
+    // For the strong formulation the interior normal flux is subtracted.
+    const auto correction = [&use_interior, &weak_formulation](
+                                const SimdType& flux_int,
+                                const SimdType& correction_int,
+                                const SimdType& correction_ext) -> SimdType {
+      if (weak_formulation) {
+        return simd::select(use_interior, flux_int + correction_int,
+                            correction_ext);
       }
+      return simd::select(use_interior, correction_int,
+                          correction_ext - flux_int);
+    };
+
+    const SimdType rho_int = load(get(mass_density_int));
+    const SimdType rho_ext = load(get(mass_density_ext));
+    const SimdType v_n_int = load(get(normal_dot_velocity_int));
+    const SimdType v_n_ext = load(get(normal_dot_velocity_ext));
+    const SimdType pre_int_minus_one = load(prefactor_int) - 1.0;
+    const SimdType pre_ext_minus_one = load(prefactor_ext) - 1.0;
+    const SimdType rho_pre_int = rho_int * load(prefactor_int);
+    const SimdType rho_pre_ext = rho_ext * load(prefactor_ext);
+
+    store(make_not_null(&get(*boundary_correction_mass_density)),
+          correction(load(get(normal_dot_flux_mass_density_int)),
+                     l_min * pre_int_minus_one * rho_int,
+                     -load(get(normal_dot_flux_mass_density_ext)) +
+                         l_max * pre_ext_minus_one * rho_ext));
+    for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
+      store(
+          make_not_null(&boundary_correction_momentum_density->get(
+              spatial_index)),
+          correction(
+              load(normal_dot_flux_momentum_density_int.get(spatial_index)),
+              l_min * (rho_pre_int * (l_star - v_n_int) *
+                           load(interface_unit_normal_int.get(spatial_index)) +
+                       load(momentum_density_int.get(spatial_index)) *
+                           pre_int_minus_one),
+              -load(normal_dot_flux_momentum_density_ext.get(spatial_index)) +
+                  l_max *
+                      (rho_pre_ext * (l_star + v_n_ext) *
+                           (-load(interface_unit_normal_ext.get(
+                               spatial_index))) +
+                       load(momentum_density_ext.get(spatial_index)) *
+                           pre_ext_minus_one)));
     }
+    store(make_not_null(&get(*boundary_correction_energy_density)),
+          correction(
+              load(get(normal_dot_flux_energy_density_int)),
+              l_min * (pre_int_minus_one * (load(get(energy_density_int)) +
+                                            load(get(pressure_int))) +
+                       rho_pre_int * l_star * (l_star - v_n_int)),
+              -load(get(normal_dot_flux_energy_density_ext)) +
+                  l_max *
+                      (pre_ext_minus_one * (load(get(energy_density_ext)) +
+                                            load(get(pressure_ext))) +
+                       rho_pre_ext * l_star * (l_star + v_n_ext))));
+  };
+
+#ifdef SPECTRE_USE_XSIMD
+  constexpr size_t simd_width = simd::size<simd::batch<double>>();
+  const size_t vectorized_size = vector_size - vector_size % simd_width;
+  for (size_t i = 0; i < vectorized_size; i += simd_width) {
+    hllc_impl(i, std::true_type{});
+  }
+  for (size_t i = vectorized_size; i < vector_size; ++i) {
+    hllc_impl(i, std::false_type{});
+  }
+#else
+  for (size_t i = 0; i < vector_size; ++i) {
+    hllc_impl(i, std::false_type{});
   }
+#endif
 }
 
 template <size_t Dim>
@@ -61,6 +61,9 @@ void compute_closure_impl(
   constexpr size_t spatial_dim = 3;
   // Tolerance used in the rootfinding used to find the closure factor
   constexpr double root_find_tolerance = 1.e-6;
+  // Half width of the bracket around the previous closure factor that is
+  // tried first in the root find
+  constexpr double warm_start_half_width = 0.02;
   Variables<
       tmpl::list<hydro::Tags::LorentzFactorSquared<DataVector>, MomentumSquared,
                  MomentumUp, hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
@@ -208,13 +211,45 @@ void compute_closure_impl(
           };
       // To avoid failures in the root find at the boundary of
       // the allowed domain for zeta, test the edge values first.
-      if (fabs(zeta_j_sqr_minus_h_sqr(0.)) < root_find_tolerance) {
+      const double f_at_zero = zeta_j_sqr_minus_h_sqr(0.);
+      const double f_at_one = zeta_j_sqr_minus_h_sqr(1.);
+      if (fabs(f_at_zero) < root_find_tolerance) {
         get(*closure_factor)[s] = 0.;
-      } else if (fabs(zeta_j_sqr_minus_h_sqr(1.)) < root_find_tolerance) {
+      } else if (fabs(f_at_one) < root_find_tolerance) {
         get(*closure_factor)[s] = 1.;
       } else {
+        // The closure factor changes little between steps, so the root is
+        // bracketed in a small interval around its previous value if that is
+        // available. The bracket is only narrowed where the function changes
+        // sign, so a poor (or uninitialized) previous value just leaves the
+        // full interval.
+        double lower = 1.e-15;
+        double upper = 1.;
+        double f_at_lower = f_at_zero;
+        double f_at_upper = f_at_one;
+        const double previous_zeta = get(*closure_factor)[s];
+        if (previous_zeta > lower + warm_start_half_width and
+            previous_zeta < upper - warm_start_half_width) {
+          const double guess_lower = previous_zeta - warm_start_half_width;
+          const double guess_upper = previous_zeta + warm_start_half_width;
+          const double f_at_guess_lower = zeta_j_sqr_minus_h_sqr(guess_lower);
+          const double f_at_guess_upper = zeta_j_sqr_minus_h_sqr(guess_upper);
+          if (f_at_lower * f_at_guess_lower <= 0.) {
+            upper = guess_lower;
+            f_at_upper = f_at_guess_lower;
+          } else if (f_at_guess_lower * f_at_guess_upper <= 0.) {
+            lower = guess_lower;
+            f_at_lower = f_at_guess_lower;
+            upper = guess_upper;
+            f_at_upper = f_at_guess_upper;
+          } else {
+            lower = guess_upper;
+            f_at_lower = f_at_guess_upper;
+          }
+        }
         get(*closure_factor)[s] = RootFinder::toms748(
-            zeta_j_sqr_minus_h_sqr, 1.e-15, 1., root_find_tolerance, 1.0e-15);
+            zeta_j_sqr_minus_h_sqr, lower, upper, f_at_lower, f_at_upper,
+            root_find_tolerance, 1.0e-15);
       }
       const double& zeta = get(*closure_factor)[s];
 
@@ -37,6 +37,7 @@ namespace evolution::dg::Actions::detail {
           div_fluxes,                                                          \
       const Variables<typename SYSTEM(data)::variables_tag::tags_list>&        \
           evolved_vars,                                                        \
+      const evolution::dg::Actions::detail::VolumeTermsStage stage,            \
       const ::dg::Formulation dg_formulation, const Mesh<DIM(data)>& mesh,     \
       [[maybe_unused]] const tnsr::I<DataVector, DIM(data), Frame::Inertial>&  \
           inertial_coordinates,                                                \
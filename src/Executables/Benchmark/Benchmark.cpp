@@ -5,12 +5,27 @@
 #pragma GCC diagnostic ignored "-Wredundant-decls"
 #include <benchmark/benchmark.h>
 #pragma GCC diagnostic pop
+#include <array>
+#include <atomic>
 #include <charm++.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <random>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
@@ -18,54 +33,93 @@
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/TimeDerivativeTerms.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
-#include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/StepperErrorTolerances.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/Factory.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
 extern "C" void CkRegisterMainModule(void) {}
 
-// This file is an example of how to do microbenchmark with Google Benchmark
-// https://github.com/google/benchmark
-// For two examples in different anonymous namespaces
+// This file holds microbenchmarks of the kernels that dominate the cost of a
+// DG evolution, using Google Benchmark (https://github.com/google/benchmark).
+// Each benchmark is parameterized by the number of grid points per dimension,
+// and most are instantiated for one, two and three dimensions. Every benchmark
+// reports the number of grid points processed per second as `items_per_second`
+// so that results for different extents can be compared directly.
+//
+// Run the `run-benchmark` target to write the results to a JSON file that can
+// be compared between commits, e.g. with Google Benchmark's `compare.py`.
 
 namespace {
-// Benchmark of push_back() in std::vector, following Chandler Carruth's talk
-// at CppCon in 2015,
-// https://www.youtube.com/watch?v=nXaxk27zwlk
-
-// void bench_create(benchmark::State &state) {
-//  while (state.KeepRunning()) {
-//    std::vector<int> v;
-//    benchmark::DoNotOptimize(&v);
-//    static_cast<void>(v);
-//  }
-// }
-// BENCHMARK(bench_create);
-
-// void bench_reserve(benchmark::State &state) {
-//  while (state.KeepRunning()) {
-//    std::vector<int> v;
-//    v.reserve(1);
-//    benchmark::DoNotOptimize(v.data());
-//  }
-// }
-// BENCHMARK(bench_reserve);
-
-// void bench_push_back(benchmark::State &state) {
-//  while (state.KeepRunning()) {
-//    std::vector<int> v;
-//    v.reserve(1);
-//    benchmark::DoNotOptimize(v.data());
-//    v.push_back(42);
-//    benchmark::ClobberMemory();
-//  }
-// }
-// BENCHMARK(bench_push_back);
+// The range of grid points per dimension that the benchmarks are run over
+constexpr int min_extent = 4;
+constexpr int max_extent = 16;
+constexpr int extent_step = 2;
+
+template <size_t Dim>
+Mesh<Dim> benchmark_mesh(const benchmark::State& state) {
+  return {static_cast<size_t>(state.range(0)), Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+template <size_t Dim>
+void set_points_processed(const gsl::not_null<benchmark::State*> state,
+                          const Mesh<Dim>& mesh) {
+  state->SetItemsProcessed(static_cast<int64_t>(state->iterations()) *
+                           static_cast<int64_t>(mesh.number_of_grid_points()));
+}
+
+template <size_t Dim>
+InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+affine_inverse_jacobian(const Mesh<Dim>& mesh) {
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      inv_jac{mesh.number_of_grid_points(), 0.0};
+  for (size_t d = 0; d < Dim; ++d) {
+    inv_jac.get(d, d) = 2.0;
+  }
+  return inv_jac;
+}
+
+template <typename... Tags>
+auto pointers_to(const gsl::not_null<Variables<tmpl::list<Tags...>>*> vars) {
+  return std::make_tuple(make_not_null(&get<Tags>(*vars))...);
+}
+
+template <typename... Tags>
+auto references_to(const Variables<tmpl::list<Tags...>>& vars) {
+  return std::forward_as_tuple(get<Tags>(vars)...);
+}
 }  // namespace
 
 namespace {
@@ -108,6 +162,488 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
 BENCHMARK(bench_all_gradient);  // NOLINT
 }  // namespace
 
+namespace {
+// Benchmarks of the linear operators applied to the evolved variables of the
+// GH system, which is the largest set of variables we commonly evolve.
+template <size_t Dim>
+using gh_variables_tags =
+    tmpl::list<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+               gh::Tags::Pi<DataVector, Dim>, gh::Tags::Phi<DataVector, Dim>>;
+
+template <size_t Dim>
+void bench_partial_derivatives(benchmark::State& state) {  // NOLINT
+  const auto mesh = benchmark_mesh<Dim>(state);
+  const auto inv_jac = affine_inverse_jacobian(mesh);
+  Variables<gh_variables_tags<Dim>> vars(mesh.number_of_grid_points(), 1.0);
+  Variables<db::wrap_tags_in<::Tags::deriv, gh_variables_tags<Dim>,
+                             tmpl::size_t<Dim>, Frame::Inertial>>
+      derivs(mesh.number_of_grid_points());
+
+  for (auto _ : state) {
+    partial_derivatives(make_not_null(&derivs), vars, mesh, inv_jac);
+    benchmark::DoNotOptimize(derivs.data());
+    benchmark::ClobberMemory();
+  }
+  set_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 1)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 2)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 3)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+
+// Projects the variables to a mesh with one more grid point per dimension, as
+// is done for p-refinement and for p-nonconforming mortars.
+template <size_t Dim>
+void bench_apply_matrices(benchmark::State& state) {  // NOLINT
+  const auto mesh = benchmark_mesh<Dim>(state);
+  const Mesh<Dim> target_mesh{mesh.extents(0) + 1, mesh.basis(0),
+                              mesh.quadrature(0)};
+  const auto matrices = Spectral::p_projection_matrices(mesh, target_mesh);
+  Variables<gh_variables_tags<Dim>> vars(mesh.number_of_grid_points(), 1.0);
+  Variables<gh_variables_tags<Dim>> result(
+      target_mesh.number_of_grid_points());
+
+  for (auto _ : state) {
+    apply_matrices(make_not_null(&result), matrices, vars, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  set_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK_TEMPLATE(bench_apply_matrices, 1)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_apply_matrices, 2)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_apply_matrices, 3)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+
+// Lifts the boundary correction on a single face of the element. The number
+// of points processed is the number of face points.
+template <size_t Dim>
+void bench_lift_flux(benchmark::State& state) {  // NOLINT
+  const auto mesh = benchmark_mesh<Dim>(state);
+  const auto face_mesh = mesh.slice_away(0);
+  const Scalar<DataVector> magnitude_of_face_normal{
+      face_mesh.number_of_grid_points(), 1.0};
+  Variables<gh_variables_tags<Dim>> boundary_corrections(
+      face_mesh.number_of_grid_points(), 1.0);
+
+  for (auto _ : state) {
+    dg::lift_flux(make_not_null(&boundary_corrections), mesh.extents(0),
+                  magnitude_of_face_normal);
+    benchmark::DoNotOptimize(boundary_corrections.data());
+    benchmark::ClobberMemory();
+  }
+  set_points_processed(make_not_null(&state), face_mesh);
+}
+BENCHMARK_TEMPLATE(bench_lift_flux, 1)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_lift_flux, 2)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_lift_flux, 3)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+}  // namespace
+
+namespace {
+// Benchmark of the GH volume time derivative on a flat spacetime with
+// damped harmonic gauge, excluding the partial derivatives.
+template <size_t Dim>
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  const auto mesh = benchmark_mesh<Dim>(state);
+  const size_t num_points = mesh.number_of_grid_points();
+  const auto inv_jac = affine_inverse_jacobian(mesh);
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
+  for (size_t d = 0; d < Dim; ++d) {
+    inertial_coords.get(d) = 10.0 * logical_coords.get(d);
+  }
+  const gh::gauges::DampedHarmonic gauge_condition{
+      100., std::array{1.2, 1.5, 1.7}, std::array{2, 4, 6}};
+
+  Variables<gh_variables_tags<Dim>> vars(num_points, 0.01);
+  auto& spacetime_metric =
+      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(vars);
+  get<0, 0>(spacetime_metric) = -1.0;
+  for (size_t i = 0; i < Dim; ++i) {
+    spacetime_metric.get(i + 1, i + 1) = 1.0;
+  }
+  Variables<db::wrap_tags_in<::Tags::deriv, gh_variables_tags<Dim>,
+                             tmpl::size_t<Dim>, Frame::Inertial>>
+      derivs(num_points, 0.01);
+  const Scalar<DataVector> gamma0{num_points, 1.0};
+  const Scalar<DataVector> gamma1{num_points, -1.0};
+  const Scalar<DataVector> gamma2{num_points, 1.0};
+
+  Variables<db::wrap_tags_in<::Tags::dt, gh_variables_tags<Dim>>> dt_vars(
+      num_points);
+  Variables<typename gh::TimeDerivative<Dim>::temporary_tags> temporaries(
+      num_points);
+
+  for (auto _ : state) {
+    std::apply(
+        [](const auto&... args) { gh::TimeDerivative<Dim>::apply(args...); },
+        std::tuple_cat(
+            pointers_to(make_not_null(&dt_vars)),
+            pointers_to(make_not_null(&temporaries)), references_to(derivs),
+            references_to(vars),
+            std::forward_as_tuple(gamma0, gamma1, gamma2, gauge_condition,
+                                  mesh, 0.0, inertial_coords, inv_jac,
+                                  std::nullopt)));
+    benchmark::DoNotOptimize(dt_vars.data());
+    benchmark::ClobberMemory();
+  }
+  set_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK_TEMPLATE(bench_gh_time_derivative, 1)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_gh_time_derivative, 2)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_gh_time_derivative, 3)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+
+// Benchmark of the ValenciaDivClean volume fluxes and sources for a fluid at
+// rest in flat space.
+void bench_valencia_time_derivative(benchmark::State& state) {  // NOLINT
+  namespace ValenciaDivClean = grmhd::ValenciaDivClean;
+  using TimeDerivativeTerms = ValenciaDivClean::TimeDerivativeTerms;
+  using evolved_tags =
+      tmpl::list<ValenciaDivClean::Tags::TildeD,
+                 ValenciaDivClean::Tags::TildeYe,
+                 ValenciaDivClean::Tags::TildeTau,
+                 ValenciaDivClean::Tags::TildeS<>,
+                 ValenciaDivClean::Tags::TildeB<>,
+                 ValenciaDivClean::Tags::TildePhi>;
+  using argument_tensor_tags =
+      tmpl::remove<typename TimeDerivativeTerms::argument_tags,
+                   ValenciaDivClean::Tags::ConstraintDampingParameter>;
+
+  const auto mesh = benchmark_mesh<3>(state);
+  const size_t num_points = mesh.number_of_grid_points();
+
+  Variables<argument_tensor_tags> arguments(num_points, 0.0);
+  get(get<gr::Tags::Lapse<DataVector>>(arguments)) = 1.0;
+  get(get<gr::Tags::SqrtDetSpatialMetric<DataVector>>(arguments)) = 1.0;
+  get(get<hydro::Tags::LorentzFactor<DataVector>>(arguments)) = 1.0;
+  get(get<hydro::Tags::RestMassDensity<DataVector>>(arguments)) = 1.0e-3;
+  get(get<hydro::Tags::ElectronFraction<DataVector>>(arguments)) = 0.1;
+  get(get<hydro::Tags::SpecificInternalEnergy<DataVector>>(arguments)) = 0.1;
+  get(get<hydro::Tags::Pressure<DataVector>>(arguments)) = 1.0e-4;
+  get(get<ValenciaDivClean::Tags::TildeD>(arguments)) = 1.0e-3;
+  get(get<ValenciaDivClean::Tags::TildeYe>(arguments)) = 1.0e-4;
+  get(get<ValenciaDivClean::Tags::TildeTau>(arguments)) = 1.0e-4;
+  for (size_t i = 0; i < 3; ++i) {
+    get<gr::Tags::SpatialMetric<DataVector, 3>>(arguments).get(i, i) = 1.0;
+    get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(arguments).get(i, i) =
+        1.0;
+    get<hydro::Tags::MagneticField<DataVector, 3>>(arguments).get(i) = 1.0e-3;
+    get<ValenciaDivClean::Tags::TildeB<>>(arguments).get(i) = 1.0e-3;
+  }
+
+  Variables<db::wrap_tags_in<::Tags::dt, evolved_tags>> dt_vars(num_points);
+  Variables<db::wrap_tags_in<::Tags::Flux, evolved_tags, tmpl::size_t<3>,
+                             Frame::Inertial>>
+      fluxes(num_points);
+  Variables<typename TimeDerivativeTerms::temporary_tags> temporaries(
+      num_points);
+
+  for (auto _ : state) {
+    std::apply(
+        [](const auto&... args) { TimeDerivativeTerms::apply(args...); },
+        std::tuple_cat(pointers_to(make_not_null(&dt_vars)),
+                       pointers_to(make_not_null(&fluxes)),
+                       pointers_to(make_not_null(&temporaries)),
+                       references_to(arguments), std::make_tuple(0.0)));
+    benchmark::DoNotOptimize(dt_vars.data());
+    benchmark::DoNotOptimize(fluxes.data());
+    benchmark::ClobberMemory();
+  }
+  set_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_valencia_time_derivative)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+}  // namespace
+
+namespace {
+// Benchmarks of Tabulated3D lookups on a synthetic table with the
+// resolution of a typical nuclear EOS table. The points are distributed
+// randomly over the table so the access pattern is representative of a
+// volume with large gradients.
+constexpr size_t table_points_per_dim = 64;
+
+const EquationsOfState::Tabulated3D<true>& benchmark_tabulated_eos() {
+  using Eos = EquationsOfState::Tabulated3D<true>;
+  static const Eos eos = []() {
+    const std::array<double, 3> lower_bounds{
+        {-3.0 * std::log(10.0), -12.0 * std::log(10.0), 0.01}};
+    const std::array<double, 3> upper_bounds{
+        {2.0 * std::log(10.0), -2.0 * std::log(10.0), 0.55}};
+    std::array<std::vector<double>, 3> coords{};
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(coords, d).resize(table_points_per_dim);
+      for (size_t i = 0; i < table_points_per_dim; ++i) {
+        gsl::at(coords, d)[i] =
+            gsl::at(lower_bounds, d) +
+            static_cast<double>(i) *
+                (gsl::at(upper_bounds, d) - gsl::at(lower_bounds, d)) /
+                static_cast<double>(table_points_per_dim - 1);
+      }
+    }
+    // Index ordering is (log T, log rho, Y_e) with log T varying fastest
+    std::vector<double> table_data(cube(table_points_per_dim) *
+                                   Eos::NumberOfVars);
+    for (size_t k = 0; k < table_points_per_dim; ++k) {
+      for (size_t j = 0; j < table_points_per_dim; ++j) {
+        for (size_t i = 0; i < table_points_per_dim; ++i) {
+          const size_t offset =
+              Eos::NumberOfVars *
+              (i + table_points_per_dim * (j + table_points_per_dim * k));
+          table_data[offset + Eos::Epsilon] = coords[0][i];
+          table_data[offset + Eos::Pressure] = coords[0][i] + coords[1][j];
+          table_data[offset + Eos::CsSquared] = 0.1 * coords[2][k];
+          table_data[offset + Eos::DeltaMu] = 0.0;
+        }
+      }
+    }
+    return Eos{coords[2], coords[1], coords[0], std::move(table_data), 0.0,
+               1.0};
+  }();
+  return eos;
+}
+
+void bench_tabulated3d_lookup(benchmark::State& state) {  // NOLINT
+  const auto& eos = benchmark_tabulated_eos();
+  const auto mesh = benchmark_mesh<3>(state);
+  const size_t num_points = mesh.number_of_grid_points();
+
+  std::mt19937 generator{42};
+  const auto random_scalar = [&generator, &num_points](const double lower,
+                                                       const double upper,
+                                                       const bool log_scale) {
+    std::uniform_real_distribution<> distribution(
+        log_scale ? std::log(lower) : lower,
+        log_scale ? std::log(upper) : upper);
+    Scalar<DataVector> result{num_points};
+    for (double& value : get(result)) {
+      value = distribution(generator);
+      if (log_scale) {
+        value = std::exp(value);
+      }
+    }
+    return result;
+  };
+  const auto rest_mass_density =
+      random_scalar(1.1 * eos.rest_mass_density_lower_bound(),
+                    0.9 * eos.rest_mass_density_upper_bound(), true);
+  const auto temperature = random_scalar(1.1 * eos.temperature_lower_bound(),
+                                         0.9 * eos.temperature_upper_bound(),
+                                         true);
+  const auto electron_fraction =
+      random_scalar(eos.electron_fraction_lower_bound() + 0.01,
+                    eos.electron_fraction_upper_bound() - 0.01, false);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(eos.pressure_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction));
+    benchmark::DoNotOptimize(
+        eos.specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+    benchmark::DoNotOptimize(
+        eos.sound_speed_squared_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+  }
+  set_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_tabulated3d_lookup)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+}  // namespace
+
+namespace {
+// Benchmarks of the per-message cost of the boundary communication between
+// neighboring elements, excluding the runtime system itself. Each message
+// holds the boundary correction data of the GH system on one face. A message
+// sent off-node is serialized and deserialized, and every received message is
+// inserted into the inbox of the element: the `std::map` inbox of the
+// `DgElementArray`, or the SPSC queues of the nodegroup `DgElementCollection`.
+// These benchmarks report the number of messages processed per second.
+template <size_t Dim>
+std::vector<std::pair<DirectionalId<Dim>, evolution::dg::BoundaryData<Dim>>>
+benchmark_boundary_messages(const benchmark::State& state) {
+  const auto face_mesh = benchmark_mesh<Dim>(state).slice_away(0);
+  std::vector<std::pair<DirectionalId<Dim>, evolution::dg::BoundaryData<Dim>>>
+      messages{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    evolution::dg::BoundaryData<Dim> data{};
+    data.interface_mesh = face_mesh;
+    data.boundary_correction_data = DataVector{
+        Variables<gh_variables_tags<Dim>>::number_of_independent_components *
+            face_mesh.number_of_grid_points(),
+        1.0};
+    data.integration_order = 3;
+    messages.emplace_back(DirectionalId<Dim>{direction, ElementId<Dim>{0}},
+                          std::move(data));
+  }
+  return messages;
+}
+
+template <size_t Dim>
+void bench_boundary_data_serialization(benchmark::State& state) {  // NOLINT
+  using BoundaryData = evolution::dg::BoundaryData<Dim>;
+  const BoundaryData data =
+      std::move(benchmark_boundary_messages<Dim>(state).front().second);
+  const size_t message_size = serialize<BoundaryData>(data).size();
+
+  for (auto _ : state) {
+    const std::vector<char> buffer = serialize<BoundaryData>(data);
+    benchmark::DoNotOptimize(deserialize<BoundaryData>(buffer.data()));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(message_size));
+}
+BENCHMARK_TEMPLATE(bench_boundary_data_serialization, 1)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_boundary_data_serialization, 2)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+BENCHMARK_TEMPLATE(bench_boundary_data_serialization, 3)  // NOLINT
+    ->DenseRange(min_extent, max_extent, extent_step);
+
+// Receives one message from every neighbor and then takes the data out of the
+// inbox, as the element does once all neighbors have sent their data.
+template <size_t Dim>
+void bench_boundary_inbox_element_array(benchmark::State& state) {  // NOLINT
+  using Inbox = evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>;
+  auto messages = benchmark_boundary_messages<Dim>(state);
+  const TimeStepId time_step_id{true, 0, Slab{0.0, 1.0}.start()};
+  typename Inbox::type_map inbox{};
+
+  for (auto _ : state) {
+    for (auto& message : messages) {
+      Inbox::insert_into_inbox(make_not_null(&inbox), time_step_id,
+                               std::move(message));
+    }
+    auto& received = inbox.at(time_step_id);
+    for (auto& [neighbor_id, data] : messages) {
+      data = std::move(received.at(neighbor_id));
+    }
+    inbox.erase(time_step_id);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(messages.size()));
+}
+BENCHMARK_TEMPLATE(bench_boundary_inbox_element_array, 1)  // NOLINT
+    ->Arg(max_extent);
+BENCHMARK_TEMPLATE(bench_boundary_inbox_element_array, 2)  // NOLINT
+    ->Arg(max_extent);
+BENCHMARK_TEMPLATE(bench_boundary_inbox_element_array, 3)  // NOLINT
+    ->Arg(max_extent);
+
+template <size_t Dim>
+void bench_boundary_inbox_element_collection(
+    benchmark::State& state) {  // NOLINT
+  using Inbox = evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>;
+  auto messages = benchmark_boundary_messages<Dim>(state);
+  const TimeStepId time_step_id{true, 0, Slab{0.0, 1.0}.start()};
+  typename Inbox::type_spsc inbox{};
+
+  for (auto _ : state) {
+    for (auto& message : messages) {
+      Inbox::insert_into_inbox(make_not_null(&inbox), time_step_id,
+                               std::move(message));
+    }
+    for (auto& [neighbor_id, data] : messages) {
+      auto& queue = gsl::at(inbox.boundary_data_in_directions,
+                            Inbox::type_spsc::index(neighbor_id));
+      data = std::move(std::get<1>(*queue.front()));
+      queue.pop();
+    }
+    inbox.message_count.store(0, std::memory_order_release);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(messages.size()));
+}
+BENCHMARK_TEMPLATE(bench_boundary_inbox_element_collection, 1)  // NOLINT
+    ->Arg(max_extent);
+BENCHMARK_TEMPLATE(bench_boundary_inbox_element_collection, 2)  // NOLINT
+    ->Arg(max_extent);
+BENCHMARK_TEMPLATE(bench_boundary_inbox_element_collection, 3)  // NOLINT
+    ->Arg(max_extent);
+}  // namespace
+
+namespace {
+// Benchmarks of taking a full step, including all substeps, with each of the
+// time steppers in the factory. The evolved variables have the size of the
+// GH variables on a 3D element, and the number of points processed is the
+// number of grid points of the element. Error estimation is benchmarked
+// separately since it can change the number of substeps.
+template <typename Stepper, bool EstimateError>
+void bench_time_stepper_step(benchmark::State& state) {  // NOLINT
+  const auto mesh = benchmark_mesh<3>(state);
+  const size_t size =
+      Variables<gh_variables_tags<3>>::number_of_independent_components *
+      mesh.number_of_grid_points();
+  const Stepper stepper{};
+  const StepperErrorTolerances tolerances{.absolute = 1.0e-8,
+                                          .relative = 1.0e-8};
+
+  DataVector u{size, 1.0};
+  const DataVector du{size, 1.0e-3};
+  TimeSteppers::History<DataVector> history{stepper.order()};
+  // Multistep methods need the values from the previous steps, which we take
+  // to be one slab long each.
+  for (size_t j = 1; j <= stepper.number_of_past_steps(); ++j) {
+    const Slab past_slab{-static_cast<double>(j),
+                         1.0 - static_cast<double>(j)};
+    history.insert_initial(
+        TimeStepId{true, -static_cast<int64_t>(j), past_slab.start()}, u, du);
+  }
+
+  Slab slab{0.0, 1.0};
+  int64_t slab_number = 0;
+  const uint64_t number_of_substeps =
+      EstimateError ? stepper.number_of_substeps_for_error()
+                    : stepper.number_of_substeps();
+  for (auto _ : state) {
+    const TimeDelta step_size = slab.duration();
+    TimeStepId time_id{true, slab_number, slab.start()};
+    for (uint64_t substep = 0; substep < number_of_substeps; ++substep) {
+      history.insert(time_id, u, du);
+      if constexpr (EstimateError) {
+        benchmark::DoNotOptimize(stepper.update_u(make_not_null(&u), history,
+                                                  step_size, tolerances));
+        time_id = stepper.next_time_id_for_error(time_id, step_size);
+      } else {
+        stepper.update_u(make_not_null(&u), history, step_size);
+        time_id = stepper.next_time_id(time_id, step_size);
+      }
+      stepper.clean_history(make_not_null(&history));
+    }
+    benchmark::DoNotOptimize(u.data());
+    benchmark::ClobberMemory();
+    slab = slab.advance();
+    ++slab_number;
+  }
+  set_points_processed(make_not_null(&state), mesh);
+}
+
+[[maybe_unused]] const bool time_stepper_benchmarks_registered = []() {
+  tmpl::for_each<TimeSteppers::time_steppers>([](auto stepper_v) {
+    using Stepper = tmpl::type_from<decltype(stepper_v)>;
+    const std::string name = pretty_type::name<Stepper>();
+    benchmark::RegisterBenchmark(
+        ("bench_time_stepper_step<" + name + ">").c_str(),
+        bench_time_stepper_step<Stepper, false>)
+        ->DenseRange(min_extent, max_extent, extent_step);
+    benchmark::RegisterBenchmark(
+        ("bench_time_stepper_step_with_error<" + name + ">").c_str(),
+        bench_time_stepper_step<Stepper, true>)
+        ->DenseRange(min_extent, max_extent, extent_step);
+  });
+  return true;
+}();
+}  // namespace
+
 // Ignore the warning about an extra ';' because some versions of benchmark
 // require it
 #pragma GCC diagnostic push
@@ -3,13 +3,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <optional>
 #include <pup.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Creators/Factory1D.hpp"
 #include "Domain/Creators/Factory2D.hpp"
 #include "Domain/Creators/Factory3D.hpp"
@@ -107,6 +113,38 @@ struct MinGridSpacingFormatter
   void pup(PUP::er& /*p*/) {}
 };
 
+using JacobianQualityReductionData = Parallel::ReductionData<
+    // Time
+    Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+    // Number of grid points
+    Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+    // Minimum and maximum determinant of the Jacobian
+    Parallel::ReductionDatum<double, funcl::Min<>>,
+    Parallel::ReductionDatum<double, funcl::Max<>>,
+    // Maximum magnitude of the Jacobian diagnostic
+    Parallel::ReductionDatum<double, funcl::Max<>>>;
+
+namespace ExportCoordinates_detail {
+// Compares the analytic Jacobian (via the CoordinateMap) to the numerical
+// Jacobian (computed via logical_partial_derivative)
+template <size_t Dim, typename DbTagsList>
+tnsr::i<DataVector, Dim, Frame::ElementLogical> jacobian_diagnostic(
+    const db::DataBox<DbTagsList>& box) {
+  const auto& mesh = get<domain::Tags::Mesh<Dim>>(box);
+  const auto& inv_jacobian =
+      db::get<domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                            Frame::Inertial>>(box);
+  const auto& inertial_coordinates =
+      db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box);
+  const auto& jacobian = determinant_and_inverse(inv_jacobian).second;
+  tnsr::i<DataVector, Dim, Frame::ElementLogical> jac_diag{
+      mesh.number_of_grid_points(), 0.0};
+  domain::jacobian_diagnostic(make_not_null(&jac_diag), jacobian,
+                              inertial_coordinates, mesh);
+  return jac_diag;
+}
+}  // namespace ExportCoordinates_detail
+
 namespace Actions {
 template <size_t Dim>
 struct ExportCoordinates {
@@ -169,11 +207,7 @@ struct ExportCoordinates {
     // Also output the jacobian diagnostic, which compares the analytic
     // Jacobian (via the CoordinateMap) to the numerical Jacobian
     // (computed via logical_partial_derivative)
-    const auto& jacobian = determinant_and_inverse(inv_jacobian).second;
-    tnsr::i<DataVector, Dim, Frame::ElementLogical> jac_diag{
-        mesh.number_of_grid_points(), 0.0};
-    domain::jacobian_diagnostic(make_not_null(&jac_diag), jacobian,
-                                inertial_coordinates, mesh);
+    const auto jac_diag = ExportCoordinates_detail::jacobian_diagnostic(box);
     for (size_t i = 0; i < Dim; ++i) {
       components.emplace_back(
           "JacobianDiagnostic_" +
@@ -238,6 +272,62 @@ struct FindGlobalMinimumGridSpacing {
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
+
+/// Reduces the range of the Jacobian determinant and the maximum of the
+/// Jacobian diagnostic over each block, and writes them to the subfile
+/// `/JacobianQuality/Block<id>`. A non-positive determinant indicates a
+/// singular or inverted map, and a large diagnostic indicates that the grid is
+/// too coarse to resolve the map.
+struct FindJacobianQualityPerBlock {
+  template <typename ParallelComponent, typename DbTagsList, size_t Dim>
+  static std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  register_info(const db::DataBox<DbTagsList>& /*box*/,
+                const ElementId<Dim>& element_id) {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_name(element_id) + ".dat")};
+  }
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const double time = get<Tags::Time>(box);
+    const DataVector det_jacobian =
+        1.0 / get(db::get<domain::Tags::DetInvJacobian<Frame::ElementLogical,
+                                                       Frame::Inertial>>(box));
+    const auto jac_diag = ExportCoordinates_detail::jacobian_diagnostic(box);
+    double max_jacobian_diagnostic = 0.0;
+    for (size_t i = 0; i < Dim; ++i) {
+      max_jacobian_diagnostic =
+          std::max(max_jacobian_diagnostic, max(abs(jac_diag.get(i))));
+    }
+
+    const std::string subfile_path = subfile_name(element_id);
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache));
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer, observers::ObservationId(time, subfile_path + ".dat"),
+        Parallel::make_array_component_id<ParallelComponent>(element_id),
+        subfile_path,
+        std::vector<std::string>{"Time", "NumberOfPoints", "MinDetJacobian",
+                                 "MaxDetJacobian", "MaxJacobianDiagnostic"},
+        JacobianQualityReductionData{time, det_jacobian.size(),
+                                     min(det_jacobian), max(det_jacobian),
+                                     max_jacobian_diagnostic});
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+
+ private:
+  template <size_t Dim>
+  static std::string subfile_name(const ElementId<Dim>& element_id) {
+    return "/JacobianQuality/Block" + std::to_string(element_id.block_id());
+  }
+};
 }  // namespace Actions
 
 namespace Initialization {
@@ -306,7 +396,9 @@ struct Metavariables {
       tmpl::list<observers::Actions::RegisterWithObservers<
                      Actions::ExportCoordinates<Dim>>,
                  observers::Actions::RegisterWithObservers<
-                     Actions::FindGlobalMinimumGridSpacing>>;
+                     Actions::FindGlobalMinimumGridSpacing>,
+                 observers::Actions::RegisterWithObservers<
+                     Actions::FindJacobianQualityPerBlock>>;
 
   using dg_element_array = DgElementArray<
       Metavariables,
@@ -335,6 +427,7 @@ struct Metavariables {
               Parallel::Phase::Execute,
               tmpl::list<Actions::AdvanceTime, Actions::ExportCoordinates<Dim>,
                          Actions::FindGlobalMinimumGridSpacing,
+                         Actions::FindJacobianQualityPerBlock,
                          evolution::Actions::RunEventsAndTriggers,
                          PhaseControl::Actions::ExecutePhaseChange>>>>;
 
@@ -1,9 +1,15 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <algorithm>
+#include <array>
 #include <boost/program_options.hpp>
 #include <cstddef>
+#include <future>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -19,6 +25,8 @@
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
 #include "Parallel/Printf/Printf.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -148,130 +156,254 @@ void slice_buffers_to_libsharp_modes(
   }
 }
 
+using reduced_boundary_tags =
+    tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
+
+// the temporaries each thread reuses for all the times it reduces
+struct ReductionBuffers {
+  explicit ReductionBuffers(const size_t computation_l_max)
+      : coefficients_set{Spectral::Swsh::size_of_libsharp_coefficient_vector(
+            computation_l_max)},
+        boundary_data_variables{
+            Spectral::Swsh::number_of_swsh_collocation_points(
+                computation_l_max)},
+        output_goldberg_mode_buffer{square(computation_l_max + 1)},
+        output_libsharp_mode_buffer{
+            Spectral::Swsh::size_of_libsharp_coefficient_vector(
+                computation_l_max)} {}
+
+  Variables<Cce::cce_metric_input_tags> coefficients_set;
+  Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
+      Cce::Tags::BoundaryValue>>
+      boundary_data_variables;
+  ComplexModalVector output_goldberg_mode_buffer;
+  ComplexModalVector output_libsharp_mode_buffer;
+};
+
+// perform the boundary computation for the time at `buffer_time_offset` in the
+// `coefficients_buffers` and store the Goldberg modes up to `l_max` of each of
+// the `reduced_boundary_tags` consecutively in `reduced_modes`.
+void reduce_worldtube_data_at_time(
+    const gsl::not_null<ComplexModalVector*> reduced_modes,
+    const gsl::not_null<ReductionBuffers*> buffers,
+    const Variables<Cce::cce_metric_input_tags>& coefficients_buffers,
+    const size_t time_span, const size_t buffer_time_offset, const size_t l_max,
+    const size_t computation_l_max, const bool unnormalized_spec_modes,
+    const double extraction_radius) {
+  auto& coefficients_set = buffers->coefficients_set;
+  auto& boundary_data_variables = buffers->boundary_data_variables;
+  slice_buffers_to_libsharp_modes(make_not_null(&coefficients_set),
+                                  coefficients_buffers, time_span,
+                                  buffer_time_offset, l_max, computation_l_max);
+
+  if (unnormalized_spec_modes) {
+    Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
+        make_not_null(&boundary_data_variables),
+        get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
+            coefficients_set),
+        get<Cce::Tags::detail::Shift>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Lapse>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(coefficients_set),
+        extraction_radius, computation_l_max);
+  } else {
+    Cce::create_bondi_boundary_data(
+        make_not_null(&boundary_data_variables),
+        get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
+            coefficients_set),
+        get<Cce::Tags::detail::Shift>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Lapse>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(coefficients_set),
+        extraction_radius, computation_l_max);
+  }
+  // loop over the tags that we want to dump.
+  tmpl::for_each<reduced_boundary_tags>([&reduced_modes, &buffers,
+                                         &boundary_data_variables, &l_max,
+                                         &computation_l_max](auto tag_v) {
+    using tag = typename decltype(tag_v)::type;
+    SpinWeighted<ComplexModalVector, tag::type::type::spin>
+        spin_weighted_libsharp_view;
+    spin_weighted_libsharp_view.set_data_ref(
+        buffers->output_libsharp_mode_buffer.data(),
+        buffers->output_libsharp_mode_buffer.size());
+    Spectral::Swsh::swsh_transform(
+        computation_l_max, 1, make_not_null(&spin_weighted_libsharp_view),
+        get(get<tag>(boundary_data_variables)));
+    SpinWeighted<ComplexModalVector, tag::type::type::spin>
+        spin_weighted_goldberg_view;
+    spin_weighted_goldberg_view.set_data_ref(
+        buffers->output_goldberg_mode_buffer.data(),
+        buffers->output_goldberg_mode_buffer.size());
+    Spectral::Swsh::libsharp_to_goldberg_modes(
+        make_not_null(&spin_weighted_goldberg_view),
+        spin_weighted_libsharp_view, computation_l_max);
+
+    // The goldberg format type is in strictly increasing l modes, so to
+    // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
+    // values.
+    std::copy(buffers->output_goldberg_mode_buffer.begin(),
+              buffers->output_goldberg_mode_buffer.begin() +
+                  static_cast<std::ptrdiff_t>(square(l_max + 1)),
+              reduced_modes->begin() +
+                  static_cast<std::ptrdiff_t>(
+                      tmpl::index_of<reduced_boundary_tags, tag>::value *
+                      square(l_max + 1)));
+  });
+}
+
 // read in the data from a (previously standard) SpEC worldtube file
 // `input_file`, perform the boundary computation, and dump the (considerably
 // smaller) dataset associated with the spin-weighted scalars to `output_file`.
+//
+// The input file is processed in time spans of `buffer_depth` times. While the
+// times of one span are reduced on `number_of_threads` threads, the next span
+// is read from the input file, so at most two spans of the input data and one
+// span of the reduced data are held in memory. All file access is serialized,
+// since the reading of the next span starts only after the previous span has
+// been written.
 void perform_cce_worldtube_reduction(
     const std::string& input_file, const std::string& output_file,
     const size_t buffer_depth, const size_t l_max_factor,
-    const bool fix_spec_normalization = false) {
+    const size_t number_of_threads, const bool fix_spec_normalization = false) {
   Cce::MetricWorldtubeH5BufferUpdater buffer_updater{input_file};
   const size_t l_max = buffer_updater.get_l_max();
   // Perform the boundary computation to scalars at twice the input l_max to be
   // absolutely certain that there are no problems associated with aliasing.
   const size_t computation_l_max = l_max_factor * l_max;
+  const bool unnormalized_spec_modes =
+      not buffer_updater.has_version_history() and fix_spec_normalization;
+  const double extraction_radius = buffer_updater.get_extraction_radius();
 
   // we're not interpolating, this is just a reasonable number of rows to ingest
   // at a time.
   const size_t size_of_buffer = square(l_max + 1) * (buffer_depth);
   const DataVector& time_buffer = buffer_updater.get_time_buffer();
 
-  Variables<Cce::cce_metric_input_tags> coefficients_buffers{size_of_buffer};
-  Variables<Cce::cce_metric_input_tags> coefficients_set{
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
-
-  Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
-      Cce::Tags::BoundaryValue>>
-      boundary_data_variables{
-          Spectral::Swsh::number_of_swsh_collocation_points(computation_l_max)};
+  // one set of buffers is reduced while the next time span is read into the
+  // other
+  std::array<Variables<Cce::cce_metric_input_tags>, 2> coefficients_buffers{
+      {Variables<Cce::cce_metric_input_tags>{size_of_buffer},
+       Variables<Cce::cce_metric_input_tags>{size_of_buffer}}};
+  std::array<std::pair<size_t, size_t>, 2> time_spans{};
+  const auto read_time_span = [&buffer_updater, &coefficients_buffers,
+                               &time_spans, &time_buffer, &l_max,
+                               &buffer_depth](const size_t buffer_index,
+                                              const size_t time_index) {
+    auto& [time_span_start, time_span_end] = gsl::at(time_spans, buffer_index);
+    // start from an empty span so that the buffer is always filled
+    time_span_start = 0;
+    time_span_end = 0;
+    buffer_updater.update_buffers_for_time(
+        make_not_null(&gsl::at(coefficients_buffers, buffer_index)),
+        make_not_null(&time_span_start), make_not_null(&time_span_end),
+        time_buffer[time_index], l_max, 0, buffer_depth);
+  };
 
-  using reduced_boundary_tags =
-      tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
+  std::vector<ReductionBuffers> reduction_buffers{};
+  reduction_buffers.reserve(number_of_threads);
+  for (size_t thread = 0; thread < number_of_threads; ++thread) {
+    reduction_buffers.emplace_back(computation_l_max);
+  }
+  const size_t number_of_reduced_modes =
+      tmpl::size<reduced_boundary_tags>::value * square(l_max + 1);
+  std::vector<ComplexModalVector> reduced_modes{};
 
-  size_t time_span_start = 0;
-  size_t time_span_end = 0;
   Cce::ReducedWorldtubeModeRecorder recorder{output_file};
 
-  ComplexModalVector output_goldberg_mode_buffer{square(computation_l_max + 1)};
-  ComplexModalVector output_libsharp_mode_buffer{
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
-
-  for (size_t i = 0; i < time_buffer.size(); ++i) {
-    const double time = time_buffer[i];
-    Parallel::printf("reducing data at time : %f / %f \r", time,
+  read_time_span(0, 0);
+  size_t current_buffer = 0;
+  size_t next_time_index = 0;
+  while (next_time_index < time_buffer.size()) {
+    const size_t time_span_start = gsl::at(time_spans, current_buffer).first;
+    const size_t time_span_end = gsl::at(time_spans, current_buffer).second;
+    ASSERT(time_span_start <= next_time_index and
+               next_time_index < time_span_end,
+           "The time span [" << time_span_start << ", " << time_span_end
+                             << ") doesn't contain the next time index "
+                             << next_time_index);
+    Parallel::printf("reducing data at time : %f / %f \r",
+                     time_buffer[next_time_index],
                      time_buffer[time_buffer.size() - 1]);
-    buffer_updater.update_buffers_for_time(
-        make_not_null(&coefficients_buffers), make_not_null(&time_span_start),
-        make_not_null(&time_span_end), time, l_max, 0, buffer_depth);
-
-    slice_buffers_to_libsharp_modes(
-        make_not_null(&coefficients_set), coefficients_buffers,
-        time_span_end - time_span_start, i - time_span_start, l_max,
-        computation_l_max);
+    std::future<void> next_read{};
+    if (time_span_end < time_buffer.size()) {
+      next_read = std::async(
+          std::launch::async,
+          [&read_time_span, next_buffer = 1 - current_buffer,
+           next_time_index = time_span_end]() {
+            read_time_span(next_buffer, next_time_index);
+          });
+    }
 
-    if (not buffer_updater.has_version_history() and fix_spec_normalization) {
-      Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
-          make_not_null(&boundary_data_variables),
-          get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Shift>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Lapse>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
-              coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
-    } else {
-      Cce::create_bondi_boundary_data(
-          make_not_null(&boundary_data_variables),
-          get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Shift>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Lapse>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
-              coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
+    const size_t number_of_times = time_span_end - next_time_index;
+    if (reduced_modes.size() < number_of_times) {
+      reduced_modes.resize(number_of_times,
+                           ComplexModalVector{number_of_reduced_modes});
+    }
+    const auto reduce_times = [&](const size_t thread, const size_t begin,
+                                  const size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        reduce_worldtube_data_at_time(
+            make_not_null(&reduced_modes[i]),
+            make_not_null(&reduction_buffers[thread]),
+            gsl::at(coefficients_buffers, current_buffer),
+            time_span_end - time_span_start,
+            next_time_index + i - time_span_start, l_max, computation_l_max,
+            unnormalized_spec_modes, extraction_radius);
+      }
+    };
+    const size_t threads = std::min(number_of_threads, number_of_times);
+    const size_t times_per_thread = (number_of_times + threads - 1) / threads;
+    std::vector<std::thread> workers{};
+    workers.reserve(threads - 1);
+    for (size_t thread = 1; thread < threads; ++thread) {
+      workers.emplace_back(
+          reduce_times, thread,
+          std::min(thread * times_per_thread, number_of_times),
+          std::min((thread + 1) * times_per_thread, number_of_times));
+    }
+    reduce_times(0, 0, times_per_thread);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (next_read.valid()) {
+      next_read.get();
     }
-    // loop over the tags that we want to dump.
-    tmpl::for_each<reduced_boundary_tags>(
-        [&recorder, &boundary_data_variables, &output_goldberg_mode_buffer,
-         &output_libsharp_mode_buffer, &l_max, &computation_l_max,
-         &time](auto tag_v) {
-          using tag = typename decltype(tag_v)::type;
-          SpinWeighted<ComplexModalVector, tag::type::type::spin>
-              spin_weighted_libsharp_view;
-          spin_weighted_libsharp_view.set_data_ref(
-              output_libsharp_mode_buffer.data(),
-              output_libsharp_mode_buffer.size());
-          Spectral::Swsh::swsh_transform(
-              computation_l_max, 1, make_not_null(&spin_weighted_libsharp_view),
-              get(get<tag>(boundary_data_variables)));
-          SpinWeighted<ComplexModalVector, tag::type::type::spin>
-              spin_weighted_goldberg_view;
-          spin_weighted_goldberg_view.set_data_ref(
-              output_goldberg_mode_buffer.data(),
-              output_goldberg_mode_buffer.size());
-          Spectral::Swsh::libsharp_to_goldberg_modes(
-              make_not_null(&spin_weighted_goldberg_view),
-              spin_weighted_libsharp_view, computation_l_max);
 
-          // The goldberg format type is in strictly increasing l modes, so to
-          // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
-          // values.
-          ComplexModalVector reduced_goldberg_view{
-              output_goldberg_mode_buffer.data(), square(l_max + 1)};
-          recorder.append_worldtube_mode_data(
-              "/" + Cce::dataset_label_for_tag<tag>(), time,
-              reduced_goldberg_view, l_max, tag::type::type::spin == 0);
-        });
+    for (size_t i = 0; i < number_of_times; ++i) {
+      tmpl::for_each<reduced_boundary_tags>([&recorder, &reduced_modes,
+                                             &time_buffer, &l_max,
+                                             &next_time_index, &i](auto tag_v) {
+        using tag = typename decltype(tag_v)::type;
+        const ComplexModalVector reduced_goldberg_view{
+            reduced_modes[i].data() +
+                tmpl::index_of<reduced_boundary_tags, tag>::value *
+                    square(l_max + 1),
+            square(l_max + 1)};
+        recorder.append_worldtube_mode_data(
+            "/" + Cce::dataset_label_for_tag<tag>(),
+            time_buffer[next_time_index + i], reduced_goldberg_view, l_max,
+            tag::type::type::spin == 0);
+      });
+    }
+    next_time_index = time_span_end;
+    current_buffer = 1 - current_buffer;
   }
   Parallel::printf("\n");
 }
@@ -301,7 +433,10 @@ int main(int argc, char** argv) {
       "routines. Higher values mean fewer, larger loads from file into RAM.")(
       "lmax_factor", boost::program_options::value<size_t>()->default_value(2),
       "the boundary computations will be performed at a resolution that is "
-      "lmax_factor times the input file lmax to avoid aliasing");
+      "lmax_factor times the input file lmax to avoid aliasing")(
+      "threads", boost::program_options::value<size_t>()->default_value(1),
+      "number of threads the times of each loaded span are reduced on. The "
+      "next span is read from file while the current one is reduced.");
 
   boost::program_options::variables_map vars;
 
@@ -318,9 +453,14 @@ int main(int argc, char** argv) {
     return 0;
   }
 
+  if (vars["threads"].as<size_t>() == 0) {
+    ERROR("The number of threads must be at least 1.");
+  }
+
   perform_cce_worldtube_reduction(vars["input_file"].as<std::string>(),
                                   vars["output_file"].as<std::string>(),
                                   vars["buffer_depth"].as<size_t>(),
                                   vars["lmax_factor"].as<size_t>(),
+                                  vars["threads"].as<size_t>(),
                                   vars.count("fix_spec_normalization") != 0u);
 }
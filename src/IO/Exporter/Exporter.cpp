@@ -3,12 +3,14 @@
 
 #include "IO/Exporter/Exporter.hpp"
 
+#include <algorithm>
 #include <csignal>  // For Blaze error handling without PCH
 #ifdef _OPENMP
 #include <omp.h>
 #endif  // _OPENMP
 
 #include "DataStructures/Tensor/EagerMath/CartesianToSpherical.hpp"
+#include "Domain/BlockBoundingBoxes.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
 #include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
@@ -38,7 +40,7 @@ namespace {
 template <size_t Dim>
 void interpolate_to_points(
     const gsl::not_null<std::vector<std::vector<double>>*> result,
-    const gsl::not_null<std::vector<bool>*> filled_data,
+    const gsl::not_null<std::vector<char>*> filled_data,
     const std::string& filename, const std::string& subfile_name,
     const size_t obs_id, const std::vector<std::string>& tensor_components,
     const std::vector<BlockLogicalCoords<Dim>>& block_logical_coords,
@@ -89,10 +91,14 @@ void interpolate_to_points(
     }
   }
   h5file.close();
+  const size_t num_components = tensor_components.size();
+  // Elements contain very different numbers of target points (most contain
+  // none), so they are distributed dynamically over the threads
 #pragma omp parallel num_threads(num_threads)
   {
+    DataVector element_data{};
     DataVector interpolated_data{};
-#pragma omp for
+#pragma omp for schedule(dynamic)
     for (const auto& element_id : element_ids) {
       const auto found_points = element_logical_coords.find(element_id);
       if (found_points == element_logical_coords.end()) {
@@ -101,29 +107,41 @@ void interpolate_to_points(
       const auto& points = found_points->second;
       const auto [offset, length] = h5::offset_and_length_for_grid(
           get_output(element_id), grid_names, all_extents);
-      // Interpolate!
-      // Possible optimization: rather than interpolating each tensor component
-      // separately, we could interpolate all components at once. This would
-      // need an offset and stride to be passed to the interpolator, since the
-      // tensor components for all elements are stored contiguously.
-      const intrp::Irregular<Dim> interpolant(meshes[element_id],
+      // Interpolate all tensor components at once. They are stored
+      // contiguously for all elements in the file, so the element's data is
+      // gathered into a buffer first.
+      const intrp::Irregular<Dim> interpolant(meshes.at(element_id),
                                               points.element_logical_coords);
       const size_t num_element_target_points =
           points.element_logical_coords.begin()->size();
-      if (interpolated_data.size() < num_element_target_points) {
-        interpolated_data.destructive_resize(num_element_target_points);
+      if (element_data.size() < num_components * length) {
+        element_data.destructive_resize(num_components * length);
       }
-      for (size_t i = 0; i < tensor_components.size(); ++i) {
-        auto output_data =
-            gsl::make_span(interpolated_data.data(), num_element_target_points);
-        const auto input_data =
-            gsl::make_span(tensor_data[i].data() + offset, length);
-        interpolant.interpolate(make_not_null(&output_data), input_data);
+      if (interpolated_data.size() <
+          num_components * num_element_target_points) {
+        interpolated_data.destructive_resize(num_components *
+                                             num_element_target_points);
+      }
+      for (size_t i = 0; i < num_components; ++i) {
+        std::copy_n(tensor_data[i].data() + offset, length,
+                    element_data.data() + i * length);
+      }
+      auto output_data = gsl::make_span(
+          interpolated_data.data(), num_components * num_element_target_points);
+      const auto input_data =
+          gsl::make_span(element_data.data(), num_components * length);
+      interpolant.interpolate(make_not_null(&output_data), input_data);
+      for (size_t i = 0; i < num_components; ++i) {
         for (size_t j = 0; j < num_element_target_points; ++j) {
-          (*result)[i][points.offsets[j]] = interpolated_data[j];
-          (*filled_data)[points.offsets[j]] = true;
+          (*result)[i][points.offsets[j]] =
+              interpolated_data[i * num_element_target_points + j];
         }
       }
+      // Elements don't overlap, so threads write to disjoint entries. This is
+      // why `filled_data` can't be a (bit-packed) `std::vector<bool>`.
+      for (size_t j = 0; j < num_element_target_points; ++j) {
+        (*filled_data)[points.offsets[j]] = 1;
+      }
     }  // omp for
   }  // omp parallel
 }
@@ -414,6 +432,10 @@ std::vector<std::vector<double>> interpolate_to_points(
   const double extrapolation_spacing = 0.3;
   std::vector<ExtrapolationInfo<num_extrapolation_anchors>>
       extrapolation_info{};
+  // Only the maps of blocks whose bounding box contains a target point are
+  // inverted
+  const domain::BlockBoundingBoxes<Dim, Frame::Inertial> bounding_boxes{
+      domain, time, functions_of_time};
 #pragma omp parallel num_threads(resolved_num_threads)
   {
     // Set up thread-local variables
@@ -426,15 +448,8 @@ std::vector<std::vector<double>> interpolate_to_points(
       for (size_t d = 0; d < Dim; ++d) {
         target_point.get(d) = gsl::at(target_points, d)[s];
       }
-      for (const auto& block : domain.blocks()) {
-        auto x_logical = block_logical_coordinates_single_point(
-            target_point, block, time, functions_of_time);
-        if (x_logical.has_value()) {
-          block_logical_coords[s] = {domain::BlockId(block.id()),
-                                     std::move(x_logical.value())};
-          break;
-        }
-      }  // for blocks
+      block_logical_coords[s] = block_logical_coordinates_single_point(
+          domain, target_point, bounding_boxes, time, functions_of_time);
       if (block_logical_coords[s].has_value() or
           not extrapolate_into_excisions) {
         continue;
@@ -477,7 +492,7 @@ std::vector<std::vector<double>> interpolate_to_points(
     result.emplace_back(block_logical_coords.size(),
                         std::numeric_limits<double>::signaling_NaN());
   }
-  std::vector<bool> filled_data(block_logical_coords.size(), false);
+  std::vector<char> filled_data(block_logical_coords.size(), 0);
 
   // Process all volume files in serial, because loading data with H5 must be
   // done in serial anyway. Instead, the loop over elements within each file is
@@ -488,7 +503,7 @@ std::vector<std::vector<double>> interpolate_to_points(
                           block_logical_coords, resolved_num_threads);
     // Terminate early if all data has been filled
     if (std::all_of(filled_data.begin(), filled_data.end(),
-                    [](const bool filled) { return filled; })) {
+                    [](const char filled) { return filled != 0; })) {
       break;
     }
   }
@@ -3,6 +3,7 @@
 
 #include "IO/External/InterpolateFromFuka.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <mutex>
@@ -48,7 +49,7 @@ std::array<std::vector<double>, 22> KadathExportBHNS(
 namespace io {
 
 namespace {
-DataVector to_datavector(std::vector<double> vec) {
+DataVector to_datavector(const std::vector<double>& vec) {
   DataVector result(vec.size());
   std::copy(vec.begin(), vec.end(), result.begin());
   return result;
@@ -3,11 +3,15 @@
 
 #include "IO/H5/CombineH5.hpp"
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <iterator>
 #include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -17,9 +21,16 @@
 #include "IO/H5/SourceArchive.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Parallel/Printf/Printf.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
+#include "Utilities/Numeric.hpp"
 #include "Utilities/StdHelpers.hpp"
 
 namespace {
@@ -34,20 +45,80 @@ std::vector<size_t> get_observation_ids(
   return initial_volume_file.list_observation_ids();
 }
 
-// Returns total number of elements for an observation id across all volume data
-// files
-size_t get_number_of_elements(const std::vector<std::string>& input_filenames,
-                              const std::string& subfile_name,
-                              const size_t& observation_id) {
-  size_t total_elements = 0;
-  for (const auto& input_filename : input_filenames) {
-    const h5::H5File<h5::AccessType::ReadOnly> original_file(input_filename,
-                                                             false);
-    const auto& original_volume_file =
-        original_file.get<h5::VolumeData>(subfile_name);
-    total_elements += original_volume_file.get_extents(observation_id).size();
+// The grids stored in a single volume data file at one observation id
+struct GridsInFile {
+  std::vector<std::string> names{};
+  std::vector<std::vector<size_t>> extents{};
+  std::vector<std::vector<Spectral::Basis>> bases{};
+  std::vector<std::vector<Spectral::Quadrature>> quadratures{};
+  size_t number_of_points = 0;
+};
+
+GridsInFile get_grids(const h5::VolumeData& volume_file,
+                      const size_t observation_id) {
+  GridsInFile grids{volume_file.get_grid_names(observation_id),
+                    volume_file.get_extents(observation_id),
+                    volume_file.get_bases(observation_id),
+                    volume_file.get_quadratures(observation_id)};
+  for (const auto& extents : grids.extents) {
+    grids.number_of_points +=
+        alg::accumulate(extents, 1_st, std::multiplies<>{});
+  }
+  return grids;
+}
+
+// Copies `component` into `result` starting at `offset`, allocating `result`
+// with `total_size` points on the first call.
+void copy_tensor_data(
+    const gsl::not_null<std::variant<DataVector, std::vector<float>>*> result,
+    const TensorComponent& component, const size_t offset,
+    const size_t total_size) {
+  std::visit(
+      [&result, offset, total_size](const auto& data) {
+        using DataType = std::decay_t<decltype(data)>;
+        if (not std::holds_alternative<DataType>(*result) or
+            std::get<DataType>(*result).size() != total_size) {
+          *result = DataType(total_size);
+        }
+        auto& contiguous_data = std::get<DataType>(*result);
+        ASSERT(offset + data.size() <= contiguous_data.size(),
+               "Too many points in tensor component. The extents of the "
+               "grids do not match the size of the tensor data.");
+        std::copy(data.begin(), data.end(),
+                  std::next(contiguous_data.begin(),
+                            static_cast<std::ptrdiff_t>(offset)));
+      },
+      component.data);
+}
+
+// Splits the contiguous `component` of all grids in a file into elements and
+// appends them to `result`
+void append_elements(
+    const gsl::not_null<std::vector<ElementVolumeData>*> result,
+    GridsInFile grids, const TensorComponent& component) {
+  size_t offset = 0;
+  for (size_t i = 0; i < grids.names.size(); ++i) {
+    const size_t mesh_size =
+        alg::accumulate(grids.extents[i], 1_st, std::multiplies<>{});
+    auto& element = result->emplace_back(
+        std::move(grids.names[i]), std::vector<TensorComponent>{},
+        std::move(grids.extents[i]), std::move(grids.bases[i]),
+        std::move(grids.quadratures[i]));
+    std::visit(
+        [&component, &element, mesh_size, offset](const auto& data) {
+          using DataType = std::decay_t<decltype(data)>;
+          DataType element_data(mesh_size);
+          std::copy(
+              std::next(data.begin(), static_cast<std::ptrdiff_t>(offset)),
+              std::next(data.begin(),
+                        static_cast<std::ptrdiff_t>(offset + mesh_size)),
+              element_data.begin());
+          element.tensor_components.emplace_back(component.name,
+                                                 std::move(element_data));
+        },
+        component.data);
+    offset += mesh_size;
   }
-  return total_elements;
 }
 }  // namespace
 namespace h5 {
@@ -91,61 +162,85 @@ void combine_h5(const std::vector<std::string>& file_names,
   const std::vector<size_t> observation_ids =
       get_observation_ids(file_names, subfile_name);
 
-  // Loops over observation ids to write volume data by observation id
+  // The input files stay open while combining so that each tensor component
+  // can be read separately without reopening the files.
+  std::vector<h5::H5File<h5::AccessType::ReadOnly>> original_files{};
+  original_files.reserve(file_names.size());
+  std::vector<const h5::VolumeData*> original_volume_files{};
+  original_volume_files.reserve(file_names.size());
+  for (const auto& file_name : file_names) {
+    original_volume_files.push_back(
+        &original_files.emplace_back(file_name, false)
+             .get<h5::VolumeData>(subfile_name));
+  }
+
+  // Loops over observation ids to write volume data by observation id. Only
+  // one tensor component of one observation is held in memory at a time, so
+  // the memory needed is bounded by the size of a single tensor component of
+  // the combined data rather than by the size of the whole observation.
   for (size_t obs_index = 0; obs_index < observation_ids.size(); ++obs_index) {
     const size_t obs_id = observation_ids[obs_index];
-    // Pre-calculates size of vector to store element data and allocates
-    // corresponding memory
-    const size_t vector_dim =
-        get_number_of_elements(file_names, subfile_name, obs_id);
-    std::vector<ElementVolumeData> element_data;
-    element_data.reserve(vector_dim);
-
-    double obs_val = 0.0;
-    std::optional<std::vector<char>> serialized_domain{};
-    std::optional<std::vector<char>> serialized_functions_of_time{};
-
-    // Loops over input files to append element data into a single vector to be
-    // stored in a single H5
-    bool printed = false;
-    for (auto const& file_name : file_names) {
-      const h5::H5File<h5::AccessType::ReadOnly> original_file(file_name,
-                                                               false);
-      const auto& original_volume_file =
-          original_file.get<h5::VolumeData>(subfile_name);
-      obs_val = original_volume_file.get_observation_value(obs_id);
-      if (not printed) {
-        Parallel::printf(
-            "Processing obsevation ID %lo (%lo/%lo) with value %1.14e\n",
-            obs_id, obs_index, observation_ids.size(), obs_val);
-        printed = true;
-      }
-      Parallel::printf("  Processing file: %s\n", file_name.c_str());
-
-      serialized_domain = original_volume_file.get_domain(obs_id);
-      serialized_functions_of_time =
-          original_volume_file.get_functions_of_time(obs_id);
-
-      // Get vector of element data for this `obs_id` and `file_name`
-      std::vector<ElementVolumeData> data_by_element =
-          std::move(std::get<2>(original_volume_file.get_data_by_element(
-              obs_val * (1.0 - 4.0 * std::numeric_limits<double>::epsilon()),
-              obs_val * (1.0 + 4.0 * std::numeric_limits<double>::epsilon()),
-              std::nullopt)[0]));
-
-      // Append vector to total vector of element data for this `obs_id`
-      element_data.insert(element_data.end(),
-                          std::make_move_iterator(data_by_element.begin()),
-                          std::make_move_iterator(data_by_element.end()));
-      data_by_element.clear();
-      original_file.close_current_object();
+    const auto& first_volume_file = *original_volume_files.front();
+    const double obs_val = first_volume_file.get_observation_value(obs_id);
+    Parallel::printf(
+        "Processing obsevation ID %lo (%lo/%lo) with value %1.14e\n", obs_id,
+        obs_index, observation_ids.size(), obs_val);
+
+    const std::vector<std::string> component_names =
+        first_volume_file.list_tensor_components(obs_id);
+    if (component_names.empty()) {
+      ERROR("No tensor components found at observation ID " << obs_id
+                                                            << " in file "
+                                                            << file_names[0]);
+    }
+
+    // The first tensor component is written together with the grids, which
+    // also writes the connectivity.
+    std::vector<ElementVolumeData> element_data{};
+    std::vector<size_t> number_of_points_per_file(file_names.size());
+    for (size_t file_index = 0; file_index < file_names.size(); ++file_index) {
+      Parallel::printf("  Processing file: %s\n",
+                       file_names[file_index].c_str());
+      const auto& original_volume_file = *original_volume_files[file_index];
+      GridsInFile grids = get_grids(original_volume_file, obs_id);
+      number_of_points_per_file[file_index] = grids.number_of_points;
+      append_elements(make_not_null(&element_data), std::move(grids),
+                      original_volume_file.get_tensor_component(
+                          obs_id, component_names.front()));
     }
+    const size_t total_number_of_points =
+        alg::accumulate(number_of_points_per_file, 0_st);
 
     h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
     auto& new_volume_file = new_file.get<h5::VolumeData>(subfile_name);
-    new_volume_file.write_volume_data(obs_id, obs_val, element_data,
-                                      serialized_domain,
-                                      serialized_functions_of_time);
+    new_volume_file.write_volume_data(
+        obs_id, obs_val, element_data, first_volume_file.get_domain(obs_id),
+        first_volume_file.get_functions_of_time(obs_id));
+    element_data.clear();
+
+    // The remaining tensor components are copied one at a time into a single
+    // contiguous buffer.
+    std::variant<DataVector, std::vector<float>> contiguous_data{};
+    for (size_t component_index = 1; component_index < component_names.size();
+         ++component_index) {
+      const std::string& component_name = component_names[component_index];
+      size_t offset = 0;
+      for (size_t file_index = 0; file_index < file_names.size();
+           ++file_index) {
+        const TensorComponent component =
+            original_volume_files[file_index]->get_tensor_component(
+                obs_id, component_name);
+        copy_tensor_data(make_not_null(&contiguous_data), component, offset,
+                         total_number_of_points);
+        offset += number_of_points_per_file[file_index];
+      }
+      std::visit(
+          [&component_name, &new_volume_file, obs_id](const auto& data) {
+            new_volume_file.write_tensor_component(obs_id, component_name,
+                                                   data);
+          },
+          contiguous_data);
+    }
     new_file.close_current_object();
   }
 }
@@ -7,7 +7,15 @@
 #include <vector>
 
 namespace h5 {
-
+/*!
+ * \brief Combine the volume data subfile `subfile_name` of all `file_names`
+ * into a single file `output`.
+ *
+ * The data is copied one observation and one tensor component at a time, so
+ * the memory needed is bounded by a single tensor component of one
+ * observation of the combined data. All input files are kept open while
+ * combining.
+ */
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
                 const bool check_src = true);
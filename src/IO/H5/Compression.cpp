@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/Compression.hpp"
+
+#include <ostream>
+
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace h5 {
+bool operator==(const Compression& lhs, const Compression& rhs) {
+  return lhs.codec == rhs.codec and lhs.level == rhs.level and
+         lhs.shuffle == rhs.shuffle and
+         lhs.target_chunk_size_in_bytes == rhs.target_chunk_size_in_bytes;
+}
+
+bool operator!=(const Compression& lhs, const Compression& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const Compression::Codec codec) {
+  switch (codec) {
+    case Compression::Codec::None:
+      return os << "None";
+    case Compression::Codec::Deflate:
+      return os << "Deflate";
+    default:
+      ERROR("Unknown h5::Compression::Codec. Known values are None and "
+            "Deflate.");
+  }
+}
+}  // namespace h5
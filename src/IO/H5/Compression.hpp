@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief How datasets are chunked and compressed when they are written.
+ *
+ * The default matches what SpECTRE has always written: deflate (gzip) at level
+ * 5 after the byte shuffle filter, in chunks of 128 KiB. Compression trades
+ * time spent writing for smaller files, so `Codec::None` is useful when data
+ * is written often and disk space is not a concern. If a filter is not
+ * available in the HDF5 installation the data is written uncompressed.
+ */
+struct Compression {
+  enum class Codec {
+    /// Write the data uncompressed
+    None,
+    /// Compress the data with deflate (gzip)
+    Deflate
+  };
+
+  Codec codec{Codec::Deflate};
+  /// The deflate level, from 1 (fastest) to 9 (smallest files)
+  size_t level{5};
+  /// Whether to apply the byte shuffle filter before compressing, which
+  /// usually improves the compression of floating point data
+  bool shuffle{true};
+  /// The target number of bytes per chunk. Setting this to a power of 2 is
+  /// important for reducing the cost of writing to disk, a non-power of 2
+  /// increases the compression overhead by ~>10x.
+  size_t target_chunk_size_in_bytes{131'072};
+};
+
+bool operator==(const Compression& lhs, const Compression& rhs);
+bool operator!=(const Compression& lhs, const Compression& rhs);
+
+std::ostream& operator<<(std::ostream& os, Compression::Codec codec);
+}  // namespace h5
@@ -181,16 +181,20 @@ bool types_equal(const hid_t dtype1, const hid_t dtype2) {
 template <typename T>
 void write_data(const hid_t group_id, const std::vector<T>& data,
                 const std::vector<size_t>& extents, const std::string& name,
-                const bool overwrite_existing) {
+                const bool overwrite_existing, const Compression& compression) {
+  ASSERT(compression.codec != Compression::Codec::Deflate or
+             (compression.level >= 1 and compression.level <= 9),
+         "The deflate level must be between 1 and 9, not "
+             << compression.level);
   std::vector<hsize_t> chunk_size(extents.size());
   for (size_t i = 0; i < chunk_size.size(); ++i) {
-    // Setting the target number of bytes per chunk to a power of 2 is important
-    // for reducing the cost of writing to disk. Setting to a non-power of 2
-    // increases the compression overhead by ~>10x.
-    constexpr size_t target_number_of_bytes_per_chunk = 131'072;
-    chunk_size[i] = target_number_of_bytes_per_chunk / sizeof(T) > extents[i]
+    // See `h5::Compression` for why the target chunk size should be a power
+    // of 2.
+    const size_t target_number_of_elements_per_chunk =
+        std::max(compression.target_chunk_size_in_bytes / sizeof(T), size_t{1});
+    chunk_size[i] = target_number_of_elements_per_chunk > extents[i]
                         ? extents[i]
-                        : target_number_of_bytes_per_chunk / sizeof(T);
+                        : target_number_of_elements_per_chunk;
   }
   ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 0; }),
          "Got zero extent when trying to write data.");
@@ -201,7 +205,10 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
   const hid_t contained_type = h5::h5_type<tt::get_fundamental_type_t<T>>();
 
   // Check for available filters and write with GZIP+shuffle if available
-  const bool use_gzip_filter = []() {
+  const bool use_gzip_filter = [&compression]() {
+    if (compression.codec != Compression::Codec::Deflate) {
+      return false;
+    }
     if (not static_cast<bool>(H5Zfilter_avail(H5Z_FILTER_DEFLATE))) {
       return false;
     }
@@ -210,7 +217,10 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
     return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
            (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
   }();
-  const bool use_shuffle_filter = []() {
+  const bool use_shuffle_filter = [&compression]() {
+    if (not compression.shuffle) {
+      return false;
+    }
     if (not static_cast<bool>(H5Zfilter_avail(H5Z_FILTER_SHUFFLE))) {
       return false;
     }
@@ -229,7 +239,8 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
       CHECK_H5(H5Pset_shuffle(property_list),
                "Failed to enable shuffle filter on dataset " << name);
     }
-    CHECK_H5(H5Pset_deflate(property_list, 5),
+    CHECK_H5(H5Pset_deflate(property_list,
+                            static_cast<unsigned int>(compression.level)),
              "Failed to enable gzip filter on dataset " << name);
     CHECK_H5(H5Pset_chunk(property_list, chunk_size.size(), chunk_size.data()),
              "Failed to set chunk size on dataset " << name);
@@ -437,17 +448,30 @@ Matrix retrieve_dataset_subset(const hid_t file_id,
 
   CHECK_H5(H5Sselect_none(dataspace_id),
            "Failed to select none of the dataspace");
-  for (auto& column : these_columns) {
+  // Consecutive columns are selected as a single block. Reading, e.g., all
+  // modes of a worldtube file is then one contiguous selection instead of the
+  // union of one selection per column, which is much cheaper for HDF5 to
+  // process.
+  for (size_t run_start = 0; run_start < num_cols;) {
+    size_t run_length = 1;
+    while (run_start + run_length < num_cols and
+           these_columns[run_start + run_length] ==
+               these_columns[run_start] + run_length) {
+      ++run_length;
+    }
     const std::array<hsize_t, 2> start{
-        {first_row, static_cast<hsize_t>(column)}};
+        {first_row, static_cast<hsize_t>(these_columns[run_start])}};
     // offset between blocks (have only one anyway)
     const std::array<hsize_t, 2> stride{{1, 1}};
     const std::array<hsize_t, 2> count{{1, 1}};
-    const std::array<hsize_t, 2> block{{num_rows, 1}};
+    const std::array<hsize_t, 2> block{{num_rows, run_length}};
 
     CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, start.data(),
                                  stride.data(), count.data(), block.data()),
-             "Failed to select column " << column);
+             "Failed to select columns " << these_columns[run_start] << " to "
+                                         << these_columns[run_start] +
+                                                run_length - 1);
+    run_start += run_length;
   }
 
   std::vector<double> raw_data(num_rows * num_cols);
@@ -931,7 +955,7 @@ template Index<3> read_extents<3>(const hid_t group_id,
   template void write_data<TYPE(DATA)>(                            \
       const hid_t group_id, const std::vector<TYPE(DATA)>& data,   \
       const std::vector<size_t>& extents, const std::string& name, \
-      bool overwrite_existing);
+      bool overwrite_existing, const Compression& compression);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_DATA,
                         (float, double, int, unsigned int, long, unsigned long,
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "DataStructures/Index.hpp"
+#include "IO/H5/Compression.hpp"
 
 /// \cond
 class DataVector;
@@ -29,12 +30,15 @@ bool types_equal(hid_t dtype1, hid_t dtype2);
 /*!
  * \ingroup HDF5Group
  * \brief Write a std::vector named `name` to the group `group_id`
+ *
+ * The data is chunked and compressed as specified by `compression`.
  */
 template <typename T>
 void write_data(hid_t group_id, const std::vector<T>& data,
                 const std::vector<size_t>& extents,
                 const std::string& name = "scalar",
-                const bool overwrite_existing = false);
+                const bool overwrite_existing = false,
+                const Compression& compression = {});
 
 /*!
  * \ingroup HDF5Group
@@ -191,21 +191,25 @@ def iter_elements(
             else:
                 functions_of_time = None
             # Pre-load the tensor data because it's stored contiguously for all
-            # grids in the file
+            # grids in the file. The datasets are read at once directly into
+            # the returned array.
             if tensor_components:
-                tensor_data = np.asarray(
-                    [
-                        volfile.get_tensor_component(obs_id, component).data
-                        for component in tensor_components
-                    ]
+                tensor_data = volfile.get_tensor_components(
+                    obs_id, list(tensor_components)
                 )
+            # Offsets of all grids in the contiguous tensor data, computed once
+            # rather than per grid
+            all_lengths = [np.prod(extents) for extents in all_extents]
+            all_offsets = dict(
+                zip(all_grid_names, np.cumsum([0] + all_lengths[:-1]))
+            )
+            all_lengths = dict(zip(all_grid_names, all_lengths))
             # Iterate elements in this file
             for grid_name, element_id, mesh in zip(
                 grid_names, element_ids, meshes
             ):
-                offset, length = spectre_h5.offset_and_length_for_grid(
-                    grid_name, all_grid_names, all_extents
-                )
+                offset = int(all_offsets[grid_name])
+                length = int(all_lengths[grid_name])
                 data_slice = slice(offset, offset + length)
                 if domain:
                     element_map = ElementMap(element_id, domain)
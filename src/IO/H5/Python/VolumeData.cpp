@@ -3,13 +3,19 @@
 
 #include "IO/H5/Python/VolumeData.hpp"
 
+#include <cstddef>
+#include <functional>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Numeric.hpp"
 
 namespace py = pybind11;
 
@@ -40,6 +46,28 @@ void bind_h5vol(py::module& m) {
            py::arg("observation_id"))
       .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def(
+          "get_tensor_components",
+          [](const h5::VolumeData& volume_data, const size_t observation_id,
+             const std::vector<std::string>& tensor_components) {
+            size_t number_of_points = 0;
+            for (const auto& extents :
+                 volume_data.get_extents(observation_id)) {
+              number_of_points +=
+                  alg::accumulate(extents, 1_st, std::multiplies<>{});
+            }
+            // Read directly into the memory of the NumPy array
+            py::array_t<double> result(std::vector<size_t>{
+                tensor_components.size(), number_of_points});
+            volume_data.get_tensor_components(
+                {result.mutable_data(), static_cast<size_t>(result.size())},
+                observation_id, tensor_components);
+            return result;
+          },
+          py::arg("observation_id"), py::arg("tensor_components"),
+          "Read the 'tensor_components' from all grids in the file into a "
+          "NumPy array of shape (len(tensor_components), num_points), reading "
+          "each dataset at once without copying.")
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "Utilities/Formaline.hpp"
 
@@ -20,9 +21,15 @@ SourceArchive::SourceArchive(const bool exists, detail::OpenGroup&& group,
     source_archive_ =
         read_data<1, std::vector<char>>(location, name + extension());
   } else {
-    source_archive_ = formaline::get_archive();
+    // The archive is assembled from the embedded tarball only once per
+    // process, since every output file (one per node) writes it again.
+    static const std::vector<char> archive = formaline::get_archive();
+    source_archive_ = archive;
+    // The archive is already a gzipped tarball, so deflating it again only
+    // costs time at file creation without making the file smaller.
     write_data(location, source_archive_, {source_archive_.size()},
-               name + extension());
+               name + extension(), false,
+               Compression{Compression::Codec::None, 1, false});
   }
 }
 }  // namespace h5
@@ -9,6 +9,8 @@
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
 #include <hdf5.h>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -18,6 +20,8 @@
 #include "DataStructures/DataVector.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/ExtendConnectivityHelpers.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
@@ -25,6 +29,7 @@
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/Type.hpp"
 #include "IO/H5/Version.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
@@ -45,11 +50,15 @@
 namespace h5 {
 namespace {
 // Append the element extents and connectivity to the total extents and
-// connectivity
+// connectivity. The connectivity of an element only depends on its extents,
+// so it is computed once per distinct extents and stored (relative to the
+// first point of the element) in the `connectivity_cache`.
 void append_element_extents_and_connectivity(
     const gsl::not_null<std::vector<size_t>*> total_extents,
     const gsl::not_null<std::vector<int>*> total_connectivity,
     const gsl::not_null<std::vector<int>*> pole_connectivity,
+    const gsl::not_null<std::map<std::vector<size_t>, std::vector<int>>*>
+        connectivity_cache,
     const gsl::not_null<int*> total_points_so_far, const size_t dim,
     const ElementVolumeData& element) {
   // Process the element extents
@@ -66,21 +75,23 @@ void append_element_extents_and_connectivity(
   const int element_num_points =
       alg::accumulate(extents, 1, std::multiplies<>{});
   // Generate the connectivity data for the element
-  // Possible optimization: local_connectivity.reserve(BLAH) if we can figure
-  // out size without computing all the connectivities.
-  const std::vector<int> connectivity = [&extents, &total_points_so_far]() {
+  auto cached_connectivity = connectivity_cache->find(extents);
+  if (cached_connectivity == connectivity_cache->end()) {
     std::vector<int> local_connectivity;
     for (const auto& cell : vis::detail::compute_cells(extents)) {
       for (const auto& bounding_indices : cell.bounding_indices) {
-        local_connectivity.emplace_back(*total_points_so_far +
-                                        static_cast<int>(bounding_indices));
+        local_connectivity.emplace_back(static_cast<int>(bounding_indices));
       }
     }
-    return local_connectivity;
-  }();
+    cached_connectivity =
+        connectivity_cache->emplace(extents, std::move(local_connectivity))
+            .first;
+  }
+  const std::vector<int>& local_connectivity = cached_connectivity->second;
+  for (const int index : local_connectivity) {
+    total_connectivity->push_back(*total_points_so_far + index);
+  }
   *total_points_so_far += element_num_points;
-  total_connectivity->insert(total_connectivity->end(), connectivity.begin(),
-                             connectivity.end());
 
   // If element is 2D and the bases are both SphericalHarmonic,
   // then add extra connections to close the surface.
@@ -188,7 +199,8 @@ void VolumeData::write_volume_data(
     const size_t observation_id, const double observation_value,
     const std::vector<ElementVolumeData>& elements,
     const std::optional<std::vector<char>>& serialized_domain,
-    const std::optional<std::vector<char>>& serialized_functions_of_time) {
+    const std::optional<std::vector<char>>& serialized_functions_of_time,
+    const Compression& compression) {
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
@@ -229,6 +241,7 @@ void VolumeData::write_volume_data(
   std::string grid_names;
   std::vector<int> total_connectivity;
   std::vector<int> pole_connectivity{};
+  std::map<std::vector<size_t>, std::vector<int>> connectivity_cache{};
   std::vector<int> quadratures;
   std::vector<int> bases;
   // Keep a running count of the number of points so far to use as a global
@@ -247,9 +260,9 @@ void VolumeData::write_volume_data(
     }
 
     const auto fill_and_write_contiguous_tensor_data =
-        [&bases, &component_name, &dim, &elements, &grid_names, i,
-         &observation_group, &quadratures, &total_connectivity,
-         &pole_connectivity, &total_extents,
+        [&bases, &component_name, &compression, &dim, &elements, &grid_names,
+         i, &observation_group, &quadratures, &total_connectivity,
+         &pole_connectivity, &connectivity_cache, &total_extents,
          &total_points_so_far](const auto contiguous_tensor_data_ptr) {
           for (const auto& element : elements) {
             if (UNLIKELY(i == 0)) {
@@ -273,7 +286,7 @@ void VolumeData::write_volume_data(
 
               append_element_extents_and_connectivity(
                   &total_extents, &total_connectivity, &pole_connectivity,
-                  &total_points_so_far, dim, element);
+                  &connectivity_cache, &total_points_so_far, dim, element);
             }
             using type_from_variant = tmpl::conditional_t<
                 std::is_same_v<
@@ -292,7 +305,8 @@ void VolumeData::write_volume_data(
                 std::get<type_from_variant>(tensor_component.data).end());
           }  // for each element
           h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
-                         {contiguous_tensor_data_ptr->size()}, component_name);
+                         {contiguous_tensor_data_ptr->size()}, component_name,
+                         false, compression);
         };
 
     if (elements[0].tensor_components[i].data.index() == 0) {
@@ -504,6 +518,46 @@ TensorComponent VolumeData::get_tensor_component(
   }
 }
 
+void VolumeData::get_tensor_components(
+    const gsl::span<double> buffer, const size_t observation_id,
+    const std::vector<std::string>& tensor_components) const {
+  if (tensor_components.empty()) {
+    return;
+  }
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  const size_t number_of_points = buffer.size() / tensor_components.size();
+  if (number_of_points * tensor_components.size() != buffer.size()) {
+    ERROR("The buffer of size " << buffer.size()
+                                << " can't hold an equal number of points for "
+                                << tensor_components.size()
+                                << " tensor components.");
+  }
+  for (size_t i = 0; i < tensor_components.size(); ++i) {
+    const std::string& tensor_component = tensor_components[i];
+    const hid_t dataset_id =
+        h5::open_dataset(observation_group.id(), tensor_component);
+    const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+    const auto dataset_size =
+        static_cast<size_t>(H5Sget_simple_extent_npoints(dataspace_id));
+    h5::close_dataspace(dataspace_id);
+    if (dataset_size != number_of_points) {
+      ERROR("The tensor component '" << tensor_component << "' has "
+                                     << dataset_size << " points, but the "
+                                     << "buffer holds " << number_of_points
+                                     << " points per component.");
+    }
+    // HDF5 converts the data to double if it was written as float
+    CHECK_H5(H5Dread(dataset_id, h5::h5_type<double>(), h5::h5s_all(),
+                     h5::h5s_all(), h5::h5p_default(),
+                     std::next(buffer.data(), static_cast<std::ptrdiff_t>(
+                                                  i * number_of_points))),
+             "Failed to read dataset: '" << tensor_component << "'");
+    h5::close_dataset(dataset_id);
+  }
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const {
   const std::string path = "ObservationId" + std::to_string(observation_id);
@@ -11,9 +11,11 @@
 #include <utility>
 #include <vector>
 
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -112,12 +114,15 @@ class VolumeData : public h5::Object {
   /// domain and the functions of time into the subfile as well.
   ///
   /// All `elements` must contain the same tensor components in the same order.
+  /// The tensor components are written with the chunking and filters
+  /// described by `compression`.
   void write_volume_data(
       size_t observation_id, double observation_value,
       const std::vector<ElementVolumeData>& elements,
       const std::optional<std::vector<char>>& serialized_domain = std::nullopt,
       const std::optional<std::vector<char>>& serialized_functions_of_time =
-          std::nullopt);
+          std::nullopt,
+      const Compression& compression = {});
 
   /// Overwrites the current connectivity dataset with a new one. This new
   /// connectivity dataset builds connectivity within each block in the domain
@@ -167,6 +172,21 @@ class VolumeData : public h5::Object {
   TensorComponent get_tensor_component(
       size_t observation_id, const std::string& tensor_component) const;
 
+  /*!
+   * \brief Read the tensor components `tensor_components` at observation id
+   * `observation_id` from all grids in the file into `buffer`, one component
+   * after the other.
+   *
+   * Unlike calling `get_tensor_component` for each component, the observation
+   * group is opened only once and every dataset is read directly into `buffer`
+   * in a single read, converting `float` data to `double`. The `buffer` must
+   * hold `tensor_components.size()` times the number of grid points in the
+   * file, which is the sum over the products of the `get_extents`.
+   */
+  void get_tensor_components(
+      gsl::span<double> buffer, size_t observation_id,
+      const std::vector<std::string>& tensor_components) const;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(size_t observation_id) const;
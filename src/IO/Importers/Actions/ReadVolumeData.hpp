@@ -15,6 +15,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockBoundingBoxes.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/ElementLogicalCoordinates.hpp"
@@ -445,6 +446,13 @@ struct ReadAllVolumeDataAndDistribute {
     std::unordered_map<std::string,
                        std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
         source_domain_functions_of_time{};
+    // The source domain is the same in all volume files, so the target points
+    // are mapped to it only once and reused for every file. The bounding boxes
+    // avoid inverting the maps of source blocks that can't contain a point.
+    std::optional<domain::BlockBoundingBoxes<Dim, Frame::Inertial>>
+        source_bounding_boxes{};
+    std::unordered_map<ElementId<Dim>, std::vector<BlockLogicalCoords<Dim>>>
+        target_block_logical_coords{};
     for (const std::string& file_name : file_paths) {
       // Open the volume data file
       h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
@@ -570,13 +578,27 @@ struct ReadAllVolumeDataAndDistribute {
         if (enable_interpolation) {
           // Transform the target points to block logical coords in the source
           // domain
-          const auto source_block_logical_coords = block_logical_coordinates(
-              *source_domain, target_points, observation_value,
-              source_domain_functions_of_time);
+          if (not source_bounding_boxes.has_value()) {
+            source_bounding_boxes.emplace(*source_domain, observation_value,
+                                          source_domain_functions_of_time);
+          }
+          auto source_block_logical_coords =
+              target_block_logical_coords.find(target_element_id);
+          if (source_block_logical_coords ==
+              target_block_logical_coords.end()) {
+            source_block_logical_coords =
+                target_block_logical_coords
+                    .emplace(target_element_id,
+                             block_logical_coordinates(
+                                 *source_domain, target_points,
+                                 *source_bounding_boxes, {}, observation_value,
+                                 source_domain_functions_of_time))
+                    .first;
+          }
           // Find the target points in the subset of source elements contained
           // in this volume file
           source_element_logical_coords = element_logical_coordinates(
-              source_element_ids, source_block_logical_coords);
+              source_element_ids, source_block_logical_coords->second);
           overlapping_source_element_ids.reserve(
               source_element_logical_coords.size());
           for (const auto& source_element_id_and_coords :
@@ -667,6 +689,7 @@ struct ReadAllVolumeDataAndDistribute {
               completed_target_elements.insert(target_element_id);
               target_element_data_buffer.erase(target_element_id);
               all_indices_of_filled_interp_points.erase(target_element_id);
+              target_block_logical_coords.erase(target_element_id);
             }
           } else {
             // Verify that the inertial coordinates of the source and target
@@ -11,6 +11,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Index.hpp"
+#include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
@@ -29,6 +30,11 @@ namespace observers {
  * \brief %Actions used by the observer parallel component
  */
 namespace Actions {
+/// \cond
+struct RegisterVolumeNodeWithWritingNode;
+struct DeregisterVolumeNodeWithWritingNode;
+/// \endcond
+
 /// \brief Register an `ArrayComponentId` with a specific
 /// `ObservationIdRegistrationKey` that will call
 /// `observers::ThreadedActions::ContributeVolumeData`.
@@ -40,12 +46,12 @@ struct RegisterVolumeContributorWithObserverWriter {
   template <typename ParallelComponent, typename DbTagsList,
             typename Metavariables, typename ArrayIndex>
   static void apply(db::DataBox<DbTagsList>& box,
-                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const observers::ObservationKey& observation_key,
                     const Parallel::ArrayComponentId& id_of_caller) {
     db::mutate<Tags::ExpectedContributorsForObservations>(
-        [&id_of_caller,
+        [&cache, &id_of_caller,
          &observation_key](const gsl::not_null<std::unordered_map<
                                ObservationKey,
                                std::unordered_set<Parallel::ArrayComponentId>>*>
@@ -54,6 +60,18 @@ struct RegisterVolumeContributorWithObserverWriter {
               volume_observers_registered->end()) {
             (*volume_observers_registered)[observation_key] =
                 std::unordered_set<Parallel::ArrayComponentId>{};
+            if constexpr (single_volume_file_v<Metavariables>) {
+              auto& my_proxy =
+                  Parallel::get_parallel_component<ParallelComponent>(cache);
+              Parallel::simple_action<
+                  Actions::RegisterVolumeNodeWithWritingNode>(
+                  Parallel::get_parallel_component<
+                      ObserverWriter<Metavariables>>(cache)[0],
+                  observation_key,
+                  Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy)));
+            } else {
+              (void)cache;
+            }
           }
 
           if (UNLIKELY(
@@ -82,12 +100,12 @@ struct DeregisterVolumeContributorWithObserverWriter {
   template <typename ParallelComponent, typename DbTagsList,
             typename Metavariables, typename ArrayIndex>
   static void apply(db::DataBox<DbTagsList>& box,
-                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const observers::ObservationKey& observation_key,
                     const Parallel::ArrayComponentId& id_of_caller) {
     db::mutate<Tags::ExpectedContributorsForObservations>(
-        [&id_of_caller,
+        [&cache, &id_of_caller,
          &observation_key](const gsl::not_null<std::unordered_map<
                                ObservationKey,
                                std::unordered_set<Parallel::ArrayComponentId>>*>
@@ -113,6 +131,104 @@ struct DeregisterVolumeContributorWithObserverWriter {
                   volume_observers_registered->at(observation_key).size() ==
                   0)) {
             volume_observers_registered->erase(observation_key);
+            if constexpr (single_volume_file_v<Metavariables>) {
+              auto& my_proxy =
+                  Parallel::get_parallel_component<ParallelComponent>(cache);
+              Parallel::simple_action<
+                  Actions::DeregisterVolumeNodeWithWritingNode>(
+                  Parallel::get_parallel_component<
+                      ObserverWriter<Metavariables>>(cache)[0],
+                  observation_key,
+                  Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy)));
+            } else {
+              (void)cache;
+            }
+          }
+        },
+        make_not_null(&box));
+  }
+};
+
+/*!
+ * \brief Register a node with the node that writes the volume data to disk
+ * when `observers::single_volume_file_v` is enabled.
+ */
+struct RegisterVolumeNodeWithWritingNode {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationKey& observation_key,
+                    const size_t caller_node_id) {
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const auto node_id =
+        Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy));
+    ASSERT(node_id == 0, "Only node zero, not node "
+                             << node_id
+                             << ", should be called from another node");
+
+    db::mutate<Tags::NodesExpectedToContributeVolumeData>(
+        [&caller_node_id, &observation_key](
+            const gsl::not_null<
+                std::unordered_map<ObservationKey, std::set<size_t>>*>
+                volume_observers_registered_nodes) {
+          auto& registered_nodes_for_key =
+              (*volume_observers_registered_nodes)[observation_key];
+          if (UNLIKELY(registered_nodes_for_key.find(caller_node_id) !=
+                       registered_nodes_for_key.end())) {
+            ERROR("Already registered node " << caller_node_id
+                                             << " for volume observations.");
+          }
+          registered_nodes_for_key.insert(caller_node_id);
+        },
+        make_not_null(&box));
+  }
+};
+
+/*!
+ * \brief Deregister a node with the node that writes the volume data to disk
+ * when `observers::single_volume_file_v` is enabled.
+ */
+struct DeregisterVolumeNodeWithWritingNode {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationKey& observation_key,
+                    const size_t caller_node_id) {
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const auto node_id =
+        Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy));
+    ASSERT(node_id == 0,
+           "Only node zero, not node "
+               << node_id << " should deregister other nodes in the volume "
+               << "observations");
+
+    db::mutate<Tags::NodesExpectedToContributeVolumeData>(
+        [&caller_node_id, &observation_key](
+            const gsl::not_null<
+                std::unordered_map<ObservationKey, std::set<size_t>>*>
+                volume_observers_registered_nodes) {
+          if (UNLIKELY(
+                  volume_observers_registered_nodes->find(observation_key) ==
+                  volume_observers_registered_nodes->end())) {
+            ERROR(
+                "Trying to deregister a node associated with an unregistered "
+                "observation key: "
+                << observation_key);
+          }
+          auto& registered_nodes_for_key =
+              volume_observers_registered_nodes->at(observation_key);
+          if (UNLIKELY(registered_nodes_for_key.find(caller_node_id) ==
+                       registered_nodes_for_key.end())) {
+            ERROR("Trying to deregister an unregistered node: "
+                  << caller_node_id);
+          }
+          registered_nodes_for_key.erase(caller_node_id);
+          if (UNLIKELY(registered_nodes_for_key.empty())) {
+            volume_observers_registered_nodes->erase(observation_key);
           }
         },
         make_not_null(&box));
@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/BackgroundWriter.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace observers {
+BackgroundWriter::BackgroundWriter() : thread_([this]() { run(); }) {}
+
+BackgroundWriter::~BackgroundWriter() {
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  task_queued_.notify_one();
+  thread_.join();
+}
+
+void BackgroundWriter::enqueue(std::function<void()> task) {
+  {
+    std::unique_lock lock(mutex_);
+    task_finished_.wait(
+        lock, [this]() { return tasks_.size() < max_pending_tasks; });
+    tasks_.push_back(std::move(task));
+  }
+  task_queued_.notify_one();
+}
+
+void BackgroundWriter::wait_until_idle() {
+  std::unique_lock lock(mutex_);
+  task_finished_.wait(lock,
+                      [this]() { return tasks_.empty() and not task_running_; });
+}
+
+void BackgroundWriter::run() {
+  std::unique_lock lock(mutex_);
+  while (true) {
+    task_queued_.wait(lock, [this]() { return stop_ or not tasks_.empty(); });
+    // Queued tasks are finished even when stopping
+    if (tasks_.empty()) {
+      return;
+    }
+    std::function<void()> task = std::move(tasks_.front());
+    tasks_.pop_front();
+    task_running_ = true;
+    lock.unlock();
+    task_finished_.notify_all();
+    task();
+    lock.lock();
+    task_running_ = false;
+    task_finished_.notify_all();
+  }
+}
+
+BackgroundWriter& background_writer() {
+  static BackgroundWriter writer{};
+  return writer;
+}
+}  // namespace observers
@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Executes file writes on a background thread so that the caller can
+ * continue working while the data is written to disk.
+ *
+ * Tasks are executed in the order in which they are queued. The writer is
+ * double-buffered: one task is being written while at most
+ * `max_pending_tasks` more are queued. `enqueue` blocks while the queue is
+ * full, which bounds the amount of memory held by data waiting to be written.
+ *
+ * The tasks are responsible for acquiring any locks they need, e.g. the
+ * `observers::Tags::H5FileLock`, since HDF5 is not assumed to be thread-safe.
+ * The destructor finishes all queued tasks before joining the thread, so all
+ * data is on disk once the process exits normally.
+ *
+ * Use `observers::background_writer()` to get the writer of this process.
+ */
+class BackgroundWriter {
+ public:
+  static constexpr size_t max_pending_tasks = 1;
+
+  BackgroundWriter();
+  BackgroundWriter(const BackgroundWriter&) = delete;
+  BackgroundWriter& operator=(const BackgroundWriter&) = delete;
+  BackgroundWriter(BackgroundWriter&&) = delete;
+  BackgroundWriter& operator=(BackgroundWriter&&) = delete;
+  ~BackgroundWriter();
+
+  /// Queue `task` for execution on the background thread, blocking while
+  /// `max_pending_tasks` tasks are already waiting.
+  void enqueue(std::function<void()> task);
+
+  /// Block until all queued tasks have finished.
+  void wait_until_idle();
+
+ private:
+  void run();
+
+  std::mutex mutex_{};
+  std::condition_variable task_queued_{};
+  std::condition_variable task_finished_{};
+  std::deque<std::function<void()>> tasks_{};
+  bool task_running_{false};
+  bool stop_{false};
+  std::thread thread_{};
+};
+
+/// \ingroup ObserversGroup
+/// The `BackgroundWriter` of this process, started on first use.
+BackgroundWriter& background_writer();
+
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(asynchronous_volume_writes)
+}  // namespace detail
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Whether volume data is written to disk on the `BackgroundWriter`
+ * instead of on the thread that received the last contribution.
+ *
+ * Opt in by setting `static constexpr bool asynchronous_volume_writes = true;`
+ * in the metavariables.
+ */
+template <typename Metavariables>
+constexpr bool asynchronous_volume_writes_v =
+    detail::get_asynchronous_volume_writes_or_default_v<Metavariables, false>;
+}  // namespace observers
@@ -9,6 +9,7 @@
 #include "Parallel/Tags/InputSource.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace observers {
 namespace detail {
@@ -29,8 +30,24 @@ struct make_reduction_data_tag_impl {
   using type = tmpl::wrap<typename ReductionDataType::datum_list,
                           ::observers::Tags::ReductionData>;
 };
+
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(single_volume_file)
 }  // namespace detail
 
+/*!
+ * \brief Whether the volume data from all nodes is written to a single file
+ * by node 0 instead of one file per node.
+ *
+ * Opt in by setting `static constexpr bool single_volume_file = true;` in the
+ * metavariables. Each node still collects the data of its elements, but then
+ * sends it to node 0 which writes it to `VolumeFileName.h5`. This removes the
+ * need to combine the per-node files after the run, at the cost of moving all
+ * volume data through node 0.
+ */
+template <typename Metavariables>
+constexpr bool single_volume_file_v =
+    detail::get_single_volume_file_or_default_v<Metavariables, false>;
+
 /// Function that returns from the global cache a string containing the
 /// options provided in the yaml-formatted input file, if those options are
 /// in the global cache. Otherwise, returns an empty string.
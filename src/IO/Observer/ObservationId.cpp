@@ -35,7 +35,10 @@ std::ostream& operator<<(std::ostream& os, const ObservationKey& t) {
 }
 
 ObservationId::ObservationId(const double t, std::string tag)
-    : observation_key_(std::move(tag)),
+    : ObservationId(t, ObservationKey{std::move(tag)}) {}
+
+ObservationId::ObservationId(const double t, ObservationKey key)
+    : observation_key_(std::move(key)),
       combined_hash_([&t](size_t type_hash) {
         size_t combined = type_hash;
         boost::hash_combine(combined, t);
@@ -78,6 +78,12 @@ class ObservationId {
    */
   ObservationId(double t, std::string tag);
 
+  /*!
+   * \brief Construct from a value and an existing ObservationKey
+   *
+   * This reuses the hash of the tag stored in the `key`, so it avoids hashing
+   * the tag again for every observation of the same type.
+   */
   ObservationId(double t, ObservationKey key);
 
   /// Hash used to distinguish between ObservationIds of different
@@ -4,11 +4,16 @@
 #pragma once
 
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
 #include "IO/Observer/Tags.hpp"
+#include "IO/Observer/WriteActionTimings.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -63,6 +68,29 @@ struct ObserverWriter {
 
   static void execute_next_phase(
       const Parallel::Phase /*next_phase*/,
-      Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
+      [[maybe_unused]] Parallel::CProxy_GlobalCache<Metavariables>&
+          global_cache) {
+#ifdef SPECTRE_PROFILE_ACTIONS
+    write_action_timings(global_cache);
+#endif  // SPECTRE_PROFILE_ACTIONS
+    if constexpr (buffered_reduction_writes_v<Metavariables>) {
+      auto& local_cache = *Parallel::local_branch(global_cache);
+      Parallel::threaded_action<ThreadedActions::FlushReductionData>(
+          Parallel::get_parallel_component<ObserverWriter>(local_cache));
+    }
+  }
+
+  /// \brief Write the `Parallel::ActionTimings` of all nodes to the
+  /// reductions file.
+  ///
+  /// This is called at every phase change, including the one to
+  /// `Parallel::Phase::Exit`, when SpECTRE is configured with
+  /// `-D SPECTRE_PROFILE_ACTIONS=ON`.
+  static void write_action_timings(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::threaded_action<ThreadedActions::WriteActionTimings>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache));
+  }
 };
 }  // namespace observers
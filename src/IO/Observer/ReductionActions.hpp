@@ -19,6 +19,7 @@
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/Protocols/ReductionDataFormatter.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -229,7 +230,9 @@ void append_to_reduction_data(
     const gsl::not_null<std::vector<double>*> all_reduction_data,
     const std::vector<double>& t);
 
-template <typename... Ts, size_t... Is>
+// If `Buffered` is true the row is collected in the `ReductionDataBuffer`,
+// which writes it to disk later together with other rows.
+template <bool Buffered = false, typename... Ts, size_t... Is>
 void write_data(const std::string& subfile_name,
                 const std::string& input_source,
                 std::vector<std::string> legend, const std::tuple<Ts...>& data,
@@ -249,12 +252,21 @@ void write_data(const std::string& subfile_name,
         << " pieces of data being reduced");
   }
 
-  h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
-                                               input_source);
-  constexpr size_t version_number = 0;
-  auto& time_series_file = h5file.try_insert<h5::Dat>(
-      subfile_name, std::move(legend), version_number);
-  time_series_file.append(data_to_append);
+  if constexpr (Buffered) {
+    auto& buffer = reduction_data_buffer();
+    buffer.append(file_prefix, input_source, subfile_name, std::move(legend),
+                  std::move(data_to_append));
+    if (buffer.needs_flush()) {
+      buffer.flush();
+    }
+  } else {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
+                                                 input_source);
+    constexpr size_t version_number = 0;
+    auto& time_series_file = h5file.try_insert<h5::Dat>(
+        subfile_name, std::move(legend), version_number);
+    time_series_file.append(data_to_append);
+  }
 }
 }  // namespace ReductionActions_detail
 
@@ -380,7 +392,8 @@ struct CollectReductionDataOnNode {
         auto& my_proxy =
             Parallel::get_parallel_component<ParallelComponent>(cache);
         const std::lock_guard hold_file_lock(*reduction_file_lock);
-        ReductionActions_detail::write_data(
+        ReductionActions_detail::write_data<
+          buffered_reduction_writes_v<Metavariables>>(
             "/Core" + std::to_string(observe_with_core_id.value()) +
                 subfile_name,
             observers::input_source_from_cache(cache),
@@ -631,7 +644,8 @@ struct WriteReductionData {
               std::apply(*formatter, received_reduction_data.data()) + "\n");
         }
       }
-      ReductionActions_detail::write_data(
+      ReductionActions_detail::write_data<
+          buffered_reduction_writes_v<Metavariables>>(
           subfile_name, observers::input_source_from_cache(cache),
           // NOLINTNEXTLINE(bugprone-use-after-move)
           std::move(reduction_names), std::move(received_reduction_data.data()),
@@ -691,7 +705,8 @@ struct WriteReductionDataRow {
     auto& reduction_file_lock =
         db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
     const std::lock_guard hold_lock(reduction_file_lock);
-    ThreadedActions::ReductionActions_detail::write_data(
+    ThreadedActions::ReductionActions_detail::write_data<
+        buffered_reduction_writes_v<Metavariables>>(
         subfile_name, observers::input_source_from_cache(cache),
         std::move(legend), std::move(reduction_data),
         Parallel::get<Tags::ReductionFileName>(cache),
@@ -699,5 +714,25 @@ struct WriteReductionDataRow {
   }
 };
 
+/*!
+ * \brief Write all rows of reduction data that are held in the
+ * `observers::ReductionDataBuffer` of this node to disk.
+ *
+ * This is invoked on all nodes of the `observers::ObserverWriter` at every
+ * phase change when `observers::buffered_reduction_writes_v` is enabled.
+ */
+struct FlushReductionData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/) {
+    auto& reduction_file_lock =
+        db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
+    const std::lock_guard hold_lock(reduction_file_lock);
+    reduction_data_buffer().flush();
+  }
+};
 }  // namespace ThreadedActions
 }  // namespace observers
@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/ReductionDataBuffer.hpp"
+
+#include <cstddef>
+#include <hdf5.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace observers {
+ReductionDataBuffer::ReductionDataBuffer() {
+  // Make sure HDF5 is initialized before the buffer so that HDF5 is only
+  // shut down at exit after the destructor has flushed the buffer
+  H5open();
+}
+
+ReductionDataBuffer::~ReductionDataBuffer() { flush(); }
+
+void ReductionDataBuffer::append(const std::string& file_prefix,
+                                 const std::string& input_source,
+                                 const std::string& subfile_name,
+                                 std::vector<std::string> legend,
+                                 std::vector<double> row) {
+  {
+    const auto file = files_.find(file_prefix);
+    if (file != files_.end()) {
+      const auto subfile = file->second.subfiles.find(subfile_name);
+      if (subfile != file->second.subfiles.end() and
+          subfile->second.legend != legend) {
+        flush();
+      }
+    }
+  }
+  if (number_of_rows_ == 0) {
+    time_of_oldest_row_ = sys::wall_time();
+  }
+  auto& file = files_[file_prefix];
+  if (file.input_source.empty()) {
+    file.input_source = input_source;
+  }
+  auto& subfile = file.subfiles[subfile_name];
+  if (subfile.rows.empty()) {
+    subfile.legend = std::move(legend);
+  }
+  subfile.rows.push_back(std::move(row));
+  ++number_of_rows_;
+}
+
+bool ReductionDataBuffer::needs_flush() const {
+  return number_of_rows_ >= max_buffered_rows or
+         (number_of_rows_ > 0 and
+          sys::wall_time() - time_of_oldest_row_ >= max_buffered_seconds);
+}
+
+void ReductionDataBuffer::flush() {
+  constexpr size_t version_number = 0;
+  for (auto& [file_prefix, file] : files_) {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
+                                                 file.input_source);
+    for (auto& [subfile_name, subfile] : file.subfiles) {
+      auto& dat_file = h5file.try_insert<h5::Dat>(
+          subfile_name, std::move(subfile.legend), version_number);
+      dat_file.append(subfile.rows);
+      h5file.close_current_object();
+    }
+  }
+  files_.clear();
+  number_of_rows_ = 0;
+}
+
+ReductionDataBuffer& reduction_data_buffer() {
+  static ReductionDataBuffer buffer{};
+  return buffer;
+}
+}  // namespace observers
@@ -0,0 +1,97 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Buffers rows of reduction data in memory and writes them to their
+ * `h5::Dat` subfiles in batches.
+ *
+ * Writing a row of reduction data means opening the H5 file and a `h5::Dat`
+ * subfile, which dominates the cost of writing small rows. When many subfiles
+ * are written every step, the buffer instead collects the rows and writes all
+ * of them with a single open of each H5 file and a single append per subfile.
+ *
+ * The buffer requests a flush once it holds `max_buffered_rows` rows or its
+ * oldest row is `max_buffered_seconds` old. It also is flushed at every phase
+ * change (so, e.g., checkpoints are consistent with the reduction files) and
+ * when it is destroyed at process exit. Rows that are still buffered when the
+ * run aborts are lost.
+ *
+ * The buffer is not thread-safe. Access it while holding the
+ * `observers::Tags::H5FileLock`.
+ *
+ * Use `observers::reduction_data_buffer()` to get the buffer of this process.
+ */
+class ReductionDataBuffer {
+ public:
+  static constexpr size_t max_buffered_rows = 100;
+  static constexpr double max_buffered_seconds = 10.0;
+
+  ReductionDataBuffer();
+  ReductionDataBuffer(const ReductionDataBuffer&) = delete;
+  ReductionDataBuffer& operator=(const ReductionDataBuffer&) = delete;
+  ReductionDataBuffer(ReductionDataBuffer&&) = delete;
+  ReductionDataBuffer& operator=(ReductionDataBuffer&&) = delete;
+  ~ReductionDataBuffer();
+
+  /// Buffer a `row` for the `subfile_name` in the file `file_prefix + ".h5"`.
+  /// If rows with a different legend are already buffered for the subfile,
+  /// the buffer is flushed first so the rows are written in order.
+  void append(const std::string& file_prefix, const std::string& input_source,
+              const std::string& subfile_name, std::vector<std::string> legend,
+              std::vector<double> row);
+
+  /// Whether the buffer is full or holds rows that are older than
+  /// `max_buffered_seconds`
+  bool needs_flush() const;
+
+  /// Write all buffered rows to disk
+  void flush();
+
+  size_t number_of_buffered_rows() const { return number_of_rows_; }
+
+ private:
+  struct BufferedSubfile {
+    std::vector<std::string> legend{};
+    std::vector<std::vector<double>> rows{};
+  };
+  struct BufferedFile {
+    std::string input_source{};
+    std::map<std::string, BufferedSubfile> subfiles{};
+  };
+
+  std::map<std::string, BufferedFile> files_{};
+  size_t number_of_rows_{0};
+  double time_of_oldest_row_{0.0};
+};
+
+/// \ingroup ObserversGroup
+/// The `ReductionDataBuffer` of this process, created on first use.
+ReductionDataBuffer& reduction_data_buffer();
+
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(buffered_reduction_writes)
+}  // namespace detail
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Whether rows of reduction data are collected in the
+ * `ReductionDataBuffer` instead of being written to disk one at a time.
+ *
+ * Opt in by setting `static constexpr bool buffered_reduction_writes = true;`
+ * in the metavariables.
+ */
+template <typename Metavariables>
+constexpr bool buffered_reduction_writes_v =
+    detail::get_buffered_reduction_writes_or_default_v<Metavariables, false>;
+}  // namespace observers
@@ -101,6 +101,31 @@ struct VolumeDataLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// \brief The set of nodes that have contributed to each `ObservationId` for
+/// writing volume data to a single file
+///
+/// This is only used on node 0 when `observers::single_volume_file_v` is
+/// enabled. The `unordered_set` is the node IDs that have contributed so far.
+struct NodesThatContributedVolumeData : db::SimpleTag {
+  using type = std::unordered_map<ObservationId, std::unordered_set<size_t>>;
+};
+
+/// \brief The set of nodes that are registered with each
+/// `ObservationIdRegistrationKey` for writing volume data to a single file
+///
+/// This is only used on node 0 when `observers::single_volume_file_v` is
+/// enabled.
+struct NodesExpectedToContributeVolumeData : db::SimpleTag {
+  using type = std::unordered_map<ObservationKey, std::set<size_t>>;
+};
+
+/// Volume tensor data received from the nodes, to be written to a single file
+/// by node 0 once all nodes have contributed.
+struct VolumeDataFromNodes : db::SimpleTag {
+  using type = std::unordered_map<observers::ObservationId,
+                                  std::vector<ElementVolumeData>>;
+};
+
 /// Volume tensor data to be written to disk.
 struct TensorData : db::SimpleTag {
   using type = std::unordered_map<
@@ -5,9 +5,15 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <mutex>
 #include <optional>
+#include <set>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Index.hpp"
@@ -18,6 +24,7 @@
 #include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/BackgroundWriter.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -157,7 +164,75 @@ void write_data(const std::string& h5_file_name,
                 const std::string& subfile_path,
                 const observers::ObservationId& observation_id,
                 std::vector<ElementVolumeData>&& volume_data);
+
+/// Write `volume_data_to_write` to the subfile `subfile_name` of
+/// `h5_file_name`, together with the serialized domain and functions of time.
+/// The write is done on the `observers::BackgroundWriter` if
+/// `observers::asynchronous_volume_writes_v` is enabled.
+template <typename Metavariables>
+void write_volume_data_to_disk(
+    Parallel::GlobalCache<Metavariables>& cache,
+    const gsl::not_null<Parallel::NodeLock*> volume_file_lock,
+    std::string h5_file_name, const std::string& subfile_name,
+    const observers::ObservationId& observation_id,
+    std::vector<ElementVolumeData>&& volume_data_to_write) {
+  // Serialize domain. See `Domain` docs for details on the serialization.
+  // The domain is retrieved from the global cache using the standard
+  // domain tag. If more flexibility is required here later, then the
+  // domain can be passed along with the `ContributeVolumeData` action.
+  std::vector<char> serialized_domain = serialize(
+      Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(cache));
+  std::optional<std::vector<char>> serialized_functions_of_time =
+      [&cache]() -> std::optional<std::vector<char>> {
+    // Functions-of-time are in the _mutable_ global cache, so they aren't
+    // accessible through the DataBox by default
+    if constexpr (Parallel::is_in_global_cache<
+                      Metavariables, domain::Tags::FunctionsOfTime>) {
+      return serialize(get<domain::Tags::FunctionsOfTime>(cache));
+    } else {
+      (void)cache;
+      return std::nullopt;
+    }
+  }();
+
+  // Write to file. We use a separate node lock because writing can be
+  // very time consuming (it's network dependent, depends on how full the
+  // disks are, what other users are doing, etc.) and we want to be able
+  // to continue to work on the nodegroup while we are writing data to
+  // disk. The write task owns all the data it needs so that it can also
+  // be executed on the background writer.
+  auto write = [volume_file_lock, h5_file_name = std::move(h5_file_name),
+                input_source = observers::input_source_from_cache(cache),
+                subfile_name, observation_id,
+                volume_data_to_write = std::move(volume_data_to_write),
+                serialized_domain = std::move(serialized_domain),
+                serialized_functions_of_time =
+                    std::move(serialized_functions_of_time)]() {
+    // The lock is acquired first so that the HDF5 file is closed before
+    // the lock is released.
+    const std::lock_guard hold_lock(*volume_file_lock);
+    h5::H5File<h5::AccessType::ReadWrite> h5file(h5_file_name, true,
+                                                 input_source);
+    constexpr size_t version_number = 0;
+    auto& volume_file =
+        h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
+    // Write the data to the file
+    volume_file.write_volume_data(
+        observation_id.hash(), observation_id.value(), volume_data_to_write,
+        serialized_domain, serialized_functions_of_time);
+  };
+  if constexpr (asynchronous_volume_writes_v<Metavariables>) {
+    background_writer().enqueue(std::move(write));
+  } else {
+    write();
+  }
+}
 }  // namespace VolumeActions_detail
+
+/// \cond
+struct ContributeVolumeDataToWritingNode;
+/// \endcond
+
 /*!
  * \ingroup ObserversGroup
  * \brief Move data to the observer writer for writing to disk.
@@ -333,9 +408,9 @@ struct ContributeVolumeDataToWriter {
       if constexpr (std::is_same_v<tmpl::at_c<VolumeDataAtObsId, 1>,
                                    ElementVolumeData>) {
         volume_data_to_write.reserve(volume_data.size());
-        for (const auto& [id, element] : volume_data) {
+        for (auto& [id, element] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.push_back(element);
+          volume_data_to_write.push_back(std::move(element));
         }
       } else {
         size_t total_size = 0;
@@ -345,59 +420,132 @@ struct ContributeVolumeDataToWriter {
         }
         volume_data_to_write.reserve(total_size);
 
-        for (const auto& [id, vec_elements] : volume_data) {
+        for (auto& [id, vec_elements] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.insert(volume_data_to_write.end(),
-                                      vec_elements.begin(), vec_elements.end());
+          volume_data_to_write.insert(
+              volume_data_to_write.end(),
+              std::make_move_iterator(vec_elements.begin()),
+              std::make_move_iterator(vec_elements.end()));
         }
       }
 
-      // Write to file. We use a separate node lock because writing can be
-      // very time consuming (it's network dependent, depends on how full the
-      // disks are, what other users are doing, etc.) and we want to be able
-      // to continue to work on the nodegroup while we are writing data to
-      // disk.
-      const std::lock_guard hold_lock(*volume_file_lock);
-      {
-        // Scoping is for closing HDF5 file before we release the lock.
-        const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
-        h5::H5File<h5::AccessType::ReadWrite> h5file(
-            file_prefix +
-                std::to_string(
-                    Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
-                ".h5",
-            true, observers::input_source_from_cache(cache));
-        constexpr size_t version_number = 0;
-        auto& volume_file =
-            h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      const auto my_node =
+          Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy));
+      if constexpr (single_volume_file_v<Metavariables>) {
+        // Node 0 writes the data of all nodes into a single file.
+        Parallel::threaded_action<ContributeVolumeDataToWritingNode>(
+            Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+                cache)[0],
+            observation_id, subfile_name, my_node,
+            std::move(volume_data_to_write));
+      } else {
+        VolumeActions_detail::write_volume_data_to_disk(
+            cache, make_not_null(volume_file_lock),
+            Parallel::get<Tags::VolumeFileName>(cache) +
+                std::to_string(my_node) + ".h5",
+            subfile_name, observation_id, std::move(volume_data_to_write));
+      }
+    }
+  }
+};
 
-        // Serialize domain. See `Domain` docs for details on the serialization.
-        // The domain is retrieved from the global cache using the standard
-        // domain tag. If more flexibility is required here later, then the
-        // domain can be passed along with the `ContributeVolumeData` action.
-        const auto serialized_domain = serialize(
-            Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
-                cache));
-        const auto serialized_functions_of_time =
-            [&cache]() -> std::optional<std::vector<char>> {
-          // Functions-of-time are in the _mutable_ global cache, so they aren't
-          // accessible through the DataBox by default
-          if constexpr (Parallel::is_in_global_cache<
-                            Metavariables, domain::Tags::FunctionsOfTime>) {
-            return serialize(get<domain::Tags::FunctionsOfTime>(cache));
-          } else {
-            (void)cache;
-            return std::nullopt;
-          }
-        }();
-        // Write the data to the file
-        volume_file.write_volume_data(
-            observation_id.hash(), observation_id.value(), volume_data_to_write,
-            serialized_domain, serialized_functions_of_time);
+/*!
+ * \ingroup ObserversGroup
+ * \brief Collect the volume data of all nodes on node 0 and write it to a
+ * single file.
+ *
+ * This is invoked by `ContributeVolumeDataToWriter` on node 0 if
+ * `observers::single_volume_file_v` is enabled. Once all nodes registered
+ * for the observation have contributed, the data is written to
+ * `VolumeFileName.h5`.
+ */
+struct ContributeVolumeDataToWritingNode {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name, const size_t sender_node,
+                    std::vector<ElementVolumeData>&& received_volume_data) {
+    // See `ContributeVolumeDataToWriter` for why we retrieve pointers to the
+    // data in the DataBox.
+    std::unordered_map<ObservationId, std::vector<ElementVolumeData>>*
+        all_volume_data = nullptr;
+    std::unordered_map<ObservationId, std::unordered_set<size_t>>*
+        nodes_contributed = nullptr;
+    Parallel::NodeLock* volume_data_lock = nullptr;
+    Parallel::NodeLock* volume_file_lock = nullptr;
+    size_t nodes_registered_with_key = std::numeric_limits<size_t>::max();
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      db::mutate<Tags::VolumeDataFromNodes,
+                 Tags::NodesThatContributedVolumeData, Tags::VolumeDataLock,
+                 Tags::H5FileLock>(
+          [&all_volume_data, &nodes_contributed, &nodes_registered_with_key,
+           &observation_id, &volume_data_lock, &volume_file_lock](
+              const gsl::not_null<std::unordered_map<
+                  ObservationId, std::vector<ElementVolumeData>>*>
+                  volume_data_ptr,
+              const gsl::not_null<std::unordered_map<
+                  ObservationId, std::unordered_set<size_t>>*>
+                  nodes_contributed_ptr,
+              const gsl::not_null<Parallel::NodeLock*> volume_data_lock_ptr,
+              const gsl::not_null<Parallel::NodeLock*> volume_file_lock_ptr,
+              const std::unordered_map<ObservationKey, std::set<size_t>>&
+                  nodes_registered) {
+            const auto registered_nodes =
+                nodes_registered.find(observation_id.observation_key());
+            if (UNLIKELY(registered_nodes == nodes_registered.end())) {
+              ERROR("No nodes are registered for the volume observation "
+                    << observation_id << ". Known keys are "
+                    << keys_of(nodes_registered));
+            }
+            nodes_registered_with_key = registered_nodes->second.size();
+            all_volume_data = &*volume_data_ptr;
+            nodes_contributed = &*nodes_contributed_ptr;
+            volume_data_lock = &*volume_data_lock_ptr;
+            volume_file_lock = &*volume_file_lock_ptr;
+          },
+          make_not_null(&box),
+          db::get<Tags::NodesExpectedToContributeVolumeData>(box));
+    }
+
+    std::vector<ElementVolumeData> volume_data_to_write{};
+    bool perform_write = false;
+    {
+      const std::lock_guard hold_lock(*volume_data_lock);
+      auto& contributed_nodes = (*nodes_contributed)[observation_id];
+      if (UNLIKELY(not contributed_nodes.insert(sender_node).second)) {
+        ERROR("Already received volume data to observation id "
+              << observation_id << " from node " << sender_node);
+      }
+      auto& current_data = (*all_volume_data)[observation_id];
+      if (current_data.empty()) {
+        current_data = std::move(received_volume_data);
+      } else {
+        current_data.insert(
+            current_data.end(),
+            std::make_move_iterator(received_volume_data.begin()),
+            std::make_move_iterator(received_volume_data.end()));
+      }
+      if (contributed_nodes.size() == nodes_registered_with_key) {
+        perform_write = true;
+        volume_data_to_write = std::move(current_data);
+        all_volume_data->erase(observation_id);
+        nodes_contributed->erase(observation_id);
       }
     }
+
+    if (perform_write) {
+      VolumeActions_detail::write_volume_data_to_disk(
+          cache, make_not_null(volume_file_lock),
+          Parallel::get<Tags::VolumeFileName>(cache) + ".h5", subfile_name,
+          observation_id, std::move(volume_data_to_write));
+    }
   }
 };
 
@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeString.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace observers::ThreadedActions {
+/*!
+ * \brief Write the `Parallel::ActionTimings` recorded on this node since the
+ * last call to the reductions file.
+ *
+ * Each action of each component gets a subfile
+ * `/ActionTimings/<Phase>/<Component>/<Action>.dat` with one row per node and
+ * call of this action, holding the timings accumulated since the previous
+ * call. Sum the rows to get the totals for the run.
+ *
+ * This is invoked on all nodes of the `observers::ObserverWriter` at every
+ * phase change when SpECTRE is configured with
+ * `-D SPECTRE_PROFILE_ACTIONS=ON`.
+ */
+struct WriteActionTimings {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/) {
+    const Parallel::ActionTimings timings = Parallel::collect_action_timings();
+    if (timings.empty()) {
+      return;
+    }
+    const double wall_time = sys::wall_time();
+    const auto node = static_cast<double>(Parallel::my_node<size_t>(cache));
+    const std::vector<std::string> legend{
+        "WallclockTime", "Node",      "Calls",   "Retries",
+        "Time",          "RetryTime", "WaitTime"};
+    auto& writer_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache)[0];
+    for (const auto& [key, timing] : timings) {
+      const auto& [component_name, phase, action_name] = key;
+      Parallel::threaded_action<WriteReductionDataRow>(
+          writer_proxy,
+          std::string{MakeString{} << "/ActionTimings/" << phase << "/"
+                                   << component_name << "/" << action_name},
+          legend,
+          std::make_tuple(wall_time, node, static_cast<double>(timing.calls),
+                          static_cast<double>(timing.retries), timing.time,
+                          timing.retry_time, timing.wait_time));
+    }
+  }
+};
+}  // namespace observers::ThreadedActions
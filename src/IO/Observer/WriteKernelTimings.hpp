@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/KernelTimings.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers::ThreadedActions {
+/*!
+ * \brief Write the `Parallel::KernelTimings` recorded on this node since the
+ * last call to the reductions file.
+ *
+ * Each kernel gets a subfile `/KernelTimings/<Kernel>.dat` with one row per
+ * node and call of this action, holding the timings accumulated since the
+ * previous call. Sum the rows to get the totals for the run.
+ *
+ * This is invoked on all nodes of the `observers::ObserverWriter` by the
+ * `Events::ObserveKernelTimings` event.
+ */
+struct WriteKernelTimings {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const double time) {
+    const Parallel::KernelTimings timings = Parallel::collect_kernel_timings();
+    if (timings.empty()) {
+      return;
+    }
+    const auto node = static_cast<double>(Parallel::my_node<size_t>(cache));
+    const std::vector<std::string> legend{
+        "Time",    "Node",    "Calls",   "TotalTime",
+        "MinTime", "MaxTime", "MeanTime"};
+    auto& writer_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache)[0];
+    for (const auto& [kernel_name, timing] : timings) {
+      const auto calls = static_cast<double>(timing.calls);
+      Parallel::threaded_action<WriteReductionDataRow>(
+          writer_proxy, "/KernelTimings/" + kernel_name, legend,
+          std::make_tuple(time, node, calls, timing.time, timing.min_time,
+                          timing.max_time, timing.time / calls));
+    }
+  }
+};
+}  // namespace observers::ThreadedActions
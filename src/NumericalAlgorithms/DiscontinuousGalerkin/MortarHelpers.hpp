@@ -14,7 +14,9 @@
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionalId.hpp"
@@ -38,6 +40,25 @@ class OrientationMap;
 /// \endcond
 
 namespace dg {
+namespace MortarHelpers_detail {
+// Applies the projection matrices with scratch memory drawn from the thread's
+// `ScratchArena`, so projecting to and from mortars doesn't allocate.
+template <typename Tags, typename MatrixType, size_t Dim>
+void apply_projection(const gsl::not_null<Variables<Tags>*> result,
+                      const std::array<MatrixType, Dim>& matrices,
+                      const Variables<Tags>& vars, const Index<Dim>& extents) {
+  static_assert(std::is_same_v<typename Variables<Tags>::value_type, double>,
+                "Only real-valued data is projected through the ScratchArena");
+  ScratchArena arena{};
+  const size_t scratch_size = apply_matrices_detail::scratch_size(
+      matrices, extents, vars.number_of_independent_components);
+  DataVector scratch{};
+  if (scratch_size > 0) {
+    scratch.set_data_ref(arena.allocate(scratch_size).data(), scratch_size);
+  }
+  apply_matrices(result, matrices, vars, extents, make_not_null(&scratch));
+}
+}  // namespace MortarHelpers_detail
 
 template <size_t VolumeDim>
 using MortarId = DirectionalId<VolumeDim>;
@@ -80,7 +101,8 @@ void project_to_mortar(const gsl::not_null<Variables<Tags>*> result,
       face_mesh, mortar_mesh, mortar_size);
   // We don't add an ASSERT about sizes here because there's already one in
   // apply_matrices
-  apply_matrices(result, projection_matrices, vars, face_mesh.extents());
+  MortarHelpers_detail::apply_projection(result, projection_matrices, vars,
+                                         face_mesh.extents());
 }
 
 template <typename Tags, size_t Dim>
@@ -111,7 +133,8 @@ void project_from_mortar(const gsl::not_null<Variables<Tags>*> result,
       mortar_mesh, face_mesh, mortar_size);
   // We don't add an ASSERT about sizes here because there's already one in
   // apply_matrices
-  apply_matrices(result, projection_matrices, vars, mortar_mesh.extents());
+  MortarHelpers_detail::apply_projection(result, projection_matrices, vars,
+                                         mortar_mesh.extents());
 }
 
 template <typename Tags, size_t Dim>
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/DiscontinuousGalerkin/ProjectToBoundary.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace dg::detail {
+template <size_t Dim>
+void interpolate_to_boundary(const gsl::not_null<double*> face_data,
+                             const double* const volume_data,
+                             const size_t number_of_independent_components,
+                             const Index<Dim>& volume_extents,
+                             const size_t sliced_dim,
+                             const Matrix& interpolation_matrix) {
+  const size_t num_points_in_sliced_dim = volume_extents[sliced_dim];
+  ASSERT(interpolation_matrix.rows() == 1 and
+             interpolation_matrix.columns() == num_points_in_sliced_dim,
+         "The boundary interpolation matrix must be 1 x "
+             << num_points_in_sliced_dim << ", but is "
+             << interpolation_matrix.rows() << " x "
+             << interpolation_matrix.columns());
+  size_t stride = 1;
+  for (size_t d = 0; d < sliced_dim; ++d) {
+    stride *= volume_extents[d];
+  }
+  // The independent components are stored one after another, so they can be
+  // treated as an additional outermost dimension.
+  const size_t number_of_slabs = number_of_independent_components *
+                                 volume_extents.product() /
+                                 (stride * num_points_in_sliced_dim);
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t slab = 0; slab < number_of_slabs; ++slab) {
+    double* const face_slab = face_data.get() + slab * stride;
+    const double* const volume_slab =
+        volume_data + slab * stride * num_points_in_sliced_dim;
+    if (stride == 1) {
+      double result = 0.0;
+      for (size_t k = 0; k < num_points_in_sliced_dim; ++k) {
+        result += interpolation_matrix(0, k) * volume_slab[k];
+      }
+      *face_slab = result;
+    } else {
+      // Accumulate one contiguous row of the volume at a time so the inner
+      // loop vectorizes
+      const double first_weight = interpolation_matrix(0, 0);
+      for (size_t i = 0; i < stride; ++i) {
+        face_slab[i] = first_weight * volume_slab[i];
+      }
+      for (size_t k = 1; k < num_points_in_sliced_dim; ++k) {
+        const double weight = interpolation_matrix(0, k);
+        const double* const volume_row = volume_slab + k * stride;
+        for (size_t i = 0; i < stride; ++i) {
+          face_slab[i] += weight * volume_row[i];
+        }
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                            \
+  template void interpolate_to_boundary(                                  \
+      gsl::not_null<double*> face_data, const double* volume_data,        \
+      size_t number_of_independent_components,                            \
+      const Index<DIM(data)>& volume_extents, size_t sliced_dim,          \
+      const Matrix& interpolation_matrix);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace dg::detail
@@ -5,9 +5,10 @@
 
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
-#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/SliceIterator.hpp"
 #include "DataStructures/Variables.hpp"
@@ -17,7 +18,6 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace dg {
@@ -29,6 +29,17 @@ template <typename... Tags>
 struct NumberOfIndependentComponents<tmpl::list<Tags...>> {
   static constexpr size_t value = (... + Tags::type::size());
 };
+
+// Interpolates all components of the volume data to a face using the 1 x N
+// boundary interpolation matrix in the `sliced_dim`, in a single pass over
+// the volume data and without transposing it.
+template <size_t Dim>
+void interpolate_to_boundary(gsl::not_null<double*> face_data,
+                             const double* volume_data,
+                             size_t number_of_independent_components,
+                             const Index<Dim>& volume_extents,
+                             size_t sliced_dim,
+                             const Matrix& interpolation_matrix);
 }  // namespace detail
 
 /*!
@@ -84,30 +95,17 @@ void project_contiguous_data_to_boundary(
   using first_volume_tag = tmpl::front<VolumeVarsTagsList>;
   const size_t sliced_dim = direction.dimension();
   if (volume_mesh.quadrature(sliced_dim) == Spectral::Quadrature::Gauss) {
-    const Matrix identity{};
-    auto interpolation_matrices = make_array<Dim>(std::cref(identity));
     const auto& matrix = Spectral::boundary_interpolation_matrices(
         volume_mesh.slice_through(sliced_dim));
-    gsl::at(interpolation_matrices, sliced_dim) =
-        direction.side() == Side::Upper ? matrix.second : matrix.first;
-
-    auto& first_face_field = get<first_volume_tag>(*face_fields);
-    auto& first_volume_field = get<first_volume_tag>(volume_fields);
 
-    // The size is the number of tensor components we are projecting times the
-    // number of grid points on the face. Note that this is _not_ equal to the
-    // size of face_fields->size() since face_fields is a superset of the
+    // Only the components of the volume variables are written. Note that
+    // this is _not_ all of the face_fields since they are a superset of the
     // volume variables.
-    DataVector face_view{
-        first_face_field[0].data(),
-        first_face_field[0].size() * number_of_independent_components};
-
-    apply_matrices(make_not_null(&face_view), interpolation_matrices,
-                   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-                   DataVector{const_cast<double*>(first_volume_field[0].data()),
-                              first_volume_field[0].size() *
-                                  number_of_independent_components},
-                   volume_mesh.extents());
+    detail::interpolate_to_boundary(
+        make_not_null(get<first_volume_tag>(*face_fields)[0].data()),
+        get<first_volume_tag>(volume_fields)[0].data(),
+        number_of_independent_components, volume_mesh.extents(), sliced_dim,
+        direction.side() == Side::Upper ? matrix.second : matrix.first);
   } else {
     const size_t fixed_index = direction.side() == Side::Upper
                                    ? volume_mesh.extents(sliced_dim) - 1
@@ -168,26 +166,21 @@ void project_tensors_to_boundary(
       "All of the tags in TagsToProjectList must be in VolumeVarsTagsList");
   const size_t sliced_dim = direction.dimension();
   if (volume_mesh.quadrature(sliced_dim) == Spectral::Quadrature::Gauss) {
-    const Matrix identity{};
-    auto interpolation_matrices = make_array<Dim>(std::cref(identity));
     const std::pair<Matrix, Matrix>& matrices =
         Spectral::boundary_interpolation_matrices(
             volume_mesh.slice_through(sliced_dim));
-    gsl::at(interpolation_matrices, sliced_dim) =
+    const Matrix& interpolation_matrix =
         direction.side() == Side::Upper ? matrices.second : matrices.first;
-    tmpl::for_each<TagsToProjectList>([&face_fields, &interpolation_matrices,
-                                       &volume_fields,
+    tmpl::for_each<TagsToProjectList>([&face_fields, &interpolation_matrix,
+                                       sliced_dim, &volume_fields,
                                        &volume_mesh](auto tag_v) {
       using tag = typename decltype(tag_v)::type;
       auto& face_field = get<tag>(*face_fields);
       const auto& volume_field = get<tag>(volume_fields);
-      DataVector face_view{face_field[0].data(),
-                           face_field[0].size() * face_field.size()};
-      apply_matrices(make_not_null(&face_view), interpolation_matrices,
-                     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-                     DataVector{const_cast<double*>(volume_field[0].data()),
-                                volume_field[0].size() * volume_field.size()},
-                     volume_mesh.extents());
+      detail::interpolate_to_boundary(
+          make_not_null(face_field[0].data()), volume_field[0].data(),
+          volume_field.size(), volume_mesh.extents(), sliced_dim,
+          interpolation_matrix);
     });
   } else {
     const size_t fixed_index = direction.side() == Side::Upper
@@ -237,18 +230,21 @@ void project_tensor_to_boundary(
     const Mesh<Dim>& volume_mesh, const Direction<Dim>& direction) {
   const size_t sliced_dim = direction.dimension();
   if (volume_mesh.quadrature(sliced_dim) == Spectral::Quadrature::Gauss) {
-    const Matrix identity{};
-    auto interpolation_matrices = make_array<Dim>(std::cref(identity));
     const std::pair<Matrix, Matrix>& matrices =
         Spectral::boundary_interpolation_matrices(
             volume_mesh.slice_through(sliced_dim));
-    gsl::at(interpolation_matrices, sliced_dim) =
+    const Matrix& interpolation_matrix =
         direction.side() == Side::Upper ? matrices.second : matrices.first;
+    // The components of a tensor need not be contiguous
     for (size_t tensor_storage_index = 0;
          tensor_storage_index < volume_field.size(); ++tensor_storage_index) {
-      apply_matrices(make_not_null(&(*face_field)[tensor_storage_index]),
-                     interpolation_matrices, volume_field[tensor_storage_index],
-                     volume_mesh.extents());
+      ASSERT((*face_field)[tensor_storage_index].size() ==
+                 volume_mesh.extents().slice_away(sliced_dim).product(),
+             "The face field has the wrong number of grid points.");
+      detail::interpolate_to_boundary(
+          make_not_null((*face_field)[tensor_storage_index].data()),
+          volume_field[tensor_storage_index].data(), 1, volume_mesh.extents(),
+          sliced_dim, interpolation_matrix);
     }
   } else {
     const size_t fixed_index = direction.side() == Side::Upper
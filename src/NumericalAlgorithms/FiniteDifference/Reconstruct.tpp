@@ -16,9 +16,16 @@
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace fd::reconstruction {
 namespace detail {
+// Reconstructors with a `static constexpr bool supports_simd = true` member
+// provide a `pointwise<T>` function that also accepts `T = simd::batch<double>`
+// and is used to reconstruct the bulk of each stripe.
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(supports_simd)
+
 template <size_t Index, size_t DimToReplace, size_t... Is,
           size_t Dim = sizeof...(Is)>
 auto generate_index_for_u_to_reconstruct_impl(
@@ -183,20 +190,42 @@ void reconstruct_impl(
 
     // Reconstruct in the bulk
     const size_t slice_end = volume_extents[0] - ghost_zone_for_stencil;
-    for (size_t vars_index = vars_slice_offset + ghost_zone_for_stencil,
-                i = ghost_zone_for_stencil;
-         i < slice_end; ++vars_index, ++i) {
-      // Note: we keep the `stride` here because we may want to
-      // experiment/support non-unit strides in the bulk in the future. For
-      // cells where the reconstruction needs boundary data we copy into a
-      // `std::array` buffer, which means we always have unit stride.
-      constexpr int stride = 1;
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          &volume_vars[vars_index], stride, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + i] = get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + 1 + i] =
-          get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
+    {
+      size_t vars_index = vars_slice_offset + ghost_zone_for_stencil;
+      size_t i = ghost_zone_for_stencil;
+#ifdef SPECTRE_USE_XSIMD
+      if constexpr (not ReturnReconstructionOrder and
+                    get_supports_simd_or_default_v<Reconstructor, false>) {
+        // Consecutive cells in a stripe are contiguous in memory, so batches
+        // of cells are reconstructed at once and the remainder is done below.
+        using SimdType = simd::batch<double>;
+        constexpr size_t simd_width = simd::size<SimdType>();
+        for (; i + simd_width <= slice_end;
+             vars_index += simd_width, i += simd_width) {
+          const auto upper_and_lower =
+              Reconstructor::template pointwise<SimdType>(
+                  &volume_vars[vars_index], 1, args_for_reconstructor...);
+          simd::store_unaligned(&(*recons_upper)[recons_slice_offset + i],
+                                get<0>(upper_and_lower));
+          simd::store_unaligned(&(*recons_lower)[recons_slice_offset + 1 + i],
+                                get<1>(upper_and_lower));
+        }
+      }
+#endif  // SPECTRE_USE_XSIMD
+      for (; i < slice_end; ++vars_index, ++i) {
+        // Note: we keep the `stride` here because we may want to
+        // experiment/support non-unit strides in the bulk in the future. For
+        // cells where the reconstruction needs boundary data we copy into a
+        // `std::array` buffer, which means we always have unit stride.
+        constexpr int stride = 1;
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            &volume_vars[vars_index], stride, args_for_reconstructor...);
+        (*recons_upper)[recons_slice_offset + i] =
+            get<0>(upper_lower_and_order);
+        (*recons_lower)[recons_slice_offset + 1 + i] =
+            get<1>(upper_lower_and_order);
+        set_recons_order(upper_lower_and_order);
+      }
     }
 
     // Reconstruct using upper neighbor data
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 #include "NumericalAlgorithms/FiniteDifference/FallbackReconstructorType.hpp"
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
@@ -28,31 +29,53 @@ class Index;
 namespace fd::reconstruction {
 namespace detail {
 // pointwise reconstruction routine for the original Wcns5z scheme
+//
+// The scheme is branch-free, so `T` can also be a `simd::batch<double>`, in
+// which case the upper and lower face values of `simd::size<T>()` consecutive
+// cells starting at `q` are reconstructed at once. This requires `stride` to
+// be one.
 template <size_t NonlinearWeightExponent>
 struct Wcns5zWork {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
+  template <typename T = double>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
       const double* const q, const int stride, const double epsilon) {
     ASSERT(epsilon > 0.0,
            "epsilon must be greater than zero but is " << epsilon);
+    ASSERT((std::is_same_v<T, double> or stride == 1),
+           "Only unit stride is supported for SIMD reconstruction, but got "
+               << stride);
 
     using std::abs;
 
-    const std::array beta{
-        1.0833333333333333 * square(q[-2 * stride] - 2.0 * q[-stride] + q[0]) +
-            0.25 * square(q[-2 * stride] - 4.0 * q[-stride] + 3.0 * q[0]),
-        1.0833333333333333 * square(q[-stride] - 2.0 * q[0] + q[stride]) +
-            0.25 * square(q[stride] - q[-stride]),
-        1.0833333333333333 * square(q[2 * stride] - 2.0 * q[stride] + q[0]) +
-            0.25 * square(q[2 * stride] - 4.0 * q[stride] + 3.0 * q[0])};
+    const auto load = [q, stride](const int offset) -> T {
+      if constexpr (std::is_same_v<T, double>) {
+        return q[offset * stride];
+      } else {
+        return T::load_unaligned(q + offset);  // NOLINT
+      }
+    };
+    const T q_m2 = load(-2);
+    const T q_m1 = load(-1);
+    const T q_0 = load(0);
+    const T q_p1 = load(1);
+    const T q_p2 = load(2);
+
+    const std::array<T, 3> beta{
+        1.0833333333333333 * square(q_m2 - 2.0 * q_m1 + q_0) +
+            0.25 * square(q_m2 - 4.0 * q_m1 + 3.0 * q_0),
+        1.0833333333333333 * square(q_m1 - 2.0 * q_0 + q_p1) +
+            0.25 * square(q_p1 - q_m1),
+        1.0833333333333333 * square(q_p2 - 2.0 * q_p1 + q_0) +
+            0.25 * square(q_p2 - 4.0 * q_p1 + 3.0 * q_0)};
 
-    const double tau5{abs(beta[2] - beta[0])};
+    const T tau5{abs(beta[2] - beta[0])};
 
-    const std::array epsilon_k{
-        epsilon * (1.0 + abs(q[0]) + abs(q[-stride]) + abs(q[-2 * stride])),
-        epsilon * (1.0 + abs(q[0]) + abs(q[-stride]) + abs(q[stride])),
-        epsilon * (1.0 + abs(q[0]) + abs(q[stride]) + abs(q[2 * stride]))};
+    const std::array<T, 3> epsilon_k{
+        epsilon * (1.0 + abs(q_0) + abs(q_m1) + abs(q_m2)),
+        epsilon * (1.0 + abs(q_0) + abs(q_m1) + abs(q_p1)),
+        epsilon * (1.0 + abs(q_0) + abs(q_p1) + abs(q_p2))};
 
-    const std::array nw_buffer{
+    const std::array<T, 3> nw_buffer{
         1.0 + pow<NonlinearWeightExponent>(tau5 / (beta[0] + epsilon_k[0])),
         1.0 + pow<NonlinearWeightExponent>(tau5 / (beta[1] + epsilon_k[1])),
         1.0 + pow<NonlinearWeightExponent>(tau5 / (beta[2] + epsilon_k[2]))};
@@ -61,24 +84,22 @@ struct Wcns5zWork {
     // for `alpha`s is omitted here since it is eventually canceled out by
     // denominator when evaluating modified nonlinear weight `omega`s (see the
     // documentation of the `wcns5z()` function below).
-    const std::array alpha_upper{nw_buffer[0], 10.0 * nw_buffer[1],
-                                 5.0 * nw_buffer[2]};
-    const std::array alpha_lower{nw_buffer[2], 10.0 * nw_buffer[1],
-                                 5.0 * nw_buffer[0]};
-    const double alpha_norm_upper =
-        alpha_upper[0] + alpha_upper[1] + alpha_upper[2];
-    const double alpha_norm_lower =
-        alpha_lower[0] + alpha_lower[1] + alpha_lower[2];
+    const std::array<T, 3> alpha_upper{nw_buffer[0], 10.0 * nw_buffer[1],
+                                       5.0 * nw_buffer[2]};
+    const std::array<T, 3> alpha_lower{nw_buffer[2], 10.0 * nw_buffer[1],
+                                       5.0 * nw_buffer[0]};
+    const T alpha_norm_upper = alpha_upper[0] + alpha_upper[1] + alpha_upper[2];
+    const T alpha_norm_lower = alpha_lower[0] + alpha_lower[1] + alpha_lower[2];
 
     // reconstruction stencils
-    const std::array recons_stencils_upper{
-        0.375 * q[-2 * stride] - 1.25 * q[-stride] + 1.875 * q[0],
-        -0.125 * q[-stride] + 0.75 * q[0] + 0.375 * q[stride],
-        0.375 * q[0] + 0.75 * q[stride] - 0.125 * q[2 * stride]};
-    const std::array recons_stencils_lower{
-        0.375 * q[2 * stride] - 1.25 * q[stride] + 1.875 * q[0],
-        -0.125 * q[stride] + 0.75 * q[0] + 0.375 * q[-stride],
-        0.375 * q[0] + 0.75 * q[-stride] - 0.125 * q[-2 * stride]};
+    const std::array<T, 3> recons_stencils_upper{
+        0.375 * q_m2 - 1.25 * q_m1 + 1.875 * q_0,
+        -0.125 * q_m1 + 0.75 * q_0 + 0.375 * q_p1,
+        0.375 * q_0 + 0.75 * q_p1 - 0.125 * q_p2};
+    const std::array<T, 3> recons_stencils_lower{
+        0.375 * q_p2 - 1.25 * q_p1 + 1.875 * q_0,
+        -0.125 * q_p1 + 0.75 * q_0 + 0.375 * q_m1,
+        0.375 * q_0 + 0.75 * q_m1 - 0.125 * q_m2};
 
     // reconstructed solutions
     return {{(alpha_lower[0] * recons_stencils_lower[0] +
@@ -123,10 +144,16 @@ struct Wcns5zReconstructor {
 
 template <size_t NonlinearWeightExponent>
 struct Wcns5zReconstructor<NonlinearWeightExponent, void> {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
+  // Without a fallback there is no branching, so the bulk of each stripe is
+  // reconstructed with SIMD batches (see `fd::reconstruction::reconstruct`).
+  static constexpr bool supports_simd = true;
+
+  template <typename T = double>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
       const double* const q, const int stride, const double epsilon,
       const size_t /*max_number_of_extrema*/) {
-    return Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
+    return Wcns5zWork<NonlinearWeightExponent>::template pointwise<T>(
+        q, stride, epsilon);
   }
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
 };
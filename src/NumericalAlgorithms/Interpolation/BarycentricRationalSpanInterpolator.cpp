@@ -3,17 +3,53 @@
 
 #include "NumericalAlgorithms/Interpolation/BarycentricRationalSpanInterpolator.hpp"
 
-#include <boost/math/interpolators/barycentric_rational.hpp>
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 
-// Doesn't exist in boost before 1.77, but referenced below.
-namespace boost::math::interpolators {}
-
 namespace intrp {
+namespace {
+// The Floater-Hormann barycentric rational interpolant of order `order`,
+// matching `boost::math::interpolators::barycentric_rational`. The weights
+// are accumulated while evaluating so that no buffers are allocated, and
+// complex values share the weights of the real and imaginary parts.
+template <typename ValueType>
+ValueType interpolate_impl(const gsl::span<const double>& source_points,
+                           const gsl::span<const ValueType>& values,
+                           const double target_point, const size_t order) {
+  const size_t size = source_points.size();
+  ValueType numerator{0.0};
+  double denominator = 0.0;
+  for (size_t k = 0; k < size; ++k) {
+    if (target_point == source_points[k]) {
+      return values[k];
+    }
+    double weight = 0.0;
+    const size_t i_min = k > order ? k - order : 0;
+    const size_t i_max = std::min(k, size - order - 1);
+    for (size_t i = i_min; i <= i_max; ++i) {
+      double product = 1.0;
+      for (size_t j = i; j <= i + order; ++j) {
+        if (j != k) {
+          ASSERT(source_points[k] != source_points[j],
+                 "The source points for barycentric rational interpolation "
+                 "must be distinct.");
+          product *= source_points[k] - source_points[j];
+        }
+      }
+      weight += (i % 2 == 0 ? 1.0 : -1.0) / product;
+    }
+    const double t = weight / (target_point - source_points[k]);
+    numerator += t * values[k];
+    denominator += t;
+  }
+  return numerator / denominator;
+}
+}  // namespace
 
 BarycentricRationalSpanInterpolator::BarycentricRationalSpanInterpolator(
     size_t min_order, size_t max_order)
@@ -29,16 +65,19 @@ double BarycentricRationalSpanInterpolator::interpolate(
   if (UNLIKELY(source_points.size() < min_order_ + 1)) {
     ERROR("provided independent values for interpolation too small.");
   }
-  // Boost moved barycentric_rational from boost::math to
-  // boost::math::interpolators in version 1.77.
-  // NOLINTNEXTLINE(google-build-using-namespace)
-  using namespace boost::math;
-  // NOLINTNEXTLINE(google-build-using-namespace)
-  using namespace boost::math::interpolators;
-  barycentric_rational<double> interpolant(
-      source_points.data(), values.data(), source_points.size(),
-      std::min(source_points.size() - 1, max_order_));
-  return interpolant(target_point);
+  return interpolate_impl(source_points, values, target_point,
+                          std::min(source_points.size() - 1, max_order_));
+}
+
+std::complex<double> BarycentricRationalSpanInterpolator::interpolate(
+    const gsl::span<const double>& source_points,
+    const gsl::span<const std::complex<double>>& values,
+    const double target_point) const {
+  if (UNLIKELY(source_points.size() < min_order_ + 1)) {
+    ERROR("provided independent values for interpolation too small.");
+  }
+  return interpolate_impl(source_points, values, target_point,
+                          std::min(source_points.size() - 1, max_order_));
 }
 
 PUP::able::PUP_ID intrp::BarycentricRationalSpanInterpolator::my_PUP_ID = 0;
@@ -69,13 +69,15 @@ class BarycentricRationalSpanInterpolator : public SpanInterpolator {
     return std::make_unique<BarycentricRationalSpanInterpolator>(*this);
   }
 
-  // to get the generic overload:
-  using SpanInterpolator::interpolate;
-
   double interpolate(const gsl::span<const double>& source_points,
                      const gsl::span<const double>& values,
                      double target_point) const override;
 
+  std::complex<double> interpolate(
+      const gsl::span<const double>& source_points,
+      const gsl::span<const std::complex<double>>& values,
+      double target_point) const override;
+
   size_t required_number_of_points_before_and_after() const override {
     return min_order_ / 2 + 1;
   }
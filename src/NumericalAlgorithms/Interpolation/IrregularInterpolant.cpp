@@ -5,194 +5,56 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iterator>
-#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Serialization/PupStlCpp11.hpp"
 
 namespace {
 
 // Just linear for now, can be extended to higher order...
-// Future optimization: it might be more efficient to use Blaze's sparse
-// matrices since the interpolation matrix is mostly zeros
-std::vector<double> fd_stencil(const DataVector& xi_source,
-                               const double xi_target) {
+Matrix fd_interpolation_matrix(const DataVector& xi_source,
+                               const DataVector& xi_target) {
   ASSERT(std::is_sorted(std::begin(xi_source), std::end(xi_source)),
          "xi_source = " << xi_source);
-  auto xi_u =
-      std::upper_bound(std::begin(xi_source), std::end(xi_source), xi_target);
-  if (std::end(xi_source) == xi_u) {
-    std::advance(xi_u, -1);
-  }
-  if (std::begin(xi_source) == xi_u) {
-    std::advance(xi_u, 1);
-  }
-  const auto xi_l = std::prev(xi_u);
-  auto index = std::distance(std::begin(xi_source), xi_l);
-  std::vector<double> result(xi_source.size(), 0.0);
-  const auto result_l = std::next(std::begin(result), index);
-  const auto result_u = std::next(result_l, 1);
-  *result_l = (*xi_u - xi_target) / (*xi_u - *xi_l);
-  *result_u = (xi_target - *xi_l) / (*xi_u - *xi_l);
-  return result;
-}
-
-template <size_t Dim>
-Matrix interpolation_matrix(
-    const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& points);
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<1>& mesh,
-    const tnsr::I<DataVector, 1, Frame::ElementLogical>& points) {
-  if (mesh.basis()[0] == Spectral::Basis::FiniteDifference) {
-    auto source_xi = logical_coordinates(mesh);
-    const auto number_of_source_points = mesh.number_of_grid_points();
-    const DataVector xi_source(get<0>(source_xi).data(),
-                               number_of_source_points);
-    const auto number_of_target_points = get<0>(points).size();
-    Matrix result(number_of_target_points, mesh.number_of_grid_points());
-    for (size_t p = 0; p < number_of_target_points; ++p) {
-      const double xi_target = get<0>(points)[p];
-      const auto stencil = fd_stencil(xi_source, xi_target);
-      for (size_t i = 0; i < number_of_source_points; ++i) {
-        result(p, i) = stencil[i];
-      }
-    }
-    return result;
-  }
-
-  // Not FD, so use spectral interpolation
-  return Spectral::interpolation_matrix(mesh, get<0>(points));
-}
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<2>& mesh,
-    const tnsr::I<DataVector, 2, Frame::ElementLogical>& points) {
-  const auto number_of_target_points = get<0>(points).size();
-  Matrix result(number_of_target_points, mesh.number_of_grid_points());
-
-  if (mesh.basis()[0] == Spectral::Basis::FiniteDifference) {
-    ASSERT(mesh.basis()[1] == Spectral::Basis::FiniteDifference,
-           "Mixed FD and DG bases are not supported. Mesh = " << mesh);
-    auto source_xi = logical_coordinates(mesh);
-    DataVector xi_source{get<0>(source_xi).data(), mesh.extents(0)};
-    DataVector eta_source;
-    if (mesh.extents(1) == mesh.extents(0)) {
-      eta_source.set_data_ref(&xi_source);
-    } else {
-      eta_source.destructive_resize(mesh.extents(1));
-      for (size_t j = 0; j < mesh.extents(1); ++j) {
-        eta_source[j] = get<1>(source_xi)[j * mesh.extents(0)];
-      }
+  Matrix result(xi_target.size(), xi_source.size(), 0.0);
+  for (size_t p = 0; p < xi_target.size(); ++p) {
+    auto xi_u = std::upper_bound(std::begin(xi_source), std::end(xi_source),
+                                 xi_target[p]);
+    if (std::end(xi_source) == xi_u) {
+      std::advance(xi_u, -1);
     }
-    for (size_t p = 0; p < number_of_target_points; ++p) {
-      const double xi_target = get<0>(points)[p];
-      const double eta_target = get<1>(points)[p];
-      const auto xi_stencil = fd_stencil(xi_source, xi_target);
-      const auto eta_stencil = fd_stencil(eta_source, eta_target);
-      for (size_t j = 0, s = 0; j < mesh.extents(1); ++j) {
-        for (size_t i = 0; i < mesh.extents(0); ++i) {
-          result(p, s) = xi_stencil[i] * eta_stencil[j];
-          ++s;
-        }
-      }
-    }
-    return result;
-  }
-
-  // Not FD, so use spectral interpolation
-  const std::array<Matrix, 2> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points))}};
-
-  // First dimension of DataVector varies fastest.
-  for (size_t j = 0, s = 0; j < mesh.extents(1); ++j) {
-    for (size_t i = 0; i < mesh.extents(0); ++i) {
-      for (size_t p = 0; p < number_of_target_points; ++p) {
-        result(p, s) = matrices[0](p, i) * matrices[1](p, j);
-      }
-      ++s;
+    if (std::begin(xi_source) == xi_u) {
+      std::advance(xi_u, 1);
     }
+    const auto xi_l = std::prev(xi_u);
+    const auto index =
+        static_cast<size_t>(std::distance(std::begin(xi_source), xi_l));
+    result(p, index) = (*xi_u - xi_target[p]) / (*xi_u - *xi_l);
+    result(p, index + 1) = (xi_target[p] - *xi_l) / (*xi_u - *xi_l);
   }
   return result;
 }
 
-template <>
-Matrix interpolation_matrix(
-    const Mesh<3>& mesh,
-    const tnsr::I<DataVector, 3, Frame::ElementLogical>& points) {
-  const auto number_of_target_points = get<0>(points).size();
-  Matrix result(number_of_target_points, mesh.number_of_grid_points());
-
-  if (mesh.basis()[0] == Spectral::Basis::FiniteDifference) {
-    ASSERT(mesh.basis()[1] == Spectral::Basis::FiniteDifference and
-               mesh.basis()[2] == Spectral::Basis::FiniteDifference,
-           "Mixed FD and DG bases are not supported. Mesh = " << mesh);
-    auto source_xi = logical_coordinates(mesh);
-    DataVector xi_source{get<0>(source_xi).data(), mesh.extents(0)};
-    DataVector eta_source;
-    if (mesh.extents(1) == mesh.extents(0)) {
-      eta_source.set_data_ref(&xi_source);
-    } else {
-      eta_source.destructive_resize(mesh.extents(1));
-      for (size_t j = 0; j < mesh.extents(1); ++j) {
-        eta_source[j] = get<1>(source_xi)[j * mesh.extents(0)];
-      }
-    }
-    DataVector zeta_source;
-    if (mesh.extents(2) == mesh.extents(0)) {
-      zeta_source.set_data_ref(&xi_source);
-    } else if (mesh.extents(2) == mesh.extents(1)) {
-      zeta_source.set_data_ref(&eta_source);
+// The interpolation matrix is the row-wise tensor product of the 1D
+// interpolation matrices in each dimension, so we only store those.
+template <size_t Dim>
+std::array<Matrix, Dim> interpolation_matrices(
+    const Mesh<Dim>& mesh,
+    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& points) {
+  std::array<Matrix, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const Mesh<1> mesh_1d = mesh.slice_through(d);
+    if (mesh_1d.basis(0) == Spectral::Basis::FiniteDifference) {
+      gsl::at(result, d) = fd_interpolation_matrix(
+          Spectral::collocation_points(mesh_1d), points.get(d));
     } else {
-      zeta_source.destructive_resize(mesh.extents(2));
-      for (size_t k = 0; k < mesh.extents(2); ++k) {
-        zeta_source[k] =
-            get<2>(source_xi)[k * mesh.extents(0) * mesh.extents(1)];
-      }
-    }
-    for (size_t p = 0; p < number_of_target_points; ++p) {
-      const double xi_target = get<0>(points)[p];
-      const double eta_target = get<1>(points)[p];
-      const double zeta_target = get<2>(points)[p];
-      const auto xi_stencil = fd_stencil(xi_source, xi_target);
-      const auto eta_stencil = fd_stencil(eta_source, eta_target);
-      const auto zeta_stencil = fd_stencil(zeta_source, zeta_target);
-      for (size_t k = 0, s = 0; k < mesh.extents(2); ++k) {
-        for (size_t j = 0; j < mesh.extents(1); ++j) {
-          for (size_t i = 0; i < mesh.extents(0); ++i) {
-            result(p, s) = xi_stencil[i] * eta_stencil[j] * zeta_stencil[k];
-            ++s;
-          }
-        }
-      }
-    }
-    return result;
-  }
-
-  // Not FD, so use spectral interpolation
-  const std::array<Matrix, 3> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(2), get<2>(points))}};
-
-  // First dimension of DataVector varies fastest.
-  for (size_t k = 0, s = 0; k < mesh.extents(2); ++k) {
-    for (size_t j = 0; j < mesh.extents(1); ++j) {
-      for (size_t i = 0; i < mesh.extents(0); ++i) {
-        for (size_t p = 0; p < number_of_target_points; ++p) {
-          result(p, s) =
-              matrices[0](p, i) * matrices[1](p, j) * matrices[2](p, k);
-        }
-        ++s;
-      }
+      gsl::at(result, d) =
+          Spectral::interpolation_matrix(mesh_1d, points.get(d));
     }
   }
   return result;
@@ -208,29 +70,44 @@ template <size_t Dim>
 Irregular<Dim>::Irregular(const Mesh<Dim>& source_mesh,
                           const tnsr::I<DataVector, Dim, Frame::ElementLogical>&
                               target_points)
-    : interpolation_matrix_(interpolation_matrix(source_mesh, target_points)) {}
+    : interpolation_matrices_(
+          interpolation_matrices(source_mesh, target_points)) {}
 
 template <size_t Dim>
 void Irregular<Dim>::pup(PUP::er& p) {
-  p | interpolation_matrix_;
+  p | interpolation_matrices_;
+}
+
+template <size_t Dim>
+size_t Irregular<Dim>::number_of_target_points() const {
+  return interpolation_matrices_[0].rows();
+}
+
+template <size_t Dim>
+size_t Irregular<Dim>::number_of_source_points() const {
+  size_t result = 1;
+  for (const auto& matrix : interpolation_matrices_) {
+    result *= matrix.columns();
+  }
+  return result;
 }
 
 template <size_t Dim>
 void Irregular<Dim>::interpolate(const gsl::not_null<DataVector*> result,
                                  const DataVector& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
-  ASSERT(k == input.size(),
+  const size_t m = number_of_target_points();
+  ASSERT(number_of_source_points() == input.size(),
          "Number of points in 'input', "
              << input.size()
-             << ",\n disagrees with the size of the source_mesh, " << k
+             << ",\n disagrees with the size of the source_mesh, "
+             << number_of_source_points()
              << ", that was passed into the constructor");
   if (result->size() != m) {
     result->destructive_resize(m);
   }
-  dgemv_('n', m, k, 1.0, interpolation_matrix_.data(),
-         interpolation_matrix_.spacing(), input.data(), 1, 0.0, result->data(),
-         1);
+  gsl::span<double> result_span{result->data(), result->size()};
+  const gsl::span<const double> input_span{input.data(), input.size()};
+  interpolate(make_not_null(&result_span), input_span);
 }
 
 template <size_t Dim>
@@ -243,8 +120,8 @@ DataVector Irregular<Dim>::interpolate(const DataVector& input) const {
 template <size_t Dim>
 void Irregular<Dim>::interpolate(const gsl::not_null<gsl::span<double>*> result,
                                  const gsl::span<const double>& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points();
+  const size_t k = number_of_source_points();
   ASSERT(input.size() % k == 0,
          "Number of points in 'input', "
              << input.size()
@@ -254,11 +131,47 @@ void Irregular<Dim>::interpolate(const gsl::not_null<gsl::span<double>*> result,
   ASSERT(result->size() == number_of_components * m,
          "The result must be of size " << number_of_components * m
                                        << " but got " << result->size());
-  dgemm_<true>('N', 'N', interpolation_matrix_.rows(), number_of_components,
-               interpolation_matrix_.columns(), 1.0,
-               interpolation_matrix_.data(), interpolation_matrix_.rows(),
-               input.data(), interpolation_matrix_.columns(), 0.0,
-               result->data(), interpolation_matrix_.rows());
+  const Matrix& xi_matrix = interpolation_matrices_[0];
+  if constexpr (Dim == 1) {
+    dgemm_<true>('N', 'N', m, number_of_components, k, 1.0, xi_matrix.data(),
+                 xi_matrix.spacing(), input.data(), k, 0.0, result->data(),
+                 m);
+  } else {
+    // Contract the first dimension with a matrix multiplication, which leaves
+    // one value per target point and stripe of source points. Then contract
+    // the remaining dimensions pointwise with the products of the 1D weights.
+    // This avoids storing (and multiplying with) the dense interpolation
+    // matrix of size `m * k`.
+    const size_t n_xi = xi_matrix.columns();
+    const size_t number_of_stripes = k / n_xi;
+    const size_t n_eta = interpolation_matrices_[1].columns();
+    DataVector partially_interpolated(m * number_of_stripes);
+    for (size_t c = 0; c < number_of_components; ++c) {
+      dgemm_<true>('N', 'N', m, number_of_stripes, n_xi, 1.0,
+                   xi_matrix.data(), xi_matrix.spacing(),
+                   input.data() + c * k, n_xi, 0.0,
+                   partially_interpolated.data(), m);
+      double* const result_component = result->data() + c * m;
+      std::fill(result_component, result_component + m, 0.0);
+      for (size_t s = 0; s < number_of_stripes; ++s) {
+        const size_t j = s % n_eta;
+        const double* const partial = partially_interpolated.data() + s * m;
+        if constexpr (Dim == 2) {
+          for (size_t p = 0; p < m; ++p) {
+            result_component[p] +=
+                interpolation_matrices_[1](p, j) * partial[p];
+          }
+        } else {
+          const size_t l = s / n_eta;
+          for (size_t p = 0; p < m; ++p) {
+            result_component[p] += interpolation_matrices_[1](p, j) *
+                                   interpolation_matrices_[2](p, l) *
+                                   partial[p];
+          }
+        }
+      }
+    }
+  }
 }
 
 template <size_t Dim>
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
@@ -27,10 +28,16 @@ namespace intrp {
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Interpolates a `Variables` onto an arbitrary set of points.
 ///
-/// \details If the `source_mesh` uses Spectral::Basis::FiniteDifference,
-/// linear interpolation is done in each dimension; otherwise it uses the
-/// barycentric interpolation provided by Spectral::interpolation_matrix in each
-/// dimension.
+/// \details In dimensions where the `source_mesh` uses
+/// Spectral::Basis::FiniteDifference, linear interpolation is done; otherwise
+/// it uses the barycentric interpolation provided by
+/// Spectral::interpolation_matrix.
+///
+/// Only the 1D interpolation matrices in each dimension are stored, so memory
+/// scales with the number of target points times the sum (not the product) of
+/// the source extents. The interpolation contracts the first dimension of the
+/// data with a matrix multiplication over all target points at once and the
+/// remaining (much smaller) dimensions pointwise.
 template <size_t Dim>
 class Irregular {
  public:
@@ -74,9 +81,12 @@ class Irregular {
 
  private:
   friend bool operator==(const Irregular& lhs, const Irregular& rhs) {
-    return lhs.interpolation_matrix_ == rhs.interpolation_matrix_;
+    return lhs.interpolation_matrices_ == rhs.interpolation_matrices_;
   }
-  Matrix interpolation_matrix_;
+  size_t number_of_target_points() const;
+  size_t number_of_source_points() const;
+  // Rows are target points, columns are source points in each dimension
+  std::array<Matrix, Dim> interpolation_matrices_{};
 };
 
 template <size_t Dim>
@@ -84,15 +94,14 @@ template <typename TagsList>
 void Irregular<Dim>::interpolate(
     const gsl::not_null<Variables<TagsList>*> result,
     const Variables<TagsList>& vars) const {
-  if (UNLIKELY(result->number_of_grid_points() !=
-               interpolation_matrix_.rows())) {
-    *result = Variables<TagsList>(interpolation_matrix_.rows(), 0.);
+  if (UNLIKELY(result->number_of_grid_points() != number_of_target_points())) {
+    *result = Variables<TagsList>(number_of_target_points(), 0.);
   }
-  ASSERT(interpolation_matrix_.columns() == vars.number_of_grid_points(),
+  ASSERT(number_of_source_points() == vars.number_of_grid_points(),
          "Number of grid points in source 'vars', "
              << vars.number_of_grid_points()
              << ",\n disagrees with the size of the source_mesh, "
-             << interpolation_matrix_.columns()
+             << number_of_source_points()
              << ", that was passed into the constructor");
   gsl::span<double> result_span{result->data(), result->size()};
   const gsl::span<const double> vars_span{vars.data(), vars.size()};
@@ -103,7 +112,7 @@ template <size_t Dim>
 template <typename TagsList>
 Variables<TagsList> Irregular<Dim>::interpolate(
     const Variables<TagsList>& vars) const {
-  Variables<TagsList> result{interpolation_matrix_.rows()};
+  Variables<TagsList> result{number_of_target_points()};
   interpolate(make_not_null(&result), vars);
   return result;
 }
@@ -8,12 +8,14 @@
 #include <cmath>
 #include <memory>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace intrp {
@@ -130,6 +132,22 @@ class MultiLinearSpanInterpolation {
                        std::make_index_sequence<Dimension>{});
   }
 
+  /*!
+   * \brief Interpolate the variables `VariablesToInterpolate` to each of the
+   * points given by the `DataVector`s `target_points`.
+   *
+   * For uniform tables and with xsimd, the interpolation weights of
+   * `simd::size<simd::batch<double>>()` points are computed at once. The
+   * values at the corners of the cells are then gathered from the table,
+   * where all variables at a node are contiguous in memory.
+   */
+  template <size_t... VariablesToInterpolate, typename... T,
+            Requires<(std::is_same_v<T, DataVector> and ...)> = nullptr>
+  void interpolate(
+      gsl::not_null<std::array<DataVector, sizeof...(VariablesToInterpolate)>*>
+          result,
+      const T&... target_points) const;
+
   MultiLinearSpanInterpolation() = default;
 
   MultiLinearSpanInterpolation(
@@ -366,6 +384,116 @@ auto MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
   return weights;
 }
 
+template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
+template <size_t... VariablesToInterpolate, typename... T,
+          Requires<(std::is_same_v<T, DataVector> and ...)>>
+void MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
+                                  UniformSpacing>::
+    interpolate(
+        const gsl::not_null<
+            std::array<DataVector, sizeof...(VariablesToInterpolate)>*>
+            result,
+        const T&... target_points) const {
+  static_assert(
+      sizeof...(T) == Dimension,
+      "You need to provide the correct number of interpolation points");
+  constexpr size_t number_of_variables_to_interpolate =
+      sizeof...(VariablesToInterpolate);
+  static_assert(number_of_variables_to_interpolate <= NumberOfVariables,
+                "You are trying to interpolate more variables than this "
+                "container holds.");
+  constexpr std::array<size_t, number_of_variables_to_interpolate>
+      variables_to_interpolate{{VariablesToInterpolate...}};
+  const std::array<const DataVector*, Dimension> targets{{&target_points...}};
+  const size_t number_of_target_points = targets[0]->size();
+  for (auto& interpolated_variable : *result) {
+    interpolated_variable.destructive_resize(number_of_target_points);
+  }
+
+  size_t s = 0;
+#ifdef SPECTRE_USE_XSIMD
+  if constexpr (UniformSpacing) {
+    using SimdType = simd::batch<double>;
+    constexpr size_t simd_width = simd::size<SimdType>();
+    for (; s + simd_width <= number_of_target_points; s += simd_width) {
+      // Relative normalized coordinates and lower cell indices of each point
+      std::array<SimdType, Dimension> relative_coordinates{};
+      std::array<std::array<size_t, simd_width>, Dimension> lower_indices{};
+      for (size_t d = 0; d < Dimension; ++d) {
+        const SimdType target = simd::load_unaligned(&(*targets[d])[s]);
+        const SimdType scaled_coordinate =
+            (target - x_[d][0]) * inverse_spacing_[d];
+        ASSERT(allow_extrapolation_below_data_[d] or
+                   simd::all(scaled_coordinate >= 0.),
+               "Interpolation exceeds lower table bounds.");
+        ASSERT(allow_extrapolation_abov_data_[d] or
+                   simd::all(scaled_coordinate <
+                             static_cast<double>(number_of_points_[d] - 1)),
+               "Interpolation exceeds upper table bounds.");
+        std::array<double, simd_width> index_values{};
+        simd::store_unaligned(
+            index_values.data(),
+            simd::clip(simd::floor(scaled_coordinate), SimdType(0.),
+                       SimdType(static_cast<double>(number_of_points_[d] -
+                                                    2))));
+        std::array<double, simd_width> lower_coordinates{};
+        for (size_t lane = 0; lane < simd_width; ++lane) {
+          gsl::at(lower_indices[d], lane) =
+              static_cast<size_t>(gsl::at(index_values, lane));
+          gsl::at(lower_coordinates, lane) =
+              x_[d][gsl::at(lower_indices[d], lane)];
+        }
+        relative_coordinates[d] =
+            (target - simd::load_unaligned(lower_coordinates.data())) *
+            inverse_spacing_[d];
+      }
+
+      // Note: first index varies fastest, as in `get_weights`
+      std::array<SimdType, number_of_variables_to_interpolate> sums{};
+      sums.fill(SimdType(0.));
+      for (size_t corner = 0; corner < two_to_the(Dimension); ++corner) {
+        SimdType weight(1.);
+        for (size_t d = 0; d < Dimension; ++d) {
+          weight *= ((corner >> d) & 1) == 1
+                        ? relative_coordinates[d]
+                        : SimdType(1.) - relative_coordinates[d];
+        }
+        std::array<std::array<double, simd_width>,
+                   number_of_variables_to_interpolate>
+            corner_values{};
+        for (size_t lane = 0; lane < simd_width; ++lane) {
+          Index<Dimension> node{};
+          for (size_t d = 0; d < Dimension; ++d) {
+            node[d] = gsl::at(lower_indices[d], lane) + ((corner >> d) & 1);
+          }
+          const size_t offset =
+              NumberOfVariables * collapsed_index(node, number_of_points_);
+          for (size_t k = 0; k < number_of_variables_to_interpolate; ++k) {
+            gsl::at(gsl::at(corner_values, k), lane) =
+                y_[offset + gsl::at(variables_to_interpolate, k)];
+          }
+        }
+        for (size_t k = 0; k < number_of_variables_to_interpolate; ++k) {
+          gsl::at(sums, k) = simd::fma(
+              weight, simd::load_unaligned(gsl::at(corner_values, k).data()),
+              gsl::at(sums, k));
+        }
+      }
+      for (size_t k = 0; k < number_of_variables_to_interpolate; ++k) {
+        simd::store_unaligned(&gsl::at(*result, k)[s], gsl::at(sums, k));
+      }
+    }
+  }
+#endif
+  for (; s < number_of_target_points; ++s) {
+    const auto weights = get_weights(target_points[s]...);
+    for (size_t k = 0; k < number_of_variables_to_interpolate; ++k) {
+      gsl::at(*result, k)[s] =
+          interpolate(weights, gsl::at(variables_to_interpolate, k));
+    }
+  }
+}
+
 template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
 MultiLinearSpanInterpolation<Dimension, NumberOfVariables, UniformSpacing>::
     MultiLinearSpanInterpolation(
@@ -29,6 +29,11 @@ class BarycentricRationalSpanInterpolator;
 /// this base class, which calls the real version for each component. If it is
 /// possible to make a specialized complex version that avoids allocations, that
 /// is probably more efficient.
+///
+/// The interpolation must be linear in the `values`, so that callers
+/// interpolating many data sets at the same source points can compute the
+/// interpolation weights once (e.g.
+/// `Cce::InterfaceManagers::GhLocalTimeStepping`).
 class SpanInterpolator : public PUP::able {
  public:
   using creatable_classes =
@@ -50,7 +55,7 @@ class SpanInterpolator : public PUP::able {
   /// Perform the interpolation of function represented by complex `values` at
   /// `source_points` to the requested `target_point`, returning the
   /// (complex) interpolation result.
-  std::complex<double> interpolate(
+  virtual std::complex<double> interpolate(
       const gsl::span<const double>& source_points,
       const gsl::span<const std::complex<double>>& values,
       double target_point) const;
@@ -5,6 +5,7 @@
 
 #include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
 
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
@@ -38,8 +39,9 @@ void divergence(
   const size_t vars_size =
       Variables<DerivativeTags>::number_of_independent_components *
       F.number_of_grid_points();
-  const auto logical_derivs_data = cpp20::make_unique_for_overwrite<double[]>(
-      (Dim > 1 ? (Dim + 2) : Dim) * vars_size);
+  ScratchArena arena{};
+  double* const logical_derivs_data =
+      arena.allocate((Dim > 1 ? (Dim + 2) : Dim) * vars_size).data();
   std::array<double*, Dim> logical_derivs{};
   std::array<Variables<DerivativeTags>, Dim> logical_partial_derivatives_of_F{};
   for (size_t i = 0; i < Dim; ++i) {
@@ -6,16 +6,19 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
-#include "Utilities/Blas.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
@@ -25,21 +28,24 @@
 namespace {
 void apply_matrix_in_first_dim(double* result, const double* const input,
                                const Matrix& matrix, const size_t size) {
-  dgemm_<true>('N', 'N',
-               matrix.rows(),            // rows of matrix and result
-               size / matrix.columns(),  // columns of result and input
-               matrix.columns(),         // columns of matrix and rows of input
-               1.0,                      // overall multiplier
-               matrix.data(),            // matrix
-               matrix.spacing(),         // rows of matrix including padding
-               input,                    // input
-               matrix.columns(),         // rows of input
-               0.0,                      // overwrite output with result
-               result,                   // result
-               matrix.rows());           // rows of result
+  partial_derivatives_detail::apply_differentiation_matrix(
+      make_not_null(result), matrix, input, size / matrix.columns());
 }
 }  // namespace
 
+namespace partial_derivatives_detail {
+void apply_differentiation_matrix(const gsl::not_null<double*> result,
+                                  const Matrix& matrix, const double* const u,
+                                  const size_t number_of_stripes) {
+  ASSERT(matrix.rows() == matrix.columns(),
+         "The matrix must be square, but has " << matrix.rows() << " rows and "
+                                               << matrix.columns()
+                                               << " columns.");
+  apply_matrices_detail::multiply_stripes(result, matrix, u,
+                                          number_of_stripes);
+}
+}  // namespace partial_derivatives_detail
+
 template <typename SymmList, typename IndexList, size_t Dim>
 void logical_partial_derivative(
     const gsl::not_null<TensorMetafunctions::prepend_spatial_index<
@@ -9,22 +9,31 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
-#include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 
 namespace partial_derivatives_detail {
 template <size_t Dim, typename VariableTags, typename DerivativeTags>
 struct LogicalImpl;
 
+// Multiplies the square `matrix` into each of the `number_of_stripes`
+// contiguous stripes of `u`, i.e. computes `matrix * u` where `u` is a
+// column-major matrix with `matrix.columns()` rows.
+//
+// Small extents are dispatched to unrolled SIMD kernels by
+// `apply_matrices_detail::multiply_stripes`, larger ones to `dgemm_`.
+void apply_differentiation_matrix(gsl::not_null<double*> result,
+                                  const Matrix& matrix, const double* u,
+                                  size_t number_of_stripes);
+
 // This routine has been optimized to perform really well. The following
 // describes what optimizations were made.
 //
@@ -130,9 +139,13 @@ void logical_partial_derivatives(
         apply(make_not_null(&deriv_pointers), temp, temp, u, mesh);
     return;
   } else {
-    auto buffer = cpp20::make_unique_for_overwrite<double[]>(
-        2 * u.number_of_grid_points() *
-        Variables<DerivativeTags>::number_of_independent_components);
+    ScratchArena arena{};
+    double* const buffer =
+        arena
+            .allocate(
+                2 * u.number_of_grid_points() *
+                Variables<DerivativeTags>::number_of_independent_components)
+            .data();
     Variables<DerivativeTags> temp0(
         &buffer[0],
         u.number_of_grid_points() *
@@ -209,8 +222,9 @@ void partial_derivatives(
   const size_t vars_size =
       u.number_of_grid_points() *
       Variables<DerivativeTags>::number_of_independent_components;
-  const auto logical_derivs_data = cpp20::make_unique_for_overwrite<double[]>(
-      (Dim > 1 ? (Dim + 1) : Dim) * vars_size);
+  ScratchArena arena{};
+  double* const logical_derivs_data =
+      arena.allocate((Dim > 1 ? (Dim + 1) : Dim) * vars_size).data();
   std::array<double*, Dim> logical_derivs{};
   for (size_t i = 0; i < Dim; ++i) {
     gsl::at(logical_derivs, i) = &(logical_derivs_data[i * vars_size]);
@@ -265,10 +279,9 @@ struct LogicalImpl<1, VariableTags, DerivativeTags> {
         u.number_of_grid_points();
     const Matrix& differentiation_matrix_xi =
         Spectral::differentiation_matrix(mesh.slice_through(0));
-    dgemm_<true>('N', 'N', mesh.extents(0), deriv_size / mesh.extents(0),
-                 mesh.extents(0), 1.0, differentiation_matrix_xi.data(),
-                 differentiation_matrix_xi.spacing(), u.data(), mesh.extents(0),
-                 0.0, logical_partial_derivatives_of_u[0], mesh.extents(0));
+    apply_differentiation_matrix(
+        make_not_null(logical_partial_derivatives_of_u[0]),
+        differentiation_matrix_xi, u.data(), deriv_size / mesh.extents(0));
   }
 };
 
@@ -291,10 +304,9 @@ struct LogicalImpl<2, VariableTags, DerivativeTags> {
     const Matrix& differentiation_matrix_xi =
         Spectral::differentiation_matrix(mesh.slice_through(0));
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
-    dgemm_<true>('N', 'N', mesh.extents(0), num_components_times_xi_slices,
-                 mesh.extents(0), 1.0, differentiation_matrix_xi.data(),
-                 differentiation_matrix_xi.spacing(), u.data(), mesh.extents(0),
-                 0.0, logical_partial_derivatives_of_u[0], mesh.extents(0));
+    apply_differentiation_matrix(
+        make_not_null(logical_partial_derivatives_of_u[0]),
+        differentiation_matrix_xi, u.data(), num_components_times_xi_slices);
 
     transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
         make_not_null(u_eta_fastest), u, mesh.extents(0),
@@ -302,11 +314,9 @@ struct LogicalImpl<2, VariableTags, DerivativeTags> {
     const Matrix& differentiation_matrix_eta =
         Spectral::differentiation_matrix(mesh.slice_through(1));
     const size_t num_components_times_eta_slices = deriv_size / mesh.extents(1);
-    dgemm_<true>('N', 'N', mesh.extents(1), num_components_times_eta_slices,
-                 mesh.extents(1), 1.0, differentiation_matrix_eta.data(),
-                 differentiation_matrix_eta.spacing(), u_eta_fastest->data(),
-                 mesh.extents(1), 0.0, partial_u_wrt_eta->data(),
-                 mesh.extents(1));
+    apply_differentiation_matrix(
+        make_not_null(partial_u_wrt_eta->data()), differentiation_matrix_eta,
+        u_eta_fastest->data(), num_components_times_eta_slices);
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[1]),
                   partial_u_wrt_eta->data(), num_components_times_xi_slices,
                   mesh.extents(0));
@@ -332,10 +342,9 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
         Variables<DerivativeTags>::number_of_independent_components *
         u.number_of_grid_points();
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
-    dgemm_<true>('N', 'N', mesh.extents(0), num_components_times_xi_slices,
-                 mesh.extents(0), 1.0, differentiation_matrix_xi.data(),
-                 differentiation_matrix_xi.spacing(), u.data(), mesh.extents(0),
-                 0.0, logical_partial_derivatives_of_u[0], mesh.extents(0));
+    apply_differentiation_matrix(
+        make_not_null(logical_partial_derivatives_of_u[0]),
+        differentiation_matrix_xi, u.data(), num_components_times_xi_slices);
 
     transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
         make_not_null(u_eta_or_zeta_fastest), u, mesh.extents(0),
@@ -343,11 +352,10 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
     const Matrix& differentiation_matrix_eta =
         Spectral::differentiation_matrix(mesh.slice_through(1));
     const size_t num_components_times_eta_slices = deriv_size / mesh.extents(1);
-    dgemm_<true>('N', 'N', mesh.extents(1), num_components_times_eta_slices,
-                 mesh.extents(1), 1.0, differentiation_matrix_eta.data(),
-                 differentiation_matrix_eta.spacing(),
-                 u_eta_or_zeta_fastest->data(), mesh.extents(1), 0.0,
-                 partial_u_wrt_eta_or_zeta->data(), mesh.extents(1));
+    apply_differentiation_matrix(
+        make_not_null(partial_u_wrt_eta_or_zeta->data()),
+        differentiation_matrix_eta, u_eta_or_zeta_fastest->data(),
+        num_components_times_eta_slices);
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[1]),
                   partial_u_wrt_eta_or_zeta->data(),
                   num_components_times_xi_slices, mesh.extents(0));
@@ -360,11 +368,10 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
         Spectral::differentiation_matrix(mesh.slice_through(2));
     const size_t num_components_times_zeta_slices =
         deriv_size / mesh.extents(2);
-    dgemm_<true>('N', 'N', mesh.extents(2), num_components_times_zeta_slices,
-                 mesh.extents(2), 1.0, differentiation_matrix_zeta.data(),
-                 differentiation_matrix_zeta.spacing(),
-                 u_eta_or_zeta_fastest->data(), mesh.extents(2), 0.0,
-                 partial_u_wrt_eta_or_zeta->data(), mesh.extents(2));
+    apply_differentiation_matrix(
+        make_not_null(partial_u_wrt_eta_or_zeta->data()),
+        differentiation_matrix_zeta, u_eta_or_zeta_fastest->data(),
+        num_components_times_zeta_slices);
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[2]),
                   partial_u_wrt_eta_or_zeta->data(), number_of_chunks,
                   chunk_size);
@@ -6,10 +6,13 @@
 #include <algorithm>
 #include <blaze/math/Column.h>
 #include <blaze/math/Matrix.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <cstddef>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/Gsl.hpp"
@@ -27,7 +30,9 @@ CREATE_IS_CALLABLE_V(reset)
  * linear operator, i.e. feeding it unit vectors.
  *
  * \param matrix Output buffer for the operator matrix. Must be sized correctly
- * on entry. Can be any dense or sparse Blaze matrix.
+ * on entry. Can be any dense or sparse Blaze matrix. Column-major sparse
+ * matrices are filled fastest, because the non-zero entries of each column can
+ * be appended in order instead of being inserted.
  * \param operand_buffer Memory buffer that can hold operand data for the
  * `linear_operator`. Must be sized correctly on entry, and must be filled with
  * zeros.
@@ -49,9 +54,14 @@ void build_matrix(const gsl::not_null<MatrixType*> matrix,
   static_assert(
       blaze::IsSparseMatrix_v<MatrixType> or blaze::IsDenseMatrix_v<MatrixType>,
       "Unexpected matrix type");
+  constexpr bool append_columns = blaze::IsSparseMatrix_v<MatrixType> and
+                                  blaze::IsColumnMajorMatrix_v<MatrixType>;
   if constexpr (blaze::IsSparseMatrix_v<MatrixType>) {
     matrix->reset();
   }
+  // Buffer for the non-zero entries of a column when appending columns
+  std::vector<std::pair<size_t, typename MatrixType::ElementType>>
+      column_non_zeros{};
   size_t i = 0;
   // Re-using the iterators for all operator invocations
   auto result_iterator_begin = result_buffer->begin();
@@ -76,8 +86,23 @@ void build_matrix(const gsl::not_null<MatrixType*> matrix,
       result_iterator_end = result_buffer->end();
     }
     // Store the result in column i of the matrix
-    auto col = column(*matrix, i);
-    if constexpr (blaze::IsSparseMatrix_v<MatrixType>) {
+    if constexpr (append_columns) {
+      column_non_zeros.clear();
+      size_t k = 0;
+      while (result_iterator_begin != result_iterator_end) {
+        if (not equal_within_roundoff(*result_iterator_begin, 0.)) {
+          column_non_zeros.emplace_back(k, *result_iterator_begin);
+        }
+        ++result_iterator_begin;
+        ++k;
+      }
+      matrix->reserve(i, column_non_zeros.size());
+      for (const auto& [row, value] : column_non_zeros) {
+        matrix->append(row, i, value);
+      }
+      matrix->finalize(i);
+    } else if constexpr (blaze::IsSparseMatrix_v<MatrixType>) {
+      auto col = column(*matrix, i);
       size_t k = 0;
       while (result_iterator_begin != result_iterator_end) {
         if (not equal_within_roundoff(*result_iterator_begin, 0.)) {
@@ -87,6 +112,7 @@ void build_matrix(const gsl::not_null<MatrixType*> matrix,
         ++k;
       }
     } else {
+      auto col = column(*matrix, i);
       std::copy(result_iterator_begin, result_iterator_end, col.begin());
     }
     ++i;
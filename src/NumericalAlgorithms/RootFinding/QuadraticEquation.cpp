@@ -3,7 +3,8 @@
 
 #include "NumericalAlgorithms/RootFinding/QuadraticEquation.hpp"
 
-#include <gsl/gsl_poly.h>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include "DataStructures/DataVector.hpp"
@@ -11,6 +12,38 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Computes the real roots in increasing order and returns their number (zero
+// or two), following gsl_poly_solve_quadratic. This is inlined into the loops
+// over points below, avoiding a call into GSL for every point.
+int compute_real_roots(const gsl::not_null<double*> x0,
+                       const gsl::not_null<double*> x1, const double a,
+                       const double b, const double c) {
+  const double discriminant = b * b - 4.0 * a * c;
+  if (discriminant > 0.0) {
+    if (b == 0.0) {
+      const double r = std::sqrt(-c / a);
+      *x0 = -r;
+      *x1 = r;
+    } else {
+      const double temp =
+          -0.5 * (b + std::copysign(std::sqrt(discriminant), b));
+      const double r1 = temp / a;
+      const double r2 = c / temp;
+      *x0 = std::min(r1, r2);
+      *x1 = std::max(r1, r2);
+    }
+    return 2;
+  } else if (discriminant == 0.0) {
+    *x0 = -0.5 * b / a;
+    *x1 = *x0;
+    return 2;
+  }
+  return 0;
+}
+}  // namespace
 
 double positive_root(const double a, const double b, const double c) {
   const auto roots = real_roots(a, b, c);
@@ -27,16 +60,12 @@ std::optional<std::array<double, 2>> real_roots(const double a, const double b,
   ASSERT(a != 0.0, "Must have non-zero quadratic term.");
   double x0 = std::numeric_limits<double>::signaling_NaN();
   double x1 = std::numeric_limits<double>::signaling_NaN();
-  const int num_real_roots = gsl_poly_solve_quadratic(a, b, c, &x0, &x1);
+  const int num_real_roots =
+      compute_real_roots(make_not_null(&x0), make_not_null(&x1), a, b, c);
   if (num_real_roots == 0) {
     return std::nullopt;
-  } else {
-    ASSERT(num_real_roots == 2,
-           "There are " << num_real_roots << " real roots with a=" << a
-           << " b=" << b << " c=" << c << ", which is not zero or two.  "
-           "This should not be possible.");
-    return {{x0, x1}};
   }
+  return {{x0, x1}};
 }
 
 namespace detail {
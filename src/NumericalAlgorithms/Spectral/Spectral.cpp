@@ -47,10 +47,11 @@ const auto& precomputed_spectral_quantity(const size_t num_points) {
          "points for this quadrature.");
   ASSERT(num_points <= max_num_points,
          "Exceeded maximum number of collocation points.");
-  // We compute the quantity for all possible `num_point`s the first time this
-  // function is called and keep the data around for the lifetime of the
-  // program. The computation is handled by the call operator of the
-  // `SpectralQuantityType` instance.
+  // The quantity for each `num_points` is computed the first time it is
+  // requested and kept around for the lifetime of the program. The computation
+  // is handled by the call operator of the `SpectralQuantityGenerator`
+  // instance. Each entry is a function-local static, so its initialization is
+  // thread-safe and a single copy is shared by all threads of the process.
   static const auto precomputed_data =
       make_static_cache<CacheRange<min_num_points, max_num_points + 1>>(
           SpectralQuantityGenerator{});
@@ -450,9 +451,9 @@ struct DifferentiationMatrixGenerator {
 template <Basis BasisType, Quadrature QuadratureType>
 struct DifferentiationMatrixTransposeGenerator {
   Matrix operator()(const size_t num_points) const {
+    // Copy the cached matrix rather than recomputing it
     Matrix diff_matrix_transpose =
-        DifferentiationMatrixGenerator<BasisType, QuadratureType>{}.operator()(
-            num_points);
+        differentiation_matrix<BasisType, QuadratureType>(num_points);
     blaze::transpose(diff_matrix_transpose);
     return diff_matrix_transpose;
   }
@@ -472,8 +473,7 @@ struct WeakFluxDifferentiationMatrixGenerator {
         quadrature_weights<BasisType, QuadratureType>(num_points);
 
     Matrix weak_diff_matrix =
-        DifferentiationMatrixGenerator<BasisType, QuadratureType>{}.operator()(
-            num_points);
+        differentiation_matrix<BasisType, QuadratureType>(num_points);
     transpose(weak_diff_matrix);
     for (size_t i = 0; i < num_points; ++i) {
       for (size_t j = 0; j < num_points; ++j) {
@@ -4,9 +4,12 @@
 #include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 
 #include <boost/math/special_functions/spherical_harmonic.hpp>
+#include <cmath>
 #include <cstddef>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -41,4 +44,83 @@ DataVector real_spherical_harmonic(const DataVector& theta,
   real_spherical_harmonic(make_not_null(&result), theta, phi, l, m);
   return result;
 }
+
+void real_spherical_harmonics(
+    const gsl::not_null<DataVector*> spherical_harmonics,
+    const DataVector& theta, const DataVector& phi, const size_t l_max) {
+  ASSERT(theta.size() == phi.size(),
+         "theta and phi must have the same size, not "
+             << theta.size() << " and " << phi.size());
+  const size_t num_points = theta.size();
+  spherical_harmonics->destructive_resize(square(l_max + 1) * num_points);
+
+  const DataVector cos_theta = cos(theta);
+  const DataVector sin_theta = sin(theta);
+  const DataVector cos_phi = cos(phi);
+  const DataVector sin_phi = sin(phi);
+
+  // The normalized associated Legendre functions (without the Condon-Shortley
+  // phase) P_l^m with l = m, m + 1, and the two preceding values for the
+  // recursion in l.
+  DataVector p_mm(num_points, 0.5 / sqrt(M_PI));
+  DataVector p_lm(num_points);
+  DataVector p_l_minus_one_m(num_points);
+  DataVector p_l_minus_two_m(num_points);
+  DataVector cos_m_phi(num_points, 1.0);
+  DataVector sin_m_phi(num_points, 0.0);
+  DataVector buffer(num_points);
+
+  const auto store = [&spherical_harmonics, &num_points, &cos_m_phi,
+                      &sin_m_phi](const size_t l, const size_t m,
+                                  const DataVector& legendre) {
+    // Non-owning views of Y_{l,m} and Y_{l,-m}
+    DataVector harmonic_positive_m(
+        spherical_harmonics->data() + (l * l + l + m) * num_points,
+        num_points);
+    if (m == 0) {
+      harmonic_positive_m = legendre;
+      return;
+    }
+    DataVector harmonic_negative_m(
+        spherical_harmonics->data() + (l * l + l - m) * num_points,
+        num_points);
+    harmonic_positive_m = M_SQRT2 * legendre * cos_m_phi;
+    harmonic_negative_m = M_SQRT2 * legendre * sin_m_phi;
+  };
+
+  for (size_t m = 0; m <= l_max; ++m) {
+    const auto m_double = static_cast<double>(m);
+    if (m > 0) {
+      p_mm *= sqrt((2.0 * m_double + 1.0) / (2.0 * m_double)) * sin_theta;
+      buffer = cos_m_phi;
+      cos_m_phi = buffer * cos_phi - sin_m_phi * sin_phi;
+      sin_m_phi = sin_m_phi * cos_phi + buffer * sin_phi;
+    }
+    store(m, m, p_mm);
+    if (m == l_max) {
+      break;
+    }
+    p_l_minus_two_m = p_mm;
+    p_l_minus_one_m = sqrt(2.0 * m_double + 3.0) * cos_theta * p_mm;
+    store(m + 1, m, p_l_minus_one_m);
+    for (size_t l = m + 2; l <= l_max; ++l) {
+      const auto l_double = static_cast<double>(l);
+      const double a = sqrt((4.0 * square(l_double) - 1.0) /
+                            (square(l_double) - square(m_double)));
+      const double b = sqrt((square(l_double - 1.0) - square(m_double)) /
+                            (4.0 * square(l_double - 1.0) - 1.0));
+      p_lm = a * (cos_theta * p_l_minus_one_m - b * p_l_minus_two_m);
+      store(l, m, p_lm);
+      std::swap(p_l_minus_two_m, p_l_minus_one_m);
+      std::swap(p_l_minus_one_m, p_lm);
+    }
+  }
+}
+
+DataVector real_spherical_harmonics(const DataVector& theta,
+                                    const DataVector& phi, const size_t l_max) {
+  DataVector result{};
+  real_spherical_harmonics(make_not_null(&result), theta, phi, l_max);
+  return result;
+}
 }  // namespace ylm
@@ -40,4 +40,29 @@ void real_spherical_harmonic(gsl::not_null<DataVector*> spherical_harmonic,
 DataVector real_spherical_harmonic(const DataVector& theta,
                                    const DataVector& phi, size_t l, int m);
 /// @}
+
+/// @{
+/*!
+ * \ingroup SpectralGroup
+ *
+ * \brief Evaluates all real spherical harmonics with \f$l \leq l_{max}\f$ at
+ * the requested angles \f$\theta\f$ and \f$\phi\f$.
+ *
+ * The harmonics are defined as in `ylm::real_spherical_harmonic` and are
+ * stored contiguously, in the order of increasing \f$l\f$ and then
+ * increasing \f$m\f$. The harmonic \f$Y_{lm}\f$ is stored at the points
+ * \f$[(l^2 + l + m) N, (l^2 + l + m + 1) N)\f$, where \f$N\f$ is the number
+ * of angles, so `spherical_harmonics` has the size \f$(l_{max} + 1)^2 N\f$.
+ *
+ * All harmonics are evaluated in a single pass of the recursion for the
+ * normalized associated Legendre functions, vectorized over the angles, so
+ * this is much faster than evaluating each harmonic separately.
+ */
+void real_spherical_harmonics(gsl::not_null<DataVector*> spherical_harmonics,
+                              const DataVector& theta, const DataVector& phi,
+                              size_t l_max);
+
+DataVector real_spherical_harmonics(const DataVector& theta,
+                                    const DataVector& phi, size_t l_max);
+/// @}
 }  // namespace ylm
@@ -5,8 +5,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
@@ -67,8 +71,7 @@ Spherepack::Spherepack(const size_t l_max, const size_t m_max)
       m_max_{m_max},
       n_theta_{l_max_ + 1},
       n_phi_{2 * m_max_ + 1},
-      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)},
-      storage_(l_max_, m_max_) {
+      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)} {
   if (l_max_ < 2) {
     ERROR("Must use l_max>=2, not l_max=" << l_max_);
   }
@@ -79,10 +82,33 @@ Spherepack::Spherepack(const size_t l_max, const size_t m_max)
     ERROR("Must use m_max<=l_max, not l_max=" << l_max_
                                               << ", m_max=" << m_max_);
   }
-  calculate_collocation_points();
-  fill_scalar_work_arrays();
-  fill_vector_work_arrays();
-  calculate_interpolation_data();
+  storage_ = shared_storage();
+}
+
+std::shared_ptr<const Spherepack_detail::ConstStorage>
+Spherepack::shared_storage() const {
+  // The work arrays only depend on l_max and m_max, and computing them
+  // dominates the cost of constructing a Spherepack, so they are computed once
+  // and then shared by all instances with the same l_max and m_max. They are
+  // kept until the end of execution: only a handful of different resolutions
+  // are used in a run, and the same resolutions keep being constructed, e.g.
+  // for the trial surfaces of the horizon finders.
+  static std::mutex cache_mutex{};
+  static std::map<std::pair<size_t, size_t>,
+                  std::shared_ptr<const Spherepack_detail::ConstStorage>>
+      cache{};
+  const std::lock_guard lock(cache_mutex);
+  auto& storage = cache[{l_max_, m_max_}];
+  if (storage == nullptr) {
+    auto new_storage =
+        std::make_shared<Spherepack_detail::ConstStorage>(l_max_, m_max_);
+    calculate_collocation_points(make_not_null(new_storage.get()));
+    fill_scalar_work_arrays(make_not_null(new_storage.get()));
+    fill_vector_work_arrays(make_not_null(new_storage.get()));
+    calculate_interpolation_data(make_not_null(new_storage.get()));
+    storage = std::move(new_storage);
+  }
+  return storage;
 }
 
 void Spherepack::phys_to_spec_impl(
@@ -106,7 +132,7 @@ void Spherepack::phys_to_spec_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_phys_to_spec = storage_.work_phys_to_spec;
+  const auto& work_phys_to_spec = storage_->work_phys_to_spec;
   shags_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -145,7 +171,7 @@ void Spherepack::spec_to_phys_impl(
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
 
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   shsgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -207,6 +233,79 @@ DataVector Spherepack::spec_to_phys_all_offsets(
   return result;
 }
 
+namespace {
+// Copies `number_of_fields` fields of `size` values each, stored one after
+// another in `fields`, to `interleaved`, where the field index varies fastest.
+void interleave_fields(const gsl::not_null<double*> interleaved,
+                       const gsl::not_null<const double*> fields,
+                       const size_t size, const size_t number_of_fields) {
+  for (size_t k = 0; k < number_of_fields; ++k) {
+    for (size_t s = 0; s < size; ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      interleaved.get()[s * number_of_fields + k] =  // NOLINT
+          fields.get()[k * size + s];                // NOLINT
+    }
+  }
+}
+
+// Inverse of `interleave_fields`.
+void deinterleave_fields(const gsl::not_null<double*> fields,
+                         const gsl::not_null<const double*> interleaved,
+                         const size_t size, const size_t number_of_fields) {
+  for (size_t k = 0; k < number_of_fields; ++k) {
+    for (size_t s = 0; s < size; ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      fields.get()[k * size + s] =                      // NOLINT
+          interleaved.get()[s * number_of_fields + k];  // NOLINT
+    }
+  }
+}
+}  // namespace
+
+void Spherepack::phys_to_spec_multiple_fields(
+    const gsl::not_null<double*> spectral_coefs,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    phys_to_spec_impl(spectral_coefs, collocation_values);
+    return;
+  }
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  interleave_fields(make_not_null(interleaved_values.data()),
+                    collocation_values, physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  deinterleave_fields(spectral_coefs, interleaved_coefs.data(),
+                      spectral_size(), number_of_fields);
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+void Spherepack::spec_to_phys_multiple_fields(
+    const gsl::not_null<double*> collocation_values,
+    const gsl::not_null<const double*> spectral_coefs,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    spec_to_phys_impl(collocation_values, spectral_coefs);
+    return;
+  }
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  interleave_fields(make_not_null(interleaved_coefs.data()), spectral_coefs,
+                    spectral_size(), number_of_fields);
+  spec_to_phys_impl(interleaved_values.data(), interleaved_coefs.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  deinterleave_fields(collocation_values, interleaved_values.data(),
+                      physical_size(), number_of_fields);
+  memory_pool_.free(interleaved_values);
+  memory_pool_.free(interleaved_coefs);
+}
+
 void Spherepack::gradient(const std::array<double*, 2>& df,
                           const gsl::not_null<const double*> collocation_values,
                           const size_t physical_stride,
@@ -231,6 +330,39 @@ void Spherepack::gradient_all_offsets(
   memory_pool_.free(f_k);
 }
 
+void Spherepack::gradient_multiple_fields(
+    const std::array<double*, 2>& df,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    gradient(df, collocation_values);
+    return;
+  }
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  interleave_fields(make_not_null(interleaved_values.data()),
+                    collocation_values, physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  // The interleaved collocation values are not needed anymore, so their
+  // storage is reused for the first component of the gradient.
+  auto& interleaved_df_1 = memory_pool_.get(number_of_fields * physical_size());
+  const std::array<double*, 2> interleaved_df{
+      {interleaved_values.data(), interleaved_df_1.data()}};
+  gradient_from_coefs_impl(interleaved_df, interleaved_coefs.data(),
+                           number_of_fields, 0, number_of_fields, 0, true);
+  for (size_t i = 0; i < 2; ++i) {
+    deinterleave_fields(make_not_null(gsl::at(df, i)),
+                        gsl::at(interleaved_df, i), physical_size(),
+                        number_of_fields);
+  }
+  memory_pool_.free(interleaved_df_1);
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
 void Spherepack::gradient_from_coefs_impl(
     const std::array<double*, 2>& df,
     const gsl::not_null<const double*> spectral_coefs,
@@ -257,7 +389,7 @@ void Spherepack::gradient_from_coefs_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  const auto& work_vector_spec_to_phys = storage_->work_vector_spec_to_phys;
   gradgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           effective_physical_offset, effective_spectral_offset,
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1, df[0],
@@ -348,7 +480,7 @@ void Spherepack::scalar_laplacian_from_coefs(
   const size_t work_size = n_theta_ * (3 * n_phi_ + 2 * l1 + 1);
   auto& work = memory_pool_.get(work_size);
   int err = 0;
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   slapgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           static_cast<int>(physical_offset), static_cast<int>(spectral_offset),
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -405,12 +537,12 @@ void Spherepack::second_derivative(
     const std::array<double*, 2>& df, const gsl::not_null<SecondDeriv*> ddf,
     const gsl::not_null<const double*> collocation_values,
     const size_t physical_stride, const size_t physical_offset) const {
-  const auto& cos_theta = storage_.cos_theta;
-  const auto& sin_theta = storage_.sin_theta;
-  const auto& sin_phi = storage_.sin_phi;
-  const auto& cos_phi = storage_.cos_phi;
-  const auto& cot_theta = storage_.cot_theta;
-  const auto& cosec_theta = storage_.cosec_theta;
+  const auto& cos_theta = storage_->cos_theta;
+  const auto& sin_theta = storage_->sin_theta;
+  const auto& sin_phi = storage_->sin_phi;
+  const auto& cos_phi = storage_->cos_phi;
+  const auto& cot_theta = storage_->cot_theta;
+  const auto& cosec_theta = storage_->cosec_theta;
 
   // Get first derivatives
   gradient(df, collocation_values, physical_stride, physical_offset);
@@ -550,7 +682,7 @@ Spherepack::InterpolationInfo<T>::InterpolationInfo(
 template <typename T>
 Spherepack::InterpolationInfo<T> Spherepack::set_up_interpolation_info(
     const std::array<T, 2>& target_points) const {
-  return InterpolationInfo(l_max_, m_max_, storage_.work_interp_pmm,
+  return InterpolationInfo(l_max_, m_max_, storage_->work_interp_pmm,
                            target_points);
 }
 
@@ -585,9 +717,9 @@ void Spherepack::interpolate_from_coefs(
           << interpolation_info.l_max() << ") and Spherepack instance ("
           << l_max_ << ")");
   };
-  const auto& alpha = storage_.work_interp_alpha;
-  const auto& beta = storage_.work_interp_beta;
-  const auto& index = storage_.work_interp_index;
+  const auto& alpha = storage_->work_interp_alpha;
+  const auto& beta = storage_->work_interp_beta;
+  const auto& index = storage_->work_interp_index;
   // alpha holds alpha(n,m,x)/x, beta holds beta(n+1,m).
   // index holds the index into the coefficient array.
   // All are indexed together.
@@ -693,9 +825,10 @@ T Spherepack::interpolate_from_coefs(
   return result;
 }
 
-void Spherepack::calculate_collocation_points() {
+void Spherepack::calculate_collocation_points(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // Theta
-  auto& theta = storage_.theta;
+  auto& theta = storage->theta;
   DataVector temp(2 * n_theta_ + 1);
   auto work = gsl::make_span(temp.data(), n_theta_);
   auto unused_weights = gsl::make_span(temp.data() + n_theta_, n_theta_ + 1);
@@ -708,17 +841,17 @@ void Spherepack::calculate_collocation_points() {
   }
 
   // Phi
-  auto& phi = storage_.phi;
+  auto& phi = storage->phi;
   const double two_pi_over_n_phi = 2.0 * M_PI / n_phi_;
   for (size_t i = 0; i < n_phi_; ++i) {
     phi[i] = two_pi_over_n_phi * i;
   }
 
   // Other trig functions at collocation points
-  auto& cos_theta = storage_.cos_theta;
-  auto& sin_theta = storage_.sin_theta;
-  auto& cot_theta = storage_.cot_theta;
-  auto& cosec_theta = storage_.cosec_theta;
+  auto& cos_theta = storage->cos_theta;
+  auto& sin_theta = storage->sin_theta;
+  auto& cot_theta = storage->cot_theta;
+  auto& cosec_theta = storage->cosec_theta;
   for (size_t i = 0; i < n_theta_; ++i) {
     cos_theta[i] = cos(theta[i]);
     sin_theta[i] = sin(theta[i]);
@@ -726,15 +859,16 @@ void Spherepack::calculate_collocation_points() {
     cot_theta[i] = cos_theta[i] * cosec_theta[i];
   }
 
-  auto& sin_phi = storage_.sin_phi;
-  auto& cos_phi = storage_.cos_phi;
+  auto& sin_phi = storage->sin_phi;
+  auto& cos_phi = storage->cos_phi;
   for (size_t i = 0; i < n_phi_; ++i) {
     cos_phi[i] = cos(phi[i]);
     sin_phi[i] = sin(phi[i]);
   }
 }
 
-void Spherepack::calculate_interpolation_data() {
+void Spherepack::calculate_interpolation_data(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // SPHEREPACK expands f(theta,phi) as
   //
   // f(theta,phi) =
@@ -772,10 +906,10 @@ void Spherepack::calculate_interpolation_data() {
   // and  Pbar(m+1)(m) is (2m+1)!! x(1-x^2)^(n/2)sqrt((2m+3)/(2(2m+1)!))
   //  Ratio Pbar(m+1)(m)/Pbar(m)(m)   = x sqrt(2m+3)
   //  Ratio Pbar(m+1)(m+1)/Pbar(m)(m) = sqrt(1-x^2) sqrt((2m+3)/(2m+2))
-  auto& alpha = storage_.work_interp_alpha;
-  auto& beta = storage_.work_interp_beta;
-  auto& pmm = storage_.work_interp_pmm;
-  auto& index = storage_.work_interp_index;
+  auto& alpha = storage->work_interp_alpha;
+  auto& beta = storage->work_interp_beta;
+  auto& pmm = storage->work_interp_pmm;
+  auto& index = storage->work_interp_index;
 
   const size_t l1 = m_max_ + 1;
 
@@ -827,10 +961,11 @@ void Spherepack::calculate_interpolation_data() {
   }
 }
 
-void Spherepack::fill_vector_work_arrays() {
+void Spherepack::fill_vector_work_arrays(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   DataVector work((3 * n_theta_ * (n_theta_ + 3) + 2) / 2);
 
-  auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  auto& work_vector_spec_to_phys = storage->work_vector_spec_to_phys;
   int err = 0;
   vhsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
           work_vector_spec_to_phys.data(),
@@ -841,7 +976,8 @@ void Spherepack::fill_vector_work_arrays() {
   }
 }
 
-void Spherepack::fill_scalar_work_arrays() {
+void Spherepack::fill_scalar_work_arrays(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // Quadrature weights
   {
     DataVector temp(3 * n_theta_ + 1);
@@ -854,7 +990,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("gaqd error " << err << " in Spherepack");
     }
-    auto& quadrature_weights = storage_.quadrature_weights;
+    auto& quadrature_weights = storage->quadrature_weights;
     for (size_t i = 0; i < n_theta_; ++i) {
       for (size_t j = 0; j < n_phi_; ++j) {
         quadrature_weights[i + j * n_theta_] = (2 * M_PI / n_phi_) * weights[i];
@@ -869,7 +1005,7 @@ void Spherepack::fill_scalar_work_arrays() {
     DataVector temp(work0_size + work1_size);
     auto work0 = gsl::make_span(temp.data(), work0_size);
     auto work1 = gsl::make_span(temp.data() + work0_size, work1_size);
-    auto& work_phys_to_spec = storage_.work_phys_to_spec;
+    auto& work_phys_to_spec = storage->work_phys_to_spec;
     int err = 0;
     shagsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_phys_to_spec.data(),
@@ -879,7 +1015,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("shagsi error " << err << " in Spherepack");
     }
-    auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+    auto& work_scalar_spec_to_phys = storage->work_scalar_spec_to_phys;
     shsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_scalar_spec_to_phys.data(),
             static_cast<int>(work_scalar_spec_to_phys.size()), work0.data(),
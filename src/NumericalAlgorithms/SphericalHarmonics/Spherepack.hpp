@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -128,9 +129,17 @@ namespace ylm {
  * be "interpolated" (i.e. the new expansion evaluated) using `interpolate`.
  *
  * Spherepack stores two types of quantities:
- *   1. storage_, which is filled in the constructor and is always const.
+ *   1. storage_, which holds the Legendre tables and other constant work
+ *      arrays. It only depends on l_max and m_max, so it is computed once per
+ *      process for each (l_max, m_max) and shared by all instances (and
+ *      threads), including copies and instances constructed later, e.g. when
+ *      a Strahlkorper is prolonged or deserialized.
  *   2. memory_pool_, which is dynamic and thread_local, and is overwritten
  *      by various member functions that need temporary storage.
+ *
+ * Since storage_ is never modified after it is computed and memory_pool_ is
+ * thread_local, the const member functions of Spherepack may be called
+ * concurrently from different threads.
  */
 class Spherepack {
  public:
@@ -209,10 +218,10 @@ class Spherepack {
   /// The theta points are Gauss-Legendre in \f$\cos(\theta)\f$,
   /// so there are no points at the poles.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& theta_points() const {
-    return storage_.theta;
+    return storage_->theta;
   }
   SPECTRE_ALWAYS_INLINE const std::vector<double>& phi_points() const {
-    return storage_.phi;
+    return storage_->phi;
   }
   std::array<DataVector, 2> theta_phi_points() const;
   /// @}
@@ -260,6 +269,27 @@ class Spherepack {
   };
   /// @}
 
+  /// @{
+  /// Spectral transformations of `number_of_fields` fields at once. The
+  /// fields are stored one after another, i.e. field `k` starts at
+  /// `k * physical_size()` in `collocation_values` and at
+  /// `k * spectral_size()` in `spectral_coefs`, like the components of a
+  /// `Variables`.
+  ///
+  /// This is faster than transforming the fields one at a time because the
+  /// fields are interleaved internally and transformed with
+  /// `phys_to_spec_all_offsets` and `spec_to_phys_all_offsets`, so SPHEREPACK
+  /// reads each Legendre table entry once for all fields and its innermost
+  /// loops run over the fields.
+  void phys_to_spec_multiple_fields(
+      gsl::not_null<double*> spectral_coefs,
+      gsl::not_null<const double*> collocation_values,
+      size_t number_of_fields) const;
+  void spec_to_phys_multiple_fields(gsl::not_null<double*> collocation_values,
+                                    gsl::not_null<const double*> spectral_coefs,
+                                    size_t number_of_fields) const;
+  /// @}
+
   /// @{
   /// Simpler, less general interfaces to `phys_to_spec` and `spec_to_phys`.
   /// Acts on a slice of the input and returns a unit-stride result.
@@ -322,6 +352,13 @@ class Spherepack {
   }
   /// @}
 
+  /// Same as `gradient`, but for `number_of_fields` fields stored one after
+  /// another as in `phys_to_spec_multiple_fields`. `df[i]` holds the `i`th
+  /// component of the gradients of all fields, in the same order.
+  void gradient_multiple_fields(const std::array<double*, 2>& df,
+                                gsl::not_null<const double*> collocation_values,
+                                size_t number_of_fields) const;
+
   /// @{
   /// Simpler, less general interfaces to `gradient`.
   /// Acts on a slice of the input and returns a unit-stride result.
@@ -396,7 +433,7 @@ class Spherepack {
       gsl::not_null<const double*> collocation_values,
       size_t physical_stride = 1, size_t physical_offset = 0) const {
     // clang-tidy: 'do not use pointer arithmetic'
-    return ddot_(n_theta_ * n_phi_, storage_.quadrature_weights.data(), 1,
+    return ddot_(n_theta_ * n_phi_, storage_->quadrature_weights.data(), 1,
                  collocation_values.get() + physical_offset,  // NOLINT
                  physical_stride);
   }
@@ -405,7 +442,7 @@ class Spherepack {
   /// is the definite integral, where \f$c_i\f$ are collocation values
   /// at point i.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& integration_weights() const {
-    return storage_.quadrature_weights;
+    return storage_->quadrature_weights;
   }
 
   /// Adds a constant (i.e. \f$f(\theta,\phi)\f$ += \f$c\f$) to the function
@@ -500,10 +537,17 @@ class Spherepack {
                                 size_t physical_stride = 1,
                                 size_t physical_offset = 0,
                                 bool loop_over_offset = false) const;
-  void calculate_collocation_points();
-  void calculate_interpolation_data();
-  void fill_scalar_work_arrays();
-  void fill_vector_work_arrays();
+  // Returns the constant work arrays for l_max_ and m_max_, computing them
+  // if no other instance has done so yet.
+  std::shared_ptr<const Spherepack_detail::ConstStorage> shared_storage() const;
+  void calculate_collocation_points(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void calculate_interpolation_data(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void fill_scalar_work_arrays(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void fill_vector_work_arrays(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
   size_t l_max_, m_max_, n_theta_, n_phi_;
   size_t spectral_size_;
   // memory_pool_ will be shared by multiple instances of
@@ -515,7 +559,7 @@ class Spherepack {
   // safe to resize objects in memory_pool_ or to overwrite them with
   // arbitrary data.
   static thread_local Spherepack_detail::MemoryPool memory_pool_;
-  Spherepack_detail::ConstStorage storage_;
+  std::shared_ptr<const Spherepack_detail::ConstStorage> storage_;
 };  // class Spherepack
 
 bool operator==(const Spherepack& lhs, const Spherepack& rhs);
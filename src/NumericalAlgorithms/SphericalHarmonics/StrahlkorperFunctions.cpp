@@ -280,7 +280,16 @@ void cartesian_derivs_of_scalar(
   // If ylm_spherepack().gradient() ever gets a not_null function,
   // that function can be used here.
   const auto gradient = strahlkorper.ylm_spherepack().gradient(get(scalar));
+  cartesian_derivs_of_scalar(dx_scalar, gradient, radius_of_strahlkorper,
+                             inv_jac);
+}
 
+template <typename Fr>
+void cartesian_derivs_of_scalar(
+    const gsl::not_null<tnsr::i<DataVector, 3, Fr>*> dx_scalar,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>& gradient,
+    const Scalar<DataVector>& radius_of_strahlkorper,
+    const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac) {
   // Use dx_scalar component as temp to store 1/r to avoid allocation.
   get<2>(*dx_scalar) = 1.0 / get(radius_of_strahlkorper);
 
@@ -314,23 +323,37 @@ void cartesian_second_derivs_of_scalar(
     const Scalar<DataVector>& radius_of_strahlkorper,
     const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac,
     const ylm::Tags::aliases::InvHessian<Fr>& inv_hess) {
-  set_number_of_grid_points(d2x_scalar, scalar);
-  for (auto& component : *d2x_scalar) {
-    component = 0.0;
-  }
-
   // If ylm_spherepack().first_and_second_derivative() ever gets a not_null
   // function, that function can be used here.
   const auto derivs =
       strahlkorper.ylm_spherepack().first_and_second_derivative(get(scalar));
+  cartesian_second_derivs_of_scalar(d2x_scalar, derivs.first, derivs.second,
+                                    radius_of_strahlkorper, inv_jac, inv_hess);
+}
+
+template <typename Fr>
+void cartesian_second_derivs_of_scalar(
+    const gsl::not_null<tnsr::ii<DataVector, 3, Fr>*> d2x_scalar,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>&
+        first_angular_derivs,
+    const tnsr::ij<DataVector, 2, ::Frame::ElementLogical>&
+        second_angular_derivs,
+    const Scalar<DataVector>& radius_of_strahlkorper,
+    const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac,
+    const ylm::Tags::aliases::InvHessian<Fr>& inv_hess) {
+  set_number_of_grid_points(d2x_scalar, radius_of_strahlkorper);
+  for (auto& component : *d2x_scalar) {
+    component = 0.0;
+  }
 
   for (size_t i = 0; i < 3; ++i) {
     // Diagonal terms.  Divide by square(r) later.
     for (size_t k = 0; k < 2; ++k) {  // Angular derivs are 2-dimensional
-      d2x_scalar->get(i, i) += derivs.first.get(k) * inv_hess.get(k, i, i);
+      d2x_scalar->get(i, i) +=
+          first_angular_derivs.get(k) * inv_hess.get(k, i, i);
       for (size_t l = 0; l < 2; ++l) {  // Angular derivs are 2-dimensional
-        d2x_scalar->get(i, i) +=
-            derivs.second.get(l, k) * inv_jac.get(k, i) * inv_jac.get(l, i);
+        d2x_scalar->get(i, i) += second_angular_derivs.get(l, k) *
+                                 inv_jac.get(k, i) * inv_jac.get(l, i);
       }
     }
     d2x_scalar->get(i, i) /= square(get(radius_of_strahlkorper));
@@ -339,12 +362,13 @@ void cartesian_second_derivs_of_scalar(
     // Divide by 2*square(r) later.
     for (size_t j = i + 1; j < 3; ++j) {
       for (size_t k = 0; k < 2; ++k) {  // Angular derivs are 2-dimensional
-        d2x_scalar->get(i, j) += derivs.first.get(k) * (inv_hess.get(k, i, j) +
-                                                        inv_hess.get(k, j, i));
+        d2x_scalar->get(i, j) +=
+            first_angular_derivs.get(k) *
+            (inv_hess.get(k, i, j) + inv_hess.get(k, j, i));
         for (size_t l = 0; l < 2; ++l) {  // Angular derivs are 2-dimensional
-          d2x_scalar->get(i, j) +=
-              derivs.second.get(l, k) * (inv_jac.get(k, i) * inv_jac.get(l, j) +
-                                         inv_jac.get(k, j) * inv_jac.get(l, i));
+          d2x_scalar->get(i, j) += second_angular_derivs.get(l, k) *
+                                   (inv_jac.get(k, i) * inv_jac.get(l, j) +
+                                    inv_jac.get(k, j) * inv_jac.get(l, i));
         }
       }
       d2x_scalar->get(i, j) /= 2.0 * square(get(radius_of_strahlkorper));
@@ -366,13 +390,25 @@ void laplacian_of_scalar(
     const gsl::not_null<Scalar<DataVector>*> laplacian,
     const Scalar<DataVector>& scalar, const Strahlkorper<Fr>& strahlkorper,
     const tnsr::i<DataVector, 2, ::Frame::Spherical<Fr>>& theta_phi) {
-  get(*laplacian).destructive_resize(get(scalar).size());
   // If ylm_spherepack().first_and_second_derivative() ever gets a not_null
   // function, that function can be used here.
   const auto derivs =
       strahlkorper.ylm_spherepack().first_and_second_derivative(get(scalar));
-  get(*laplacian) = get<0, 0>(derivs.second) + get<1, 1>(derivs.second) +
-                    get<0>(derivs.first) / tan(get<0>(theta_phi));
+  laplacian_of_scalar(laplacian, derivs.first, derivs.second, theta_phi);
+}
+
+template <typename Fr>
+void laplacian_of_scalar(
+    const gsl::not_null<Scalar<DataVector>*> laplacian,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>&
+        first_angular_derivs,
+    const tnsr::ij<DataVector, 2, ::Frame::ElementLogical>&
+        second_angular_derivs,
+    const tnsr::i<DataVector, 2, ::Frame::Spherical<Fr>>& theta_phi) {
+  get(*laplacian).destructive_resize(get<0>(theta_phi).size());
+  get(*laplacian) = get<0, 0>(second_angular_derivs) +
+                    get<1, 1>(second_angular_derivs) +
+                    get<0>(first_angular_derivs) / tan(get<0>(theta_phi));
 }
 
 template <typename Fr>
@@ -392,6 +428,15 @@ void tangents(const gsl::not_null<ylm::Tags::aliases::Jacobian<Fr>*> result,
               const tnsr::i<DataVector, 3, Fr>& r_hat,
               const ylm::Tags::aliases::Jacobian<Fr>& jac) {
   const auto dr = strahlkorper.ylm_spherepack().gradient(get(radius));
+  tangents(result, dr, radius, r_hat, jac);
+}
+
+template <typename Fr>
+void tangents(
+    const gsl::not_null<ylm::Tags::aliases::Jacobian<Fr>*> result,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>& dr,
+    const Scalar<DataVector>& radius, const tnsr::i<DataVector, 3, Fr>& r_hat,
+    const ylm::Tags::aliases::Jacobian<Fr>& jac) {
   for (size_t i = 0; i < 2; ++i) {
     for (size_t j = 0; j < 3; ++j) {
       result->get(j, i) =
@@ -568,6 +613,11 @@ void time_deriv_of_strahlkorper(
       const Strahlkorper<FRAME(data)>& strahlkorper,                          \
       const Scalar<DataVector>& radius_of_strahlkorper,                       \
       const ylm::Tags::aliases::InvJacobian<FRAME(data)>& inv_jac);           \
+  template void ylm::cartesian_derivs_of_scalar(                              \
+      const gsl::not_null<tnsr::i<DataVector, 3, FRAME(data)>*> dx_scalar,    \
+      const tnsr::i<DataVector, 2, ::Frame::ElementLogical>& angular_derivs,  \
+      const Scalar<DataVector>& radius_of_strahlkorper,                       \
+      const ylm::Tags::aliases::InvJacobian<FRAME(data)>& inv_jac);           \
   template tnsr::ii<DataVector, 3, FRAME(data)>                               \
   ylm::cartesian_second_derivs_of_scalar(                                     \
       const Scalar<DataVector>& scalar,                                       \
@@ -582,6 +632,15 @@ void time_deriv_of_strahlkorper(
       const Scalar<DataVector>& radius_of_strahlkorper,                       \
       const ylm::Tags::aliases::InvJacobian<FRAME(data)>& inv_jac,            \
       const ylm::Tags::aliases::InvHessian<FRAME(data)>& inv_hess);           \
+  template void ylm::cartesian_second_derivs_of_scalar(                       \
+      const gsl::not_null<tnsr::ii<DataVector, 3, FRAME(data)>*> result,      \
+      const tnsr::i<DataVector, 2, ::Frame::ElementLogical>&                  \
+          first_angular_derivs,                                               \
+      const tnsr::ij<DataVector, 2, ::Frame::ElementLogical>&                 \
+          second_angular_derivs,                                              \
+      const Scalar<DataVector>& radius_of_strahlkorper,                       \
+      const ylm::Tags::aliases::InvJacobian<FRAME(data)>& inv_jac,            \
+      const ylm::Tags::aliases::InvHessian<FRAME(data)>& inv_hess);           \
   template Scalar<DataVector> ylm::laplacian_of_scalar(                       \
       const Scalar<DataVector>& scalar,                                       \
       const Strahlkorper<FRAME(data)>& strahlkorper,                          \
@@ -593,6 +652,14 @@ void time_deriv_of_strahlkorper(
       const Strahlkorper<FRAME(data)>& strahlkorper,                          \
       const tnsr::i<DataVector, 2, ::Frame::Spherical<FRAME(data)>>&          \
           theta_phi);                                                         \
+  template void ylm::laplacian_of_scalar(                                     \
+      const gsl::not_null<Scalar<DataVector>*> result,                        \
+      const tnsr::i<DataVector, 2, ::Frame::ElementLogical>&                  \
+          first_angular_derivs,                                               \
+      const tnsr::ij<DataVector, 2, ::Frame::ElementLogical>&                 \
+          second_angular_derivs,                                              \
+      const tnsr::i<DataVector, 2, ::Frame::Spherical<FRAME(data)>>&          \
+          theta_phi);                                                         \
   template ylm::Tags::aliases::Jacobian<FRAME(data)> ylm::tangents(           \
       const Strahlkorper<FRAME(data)>& strahlkorper,                          \
       const Scalar<DataVector>& radius,                                       \
@@ -604,6 +671,12 @@ void time_deriv_of_strahlkorper(
       const Scalar<DataVector>& radius,                                       \
       const tnsr::i<DataVector, 3, FRAME(data)>& r_hat,                       \
       const ylm::Tags::aliases::Jacobian<FRAME(data)>& jac);                  \
+  template void ylm::tangents(                                                \
+      const gsl::not_null<ylm::Tags::aliases::Jacobian<FRAME(data)>*> result, \
+      const tnsr::i<DataVector, 2, ::Frame::ElementLogical>& angular_derivs,  \
+      const Scalar<DataVector>& radius,                                       \
+      const tnsr::i<DataVector, 3, FRAME(data)>& r_hat,                       \
+      const ylm::Tags::aliases::Jacobian<FRAME(data)>& jac);                  \
   template tnsr::i<DataVector, 3, FRAME(data)> ylm::normal_one_form(          \
       const tnsr::i<DataVector, 3, FRAME(data)>& dx_radius,                   \
       const tnsr::i<DataVector, 3, FRAME(data)>& r_hat);                      \
@@ -207,6 +207,25 @@ void cartesian_derivs_of_scalar(
     const Scalar<DataVector>& scalar, const Strahlkorper<Fr>& strahlkorper,
     const Scalar<DataVector>& radius_of_strahlkorper,
     const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac);
+
+/*!
+ * \brief Same as above, but takes the angular derivatives of the scalar, as
+ * returned by `ylm::Spherepack::gradient`, instead of computing them.
+ *
+ * \param dx_scalar The returned derivatives of the scalar.
+ * \param angular_derivs The derivatives
+ * \f$(\partial_\theta f, \csc\theta\,\partial_\phi f)\f$ of the scalar.
+ * \param radius_of_strahlkorper The radius of the Strahlkorper at each
+ * point, as returned by `ylm::radius`.
+ * \param inv_jac The inverse Jacobian as returned by
+ * `ylm::inv_jacobian`
+ */
+template <typename Fr>
+void cartesian_derivs_of_scalar(
+    const gsl::not_null<tnsr::i<DataVector, 3, Fr>*> dx_scalar,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>& angular_derivs,
+    const Scalar<DataVector>& radius_of_strahlkorper,
+    const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac);
 /// @}
 
 /// @{
@@ -252,6 +271,22 @@ void cartesian_second_derivs_of_scalar(
     const Scalar<DataVector>& radius_of_strahlkorper,
     const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac,
     const ylm::Tags::aliases::InvHessian<Fr>& inv_hess);
+
+/*!
+ * \brief Same as above, but takes the first and second angular derivatives
+ * of the scalar, as returned by
+ * `ylm::Spherepack::first_and_second_derivative`, instead of computing them.
+ */
+template <typename Fr>
+void cartesian_second_derivs_of_scalar(
+    const gsl::not_null<tnsr::ii<DataVector, 3, Fr>*> d2x_scalar,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>&
+        first_angular_derivs,
+    const tnsr::ij<DataVector, 2, ::Frame::ElementLogical>&
+        second_angular_derivs,
+    const Scalar<DataVector>& radius_of_strahlkorper,
+    const ylm::Tags::aliases::InvJacobian<Fr>& inv_jac,
+    const ylm::Tags::aliases::InvHessian<Fr>& inv_hess);
 /// @}
 
 /// @{
@@ -274,6 +309,17 @@ void laplacian_of_scalar(
     const gsl::not_null<Scalar<DataVector>*> laplacian,
     const Scalar<DataVector>& scalar, const Strahlkorper<Fr>& strahlkorper,
     const tnsr::i<DataVector, 2, ::Frame::Spherical<Fr>>& theta_phi);
+
+/// Same as above, but takes the first and second angular derivatives of the
+/// scalar, as returned by `ylm::Spherepack::first_and_second_derivative`.
+template <typename Fr>
+void laplacian_of_scalar(
+    const gsl::not_null<Scalar<DataVector>*> laplacian,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>&
+        first_angular_derivs,
+    const tnsr::ij<DataVector, 2, ::Frame::ElementLogical>&
+        second_angular_derivs,
+    const tnsr::i<DataVector, 2, ::Frame::Spherical<Fr>>& theta_phi);
 /// @}
 
 /// @{
@@ -322,6 +368,17 @@ void tangents(const gsl::not_null<ylm::Tags::aliases::Jacobian<Fr>*> result,
               const Scalar<DataVector>& radius,
               const tnsr::i<DataVector, 3, Fr>& r_hat,
               const ylm::Tags::aliases::Jacobian<Fr>& jac);
+
+/*!
+ * \brief Same as above, but takes the angular derivatives of the radius, as
+ * returned by `ylm::Spherepack::gradient`, instead of computing them.
+ */
+template <typename Fr>
+void tangents(
+    const gsl::not_null<ylm::Tags::aliases::Jacobian<Fr>*> result,
+    const tnsr::i<DataVector, 2, ::Frame::ElementLogical>& angular_derivs,
+    const Scalar<DataVector>& radius, const tnsr::i<DataVector, 3, Fr>& r_hat,
+    const ylm::Tags::aliases::Jacobian<Fr>& jac);
 /// @}
 
 /// @{
@@ -8,6 +8,8 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ContainerHelpers.hpp"
@@ -24,6 +26,36 @@ void PhysicalCenterCompute<Frame>::function(
   *physical_center = strahlkorper.physical_center();
 }
 
+template <typename Frame>
+void AngularGradientOfRadiusCompute<Frame>::function(
+    const gsl::not_null<ylm::Spherepack::FirstDeriv*> angular_gradient,
+    const ylm::Strahlkorper<Frame>& strahlkorper) {
+  const auto& spherepack = strahlkorper.ylm_spherepack();
+  for (auto& component : *angular_gradient) {
+    component.destructive_resize(spherepack.physical_size());
+  }
+  spherepack.gradient_from_coefs({{get<0>(*angular_gradient).data(),
+                                   get<1>(*angular_gradient).data()}},
+                                 strahlkorper.coefficients().data());
+}
+
+template <typename Frame>
+void AngularSecondDerivsOfRadiusCompute<Frame>::function(
+    const gsl::not_null<ylm::Spherepack::SecondDeriv*> angular_second_derivs,
+    const ylm::Strahlkorper<Frame>& strahlkorper,
+    const Scalar<DataVector>& radius) {
+  const auto& spherepack = strahlkorper.ylm_spherepack();
+  for (auto& component : *angular_second_derivs) {
+    component.destructive_resize(spherepack.physical_size());
+  }
+  // `second_derivative` also computes the first derivatives. They are
+  // discarded here because `AngularGradientOfRadius` already holds them.
+  ylm::Spherepack::FirstDeriv first_derivs(spherepack.physical_size());
+  spherepack.second_derivative(
+      {{get<0>(first_derivs).data(), get<1>(first_derivs).data()}},
+      angular_second_derivs, get(radius).data());
+}
+
 }  // namespace ylm::Tags
 
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -31,4 +63,11 @@ void PhysicalCenterCompute<Frame>::function(
   template struct ylm::Tags::PhysicalCenterCompute<FRAME(data)>;
 GENERATE_INSTANTIATIONS(INSTANTIATE, (Frame::Grid, Frame::Inertial))
 #undef INSTANTIATE
+
+#define INSTANTIATE(_, data)                                               \
+  template struct ylm::Tags::AngularGradientOfRadiusCompute<FRAME(data)>; \
+  template struct ylm::Tags::AngularSecondDerivsOfRadiusCompute<FRAME(data)>;
+GENERATE_INSTANTIATIONS(INSTANTIATE,
+                        (Frame::Distorted, Frame::Grid, Frame::Inertial))
+#undef INSTANTIATE
 #undef FRAME
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/TagsDeclarations.hpp"
@@ -197,6 +198,52 @@ struct CartesianCoordsCompute : CartesianCoords<Frame>, db::ComputeTag {
 };
 /// @}
 
+/// @{
+/// The angular derivatives \f$\partial_\theta r_{\rm surf}\f$ and
+/// \f$\csc\theta\,\partial_\phi r_{\rm surf}\f$ of the radius, as returned
+/// by `ylm::Spherepack::gradient`. These are shared by `DxRadius` and
+/// `Tangents` and the quantities derived from them, so they are computed only
+/// once per surface. Computed directly from the coefficients of the
+/// `ylm::Strahlkorper`.
+template <typename Frame>
+struct AngularGradientOfRadius : db::SimpleTag {
+  using type = ylm::Spherepack::FirstDeriv;
+};
+
+template <typename Frame>
+struct AngularGradientOfRadiusCompute : AngularGradientOfRadius<Frame>,
+                                        db::ComputeTag {
+  using base = AngularGradientOfRadius<Frame>;
+  using return_type = ylm::Spherepack::FirstDeriv;
+  static void function(
+      gsl::not_null<ylm::Spherepack::FirstDeriv*> angular_gradient,
+      const ylm::Strahlkorper<Frame>& strahlkorper);
+  using argument_tags = tmpl::list<Strahlkorper<Frame>>;
+};
+/// @}
+
+/// @{
+/// The second angular derivatives of the radius, as returned by
+/// `ylm::Spherepack::second_derivative`. These are shared by `D2xRadius` and
+/// `LaplacianRadius`.
+template <typename Frame>
+struct AngularSecondDerivsOfRadius : db::SimpleTag {
+  using type = ylm::Spherepack::SecondDeriv;
+};
+
+template <typename Frame>
+struct AngularSecondDerivsOfRadiusCompute : AngularSecondDerivsOfRadius<Frame>,
+                                            db::ComputeTag {
+  using base = AngularSecondDerivsOfRadius<Frame>;
+  using return_type = ylm::Spherepack::SecondDeriv;
+  static void function(
+      gsl::not_null<ylm::Spherepack::SecondDeriv*> angular_second_derivs,
+      const ylm::Strahlkorper<Frame>& strahlkorper,
+      const Scalar<DataVector>& radius);
+  using argument_tags = tmpl::list<Strahlkorper<Frame>, Radius<Frame>>;
+};
+/// @}
+
 /// @{
 /// `DxRadius(i)` is \f$\partial r_{\rm surf}/\partial x^i\f$.  Here
 /// \f$r_{\rm surf}=r_{\rm surf}(\theta,\phi)\f$ is the function
@@ -215,12 +262,11 @@ struct DxRadiusCompute : DxRadius<Frame>, db::ComputeTag {
   using return_type = tnsr::i<DataVector, 3, Frame>;
   static constexpr auto function = static_cast<void (*)(
       const gsl::not_null<tnsr::i<DataVector, 3, Frame>*> dx_radius,
-      const Scalar<DataVector>& scalar,
-      const ylm::Strahlkorper<Frame>& strahlkorper,
+      const ylm::Spherepack::FirstDeriv& angular_derivs,
       const Scalar<DataVector>& radius_of_strahlkorper,
       const aliases::InvJacobian<Frame>& inv_jac)>(
       &ylm::cartesian_derivs_of_scalar);
-  using argument_tags = tmpl::list<Radius<Frame>, Strahlkorper<Frame>,
+  using argument_tags = tmpl::list<AngularGradientOfRadius<Frame>,
                                    Radius<Frame>, InvJacobian<Frame>>;
 };
 /// @}
@@ -244,14 +290,15 @@ struct D2xRadiusCompute : D2xRadius<Frame>, db::ComputeTag {
   using return_type = tnsr::ii<DataVector, 3, Frame>;
   static constexpr auto function = static_cast<void (*)(
       gsl::not_null<tnsr::ii<DataVector, 3, Frame>*> d2x_radius,
-      const Scalar<DataVector>& scalar,
-      const ylm::Strahlkorper<Frame>& strahlkorper,
+      const ylm::Spherepack::FirstDeriv& first_angular_derivs,
+      const ylm::Spherepack::SecondDeriv& second_angular_derivs,
       const Scalar<DataVector>& radius_of_strahlkorper,
       const aliases::InvJacobian<Frame>& inv_jac,
       const aliases::InvHessian<Frame>& inv_hess)>(
       &ylm::cartesian_second_derivs_of_scalar);
   using argument_tags =
-      tmpl::list<Radius<Frame>, Strahlkorper<Frame>, Radius<Frame>,
+      tmpl::list<AngularGradientOfRadius<Frame>,
+                 AngularSecondDerivsOfRadius<Frame>, Radius<Frame>,
                  InvJacobian<Frame>, InvHessian<Frame>>;
 };
 /// @}
@@ -271,12 +318,13 @@ struct LaplacianRadiusCompute : LaplacianRadius<Frame>, db::ComputeTag {
   using return_type = Scalar<DataVector>;
   static constexpr auto function = static_cast<void (*)(
       gsl::not_null<Scalar<DataVector>*> lap_radius,
-      const Scalar<DataVector>& radius,
-      const ylm::Strahlkorper<Frame>& strahlkorper,
+      const ylm::Spherepack::FirstDeriv& first_angular_derivs,
+      const ylm::Spherepack::SecondDeriv& second_angular_derivs,
       const tnsr::i<DataVector, 2, ::Frame::Spherical<Frame>>& theta_phi)>(
       &ylm::laplacian_of_scalar);
   using argument_tags =
-      tmpl::list<Radius<Frame>, Strahlkorper<Frame>, ThetaPhi<Frame>>;
+      tmpl::list<AngularGradientOfRadius<Frame>,
+                 AngularSecondDerivsOfRadius<Frame>, ThetaPhi<Frame>>;
 };
 /// @}
 
@@ -334,13 +382,14 @@ struct TangentsCompute : Tangents<Frame>, db::ComputeTag {
   using return_type = aliases::Jacobian<Frame>;
   static constexpr auto function =
       static_cast<void (*)(gsl::not_null<aliases::Jacobian<Frame>*> tangents,
-                           const ylm::Strahlkorper<Frame>& strahlkorper,
+                           const ylm::Spherepack::FirstDeriv& angular_derivs,
                            const Scalar<DataVector>& radius,
                            const tnsr::i<DataVector, 3, Frame>& r_hat,
                            const aliases::Jacobian<Frame>& jac)>(
           &ylm::tangents);
-  using argument_tags = tmpl::list<Strahlkorper<Frame>, Radius<Frame>,
-                                   Rhat<Frame>, Jacobian<Frame>>;
+  using argument_tags =
+      tmpl::list<AngularGradientOfRadius<Frame>, Radius<Frame>, Rhat<Frame>,
+                 Jacobian<Frame>>;
 };
 /// @}
 
@@ -382,7 +431,10 @@ using compute_items_tags =
     tmpl::list<ThetaPhiCompute<Frame>, RhatCompute<Frame>,
                JacobianCompute<Frame>, InvJacobianCompute<Frame>,
                InvHessianCompute<Frame>, RadiusCompute<Frame>,
-               CartesianCoordsCompute<Frame>, DxRadiusCompute<Frame>,
+               CartesianCoordsCompute<Frame>,
+               AngularGradientOfRadiusCompute<Frame>,
+               AngularSecondDerivsOfRadiusCompute<Frame>,
+               DxRadiusCompute<Frame>,
                D2xRadiusCompute<Frame>, LaplacianRadiusCompute<Frame>,
                NormalOneFormCompute<Frame>, TangentsCompute<Frame>>;
 }  // namespace ylm::Tags
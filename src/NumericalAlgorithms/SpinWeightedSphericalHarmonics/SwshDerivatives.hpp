@@ -10,6 +10,7 @@
 #include "DataStructures/ComplexDiagonalModalOperator.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
@@ -339,6 +340,23 @@ auto swsh_buffer(const size_t l_max, const size_t number_of_radial_points) {
 }
 
 namespace detail {
+// Produces a modal buffer like `swsh_buffer`, but with memory taken from the
+// `arena`, so that the derivative interfaces that don't receive buffers from
+// the caller don't allocate on every call.
+template <int Spin>
+SpinWeighted<ComplexModalVector, Spin> arena_swsh_buffer(
+    const gsl::not_null<ScratchArena*> arena, const size_t l_max,
+    const size_t number_of_radial_points) {
+  const size_t size =
+      size_of_libsharp_coefficient_vector(l_max) * number_of_radial_points;
+  SpinWeighted<ComplexModalVector, Spin> result{};
+  result.data().set_data_ref(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<std::complex<double>*>(arena->allocate(2 * size).data()),
+      size);
+  return result;
+}
+
 // template 'implementation' for the `angular_derivatives` function below which
 // evaluates an arbitrary number of derivatives, and places them in the set of
 // nodal containers passed by pointer.
@@ -375,12 +393,14 @@ void angular_derivatives_impl(
     std::index_sequence<Is...> index_sequence,
     tmpl::list<DerivativeKinds...> derivative_kinds,
     std::bool_constant<false> /*buffers_included_in_arguments*/) {
+  ScratchArena arena{};
   auto derivative_buffer_tuple = std::make_tuple(
-      swsh_buffer<std::decay_t<decltype(*get<Is>(argument_tuple))>::spin>(
-          l_max, number_of_radial_points)...);
-  auto input_buffer_tuple = std::make_tuple(
-      swsh_buffer<std::decay_t<decltype(get<Is + sizeof...(Is)>(
-          argument_tuple))>::spin>(l_max, number_of_radial_points)...);
+      arena_swsh_buffer<std::decay_t<decltype(*get<Is>(argument_tuple))>::spin>(
+          make_not_null(&arena), l_max, number_of_radial_points)...);
+  auto input_buffer_tuple =
+      std::make_tuple(arena_swsh_buffer<std::decay_t<decltype(get<
+                          Is + sizeof...(Is)>(argument_tuple))>::spin>(
+          make_not_null(&arena), l_max, number_of_radial_points)...);
   angular_derivatives_impl<Representation>(
       std::forward_as_tuple(make_not_null(&get<Is>(derivative_buffer_tuple))...,
                             make_not_null(&get<Is>(input_buffer_tuple))...,
@@ -399,8 +419,9 @@ void angular_derivatives_impl(
  *
  * \details This function provides two interfaces, one in which the caller
  * provides the intermediate coefficient buffers needed during the computation
- * of the derivatives, and one in which those buffers are temporarily allocated
- * during the derivative function calls.
+ * of the derivatives, and one in which those buffers are temporarily taken
+ * from a `ScratchArena` during the derivative function calls, so that
+ * repeated calls don't allocate once the arena has grown to the needed size.
  *
  * For the interface in which the caller does not provide buffers, the arguments
  * must take the following structure (enforced by internal function calls):
@@ -3,14 +3,33 @@
 
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
 namespace Spectral::Swsh {
+namespace {
+std::atomic<size_t> transform_threads{1};
+}  // namespace
+
+void set_number_of_transform_threads(const size_t number_of_threads) {
+  ASSERT(number_of_threads > 0,
+         "The libsharp transforms need at least one thread.");
+  transform_threads.store(number_of_threads, std::memory_order_relaxed);
+}
+
+size_t number_of_transform_threads() {
+  return transform_threads.load(std::memory_order_relaxed);
+}
 
 namespace detail {
 template <ComplexRepresentation Representation>
@@ -64,37 +83,51 @@ void execute_libsharp_transform_set(
     const sharp_alm_info* alm_info, const size_t num_transforms) {
   // libsharp considers two arrays per transform when spin is not zero.
   const size_t number_of_arrays_per_transform = (spin == 0 ? 1 : 2);
+  if (num_transforms == 0) {
+    return;
+  }
+  const size_t number_of_threads =
+      std::min(number_of_transform_threads(), num_transforms);
   // libsharp has an internal flag for the maximum number of transforms, so if
   // we have more than max_libsharp_transforms, we have to do them in chunks
-  // of max_libsharp_transforms.
-  for (size_t transform_block = 0;
-       transform_block <
-       (num_transforms + max_libsharp_transforms - 1) / max_libsharp_transforms;
-       ++transform_block) {
-    if (transform_block < (num_transforms / max_libsharp_transforms)) {
-      // clang-tidy cppcoreguidelines-pro-bounds-pointer-arithmetic
-      sharp_execute(jobtype, abs(spin),
-                    coefficient_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_metadata->get_sharp_geom_info(), alm_info,
-                    max_libsharp_transforms, SHARP_DP, nullptr, nullptr);
-    } else {
-      // clang-tidy cppcoreguidelines-pro-bounds-pointer-arithmetic
-      sharp_execute(jobtype, abs(spin),
-                    coefficient_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_data->data() +  // NOLINT
-                        number_of_arrays_per_transform *
-                            max_libsharp_transforms * transform_block,
-                    collocation_metadata->get_sharp_geom_info(), alm_info,
-                    num_transforms % max_libsharp_transforms, SHARP_DP, nullptr,
-                    nullptr);
-    }
+  // of max_libsharp_transforms. The chunks are made smaller if needed so each
+  // thread gets at least one.
+  const size_t transforms_per_chunk =
+      std::min(max_libsharp_transforms,
+               (num_transforms + number_of_threads - 1) / number_of_threads);
+  const size_t number_of_chunks =
+      (num_transforms + transforms_per_chunk - 1) / transforms_per_chunk;
+  const auto execute_chunk = [&](const size_t chunk) {
+    const size_t offset =
+        number_of_arrays_per_transform * transforms_per_chunk * chunk;
+    // clang-tidy cppcoreguidelines-pro-bounds-pointer-arithmetic
+    sharp_execute(jobtype, abs(spin),
+                  coefficient_data->data() + offset,  // NOLINT
+                  collocation_data->data() + offset,  // NOLINT
+                  collocation_metadata->get_sharp_geom_info(), alm_info,
+                  std::min(transforms_per_chunk,
+                           num_transforms - transforms_per_chunk * chunk),
+                  SHARP_DP, nullptr, nullptr);
+  };
+  // The chunks are distributed round-robin and the calling thread executes
+  // its share as well. The chunks only share the read-only libsharp metadata.
+  std::vector<std::thread> workers{};
+  workers.reserve(number_of_threads - 1);
+  for (size_t thread = 1; thread < number_of_threads; ++thread) {
+    workers.emplace_back(
+        [&execute_chunk, thread, number_of_threads, number_of_chunks]() {
+          for (size_t chunk = thread; chunk < number_of_chunks;
+               chunk += number_of_threads) {
+            execute_chunk(chunk);
+          }
+        });
+  }
+  for (size_t chunk = 0; chunk < number_of_chunks;
+       chunk += number_of_threads) {
+    execute_chunk(chunk);
+  }
+  for (auto& worker : workers) {
+    worker.join();
   }
 }
 }  // namespace detail
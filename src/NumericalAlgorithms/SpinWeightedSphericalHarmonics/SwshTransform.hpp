@@ -27,6 +27,24 @@ class ComplexModalVector;
 namespace Spectral {
 namespace Swsh {
 
+/*!
+ * \ingroup SwshGroup
+ * \brief Set the number of threads that the libsharp transforms of this
+ * process are split across.
+ *
+ * \details Each `SwshTransform` or `InverseSwshTransform` splits its set of
+ * transforms, e.g. all radial shells of a CCE hypersurface, into chunks that
+ * are executed concurrently, each with its own libsharp job. The default is a
+ * single thread, i.e. no additional threads are started. The threads are not
+ * bound to cores, so this should only be increased when cores are otherwise
+ * idle, e.g. on a node reserved for the CCE singleton.
+ */
+void set_number_of_transform_threads(size_t number_of_threads);
+
+/// \ingroup SwshGroup
+/// The number of threads set by `set_number_of_transform_threads()`
+size_t number_of_transform_threads();
+
 namespace detail {
 // libsharp has an internal maximum number of transforms that is not in the
 // public interface, so we must hard-code its value here
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -79,10 +80,10 @@ YAML::Node load_and_check_yaml(const std::string& options,
 namespace parse_detail {
 std::unordered_set<std::string> get_given_options(
     const Options::Context& context, const YAML::Node& node,
-    const std::string& help) {
+    const std::function<std::string()>& help) {
   if (not(node.IsMap() or node.IsNull())) {
     PARSE_ERROR(context, "'" << node << "' does not look like options.\n"
-                             << help);
+                             << help());
   }
 
   std::unordered_set<std::string> given_options{};
@@ -94,12 +95,12 @@ std::unordered_set<std::string> get_given_options(
 
 void check_for_unique_choice(const std::vector<size_t>& alternative_choices,
                              const Options::Context& context,
-                             const std::string& parsing_help) {
+                             const std::function<std::string()>& parsing_help) {
   if (alg::any_of(alternative_choices, [](const size_t x) {
         return x == std::numeric_limits<size_t>::max();
       })) {
     PARSE_ERROR(context, "Cannot decide between alternative options.\n"
-                             << parsing_help);
+                             << parsing_help());
   }
 }
 
@@ -113,35 +114,36 @@ void add_name_to_valid_option_names(
 
 [[noreturn]] void option_specified_twice_error(
     const Options::Context& context, const std::string& name,
-    const std::string& parsing_help) {
+    const std::function<std::string()>& parsing_help) {
   PARSE_ERROR(context, "Option '" << name << "' specified twice.\n"
-                                  << parsing_help);
+                                  << parsing_help());
 }
 
-[[noreturn]] void unused_key_error(const Context& context,
-                                   const std::string& name,
-                                   const std::string& parsing_help) {
+[[noreturn]] void unused_key_error(
+    const Context& context, const std::string& name,
+    const std::function<std::string()>& parsing_help) {
   PARSE_ERROR(context, "Option '"
                            << name
                            << "' is unused because of other provided options.\n"
-                           << parsing_help);
+                           << parsing_help());
 }
 
-[[noreturn]] void option_invalid_error(const Options::Context& context,
-                                       const std::string& name,
-                                       const std::string& parsing_help) {
+[[noreturn]] void option_invalid_error(
+    const Options::Context& context, const std::string& name,
+    const std::function<std::string()>& parsing_help) {
   PARSE_ERROR(context, "Option '" << name << "' is not a valid option.\n"
-                                  << parsing_help);
+                                  << parsing_help());
 }
 
-void check_for_missing_option(const std::vector<std::string>& valid_names,
-                              const Options::Context& context,
-                              const std::string& parsing_help) {
+void check_for_missing_option(
+    const std::vector<std::string>& valid_names,
+    const Options::Context& context,
+    const std::function<std::string()>& parsing_help) {
   if (not valid_names.empty()) {
     PARSE_ERROR(context, "You did not specify the option"
                              << (valid_names.size() == 1 ? " " : "s ")
                              << (MakeString{} << valid_names) << "\n"
-                             << parsing_help);
+                             << parsing_help());
   }
 }
 
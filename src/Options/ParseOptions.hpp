@@ -10,6 +10,7 @@
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <iterator>
 #include <limits>
@@ -680,13 +681,17 @@ void Parser<OptionList, Group>::pup(PUP::er& p) {
 // implementation of Options::Parser::parse() factored out to save on compile
 // time and compile memory
 namespace parse_detail {
+// The help strings passed to these functions are only needed for error
+// messages, so they are computed lazily: building them renders the help of
+// all nested options and, for `parsing_help`, the YAML node, which would
+// otherwise be done for every nested parser in the input file.
 std::unordered_set<std::string> get_given_options(
     const Options::Context& context, const YAML::Node& node,
-    const std::string& help);
+    const std::function<std::string()>& help);
 
 void check_for_unique_choice(const std::vector<size_t>& alternative_choices,
                              const Options::Context& context,
-                             const std::string& parsing_help);
+                             const std::function<std::string()>& parsing_help);
 
 void add_name_to_valid_option_names(
     gsl::not_null<std::vector<std::string>*> valid_option_names,
@@ -711,17 +716,17 @@ struct get_valid_option_names<tmpl::list<TopLevelOptionsAndGroups...>> {
   }
 };
 
-[[noreturn]] void option_specified_twice_error(const Options::Context& context,
-                                               const std::string& name,
-                                               const std::string& parsing_help);
+[[noreturn]] void option_specified_twice_error(
+    const Options::Context& context, const std::string& name,
+    const std::function<std::string()>& parsing_help);
 
-[[noreturn]] void unused_key_error(const Context& context,
-                                   const std::string& name,
-                                   const std::string& parsing_help);
+[[noreturn]] void unused_key_error(
+    const Context& context, const std::string& name,
+    const std::function<std::string()>& parsing_help);
 
 template <typename Tag>
 void check_for_unused_key(const Context& context, const std::string& name,
-                          const std::string& parsing_help) {
+                          const std::function<std::string()>& parsing_help) {
   if (name == pretty_type::name<Tag>()) {
     unused_key_error(context, name, parsing_help);
   }
@@ -733,19 +738,20 @@ struct check_for_unused_key_helper;
 template <typename... AllPossibleOptions>
 struct check_for_unused_key_helper<tmpl::list<AllPossibleOptions...>> {
   static void apply(const Context& context, const std::string& name,
-                    const std::string& parsing_help) {
+                    const std::function<std::string()>& parsing_help) {
     (check_for_unused_key<AllPossibleOptions>(context, name, parsing_help),
      ...);
   }
 };
 
-[[noreturn]] void option_invalid_error(const Options::Context& context,
-                                       const std::string& name,
-                                       const std::string& parsing_help);
+[[noreturn]] void option_invalid_error(
+    const Options::Context& context, const std::string& name,
+    const std::function<std::string()>& parsing_help);
 
-void check_for_missing_option(const std::vector<std::string>& valid_names,
-                              const Options::Context& context,
-                              const std::string& parsing_help);
+void check_for_missing_option(
+    const std::vector<std::string>& valid_names,
+    const Options::Context& context,
+    const std::function<std::string()>& parsing_help);
 
 std::string add_group_prefix_to_name(const std::string& name);
 
@@ -755,11 +761,14 @@ void print_top_level_error_message();
 template <typename OptionList, typename Group>
 void Parser<OptionList, Group>::parse(const YAML::Node& node) {
   std::unordered_set<std::string> given_options =
-      parse_detail::get_given_options(context_, node, help());
+      parse_detail::get_given_options(context_, node,
+                                      [this]() { return help(); });
 
   alternative_choices_ =
       Options_detail::choose_alternatives<OptionList>(given_options).second;
-  const std::string parsing_help_message = parsing_help(node);
+  const auto parsing_help_message = [this, &node]() {
+    return parsing_help(node);
+  };
   parse_detail::check_for_unique_choice(alternative_choices_, context_,
                                         parsing_help_message);
 
@@ -0,0 +1,115 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ActionTimings.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "Parallel/Phase.hpp"
+
+namespace Parallel {
+namespace {
+using TimingKey = std::tuple<const std::string*, Phase, const std::string*>;
+
+struct TimingKeyHash {
+  size_t operator()(const TimingKey& key) const {
+    size_t result = 0;
+    boost::hash_combine(result, std::get<0>(key));
+    boost::hash_combine(result, static_cast<int>(std::get<1>(key)));
+    boost::hash_combine(result, std::get<2>(key));
+    return result;
+  }
+};
+
+// The timings recorded by one thread. The mutex is only contended while the
+// timings are collected.
+struct ThreadActionTimings {
+  std::mutex mutex{};
+  std::unordered_map<TimingKey, ActionTiming, TimingKeyHash> timings{};
+};
+
+struct ActionTimingsRegistry {
+  std::mutex mutex{};
+  std::vector<std::unique_ptr<ThreadActionTimings>> threads{};
+};
+
+ActionTimingsRegistry& registry() {
+  static ActionTimingsRegistry registry{};
+  return registry;
+}
+
+ThreadActionTimings& thread_action_timings() {
+  thread_local ThreadActionTimings* const timings = []() {
+    auto& all_timings = registry();
+    const std::lock_guard lock(all_timings.mutex);
+    return all_timings.threads
+        .emplace_back(std::make_unique<ThreadActionTimings>())
+        .get();
+  }();
+  return *timings;
+}
+}  // namespace
+
+void ActionTiming::pup(PUP::er& p) {
+  p | calls;
+  p | retries;
+  p | time;
+  p | retry_time;
+  p | wait_time;
+}
+
+bool operator==(const ActionTiming& lhs, const ActionTiming& rhs) {
+  return lhs.calls == rhs.calls and lhs.retries == rhs.retries and
+         lhs.time == rhs.time and lhs.retry_time == rhs.retry_time and
+         lhs.wait_time == rhs.wait_time;
+}
+
+bool operator!=(const ActionTiming& lhs, const ActionTiming& rhs) {
+  return not(lhs == rhs);
+}
+
+void record_action_timing(const std::string& component_name,
+                          const Phase phase, const std::string& action_name,
+                          const double time, const bool retried,
+                          const double wait_time) {
+  auto& timings = thread_action_timings();
+  const std::lock_guard lock(timings.mutex);
+  ActionTiming& timing =
+      timings.timings[TimingKey{&component_name, phase, &action_name}];
+  ++timing.calls;
+  timing.time += time;
+  timing.wait_time += wait_time;
+  if (retried) {
+    ++timing.retries;
+    timing.retry_time += time;
+  }
+}
+
+ActionTimings collect_action_timings() {
+  ActionTimings result{};
+  auto& all_timings = registry();
+  const std::lock_guard registry_lock(all_timings.mutex);
+  for (const auto& thread_timings : all_timings.threads) {
+    const std::lock_guard lock(thread_timings->mutex);
+    for (const auto& [key, timing] : thread_timings->timings) {
+      ActionTiming& total = result[std::tuple{
+          *std::get<0>(key), std::get<1>(key), *std::get<2>(key)}];
+      total.calls += timing.calls;
+      total.retries += timing.retries;
+      total.time += timing.time;
+      total.retry_time += timing.retry_time;
+      total.wait_time += timing.wait_time;
+    }
+    thread_timings->timings.clear();
+  }
+  return result;
+}
+}  // namespace Parallel
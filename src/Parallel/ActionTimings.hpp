@@ -0,0 +1,91 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "Parallel/Phase.hpp"
+#include "Utilities/PrettyType.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/// \brief The number of calls to and the wallclock time spent in one iterable
+/// action.
+///
+/// \see Parallel::ActionTimings
+struct ActionTiming {
+  /// The number of times the action was invoked
+  size_t calls{0};
+  /// The number of invocations that returned `AlgorithmExecution::Retry`,
+  /// i.e. where the action was waiting for data in its inboxes
+  size_t retries{0};
+  /// The total wallclock time in seconds spent in the action
+  double time{0.0};
+  /// The wallclock time in seconds spent in invocations that returned
+  /// `AlgorithmExecution::Retry`
+  double retry_time{0.0};
+  /// The wallclock time in seconds between an invocation that returned
+  /// `AlgorithmExecution::Retry` and the next invocation, during which the
+  /// object was idle waiting for data, e.g. for a function of time to be
+  /// updated by a control system
+  double wait_time{0.0};
+
+  void pup(PUP::er& p);
+};
+
+bool operator==(const ActionTiming& lhs, const ActionTiming& rhs);
+bool operator!=(const ActionTiming& lhs, const ActionTiming& rhs);
+
+/*!
+ * \brief The timings of the iterable actions, keyed by the (pretty) name of
+ * the parallel component, the phase the action was run in, and the (pretty)
+ * name of the action.
+ *
+ * Timings are only recorded when SpECTRE is configured with
+ * `-D SPECTRE_PROFILE_ACTIONS=ON`. They are then written to the reductions
+ * file by the `observers::ObserverWriter` at every phase change, which is far
+ * cheaper to collect at scale than a Charm++ Projections trace.
+ */
+using ActionTimings =
+    std::map<std::tuple<std::string, Phase, std::string>, ActionTiming>;
+
+/*!
+ * \brief Record one invocation of an iterable action on the calling thread.
+ *
+ * `wait_time` is the time since the previous invocation if that invocation
+ * returned `AlgorithmExecution::Retry`, and zero otherwise.
+ *
+ * Only the addresses of `component_name` and `action_name` are stored, so
+ * they must remain valid for the whole run, e.g. by being function-local
+ * statics. This keeps the cost of recording an invocation to a hash map
+ * lookup per action call.
+ */
+void record_action_timing(const std::string& component_name, Phase phase,
+                          const std::string& action_name, double time,
+                          bool retried, double wait_time);
+
+/// \brief Record one invocation of the iterable action `Action` of the
+/// `ParallelComponent` on the calling thread.
+template <typename ParallelComponent, typename Action>
+void record_action_timing(const Phase phase, const double time,
+                          const bool retried, const double wait_time) {
+  static const std::string component_name =
+      pretty_type::name<ParallelComponent>();
+  static const std::string action_name = pretty_type::name<Action>();
+  record_action_timing(component_name, phase, action_name, time, retried,
+                       wait_time);
+}
+
+/// \brief Collect the timings that were recorded on all threads of this
+/// process since the last call and reset them.
+ActionTimings collect_action_timings();
+}  // namespace Parallel
@@ -23,6 +23,8 @@
 #include "Parallel/ArrayCollection/SpawnInitializeElementsInCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/MeasuredElementCosts.hpp"
+#include "Parallel/ArrayCollection/Tags/NodesWithMeasuredElementCosts.hpp"
 #include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
 #include "Parallel/CreateElementsUsingDistribution.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -60,6 +62,8 @@ namespace Parallel::Actions {
  *   - `Parallel::Tags::ElementCollection`
  *   - `Parallel::Tags::ElementLocations<Dim>`
  *   - `Parallel::Tags::NumberOfElementsTerminated`
+ *   - `Parallel::Tags::MeasuredElementCosts<Dim>`
+ *   - `Parallel::Tags::NodesWithMeasuredElementCosts`
  * - Removes: nothing
  * - Modifies:
  *   - `Parallel::Tags::ElementCollection`
@@ -72,7 +76,8 @@ struct CreateElementCollection {
   using simple_tags = tmpl::list<
       Parallel::Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
                                         SimpleTagsFromOptions>,
-      Parallel::Tags::ElementLocations<Dim>, Tags::NumberOfElementsTerminated>;
+      Parallel::Tags::ElementLocations<Dim>, Tags::NumberOfElementsTerminated,
+      Tags::MeasuredElementCosts<Dim>, Tags::NodesWithMeasuredElementCosts>;
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<::domain::Tags::Domain<Dim>,
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <charm++.h>
+#include <cmath>
 #include <cstddef>
 #include <exception>
+#include <limits>
 #include <pup.h>
 #include <string>
 #include <type_traits>
@@ -14,10 +16,12 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ActionTimings.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMemberBase.hpp"
 #include "Parallel/ArrayCollection/SetTerminateOnElement.hpp"
+#include "Parallel/ElementRegistration.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
@@ -34,6 +38,7 @@
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/System/Abort.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -159,6 +164,15 @@ class DgElementArrayMember<Dim, Metavariables,
     }
   }
 
+  /// @{
+  /// \brief (De)register the element with the
+  /// `Metavariables::registration::element_registrars`.
+  ///
+  /// This must be done when the element is moved to another node.
+  void deregister_element();
+  void register_element();
+  /// @}
+
   /// Print the expanded type aliases
   std::string print_types() const override;
 
@@ -191,6 +205,11 @@ class DgElementArrayMember<Dim, Metavariables,
   Parallel::CProxy_GlobalCache<Metavariables> global_cache_proxy_{};
   databox_type box_{};
   inbox_type inboxes_{};
+#ifdef SPECTRE_PROFILE_ACTIONS
+  // When the last iterable action returned `AlgorithmExecution::Retry`, or
+  // NaN. Not serialized since the wallclock time is local to the process.
+  double retried_at_time_ = std::numeric_limits<double>::quiet_NaN();
+#endif  // SPECTRE_PROFILE_ACTIONS
 };
 
 /// \cond
@@ -281,6 +300,7 @@ void DgElementArrayMember<Dim, Metavariables,
         this->halt_algorithm_until_next_phase_) {
       return;
     }
+    const double start_time = sys::wall_time();
     const auto invoke_for_phase = [this](auto phase_dep_v) {
       using PhaseDep = decltype(phase_dep_v);
       constexpr Parallel::Phase phase = PhaseDep::phase;
@@ -308,11 +328,30 @@ void DgElementArrayMember<Dim, Metavariables,
     // waiting on data to be sent or because the algorithm has been marked as
     // terminated.
     EXPAND_PACK_LEFT_TO_RIGHT(invoke_for_phase(PhaseDepActionListsPack{}));
+    this->measured_cost_ += sys::wall_time() - start_time;
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
   }
 }
 
+template <size_t Dim, typename Metavariables,
+          typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
+void DgElementArrayMember<Dim, Metavariables,
+                          tmpl::list<PhaseDepActionListsPack...>,
+                          SimpleTagsFromOptions>::deregister_element() {
+  Parallel::deregister_element<ParallelComponent>(
+      box_, *Parallel::local_branch(global_cache_proxy_), this->element_id_);
+}
+
+template <size_t Dim, typename Metavariables,
+          typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
+void DgElementArrayMember<Dim, Metavariables,
+                          tmpl::list<PhaseDepActionListsPack...>,
+                          SimpleTagsFromOptions>::register_element() {
+  Parallel::register_element<ParallelComponent>(
+      box_, *Parallel::local_branch(global_cache_proxy_), this->element_id_);
+}
+
 template <size_t Dim, typename Metavariables,
           typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
 std::string
@@ -436,10 +475,24 @@ bool DgElementArrayMember<Dim, Metavariables,
   }
 #endif  // SPECTRE_CHARM_PROJECTIONS
 
+#ifdef SPECTRE_PROFILE_ACTIONS
+  const double start_time = sys::wall_time();
+  const double wait_time = std::isnan(retried_at_time_)
+                               ? 0.0
+                               : start_time - retried_at_time_;
+#endif  // SPECTRE_PROFILE_ACTIONS
   const auto& [requested_execution, next_action_step] = ThisAction::apply(
       box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
       std::as_const(this->element_id_), actions_list{},
       std::add_pointer_t<ParallelComponent>{});
+#ifdef SPECTRE_PROFILE_ACTIONS
+  Parallel::record_action_timing<ParallelComponent, ThisAction>(
+      phase_dep_action::phase, sys::wall_time() - start_time,
+      requested_execution == AlgorithmExecution::Retry, wait_time);
+  retried_at_time_ = requested_execution == AlgorithmExecution::Retry
+                         ? sys::wall_time()
+                         : std::numeric_limits<double>::quiet_NaN();
+#endif  // SPECTRE_PROFILE_ACTIONS
 
   if (next_action_step.has_value()) {
     ASSERT(
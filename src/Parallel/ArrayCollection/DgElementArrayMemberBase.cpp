@@ -3,6 +3,7 @@
 
 #include "Parallel/ArrayCollection/DgElementArrayMemberBase.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <pup.h>
 #include <sstream>
@@ -65,6 +66,36 @@ size_t DgElementArrayMemberBase<Dim>::algorithm_step() const {
   return algorithm_step_;
 }
 
+template <size_t Dim>
+bool DgElementArrayMemberBase<Dim>::try_perform_algorithm() {
+  auto& requests = *perform_algorithm_requests_;
+  if (requests.fetch_add(1, std::memory_order_acq_rel) != 0) {
+    // Another thread is evaluating the algorithm and will handle this request
+    // before it releases the element.
+    return true;
+  }
+  if (not element_lock_.try_lock()) {
+    // The element is locked by something else. Requests made since our
+    // increment are covered by the retry of the caller.
+    requests.store(0, std::memory_order_release);
+    return false;
+  }
+  size_t requests_to_handle = 1;
+  while (true) {
+    perform_algorithm();
+    const size_t previous_requests =
+        requests.fetch_sub(requests_to_handle, std::memory_order_acq_rel);
+    if (previous_requests == requests_to_handle) {
+      break;
+    }
+    requests_to_handle = previous_requests - requests_to_handle;
+  }
+  // A request made between the decrement and the unlock fails to lock the
+  // element and is retried by its caller, so no request is lost.
+  element_lock_.unlock();
+  return true;
+}
+
 template <size_t Dim>
 std::string DgElementArrayMemberBase<Dim>::print_state() const {
   using ::operator<<;
@@ -102,6 +133,16 @@ size_t DgElementArrayMemberBase<Dim>::get_core() const {
   return my_core_;
 }
 
+template <size_t Dim>
+double DgElementArrayMemberBase<Dim>::measured_cost() const {
+  return measured_cost_;
+}
+
+template <size_t Dim>
+void DgElementArrayMemberBase<Dim>::reset_measured_cost() {
+  measured_cost_ = 0.0;
+}
+
 template <size_t Dim>
 void DgElementArrayMemberBase<Dim>::pup(PUP::er& p) {
   PUP::able::pup(p);
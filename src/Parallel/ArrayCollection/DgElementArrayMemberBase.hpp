@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <charm++.h>
 #include <cstddef>
 #include <limits>
+#include <memory>
 #include <pup.h>
 #include <string>
 #include <unordered_map>
@@ -73,6 +75,24 @@ class DgElementArrayMemberBase : PUP::able {
   /// Start evaluating the algorithm until it is stopped by an action.
   virtual void perform_algorithm() = 0;
 
+  /*!
+   * \brief Call `perform_algorithm()` if no other thread is operating on the
+   * element.
+   *
+   * If another thread is already evaluating the algorithm through this
+   * function, that thread is asked to call `perform_algorithm()` again once it
+   * is done. The work is then handed to the thread that already holds the
+   * element instead of being re-sent to the nodegroup, where it would wait
+   * behind all other queued messages and may fail to lock the element again.
+   *
+   * Returns `false` if the element is locked for another reason, e.g. a
+   * simple action. The caller must then retry later.
+   *
+   * No lock other than the `element_lock()` is acquired, so contributing
+   * threads never wait on each other.
+   */
+  bool try_perform_algorithm();
+
   /// Print the expanded type aliases
   virtual std::string print_types() const = 0;
 
@@ -105,6 +125,18 @@ class DgElementArrayMemberBase : PUP::able {
   /// \brief Get which core this element should pretend to be bound to.
   size_t get_core() const;
 
+  /// \brief The wallclock time in seconds spent evaluating the algorithm on
+  /// this element since the last call to `reset_measured_cost()`.
+  ///
+  /// This is used to redistribute the elements between nodes during the
+  /// `Parallel::Phase::LoadBalancing` phase, since a static
+  /// `domain::ElementWeight` cannot capture e.g. elements switching to a more
+  /// expensive numerical method during the evolution.
+  double measured_cost() const;
+
+  /// \brief Reset the `measured_cost()` to zero.
+  void reset_measured_cost();
+
   /// Returns the name of the last "next iterable action" to be run before a
   /// deadlock occurred.
   const std::string& deadlock_analysis_next_iterable_action() const {
@@ -118,6 +150,12 @@ class DgElementArrayMemberBase : PUP::able {
 
   Parallel::NodeLock inbox_lock_{};
   Parallel::NodeLock element_lock_{};
+  // The number of calls to try_perform_algorithm() that have not yet been
+  // handled. The thread that increments it from zero evaluates the algorithm
+  // until all requests are handled. Held by pointer so that the class remains
+  // movable.
+  std::unique_ptr<std::atomic<size_t>> perform_algorithm_requests_{
+      std::make_unique<std::atomic<size_t>>(0)};
   bool performing_action_ = false;
   Parallel::Phase phase_{Parallel::Phase::Initialization};
   std::unordered_map<Parallel::Phase, size_t> phase_bookmarks_{};
@@ -135,5 +173,8 @@ class DgElementArrayMemberBase : PUP::able {
   // interoperating with core-aware concepts like the interpolation
   // framework. Once that framework is core-agnostic we will remove my_core_.
   size_t my_core_{std::numeric_limits<size_t>::max()};
+  // Not serialized since the measurement is only meaningful on the hardware
+  // it was taken on.
+  double measured_cost_{0.0};
 };
 }  // namespace Parallel
@@ -5,22 +5,36 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include "Parallel/Algorithms/AlgorithmNodegroupDeclarations.hpp"
 #include "Parallel/ArrayCollection/CreateElementCollection.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMember.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMemberBase.hpp"
+#include "Parallel/ArrayCollection/RebalanceElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/TransformPdalForNodegroup.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace Parallel {
+namespace detail {
+template <typename PhaseDepActionList>
+struct has_load_balancing_phase;
+
+template <typename... PhaseDepActionListsPack>
+struct has_load_balancing_phase<tmpl::list<PhaseDepActionListsPack...>>
+    : std::bool_constant<((PhaseDepActionListsPack::phase ==
+                           Parallel::Phase::LoadBalancing) or
+                          ...)> {};
+}  // namespace detail
+
 /*!
  * \brief A collection of DG elements on a node.
  *
@@ -50,11 +64,20 @@ struct DgElementCollection {
       Parallel::Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
                                         simple_tags_from_options>;
 
+  static_assert(
+      not detail::has_load_balancing_phase<PhaseDepActionList>::value,
+      "The DgElementCollection redistributes its elements in the "
+      "LoadBalancing phase, so the elements must not have actions in that "
+      "phase.");
+
   /// \brief The phase dependent action lists.
   ///
   /// These are computed using
   /// `Parallel::TransformPhaseDependentActionListForNodegroup` from the
-  /// `PhaseDepActionList` template parameter.
+  /// `PhaseDepActionList` template parameter. In the
+  /// `Parallel::Phase::LoadBalancing` phase the elements are redistributed
+  /// between the nodes according to their measured cost (see
+  /// `Parallel::Actions::ContributeElementCosts`).
   using phase_dependent_action_list = tmpl::append<
       tmpl::list<Parallel::PhaseActions<
           Parallel::Phase::Initialization,
@@ -62,7 +85,11 @@ struct DgElementCollection {
                                                       PhaseDepActionList,
                                                       simple_tags_from_options>,
                      Parallel::Actions::TerminatePhase>>>,
-      TransformPhaseDependentActionListForNodegroup<PhaseDepActionList>>;
+      TransformPhaseDependentActionListForNodegroup<PhaseDepActionList>,
+      tmpl::list<Parallel::PhaseActions<
+          Parallel::Phase::LoadBalancing,
+          tmpl::list<Actions::ContributeElementCosts,
+                     Parallel::Actions::TerminatePhase>>>>;
 
   /// @{
   /// \brief The tags for the global cache.
@@ -41,14 +41,11 @@ struct PerformAlgorithmOnElement {
         typename ParallelComponent::element_collection_tag>(
         make_not_null(&box));
     auto& element = element_collection.at(element_to_execute_on);
-    std::unique_lock element_lock(element.element_lock(), std::defer_lock);
     if constexpr (Block) {
-      element_lock.lock();
+      const std::lock_guard element_lock(element.element_lock());
       element.perform_algorithm();
     } else {
-      if (element_lock.try_lock()) {
-        element.perform_algorithm();
-      } else {
+      if (not element.try_perform_algorithm()) {
         Parallel::threaded_action<
             Parallel::Actions::PerformAlgorithmOnElement<Block>>(
             my_proxy[my_node], element_to_execute_on);
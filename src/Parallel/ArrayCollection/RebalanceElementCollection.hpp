@@ -0,0 +1,253 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Creators/Tags/InitialExtents.hpp"
+#include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/MeasuredElementCosts.hpp"
+#include "Parallel/ArrayCollection/Tags/NodesWithMeasuredElementCosts.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/CreateElementsUsingDistribution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Parallel::Actions {
+/// \brief Threaded action that inserts an element moved from another node
+/// into the `DgElementCollection` and registers it on this node.
+///
+/// This is a threaded action intended to be run on the DG nodegroup.
+struct ReceiveMigratedElement {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DistributedObject, size_t Dim>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const DistributedObject* /*distributed_object*/,
+                    const ElementId<Dim>& element_id, const size_t core,
+                    const std::vector<char>& serialized_element) {
+    using element_type = typename ParallelComponent::dg_element_array_member;
+    const std::lock_guard node_guard(*node_lock);
+    db::mutate<typename ParallelComponent::element_collection_tag,
+               Tags::NumberOfElementsTerminated>(
+        [&element_id, core, &serialized_element](
+            const auto element_collection_ptr,
+            const gsl::not_null<size_t*> number_of_elements_terminated) {
+          const auto [it, inserted] = element_collection_ptr->emplace(
+              element_id,
+              deserialize<element_type>(serialized_element.data()));
+          if (not inserted) {
+            ERROR("Failed to insert migrated element with ID: " << element_id);
+          }
+          ASSERT(it->second.get_terminate(),
+                 "The element " << element_id
+                                << " was migrated while not terminated.");
+          ++(*number_of_elements_terminated);
+          it->second.set_core(core);
+          it->second.register_element();
+        },
+        make_not_null(&box));
+  }
+};
+
+/*!
+ * \brief Threaded action that collects the measured costs of the elements on
+ * all nodes and moves elements between nodes once every node has contributed.
+ *
+ * Every node receives the costs of all elements and computes the same new
+ * distribution with `domain::BlockZCurveProcDistribution`, using the measured
+ * wallclock time of the elements as their cost. If the metavariables opt into
+ * `Parallel::minimize_inter_node_communication_v` the distribution is then
+ * refined with `domain::minimize_inter_node_communication()`, just like the
+ * initial distribution. As for the initial distribution, the blocks are
+ * traversed along a Hilbert curve if the metavariables opt into
+ * `Parallel::order_blocks_along_hilbert_curve_v`. Each node then sends its
+ * elements that are assigned to a different node to that node with
+ * `ReceiveMigratedElement` and updates its `Parallel::Tags::ElementLocations`.
+ *
+ * If no cost has been measured yet, e.g. when load balancing before the
+ * evolution has started, the elements are not moved.
+ *
+ * \warning This may only be done while no element is executing and no data is
+ * in flight between elements, i.e. during the
+ * `Parallel::Phase::LoadBalancing` phase.
+ *
+ * This is a threaded action intended to be run on the DG nodegroup.
+ */
+struct ReceiveElementCosts {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DistributedObject, size_t Dim>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const DistributedObject* /*distributed_object*/,
+                    const size_t sender_node,
+                    const std::unordered_map<ElementId<Dim>, double>&
+                        element_costs) {
+    const size_t number_of_nodes = Parallel::number_of_nodes<size_t>(cache);
+    std::optional<std::unordered_map<ElementId<Dim>, double>> all_costs{};
+    {
+      const std::lock_guard node_guard(*node_lock);
+      db::mutate<Tags::MeasuredElementCosts<Dim>,
+                 Tags::NodesWithMeasuredElementCosts>(
+          [&all_costs, &element_costs, number_of_nodes, sender_node](
+              const auto measured_costs_ptr, const auto nodes_ptr) {
+            ASSERT(nodes_ptr->count(sender_node) == 0,
+                   "Already received the element costs from node "
+                       << sender_node);
+            nodes_ptr->insert(sender_node);
+            measured_costs_ptr->insert(element_costs.begin(),
+                                       element_costs.end());
+            if (nodes_ptr->size() == number_of_nodes) {
+              all_costs = std::move(*measured_costs_ptr);
+              measured_costs_ptr->clear();
+              nodes_ptr->clear();
+            }
+          },
+          make_not_null(&box));
+    }
+    if (not all_costs.has_value()) {
+      return;
+    }
+
+    double total_cost = 0.0;
+    for (const auto& [element_id, cost] : *all_costs) {
+      total_cost += cost;
+    }
+    if (total_cost == 0.0) {
+      return;
+    }
+
+    const auto& blocks =
+        Parallel::get<domain::Tags::Domain<Dim>>(cache).blocks();
+    const auto& initial_refinement_levels =
+        db::get<domain::Tags::InitialRefinementLevels<Dim>>(box);
+    const auto& initial_extents =
+        db::get<domain::Tags::InitialExtents<Dim>>(box);
+    const size_t number_of_procs = Parallel::number_of_procs<size_t>(cache);
+    const domain::BlockZCurveProcDistribution<Dim> element_distribution{
+        *all_costs,
+        number_of_procs,
+        blocks,
+        initial_refinement_levels,
+        initial_extents,
+        {},
+        order_blocks_along_hilbert_curve_v<Metavariables>};
+    std::vector<size_t> node_of_proc(number_of_procs);
+    for (size_t proc = 0; proc < number_of_procs; ++proc) {
+      node_of_proc[proc] = Parallel::node_of<size_t>(proc, cache);
+    }
+    std::unordered_map<ElementId<Dim>, size_t> proc_for_element{};
+    if constexpr (minimize_inter_node_communication_v<Metavariables>) {
+      if (number_of_nodes > 1) {
+        proc_for_element = domain::minimize_inter_node_communication(
+            element_distribution, *all_costs, blocks,
+            initial_refinement_levels, initial_extents, node_of_proc);
+      }
+    }
+    if (proc_for_element.empty()) {
+      for (const auto& [element_id, cost] : *all_costs) {
+        proc_for_element.emplace(
+            element_id, element_distribution.get_proc_for_element(element_id));
+      }
+    }
+
+    const size_t my_node = Parallel::my_node<size_t>(cache);
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const std::lock_guard node_guard(*node_lock);
+    db::mutate<Tags::ElementLocations<Dim>,
+               typename ParallelComponent::element_collection_tag,
+               Tags::NumberOfElementsTerminated>(
+        [&my_proxy, my_node, &node_of_proc, &proc_for_element](
+            const auto element_locations_ptr,
+            const auto element_collection_ptr,
+            const gsl::not_null<size_t*> number_of_elements_terminated) {
+          for (const auto& [element_id, proc] : proc_for_element) {
+            const size_t node = node_of_proc[proc];
+            (*element_locations_ptr)[element_id] = node;
+            const auto it = element_collection_ptr->find(element_id);
+            if (it == element_collection_ptr->end()) {
+              continue;
+            }
+            if (node == my_node) {
+              it->second.set_core(proc);
+              continue;
+            }
+            ASSERT(it->second.get_terminate(),
+                   "Can only move terminated elements, but "
+                       << element_id << " is not terminated.");
+            it->second.deregister_element();
+            Parallel::threaded_action<ReceiveMigratedElement>(
+                my_proxy[node], element_id, proc, serialize(it->second));
+            element_collection_ptr->erase(it);
+            --(*number_of_elements_terminated);
+          }
+        },
+        make_not_null(&box));
+  }
+};
+
+/*!
+ * \brief Sends the measured costs of all elements on this node to every node
+ * and resets them, so that the elements can be redistributed based on their
+ * cost since the last load balancing.
+ *
+ * See `ReceiveElementCosts` for the redistribution. This is run by the
+ * `DgElementCollection` in the `Parallel::Phase::LoadBalancing` phase, which
+ * can be triggered periodically with
+ * `PhaseControl::VisitAndReturn<Parallel::Phase::LoadBalancing>`.
+ *
+ * This is an iterable action intended to be run on the DG nodegroup.
+ */
+struct ContributeElementCosts {
+  template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent,
+            typename Metavariables>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    constexpr size_t Dim = Metavariables::volume_dim;
+    std::unordered_map<ElementId<Dim>, double> element_costs{};
+    db::mutate<typename ParallelComponent::element_collection_tag>(
+        [&element_costs](const auto element_collection_ptr) {
+          for (auto& [element_id, element] : *element_collection_ptr) {
+            element_costs.emplace(element_id, element.measured_cost());
+            element.reset_measured_cost();
+          }
+        },
+        make_not_null(&box));
+    Parallel::threaded_action<ReceiveElementCosts>(
+        Parallel::get_parallel_component<ParallelComponent>(cache),
+        Parallel::my_node<size_t>(cache), std::move(element_costs));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace Parallel::Actions
@@ -92,10 +92,7 @@ struct ReceiveDataForElement {
       element.start_phase(current_phase);
     } else {
       auto& element = element_collection->at(element_to_execute_on);
-      std::unique_lock element_lock(element.element_lock(), std::defer_lock);
-      if (element_lock.try_lock()) {
-        element.perform_algorithm();
-      } else {
+      if (not element.try_perform_algorithm()) {
         Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
             my_proxy[my_node], element_to_execute_on);
       }
@@ -0,0 +1,25 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+
+#include "DataStructures/DataBox/Tag.hpp"
+
+/// \cond
+template <size_t Dim>
+class ElementId;
+/// \endcond
+
+namespace Parallel::Tags {
+/// \brief The measured costs of the elements on all nodes, collected during
+/// the `Parallel::Phase::LoadBalancing` phase.
+///
+/// This should be in the nodegroup's DataBox.
+template <size_t Dim>
+struct MeasuredElementCosts : db::SimpleTag {
+  using type = std::unordered_map<ElementId<Dim>, double>;
+};
+}  // namespace Parallel::Tags
@@ -0,0 +1,20 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_set>
+
+#include "DataStructures/DataBox/Tag.hpp"
+
+namespace Parallel::Tags {
+/// \brief The nodes whose element costs have been received into
+/// `Parallel::Tags::MeasuredElementCosts` during the
+/// `Parallel::Phase::LoadBalancing` phase.
+///
+/// This should be in the nodegroup's DataBox.
+struct NodesWithMeasuredElementCosts : db::SimpleTag {
+  using type = std::unordered_set<size_t>;
+};
+}  // namespace Parallel::Tags
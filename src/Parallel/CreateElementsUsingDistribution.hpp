@@ -16,15 +16,48 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Parallel/DomainDiagnosticInfo.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Utilities/Numeric.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace Parallel {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(minimize_inter_node_communication)
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(order_blocks_along_hilbert_curve)
+}  // namespace detail
+
+/// \brief Whether the metavariables opted into refining the space-filling
+/// curve element distribution with
+/// `domain::minimize_inter_node_communication()` by setting
+/// `static constexpr bool minimize_inter_node_communication = true;`
+template <typename Metavariables>
+constexpr bool minimize_inter_node_communication_v =
+    detail::get_minimize_inter_node_communication_or_default_v<Metavariables,
+                                                               false>;
+
+/// \brief Whether the metavariables opted into traversing the blocks along a
+/// Hilbert curve in the space-filling curve element distribution (see
+/// `domain::BlockZCurveProcDistribution`) by setting
+/// `static constexpr bool order_blocks_along_hilbert_curve = true;`
+template <typename Metavariables>
+constexpr bool order_blocks_along_hilbert_curve_v =
+    detail::get_order_blocks_along_hilbert_curve_or_default_v<Metavariables,
+                                                              false>;
+
 /*!
  * \brief Creates elements using a chosen distribution.
  *
  * The `func` is called with `(element_id, target_proc, target_node)` allowing
  * the `func` to insert the element with `element_id` on the target processor
  * and node.
+ *
+ * If the `Metavariables` opt into `minimize_inter_node_communication_v` and
+ * the elements are distributed with a space-filling curve on more than one
+ * node, the distribution is refined with
+ * `domain::minimize_inter_node_communication()` to keep more mortars within a
+ * node. If they opt into `order_blocks_along_hilbert_curve_v`, the
+ * space-filling curve traverses the blocks along a Hilbert curve through their
+ * centers rather than in order of their block id.
  */
 template <typename F, size_t Dim, typename Metavariables>
 void create_elements_using_distribution(
@@ -43,14 +76,32 @@ void create_elements_using_distribution(
   // because then we have to use the space filling curve and not just use round
   // robin.
   domain::BlockZCurveProcDistribution<Dim> element_distribution{};
+  std::optional<std::unordered_map<ElementId<Dim>, size_t>>
+      refined_proc_for_element{};
   if (element_weight.has_value()) {
     const std::unordered_map<ElementId<Dim>, double> element_costs =
         domain::get_element_costs(blocks, initial_refinement_levels,
                                   initial_extents, element_weight.value(),
                                   quadrature);
     element_distribution = domain::BlockZCurveProcDistribution<Dim>{
-        element_costs,   num_of_procs_to_use, blocks, initial_refinement_levels,
-        initial_extents, procs_to_ignore};
+        element_costs,
+        num_of_procs_to_use,
+        blocks,
+        initial_refinement_levels,
+        initial_extents,
+        procs_to_ignore,
+        order_blocks_along_hilbert_curve_v<Metavariables>};
+    if constexpr (minimize_inter_node_communication_v<Metavariables>) {
+      if (number_of_nodes > 1) {
+        std::vector<size_t> node_of_proc(number_of_procs);
+        for (size_t proc = 0; proc < number_of_procs; ++proc) {
+          node_of_proc[proc] = Parallel::node_of<size_t>(proc, local_cache);
+        }
+        refined_proc_for_element = domain::minimize_inter_node_communication(
+            element_distribution, element_costs, blocks,
+            initial_refinement_levels, initial_extents, node_of_proc);
+      }
+    }
   }
 
   // Will be used to print domain diagnostic info
@@ -72,7 +123,9 @@ void create_elements_using_distribution(
     if (element_weight.has_value()) {
       for (const auto& element_id : element_ids) {
         const size_t target_proc =
-            element_distribution.get_proc_for_element(element_id);
+            refined_proc_for_element.has_value()
+                ? refined_proc_for_element->at(element_id)
+                : element_distribution.get_proc_for_element(element_id);
         const size_t target_node =
             Parallel::node_of<size_t>(target_proc, local_cache);
         func(element_id, target_proc, target_node);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <charm++.h>
+#include <cmath>
 #include <converse.h>
 #include <cstddef>
 #include <exception>
@@ -22,6 +23,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "Parallel/ActionTimings.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/Algorithms/AlgorithmArrayDeclarations.hpp"
@@ -440,6 +442,11 @@ class DistributedObject<ParallelComponent,
 #ifdef SPECTRE_CHARM_PROJECTIONS
   double non_action_time_start_;
 #endif
+#ifdef SPECTRE_PROFILE_ACTIONS
+  // When the last iterable action returned `AlgorithmExecution::Retry`, or
+  // NaN. Not serialized since the wallclock time is local to the process.
+  double retried_at_time_ = std::numeric_limits<double>::quiet_NaN();
+#endif  // SPECTRE_PROFILE_ACTIONS
 
   Parallel::CProxy_GlobalCache<metavariables> global_cache_proxy_;
   bool performing_action_ = false;
@@ -684,7 +691,8 @@ void DistributedObject<
   if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
     if (phase_ == Parallel::Phase::LoadBalancing) {
       ERROR(
-          "Can't do load balacing phase with DG element collection right now.");
+          "The DG element collection balances its elements itself and must "
+          "not be migrated by Charm++ in the load balancing phase.");
     }
   } else {
     // Note that `perform_registration_or_deregistration` passes the `box_` by
@@ -1132,12 +1140,26 @@ bool DistributedObject<
   }
 #endif // SPECTRE_CHARM_PROJECTIONS
 
+#ifdef SPECTRE_PROFILE_ACTIONS
+  const double start_time = sys::wall_time();
+  const double wait_time = std::isnan(retried_at_time_)
+                               ? 0.0
+                               : start_time - retried_at_time_;
+#endif  // SPECTRE_PROFILE_ACTIONS
   AlgorithmExecution requested_execution{};
   std::optional<std::size_t> next_action_step{};
   std::tie(requested_execution, next_action_step) = ThisAction::apply(
       box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
       std::as_const(array_index_), actions_list{},
       std::add_pointer_t<ParallelComponent>{});
+#ifdef SPECTRE_PROFILE_ACTIONS
+  Parallel::record_action_timing<ParallelComponent, ThisAction>(
+      phase_dep_action::phase, sys::wall_time() - start_time,
+      requested_execution == AlgorithmExecution::Retry, wait_time);
+  retried_at_time_ = requested_execution == AlgorithmExecution::Retry
+                         ? sys::wall_time()
+                         : std::numeric_limits<double>::quiet_NaN();
+#endif  // SPECTRE_PROFILE_ACTIONS
 
   if (next_action_step.has_value()) {
     ASSERT(
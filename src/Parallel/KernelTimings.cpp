@@ -0,0 +1,97 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/KernelTimings.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel {
+namespace {
+// The timings recorded by one thread. The mutex is only contended while the
+// timings are collected.
+struct ThreadKernelTimings {
+  std::mutex mutex{};
+  std::unordered_map<const std::string*, KernelTiming> timings{};
+};
+
+struct KernelTimingsRegistry {
+  std::mutex mutex{};
+  std::vector<std::unique_ptr<ThreadKernelTimings>> threads{};
+};
+
+KernelTimingsRegistry& registry() {
+  static KernelTimingsRegistry registry{};
+  return registry;
+}
+
+ThreadKernelTimings& thread_kernel_timings() {
+  thread_local ThreadKernelTimings* const timings = []() {
+    auto& all_timings = registry();
+    const std::lock_guard lock(all_timings.mutex);
+    return all_timings.threads
+        .emplace_back(std::make_unique<ThreadKernelTimings>())
+        .get();
+  }();
+  return *timings;
+}
+}  // namespace
+
+void KernelTiming::pup(PUP::er& p) {
+  p | calls;
+  p | time;
+  p | min_time;
+  p | max_time;
+}
+
+bool operator==(const KernelTiming& lhs, const KernelTiming& rhs) {
+  return lhs.calls == rhs.calls and lhs.time == rhs.time and
+         lhs.min_time == rhs.min_time and lhs.max_time == rhs.max_time;
+}
+
+bool operator!=(const KernelTiming& lhs, const KernelTiming& rhs) {
+  return not(lhs == rhs);
+}
+
+void record_kernel_timing(const std::string& kernel_name, const double time) {
+  auto& timings = thread_kernel_timings();
+  const std::lock_guard lock(timings.mutex);
+  KernelTiming& timing = timings.timings[&kernel_name];
+  ++timing.calls;
+  timing.time += time;
+  timing.min_time = std::min(timing.min_time, time);
+  timing.max_time = std::max(timing.max_time, time);
+}
+
+KernelTimings collect_kernel_timings() {
+  KernelTimings result{};
+  auto& all_timings = registry();
+  const std::lock_guard registry_lock(all_timings.mutex);
+  for (const auto& thread_timings : all_timings.threads) {
+    const std::lock_guard lock(thread_timings->mutex);
+    for (const auto& [kernel_name, timing] : thread_timings->timings) {
+      KernelTiming& total = result[*kernel_name];
+      total.calls += timing.calls;
+      total.time += timing.time;
+      total.min_time = std::min(total.min_time, timing.min_time);
+      total.max_time = std::max(total.max_time, timing.max_time);
+    }
+    thread_timings->timings.clear();
+  }
+  return result;
+}
+
+ScopedKernelTimer::ScopedKernelTimer(const std::string& kernel_name)
+    : kernel_name_(kernel_name), start_time_(sys::wall_time()) {}
+
+ScopedKernelTimer::~ScopedKernelTimer() {
+  record_kernel_timing(kernel_name_, sys::wall_time() - start_time_);
+}
+}  // namespace Parallel
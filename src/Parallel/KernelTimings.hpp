@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/preprocessor/cat.hpp>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/// \brief The number of calls to and the wallclock times spent in one
+/// annotated kernel.
+///
+/// \see SPECTRE_KERNEL_TIMER
+struct KernelTiming {
+  /// The number of times the kernel was run
+  size_t calls{0};
+  /// The total wallclock time in seconds spent in the kernel
+  double time{0.0};
+  /// The shortest wallclock time in seconds of a single call
+  double min_time{std::numeric_limits<double>::infinity()};
+  /// The longest wallclock time in seconds of a single call
+  double max_time{0.0};
+
+  void pup(PUP::er& p);
+};
+
+bool operator==(const KernelTiming& lhs, const KernelTiming& rhs);
+bool operator!=(const KernelTiming& lhs, const KernelTiming& rhs);
+
+/// \brief The timings of the annotated kernels, keyed by the name of the
+/// kernel.
+///
+/// \see SPECTRE_KERNEL_TIMER
+using KernelTimings = std::map<std::string, KernelTiming>;
+
+/*!
+ * \brief Record one call of a kernel on the calling thread.
+ *
+ * Only the address of `kernel_name` is stored, so it must remain valid for the
+ * whole run, e.g. by being a function-local static.
+ */
+void record_kernel_timing(const std::string& kernel_name, double time);
+
+/// \brief Collect the timings that were recorded on all threads of this
+/// process since the last call and reset them.
+KernelTimings collect_kernel_timings();
+
+/// \brief Records the wallclock time between its construction and destruction
+/// as one call of the kernel `kernel_name`.
+///
+/// Use the `SPECTRE_KERNEL_TIMER` macro instead of constructing this directly,
+/// so the timer is compiled out unless profiling is enabled.
+class ScopedKernelTimer {
+ public:
+  explicit ScopedKernelTimer(const std::string& kernel_name);
+  ~ScopedKernelTimer();
+  ScopedKernelTimer(const ScopedKernelTimer&) = delete;
+  ScopedKernelTimer& operator=(const ScopedKernelTimer&) = delete;
+  ScopedKernelTimer(ScopedKernelTimer&&) = delete;
+  ScopedKernelTimer& operator=(ScopedKernelTimer&&) = delete;
+
+ private:
+  const std::string& kernel_name_;
+  double start_time_;
+};
+}  // namespace Parallel
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Time the rest of the enclosing scope as one call of the kernel
+ * `NAME` (a string literal).
+ *
+ * When SpECTRE is configured with `-D SPECTRE_PROFILE_KERNELS=ON`, the number
+ * of calls and the total, shortest and longest wallclock times of every
+ * annotated kernel are recorded in thread-local maps, which costs two clock
+ * reads and a hash map lookup per call. They are written to the reductions
+ * file by the `Events::ObserveKernelTimings` event. Otherwise this macro
+ * expands to nothing.
+ *
+ * \snippet Test_KernelTimings.cpp kernel_timer_example
+ */
+#ifdef SPECTRE_PROFILE_KERNELS
+#define SPECTRE_KERNEL_TIMER(NAME)                                          \
+  static const std::string BOOST_PP_CAT(spectre_kernel_name_, __LINE__){    \
+      NAME};                                                                \
+  const Parallel::ScopedKernelTimer BOOST_PP_CAT(spectre_kernel_timer_,     \
+                                                 __LINE__) {                \
+    BOOST_PP_CAT(spectre_kernel_name_, __LINE__)                            \
+  }
+#else
+#define SPECTRE_KERNEL_TIMER(NAME)
+#endif  // SPECTRE_PROFILE_KERNELS
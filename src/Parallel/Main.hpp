@@ -56,6 +56,8 @@ namespace Parallel {
 namespace detail {
 CREATE_IS_CALLABLE(run_deadlock_analysis_simple_actions)
 CREATE_IS_CALLABLE_V(run_deadlock_analysis_simple_actions)
+CREATE_IS_CALLABLE(write_action_timings)
+CREATE_IS_CALLABLE_V(write_action_timings)
 }  // namespace detail
 
 /// \ingroup ParallelGroup
@@ -142,6 +144,11 @@ class Main : public CBase_Main<Metavariables> {
   /// detected.
   void post_deadlock_analysis_termination();
 
+  /// Checks that all components terminated cleanly before exiting. Used as a
+  /// quiescence callback when entering the Exit phase requires finishing work
+  /// first, such as writing the `Parallel::ActionTimings`.
+  void start_termination_check();
+
  private:
   // Return the dir name for the Charm++ checkpoints as well as the prefix for
   // checkpoint names and their padding. This is a "detail" function so that
@@ -784,7 +791,22 @@ void Main<Metavariables>::execute_next_phase() {
   }
 
   if (Parallel::Phase::Exit == current_phase_) {
+#ifdef SPECTRE_PROFILE_ACTIONS
+    // Write the action timings of the last phase and wait for them to be
+    // written before the termination check ends the run.
+    tmpl::for_each<component_list>([this](auto parallel_component) {
+      using component = tmpl::type_from<decltype(parallel_component)>;
+      if constexpr (detail::is_write_action_timings_callable_v<
+                        component, CProxy_GlobalCache<Metavariables>&>) {
+        component::write_action_timings(global_cache_proxy_);
+      }
+    });
+    CkStartQD(CkCallback(
+        CkIndex_Main<Metavariables>::start_termination_check(),
+        this->thisProxy));
+#else
     check_if_component_terminated_correctly();
+#endif  // SPECTRE_PROFILE_ACTIONS
     return;
   }
   tmpl::for_each<component_list>([this](auto parallel_component) {
@@ -928,6 +950,11 @@ void Main<Metavariables>::did_all_elements_terminate(
   check_if_component_terminated_correctly();
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::start_termination_check() {
+  check_if_component_terminated_correctly();
+}
+
 template <typename Metavariables>
 void Main<Metavariables>::check_if_component_terminated_correctly() {
   auto* global_cache = Parallel::local_branch(global_cache_proxy_);
@@ -4,9 +4,13 @@
 #include "Parallel/Printf/Printf.hpp"
 
 #include <cerrno>
+#include <cstddef>
 #include <cstdio>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -84,6 +88,30 @@ void send_message_to_file(const std::string& file,
     do_print_to_file(file, message);
   }
 }
+
+std::optional<size_t> rate_limit(const std::string& source,
+                                 const double min_interval) {
+  struct SourceState {
+    double last_printed;
+    size_t dropped;
+  };
+  static std::mutex mutex{};
+  static std::unordered_map<std::string, SourceState> sources{};
+  const double now = sys::wall_time();
+  const std::lock_guard lock(mutex);
+  const auto [state, inserted] =
+      sources.try_emplace(source, SourceState{now, 0});
+  if (inserted) {
+    return 0;
+  }
+  if (now - state->second.last_printed < min_interval) {
+    ++state->second.dropped;
+    return std::nullopt;
+  }
+  const size_t dropped = state->second.dropped;
+  state->second = SourceState{now, 0};
+  return dropped;
+}
 }  // namespace detail
 
 void PrinterChare::print(const bool error, const std::vector<char>& message) {
@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <iomanip>
 #include <limits>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -86,6 +87,14 @@ void send_message(bool error, const std::vector<char>& message);
 void send_message_to_file(const std::string& file,
                           const std::vector<char>& message);
 
+/*!
+ * Returns `std::nullopt` if a message from `source` was already printed by
+ * this process less than `min_interval` seconds ago, and otherwise the number
+ * of messages from `source` that were dropped since the last one was printed.
+ */
+std::optional<size_t> rate_limit(const std::string& source,
+                                 double min_interval);
+
 template <typename... Ts>
 inline std::vector<char> allocate_message(const char* const format, Ts&&... t) {
 #pragma GCC diagnostic push
@@ -127,6 +136,40 @@ inline void printf(const std::string& format, Args&&... args) {
       false, detail::format_message(format, std::forward<Args>(args)...));
 }
 
+/*!
+ * \ingroup ParallelGroup
+ * \brief Print an atomic message to stdout like Parallel::printf, but at most
+ * once every `min_interval` seconds of wallclock time per `source` on each
+ * node.
+ *
+ * Use this for diagnostics that can be emitted by many elements or at every
+ * step, so they don't flood the printer chare on node 0. Messages are
+ * dropped before they are formatted and sent, and the number of dropped
+ * messages is noted with the next message from the same `source` that is
+ * printed.
+ */
+template <typename... Args>
+inline void printf_rate_limited(const std::string& source,
+                                const double min_interval,
+                                const std::string& format, Args&&... args) {
+  const std::optional<size_t> dropped =
+      detail::rate_limit(source, min_interval);
+  if (not dropped.has_value()) {
+    return;
+  }
+  std::vector<char> message =
+      detail::format_message(format, std::forward<Args>(args)...);
+  if (*dropped > 0) {
+    const std::string note = "[Dropped " + std::to_string(*dropped) +
+                             " messages from '" + source + "']\n";
+    // Replace the null byte
+    message.pop_back();
+    message.insert(message.end(), note.begin(), note.end());
+    message.push_back('\0');
+  }
+  detail::send_message(false, message);
+}
+
 /*!
  * \ingroup ParallelGroup
  * \brief Print an atomic message to stderr with C printf usage.
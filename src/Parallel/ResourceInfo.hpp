@@ -34,6 +34,7 @@
 #include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 #include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
 
 /// \cond
@@ -47,6 +48,21 @@ struct ResourceInfo;
 /// \endcond
 
 namespace Parallel {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(exclusive_by_default)
+}  // namespace detail
+
+/// \brief Whether the singleton `Component` opted into being placed on an
+/// exclusive proc when its resources are chosen automatically by setting
+/// `static constexpr bool exclusive_by_default = true;`
+///
+/// This is meant for singletons doing enough work that sharing a proc with
+/// array elements would hold back the rest of the simulation, e.g. the CCE
+/// evolution. See `Parallel::ResourceInfo` for details.
+template <typename Component>
+constexpr bool exclusive_by_default_v =
+    detail::get_exclusive_by_default_or_default_v<Component, false>;
+
 /*!
  * \ingroup ParallelGroup
  * \brief Holds resource info for a single singleton component
@@ -56,8 +72,11 @@ namespace Parallel {
  * singletons placed on that proc. Instead of specifying a proc, the proc can be
  * chosen automatically by using the `Options::Auto` option.
  *
- * The template parameter `Component` is only used to identify which singleton
- * component this SingletonInfoHolder belongs to.
+ * The template parameter `Component` identifies which singleton component
+ * this SingletonInfoHolder belongs to. A default-constructed
+ * SingletonInfoHolder (e.g. from specifying `Auto` in the input file) chooses
+ * its proc automatically and is exclusive if and only if
+ * `Parallel::exclusive_by_default_v<Component>` is true.
  */
 template <typename Component>
 struct SingletonInfoHolder {
@@ -123,7 +142,7 @@ struct SingletonInfoHolder {
   // in the option because we want to protect against negative numbers. And a
   // negative size_t is actually a really large value (it wraps around)
   std::optional<size_t> proc_{std::nullopt};
-  bool exclusive_{false};
+  bool exclusive_{exclusive_by_default_v<Component>};
 };
 
 template <typename ParallelComponent>
@@ -276,6 +295,17 @@ using singleton_components =
  * you want to have it's proc determined automatically and be non-exclusive,
  * like `MySingleton2`).
  *
+ * Singletons that are expensive enough that array elements on the same proc
+ * would slow them down (and through them the whole simulation) can set
+ * `static constexpr bool exclusive_by_default = true;` in their component. When
+ * such a singleton is `Auto` (either itself or through `Singletons: Auto`) it
+ * is treated as `Proc: Auto` and `Exclusive: true`, so a core is reserved for
+ * it and the array elements are distributed over the remaining cores. If there
+ * aren't enough cores to reserve one for each of these auto exclusive
+ * singletons while leaving at least one core for array elements, as many of
+ * them as necessary are made nonexclusive instead of raising an error, so small
+ * runs and tests keep working.
+ *
  * Several consistency checks are done during option parsing to avoid user
  * error. However, some checks can't be done during option parsing because the
  * number of nodes/procs is needed to determine if there is an inconsistency.
@@ -438,6 +468,7 @@ struct ResourceInfo {
   // determined just by option parsing
   size_t num_exclusive_singletons_{};
   size_t num_procs_to_ignore_{};
+  size_t num_auto_exclusive_by_default_singletons_{};
   size_t num_requested_exclusive_singletons_{};
   size_t num_requested_nonexclusive_singletons_{};
   std::unordered_multiset<size_t> requested_nonexclusive_procs_{};
@@ -507,6 +538,8 @@ ResourceInfo<Metavariables>::ResourceInfo(
           if (proc.has_value()) {
             procs_to_ignore_.insert(static_cast<size_t>(*proc));
             ++num_requested_exclusive_singletons_;
+          } else if constexpr (exclusive_by_default_v<component>) {
+            ++num_auto_exclusive_by_default_singletons_;
           }
         } else {
           // This singleton is not exclusive.
@@ -566,6 +599,7 @@ void ResourceInfo<Metavariables>::pup(PUP::er& p) {
   p | singleton_map_has_been_set_;
   p | num_exclusive_singletons_;
   p | num_procs_to_ignore_;
+  p | num_auto_exclusive_by_default_singletons_;
   p | num_requested_exclusive_singletons_;
   p | num_requested_nonexclusive_singletons_;
   p | requested_nonexclusive_procs_;
@@ -620,6 +654,8 @@ bool operator==(const ResourceInfo<Metavars>& lhs,
          lhs.singleton_map_has_been_set_ == rhs.singleton_map_has_been_set_ and
          lhs.num_exclusive_singletons_ == rhs.num_exclusive_singletons_ and
          lhs.num_procs_to_ignore_ == rhs.num_procs_to_ignore_ and
+         lhs.num_auto_exclusive_by_default_singletons_ ==
+             rhs.num_auto_exclusive_by_default_singletons_ and
          lhs.num_requested_exclusive_singletons_ ==
              rhs.num_requested_exclusive_singletons_ and
          lhs.num_requested_nonexclusive_singletons_ ==
@@ -644,6 +680,26 @@ void ResourceInfo<Metavariables>::build_singleton_map(const Cache& cache) {
   const size_t num_procs = Parallel::number_of_procs<size_t>(cache);
   const size_t num_nodes = Parallel::number_of_nodes<size_t>(cache);
 
+  // Singletons that are only exclusive because their component asks to be by
+  // default give up their exclusive proc if otherwise there would be no procs
+  // left for array elements.
+  if (num_procs_to_ignore_ >= num_procs and
+      num_auto_exclusive_by_default_singletons_ > 0) {
+    tmpl::for_each<singletons>([this, &num_procs](const auto component_v) {
+      using component = tmpl::type_from<decltype(component_v)>;
+      if constexpr (exclusive_by_default_v<component>) {
+        auto& singleton_map = tuples::get<LocalTag<component>>(singleton_map_);
+        if (num_procs_to_ignore_ >= num_procs and singleton_map.first and
+            not singleton_map.second.has_value()) {
+          singleton_map.first = false;
+          --num_exclusive_singletons_;
+          --num_procs_to_ignore_;
+          --num_auto_exclusive_by_default_singletons_;
+        }
+      }
+    });
+  }
+
   // We don't do procs_to_ignore_.size() here because the auto singletons who
   // requested to be exclusive haven't been assigned yet so their procs haven't
   // been added to procs_to_ignore_
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <optional>
 #include <string>
 #include <tuple>
@@ -12,7 +13,10 @@
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Domain/Creators/BlockGroups.hpp"
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -58,6 +62,25 @@ struct FilterAllEvolvedVars<true, true> {
   template <typename EvolvedVarsTagList, typename... FilterTags>
   using f = std::integral_constant<bool, true>;
 };
+
+// Filters `vars` in place with all intermediate storage taken from the
+// thread's `ScratchArena`, so filtering doesn't allocate.
+template <typename Tags, size_t Dim>
+void apply_filter(
+    const gsl::not_null<Variables<Tags>*> vars,
+    const std::array<std::reference_wrapper<const Matrix>, Dim>& filter,
+    const Index<Dim>& extents) {
+  ScratchArena arena{};
+  auto filtered =
+      arena.make_variables<Variables<Tags>>(vars->number_of_grid_points());
+  const size_t scratch_size = apply_matrices_detail::scratch_size(
+      filter, extents, vars->number_of_independent_components);
+  DataVector scratch{};
+  scratch.set_data_ref(arena.allocate(scratch_size).data(), scratch_size);
+  apply_matrices(make_not_null(&filtered), filter, *vars, extents,
+                 make_not_null(&scratch));
+  *vars = filtered;
+}
 }  // namespace Filter_detail
 
 /// \cond
@@ -75,6 +98,10 @@ struct Filter;
  *
  * \snippet LinearOperators/Test_Filtering.cpp action_list_example
  *
+ * All components of the tags to filter are filtered together in one
+ * application of the (cached) filter matrices, and the temporaries are taken
+ * from the `ScratchArena`, so filtering doesn't allocate memory.
+ *
  * Uses:
  * - GlobalCache:
  *   - `Filter`
@@ -145,20 +172,20 @@ class Filter<FilterType, tmpl::list<TagsToFilter...>> {
     }
 
     // In the case that the tags we are filtering are all the evolved variables
-    // we filter the entire Variables at once to be more efficient. This case is
-    // the first branch of the `if-else`.
-    if (Filter_detail::FilterAllEvolvedVars<
-            sizeof...(TagsToFilter) ==
-                tmpl::size<evolved_vars_tags_list>::value,
-            std::is_same_v<evolved_vars_tags_list,
-                           tmpl::list<TagsToFilter...>>>::
-            template f<evolved_vars_tags_list, TagsToFilter...>::value) {
-      db::mutate<typename Metavariables::system::variables_tag>(
-          [&filter](const gsl::not_null<
-                        typename Metavariables::system::variables_tag::type*>
-                        vars,
+    // we filter the entire Variables in place. Otherwise the tags to filter are
+    // gathered into one Variables so all their components are still filtered
+    // by a single batched matrix application.
+    if constexpr (Filter_detail::FilterAllEvolvedVars<
+                      sizeof...(TagsToFilter) ==
+                          tmpl::size<evolved_vars_tags_list>::value,
+                      std::is_same_v<evolved_vars_tags_list,
+                                     tmpl::list<TagsToFilter...>>>::
+                      template f<evolved_vars_tags_list,
+                                 TagsToFilter...>::value) {
+      db::mutate<evolved_vars_tag>(
+          [&filter](const gsl::not_null<typename evolved_vars_tag::type*> vars,
                     const auto& local_mesh) {
-            *vars = apply_matrices(filter, *vars, local_mesh.extents());
+            Filter_detail::apply_filter(vars, filter, local_mesh.extents());
           },
           make_not_null(&box), mesh);
     } else {
@@ -166,17 +193,16 @@ class Filter<FilterType, tmpl::list<TagsToFilter...>> {
           [&filter](const gsl::not_null<
                         typename TagsToFilter::type*>... tensors_to_filter,
                     const auto& local_mesh) {
-            DataVector temp(local_mesh.number_of_grid_points(), 0.0);
-            const auto helper = [&local_mesh, &filter,
-                                 &temp](const auto tensor) {
-              for (auto& component : *tensor) {
-                temp = 0.0;
-                apply_matrices(make_not_null(&temp), filter, component,
-                               local_mesh.extents());
-                component = temp;
-              }
-            };
-            EXPAND_PACK_LEFT_TO_RIGHT(helper(tensors_to_filter));
+            ScratchArena arena{};
+            auto vars_to_filter =
+                arena.make_variables<Variables<tmpl::list<TagsToFilter...>>>(
+                    local_mesh.number_of_grid_points());
+            EXPAND_PACK_LEFT_TO_RIGHT(get<TagsToFilter>(vars_to_filter) =
+                                          *tensors_to_filter);
+            Filter_detail::apply_filter(make_not_null(&vars_to_filter), filter,
+                                        local_mesh.extents());
+            EXPAND_PACK_LEFT_TO_RIGHT(*tensors_to_filter =
+                                          get<TagsToFilter>(vars_to_filter));
           },
           make_not_null(&box), mesh);
     }
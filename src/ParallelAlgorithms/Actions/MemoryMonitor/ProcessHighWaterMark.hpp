@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Simple action meant to be used as a callback for
+ * Parallel::contribute_to_reduction that writes the peak resident memory of
+ * each node to disk.
+ *
+ * \details The high-water mark of a node is the largest
+ * `sys::peak_resident_memory_in_megabytes()` of any process on that node. It
+ * includes all memory used by the process, not just the memory of the
+ * monitored parallel components. The columns in the dat file when running on
+ * 3 nodes will be
+ *
+ * - %Time
+ * - High-water mark on node 0 (MB)
+ * - High-water mark on node 1 (MB)
+ * - High-water mark on node 2 (MB)
+ * - Maximum high-water mark (MB)
+ *
+ * The dat file will be placed at `/MemoryMonitors/HighWaterMark` in the
+ * reduction file.
+ */
+struct ProcessHighWaterMark {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const double time,
+                    const std::vector<double>& high_water_mark_per_node) {
+    auto& observer_writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+
+    std::vector<std::string> legend{{"Time"}};
+    for (size_t i = 0; i < high_water_mark_per_node.size(); i++) {
+      legend.emplace_back("High-water mark on node " + get_output(i) +
+                          " (MB)");
+    }
+    legend.emplace_back("Maximum high-water mark (MB)");
+
+    const double max_high_water_mark =
+        high_water_mark_per_node.empty()
+            ? 0.0
+            : *std::max_element(high_water_mark_per_node.begin(),
+                                high_water_mark_per_node.end());
+
+    Parallel::threaded_action<
+        observers::ThreadedActions::WriteReductionDataRow>(
+        // Node 0 is always the writer
+        observer_writer_proxy[0], "/MemoryMonitors/HighWaterMark", legend,
+        std::make_tuple(time, high_water_mark_per_node, max_high_water_mark));
+  }
+};
+}  // namespace mem_monitor
@@ -25,6 +25,7 @@
 #include "IO/Logging/Verbosity.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/Printf/Printf.hpp"
@@ -152,9 +153,9 @@ struct AdjustDomain {
         Parallel::printf("Splitting element %s into %zu: %s\n", element_id,
                          children_ids.size(), children_ids);
       }
-      Parallel::simple_action<CreateChild>(amr_component, element_array,
-                                           element_id, children_ids, 0_st,
-                                           phase_bookmarks);
+      Parallel::simple_action<CreateChild>(
+          amr_component, element_array, element_id, children_ids, 0_st,
+          phase_bookmarks, Parallel::my_proc<int>(cache));
 
     } else if (alg::any_of(my_amr_flags, [](amr::Flag flag) {
                  return flag == amr::Flag::Join;
@@ -174,7 +175,8 @@ struct AdjustDomain {
         }
         Parallel::simple_action<CreateParent>(
             amr_component, element_array, std::move(parent_id), element_id,
-            std::move(ids_to_join), phase_bookmarks);
+            std::move(ids_to_join), phase_bookmarks,
+            Parallel::my_proc<int>(cache));
       }
 
     } else {
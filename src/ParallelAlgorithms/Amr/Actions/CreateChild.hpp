@@ -37,6 +37,10 @@ namespace amr::Actions {
 /// Otherwise, it will invoke amr::Actions::CreateChild on the next element of
 /// `children_ids`.
 ///
+/// The children are inserted on the processor `new_element_proc`, which is
+/// typically the processor of the parent element, so the parent sends its data
+/// to the children with local messages.
+///
 /// This action does not modify anything in the DataBox
 struct CreateChild {
   template <typename ParallelComponent, typename DbTagList,
@@ -48,8 +52,8 @@ struct CreateChild {
       ElementId<Metavariables::volume_dim> parent_id,
       std::vector<ElementId<Metavariables::volume_dim>> children_ids,
       const size_t index_of_child_id,
-      const std::unordered_map<Parallel::Phase, size_t>
-          parent_phase_bookmarks) {
+      const std::unordered_map<Parallel::Phase, size_t> parent_phase_bookmarks,
+      const int new_element_proc) {
     auto my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
     const ElementId<Metavariables::volume_dim>& child_id =
         children_ids[index_of_child_id];
@@ -61,7 +65,8 @@ struct CreateChild {
           std::make_unique<Parallel::SimpleActionCallback<
               SendDataToChildren, decltype(parent_proxy),
               std::vector<ElementId<Metavariables::volume_dim>>>>(
-              parent_proxy, std::move(children_ids)));
+              parent_proxy, std::move(children_ids)),
+          new_element_proc);
     } else {
       element_proxy[child_id].insert(
           cache.get_this_proxy(), Parallel::Phase::AdjustDomain,
@@ -70,10 +75,11 @@ struct CreateChild {
               CreateChild, decltype(my_proxy), ElementProxy,
               ElementId<Metavariables::volume_dim>,
               std::vector<ElementId<Metavariables::volume_dim>>, size_t,
-              std::unordered_map<Parallel::Phase, size_t>>>(
+              std::unordered_map<Parallel::Phase, size_t>, int>>(
               my_proxy, std::move(element_proxy), std::move(parent_id),
               std::move(children_ids), index_of_child_id + 1,
-              parent_phase_bookmarks));
+              parent_phase_bookmarks, new_element_proc),
+          new_element_proc);
     }
   }
 };
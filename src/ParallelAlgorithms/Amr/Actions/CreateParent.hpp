@@ -30,6 +30,10 @@ namespace amr::Actions {
 /// the constructor of the new DistributedObject, which will invoke
 /// amr::Actions::CollectDataFromChildren on the element with id `child_id`.
 ///
+/// The parent is inserted on the processor `new_element_proc`, which is
+/// typically the processor of the child element with id `child_id`, so at
+/// least that child's data reaches the parent with a local message.
+///
 /// This action does not modify anything in the DataBox
 struct CreateParent {
   template <typename ParallelComponent, typename DbTagList,
@@ -41,7 +45,8 @@ struct CreateParent {
       ElementId<Metavariables::volume_dim> parent_id,
       const ElementId<Metavariables::volume_dim>& child_id,
       std::deque<ElementId<Metavariables::volume_dim>> sibling_ids_to_collect,
-      const std::unordered_map<Parallel::Phase, size_t> child_phase_bookmarks) {
+      const std::unordered_map<Parallel::Phase, size_t> child_phase_bookmarks,
+      const int new_element_proc) {
     auto child_proxy = element_proxy[child_id];
     element_proxy[parent_id].insert(
         cache.get_this_proxy(), Parallel::Phase::AdjustDomain,
@@ -51,7 +56,8 @@ struct CreateParent {
             ElementId<Metavariables::volume_dim>,
             std::deque<ElementId<Metavariables::volume_dim>>>>(
             child_proxy, std::move(parent_id),
-            std::move(sibling_ids_to_collect)));
+            std::move(sibling_ids_to_collect)),
+        new_element_proc);
   }
 };
 }  // namespace amr::Actions
@@ -26,7 +26,7 @@ void register_callbacks() {
               CProxy_AlgorithmSingleton<amr::Component<Metavariables>, int>,
               CProxy_AlgorithmArray<Component, ArrayIndex>, ArrayIndex,
               std::vector<ArrayIndex>, size_t,
-              std::unordered_map<Parallel::Phase, size_t>>,
+              std::unordered_map<Parallel::Phase, size_t>, int>,
           Parallel::SimpleActionCallback<
               amr::Actions::SendDataToChildren,
               CProxyElement_AlgorithmArray<Component, ArrayIndex>,
@@ -0,0 +1,58 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace amr::Criteria::Tags {
+
+/*!
+ * \brief The power monitors of every component of the tensor `Tag`
+ *
+ * Holds one set of power monitors per tensor component, in the same order as
+ * iterating over the tensor. See `PowerMonitors::power_monitors`.
+ *
+ * \tparam VolumeDim The volume dimension as a `tmpl::size_t`
+ */
+template <typename Tag, typename VolumeDim>
+struct PowerMonitors : db::SimpleTag {
+  using type = std::vector<std::array<DataVector, VolumeDim::value>>;
+};
+
+/*!
+ * \brief Computes the power monitors of every component of the tensor `Tag`
+ *
+ * Refinement criteria list this tag in their
+ * `compute_tags_for_observation_box`. Since all criteria are evaluated on the
+ * same `ObservationBox` and compute tags are evaluated lazily, the modal
+ * transform of each monitored tensor is done at most once per AMR check, no
+ * matter how many criteria request it.
+ */
+template <typename Tag, typename VolumeDim>
+struct PowerMonitorsCompute : PowerMonitors<Tag, VolumeDim>, db::ComputeTag {
+  using base = PowerMonitors<Tag, VolumeDim>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<Tag, ::domain::Tags::Mesh<VolumeDim::value>>;
+  static void function(const gsl::not_null<return_type*> result,
+                       const typename Tag::type& tensor,
+                       const Mesh<VolumeDim::value>& mesh) {
+    result->resize(tensor.size());
+    for (size_t i = 0; i < tensor.size(); ++i) {
+      ::PowerMonitors::power_monitors(make_not_null(&(*result)[i]), tensor[i],
+                                      mesh);
+    }
+  }
+};
+
+}  // namespace amr::Criteria::Tags
@@ -10,7 +10,6 @@
 #include "DataStructures/DataVector.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
-#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -19,8 +18,8 @@ namespace amr::Criteria::TruncationError_detail {
 template <size_t Dim>
 void max_over_components(
     const gsl::not_null<std::array<Flag, Dim>*> result,
-    const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
+    const std::array<DataVector, Dim>& power_monitors,
+    const DataVector& tensor_component,
     const std::optional<double> target_abs_truncation_error,
     const std::optional<double> target_rel_truncation_error) {
   // We take the highest-priority refinement flag in each dimension, so if any
@@ -28,14 +27,13 @@ void max_over_components(
   // increase p refinement in that dimension. And only if all tensor components
   // still satisfy the target with the highest mode removed will the element
   // decrease p refinement in that dimension.
-  PowerMonitors::power_monitors(power_monitors_buffer, tensor_component, mesh);
   const double umax = max(abs(tensor_component));
   for (size_t d = 0; d < Dim; ++d) {
     // Skip this dimension if we have already decided to refine it
     if (gsl::at(*result, d) == Flag::IncreaseResolution) {
       continue;
     }
-    const auto& modes = gsl::at(*power_monitors_buffer, d);
+    const auto& modes = gsl::at(power_monitors, d);
     // Increase p refinement if the truncation error exceeds the target
     const double rel_truncation_error =
         pow(10, -PowerMonitors::relative_truncation_error(modes, modes.size()));
@@ -81,13 +79,12 @@ void max_over_components(
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(_, data)                                         \
-  template void max_over_components(                                   \
-      gsl::not_null<std::array<Flag, DIM(data)>*> result,              \
-      const gsl::not_null<std::array<DataVector, DIM(data)>*>          \
-          power_monitors_buffer,                                       \
-      const DataVector& tensor_component, const Mesh<DIM(data)>& mesh, \
-      std::optional<double> target_abs_truncation_error,               \
+#define INSTANTIATION(_, data)                                 \
+  template void max_over_components(                           \
+      gsl::not_null<std::array<Flag, DIM(data)>*> result,      \
+      const std::array<DataVector, DIM(data)>& power_monitors, \
+      const DataVector& tensor_component,                      \
+      std::optional<double> target_abs_truncation_error,       \
       std::optional<double> target_rel_truncation_error);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
@@ -12,16 +12,16 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Amr/Flag.hpp"
-#include "Domain/Tags.hpp"
-#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Context.hpp"
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/PowerMonitors.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -41,12 +41,15 @@ namespace TruncationError_detail {
  * the "max" of the current and new flags, where the "highest" flag is
  * `Flag::IncreaseResolution`, followed by `Flag::DoNothing`, and then
  * `Flag::DecreaseResolution`.
+ *
+ * The `power_monitors` are those of the `tensor_component`, see
+ * `PowerMonitors::power_monitors`.
  */
 template <size_t Dim>
 void max_over_components(
     gsl::not_null<std::array<Flag, Dim>*> result,
-    const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
+    const std::array<DataVector, Dim>& power_monitors,
+    const DataVector& tensor_component,
     std::optional<double> target_abs_truncation_error,
     std::optional<double> target_rel_truncation_error);
 }  // namespace TruncationError_detail
@@ -60,7 +63,9 @@ void max_over_components(
  *   removed, the element will be p-coarsened.
  *
  * For details on how the truncation error is computed see
- * `PowerMonitors::truncation_error`.
+ * `PowerMonitors::truncation_error`. The power monitors are taken from
+ * `amr::Criteria::Tags::PowerMonitorsCompute`, so they are computed only once
+ * per AMR check even if other criteria monitor the same tensors.
  *
  * \tparam Dim Spatial dimension of the grid
  * \tparam TensorTags List of tags of the tensors to be monitored
@@ -110,14 +115,18 @@ class TruncationError : public Criterion {
   WRAPPED_PUPable_decl_template(TruncationError);  // NOLINT
   /// \endcond
 
-  using compute_tags_for_observation_box = tmpl::list<>;
+  using compute_tags_for_observation_box = tmpl::transform<
+      TensorTags, tmpl::bind<Tags::PowerMonitorsCompute, tmpl::_1,
+                             tmpl::pin<tmpl::size_t<Dim>>>>;
 
-  using argument_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<::Tags::ObservationBox>;
 
-  template <typename DbTagsList, typename Metavariables>
-  std::array<Flag, Dim> operator()(const db::DataBox<DbTagsList>& box,
-                                   Parallel::GlobalCache<Metavariables>& cache,
-                                   const ElementId<Dim>& element_id) const;
+  template <typename ComputeTagsList, typename DataBoxType,
+            typename Metavariables>
+  std::array<Flag, Dim> operator()(
+      const ObservationBox<ComputeTagsList, DataBoxType>& box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id) const;
 
   void pup(PUP::er& p) override;
 
@@ -152,35 +161,34 @@ TruncationError<Dim, TensorTags>::TruncationError(CkMigrateMessage* msg)
     : Criterion(msg) {}
 
 template <size_t Dim, typename TensorTags>
-template <typename DbTagsList, typename Metavariables>
+template <typename ComputeTagsList, typename DataBoxType,
+          typename Metavariables>
 std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
-    const db::DataBox<DbTagsList>& box,
+    const ObservationBox<ComputeTagsList, DataBoxType>& box,
     Parallel::GlobalCache<Metavariables>& /*cache*/,
     const ElementId<Dim>& /*element_id*/) const {
   auto result = make_array<Dim>(Flag::Undefined);
-  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
-  std::array<DataVector, Dim> power_monitors_buffer{};
   // Check all tensors and all tensor components in turn
-  tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &power_monitors_buffer, this](const auto tag_v) {
-        // Stop if we have already decided to refine every dimension
-        if (result == make_array<Dim>(Flag::IncreaseResolution)) {
-          return;
-        }
-        using tag = tmpl::type_from<std::decay_t<decltype(tag_v)>>;
-        const std::string tag_name = db::tag_name<tag>();
-        // Skip if this tensor is not being monitored
-        if (not alg::found(vars_to_monitor_, tag_name)) {
-          return;
-        }
-        const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
-          TruncationError_detail::max_over_components(
-              make_not_null(&result), make_not_null(&power_monitors_buffer),
-              tensor_component, mesh, target_abs_truncation_error_,
-              target_rel_truncation_error_);
-        }
-      });
+  tmpl::for_each<TensorTags>([&result, &box, this](const auto tag_v) {
+    // Stop if we have already decided to refine every dimension
+    if (result == make_array<Dim>(Flag::IncreaseResolution)) {
+      return;
+    }
+    using tag = tmpl::type_from<std::decay_t<decltype(tag_v)>>;
+    const std::string tag_name = db::tag_name<tag>();
+    // Skip if this tensor is not being monitored
+    if (not alg::found(vars_to_monitor_, tag_name)) {
+      return;
+    }
+    const auto& tensor = get<tag>(box);
+    const auto& power_monitors =
+        get<Tags::PowerMonitors<tag, tmpl::size_t<Dim>>>(box);
+    for (size_t i = 0; i < tensor.size(); ++i) {
+      TruncationError_detail::max_over_components(
+          make_not_null(&result), power_monitors[i], tensor[i],
+          target_abs_truncation_error_, target_rel_truncation_error_);
+    }
+  });
   return result;
 }
 
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <unordered_map>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -16,6 +19,7 @@
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/Projector.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -29,7 +33,9 @@ namespace amr::projectors {
 /// `tmpl::list` is available.
 ///
 /// \details For each item corresponding to each tag in TensorTags, project
-/// the data for each tensor from the old mesh to the new mesh
+/// the data for each tensor from the old mesh to the new mesh. On
+/// p-refinement, tensors of `DataVector`s are projected together in a single
+/// pass over all their components.
 ///
 /// \see ProjectVariables
 template <size_t Dim, typename... TensorTags>
@@ -48,13 +54,54 @@ struct ProjectTensors : tt::ConformsTo<amr::protocols::Projector> {
     const auto projection_matrices =
         Spectral::p_projection_matrices(old_mesh, new_mesh);
     const auto& old_extents = old_mesh.extents();
-    const auto project_tensor = [&projection_matrices,
-                                 old_extents](auto& tensor) {
-      for (size_t i = 0; i < tensor.size(); ++i) {
-        tensor[i] = apply_matrices(projection_matrices, tensor[i], old_extents);
-      }
-    };
-    EXPAND_PACK_LEFT_TO_RIGHT(project_tensor(*tensors));
+    if constexpr (sizeof...(TensorTags) > 0 and
+                  (std::is_same_v<typename TensorTags::type::type,
+                                  DataVector> and
+                   ...)) {
+      // Gather all components into contiguous memory so they are projected
+      // together in a single pass
+      const size_t num_components = (0_st + ... + tensors->size());
+      const size_t old_num_points = old_mesh.number_of_grid_points();
+      const size_t new_num_points = new_mesh.number_of_grid_points();
+      DataVector buffer{num_components * (old_num_points + new_num_points)};
+      DataVector old_data{buffer.data(), num_components * old_num_points};
+      DataVector new_data{buffer.data() + num_components * old_num_points,
+                          num_components * new_num_points};
+      size_t offset = 0;
+      const auto gather = [&old_data, &offset,
+                           &old_num_points](const auto& tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
+          std::copy(tensor[i].begin(), tensor[i].end(),
+                    old_data.begin() + static_cast<std::ptrdiff_t>(offset));
+          offset += old_num_points;
+        }
+      };
+      EXPAND_PACK_LEFT_TO_RIGHT(gather(*tensors));
+      apply_matrices(make_not_null(&new_data), projection_matrices, old_data,
+                     old_extents);
+      offset = 0;
+      const auto scatter = [&new_data, &offset,
+                            &new_num_points](auto& tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
+          tensor[i].destructive_resize(new_num_points);
+          std::copy(new_data.begin() + static_cast<std::ptrdiff_t>(offset),
+                    new_data.begin() +
+                        static_cast<std::ptrdiff_t>(offset + new_num_points),
+                    tensor[i].begin());
+          offset += new_num_points;
+        }
+      };
+      EXPAND_PACK_LEFT_TO_RIGHT(scatter(*tensors));
+    } else {
+      const auto project_tensor = [&projection_matrices,
+                                   old_extents](auto& tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
+          tensor[i] =
+              apply_matrices(projection_matrices, tensor[i], old_extents);
+        }
+      };
+      EXPAND_PACK_LEFT_TO_RIGHT(project_tensor(*tensors));
+    }
   }
 
   template <typename... Tags>
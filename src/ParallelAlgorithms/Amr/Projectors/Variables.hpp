@@ -4,10 +4,12 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -50,8 +52,17 @@ struct ProjectVariables : tt::ConformsTo<amr::protocols::Projector> {
     const auto projection_matrices =
         Spectral::p_projection_matrices(old_mesh, new_mesh);
     const auto& old_extents = old_mesh.extents();
-    expand_pack(
-        (*vars = apply_matrices(projection_matrices, *vars, old_extents))...);
+    // All Variables share the intermediate storage of the projection
+    DataVector scratch{};
+    const auto project_variables = [&projection_matrices, &old_extents,
+                                    &new_mesh, &scratch](auto& local_vars) {
+      std::decay_t<decltype(local_vars)> projected_vars{
+          new_mesh.number_of_grid_points()};
+      apply_matrices(make_not_null(&projected_vars), projection_matrices,
+                     local_vars, old_extents, make_not_null(&scratch));
+      local_vars = std::move(projected_vars);
+    };
+    EXPAND_PACK_LEFT_TO_RIGHT(project_variables(*vars));
   }
 
   // h-refinement
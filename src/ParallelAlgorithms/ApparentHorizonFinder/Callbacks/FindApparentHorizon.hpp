@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/FunctionsOfTime/Tags.hpp"
@@ -348,25 +349,33 @@ struct FindApparentHorizon
             const size_t L_mesh = fast_flow.current_l_mesh(strahlkorper);
             const auto prolonged_strahlkorper =
                 ylm::Strahlkorper<Frame>(L_mesh, L_mesh, strahlkorper);
-            auto new_vars = ::Variables<vars_tags>(
-                strahlkorper.ylm_spherepack().physical_size());
+            const auto& surface_ylm = strahlkorper.ylm_spherepack();
+            const auto& prolonged_ylm = prolonged_strahlkorper.ylm_spherepack();
 
-            tmpl::for_each<vars_tags>([&strahlkorper, &prolonged_strahlkorper,
-                                       &vars, &new_vars](auto tag_v) {
-              using tag = typename decltype(tag_v)::type;
-              const auto& old_var = get<tag>(*vars);
-              auto& new_var = get<tag>(new_vars);
-              auto old_iter = old_var.begin();
-              auto new_iter = new_var.begin();
-              for (; old_iter != old_var.end() and new_iter != new_var.end();
-                   ++old_iter, ++new_iter) {
-                *new_iter = strahlkorper.ylm_spherepack().spec_to_phys(
-                    prolonged_strahlkorper.ylm_spherepack().prolong_or_restrict(
-                        prolonged_strahlkorper.ylm_spherepack().phys_to_spec(
-                            *old_iter),
-                        strahlkorper.ylm_spherepack()));
-              }
-            });
+            // All components are transformed at once, since the components
+            // of a Variables are stored one after another.
+            const size_t number_of_components =
+                Variables<vars_tags>::number_of_independent_components;
+            DataVector prolonged_coefs(number_of_components *
+                                       prolonged_ylm.spectral_size());
+            prolonged_ylm.phys_to_spec_multiple_fields(
+                prolonged_coefs.data(), vars->data(), number_of_components);
+            DataVector coefs(number_of_components *
+                             surface_ylm.spectral_size());
+            for (size_t i = 0; i < number_of_components; ++i) {
+              const DataVector prolonged_coefs_of_component(
+                  prolonged_coefs.data() + i * prolonged_ylm.spectral_size(),
+                  prolonged_ylm.spectral_size());
+              DataVector coefs_of_component(
+                  coefs.data() + i * surface_ylm.spectral_size(),
+                  surface_ylm.spectral_size());
+              coefs_of_component = prolonged_ylm.prolong_or_restrict(
+                  prolonged_coefs_of_component, surface_ylm);
+            }
+            auto new_vars =
+                ::Variables<vars_tags>(surface_ylm.physical_size());
+            surface_ylm.spec_to_phys_multiple_fields(
+                new_vars.data(), coefs.data(), number_of_components);
             *vars = std::move(new_vars);
           },
           box);
@@ -162,8 +162,14 @@ FastFlow::iterate_horizon_finder(
   // here we compute the L2 integral norm.  The integral should be
   // more accurate, but if it turns out that this integral is
   // expensive, we can switch back to the pointwise L2 norm.
-  const double residual_mesh_norm = sqrt(strahlkorper.ylm_spherepack().average(
-      strahlkorper.ylm_spherepack().phys_to_spec(square(weighted_residual))));
+  // The average over the sphere is computed with the quadrature weights,
+  // which gives the same result as the l=0 coefficient of a spectral
+  // transformation without the cost of the transformation.
+  const DataVector squared_residual = square(weighted_residual);
+  const double residual_mesh_norm =
+      sqrt(strahlkorper.ylm_spherepack().definite_integral(
+               squared_residual.data()) /
+           (4.0 * M_PI));
 
   if (residual_mesh_norm < min_residual_mesh_norm_) {
     min_residual_mesh_norm_ = residual_mesh_norm;
@@ -181,11 +187,12 @@ FastFlow::iterate_horizon_finder(
 
   // Evaluate the norm of the residual on the surface of size l_surface.
   // See comment on pointwise norm vs integral norm above.
+  const DataVector squared_residual_on_surface = square(
+      current_strahlkorper->ylm_spherepack().spec_to_phys(residual_on_surface));
   const auto residual_ylm_norm =
-      sqrt(current_strahlkorper->ylm_spherepack().average(
-          current_strahlkorper->ylm_spherepack().phys_to_spec(
-              square(current_strahlkorper->ylm_spherepack().spec_to_phys(
-                  residual_on_surface)))));
+      sqrt(current_strahlkorper->ylm_spherepack().definite_integral(
+               squared_residual_on_surface.data()) /
+           (4.0 * M_PI));
 
   // Fill iter_info
   const auto minmax_residual =
@@ -55,6 +55,8 @@ using compute_items_on_target = tmpl::append<
         ylm::Tags::RhatCompute<Frame>, ylm::Tags::CartesianCoordsCompute<Frame>,
         ylm::Tags::InvJacobianCompute<Frame>,
         ylm::Tags::InvHessianCompute<Frame>, ylm::Tags::JacobianCompute<Frame>,
+        ylm::Tags::AngularGradientOfRadiusCompute<Frame>,
+        ylm::Tags::AngularSecondDerivsOfRadiusCompute<Frame>,
         ylm::Tags::DxRadiusCompute<Frame>, ylm::Tags::D2xRadiusCompute<Frame>,
         ylm::Tags::NormalOneFormCompute<Frame>,
         ylm::Tags::OneOverOneFormMagnitudeCompute<DataVector, Dim, Frame>,
@@ -118,6 +118,11 @@ class ErrorIfDataTooBig : public Event {
       if (variables_to_check_.count(tag_name) != 0) {
         const auto check_components = [&](const auto& tensor) {
           for (const auto& component : tensor) {
+            // Vectorized check first so the common case of all points being
+            // within the threshold doesn't branch on every point.
+            if (max(abs(component)) <= threshold_) {
+              continue;
+            }
             for (size_t point = 0; point < component.size(); ++point) {
               if (std::abs(component[point]) > threshold_) {
                 ERROR_NO_TRACE(
@@ -37,12 +37,14 @@
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessHighWaterMark.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/System/MemoryUsage.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -71,6 +73,13 @@ namespace Events {
  * parallel component ("Blah" for example) in the input file. An ERROR will
  * occur and a list of the available components to monitor will be printed.
  *
+ * When the DgElementArray is monitored, the peak resident memory of each node
+ * is also written to `/MemoryMonitors/HighWaterMark` (see
+ * mem_monitor::ProcessHighWaterMark). Comparing it to the sizes of the
+ * components shows how much memory isn't accounted for by serialized data,
+ * e.g. from temporaries or allocator fragmentation. For a breakdown of the
+ * memory of each component by DataBox item, use the `ObserveDataBox` event.
+ *
  * \note Currently, the only Parallel::Algorithms::Array parallel component that
  * can be monitored is the DgElementArray itself.
  */
@@ -85,6 +94,13 @@ class MonitorMemory : public Event {
       // Vector of total mem usage on each node
       Parallel::ReductionDatum<std::vector<double>,
                                funcl::ElementWise<funcl::Plus<>>>>;
+  // Reduction data for the peak resident memory of each node
+  using HighWaterMarkReductionData = Parallel::ReductionData<
+      // Time
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      // Vector of the high-water mark on each node
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Max<>>>>;
 
  public:
   explicit MonitorMemory(CkMigrateMessage* msg);
@@ -113,7 +129,8 @@ class MonitorMemory : public Event {
       const Options::Context& context, Metavariables /*meta*/);
 
   using observed_reduction_data_tags =
-      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+      observers::make_reduction_data_tags<
+          tmpl::list<ReductionData, HighWaterMarkReductionData>>;
 
   using compute_tags_for_observation_box = tmpl::list<>;
 
@@ -281,6 +298,15 @@ void MonitorMemory<Dim>::operator()(
           mem_monitor::ProcessArray<ParallelComponent>>(
           ReductionData{observation_value.value, data}, array_element_proxy,
           memory_monitor_proxy);
+
+      // The high-water mark is measured per process, so take the max over the
+      // elements on each node rather than the sum
+      std::vector<double> high_water_marks(num_nodes, 0.0);
+      high_water_marks[my_node] = sys::peak_resident_memory_in_megabytes();
+      Parallel::contribute_to_reduction<mem_monitor::ProcessHighWaterMark>(
+          HighWaterMarkReductionData{observation_value.value,
+                                     std::move(high_water_marks)},
+          array_element_proxy, memory_monitor_proxy);
     } else if constexpr (Parallel::is_singleton_v<component>) {
       // If this is a singleton, we only run this once so use the designated
       // element. Nothing to reduce with singletons so just call the simple
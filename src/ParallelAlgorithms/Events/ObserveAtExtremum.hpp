@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <pup.h>
@@ -316,20 +317,19 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
                  "without an analytic solution.");
       }
       const auto& scalar = value(get<tag>(box));
-      const auto components = get<1>(scalar.get_vector_of_data());
-      if (components.size() > 1) {
+      if (scalar.size() > 1) {
         ERROR("Extremum should be taken on a scalar, yet we have "
-              << components.size() << " components in tensor " << tensor_name);
+              << scalar.size() << " components in tensor " << tensor_name);
       }
-      for (size_t i = 1; i < components[0].size(); i++) {
-        if ((extremum_type_ == "Max" and
-             (components[0][i] > components[0][index_of_extremum])) or
-            (extremum_type_ == "Min" and
-             (components[0][i] < components[0][index_of_extremum]))) {
-          index_of_extremum = i;
-        }
-      }
-      data_to_reduce.push_back(components[0][index_of_extremum]);
+      // Read the component in place rather than through
+      // `get_vector_of_data()`, which copies every component.
+      const auto& component = scalar[0];
+      index_of_extremum = static_cast<size_t>(
+          (extremum_type_ == "Max"
+               ? std::max_element(component.begin(), component.end())
+               : std::min_element(component.begin(), component.end())) -
+          component.begin());
+      data_to_reduce.push_back(component[index_of_extremum]);
       if (extremum_type_ == "Max") {
         legend.push_back("Max(" + scalar_name_ + ")");
       } else {
@@ -352,12 +352,12 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
                    "without an analytic solution.");
         }
         const auto& tensor = value(get<tag>(box));
-        const auto [component_names, components] = tensor.get_vector_of_data();
-        for (size_t j = 0; j < components.size(); j++) {
-          data_to_reduce.push_back(components[j][index_of_extremum]);
-          if (components.size() > 1) {
-            legend.push_back("At" + scalar_name_ + extremum_type_ + "(" +
-                             tensor_name + "_" + component_names[j] + ")");
+        for (size_t j = 0; j < tensor.size(); j++) {
+          data_to_reduce.push_back(tensor[j][index_of_extremum]);
+          if (tensor.size() > 1) {
+            legend.push_back(
+                "At" + scalar_name_ + extremum_type_ + "(" + tensor_name +
+                "_" + tensor.component_name(tensor.get_tensor_index(j)) + ")");
           } else {
             legend.push_back("At" + scalar_name_ + extremum_type_ + "(" +
                              tensor_name + ")");
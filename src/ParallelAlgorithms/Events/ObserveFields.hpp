@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
@@ -12,6 +14,7 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataBox/ObservationBox.hpp"
@@ -29,6 +32,8 @@
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/VolumeActions.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
@@ -42,6 +47,7 @@
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
@@ -53,8 +59,6 @@
 #include "Utilities/TypeTraits/IsA.hpp"
 
 /// \cond
-template <size_t Dim>
-class Mesh;
 namespace Frame {
 struct Inertial;
 }  // namespace Frame
@@ -62,6 +66,44 @@ struct Inertial;
 
 namespace dg {
 namespace Events {
+/*!
+ * \brief Observe on a mesh with fewer grid points than each element's mesh.
+ *
+ * The number of grid points of the element's mesh in each dimension is
+ * divided by the `Factor`, rounding up and keeping at least the minimum number
+ * of points of the basis and quadrature. Unlike a fixed `InterpolateToMesh`,
+ * the observation mesh follows p-refinement of the elements. The volume data
+ * files store the mesh of each element, so readers need no changes.
+ */
+struct CoarsenObservationMesh {
+  struct Factor {
+    using type = size_t;
+    static constexpr Options::String help =
+        "Divide the number of grid points per dimension by this factor.";
+    static size_t lower_bound() { return 1; }
+  };
+  using options = tmpl::list<Factor>;
+  static constexpr Options::String help =
+      "Observe on a mesh with fewer grid points than each element's mesh.";
+
+  size_t factor{1};
+
+  template <size_t Dim>
+  Mesh<Dim> operator()(const Mesh<Dim>& mesh) const {
+    std::array<size_t, Dim> extents{};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(extents, d) = std::max(
+          (mesh.extents(d) + factor - 1) / factor,
+          Spectral::detail::minimum_number_of_points(mesh.basis(d),
+                                                     mesh.quadrature(d)));
+    }
+    return {extents, mesh.basis(), mesh.quadrature()};
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) { p | factor; }
+};
+
 /// \cond
 template <size_t VolumeDim, typename Tensors,
           typename NonTensorComputeTagsList = tmpl::list<>,
@@ -83,7 +125,8 @@ class ObserveFields;
  * `InertialCoordinates` are always observed.
  *
  * The user may specify an `interpolation_mesh` to which the
- * data is interpolated.
+ * data is interpolated, or coarsen the mesh of each element for observing
+ * with `CoarsenObservationMesh` to reduce the size of the volume data.
  *
  * \note The `NonTensorComputeTags` are intended to be used for `Variables`
  * compute tags like `Tags::DerivCompute`
@@ -121,16 +164,20 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     static size_t lower_bound_on_size() { return 1; }
   };
 
+  using InterpolationMesh =
+      std::variant<Mesh<VolumeDim>, CoarsenObservationMesh>;
+
   struct InterpolateToMesh {
-    using type = Options::Auto<Mesh<VolumeDim>, Options::AutoLabel::None>;
+    using type = Options::Auto<InterpolationMesh, Options::AutoLabel::None>;
     static constexpr Options::String help =
         "An optional mesh to which the variables are interpolated. This mesh "
         "specifies any number of collocation points, basis, and quadrature on "
-        "which the observed quantities are evaluated. If no mesh is given, the "
-        "results will be evaluated on the mesh the simulation runs on. The "
-        "user may add several ObserveField Events e.g. with and without an "
-        "interpolating mesh to output the data both on the original mesh and "
-        "on a new mesh.";
+        "which the observed quantities are evaluated. Alternatively, specify "
+        "a 'Factor' by which to reduce the number of grid points of each "
+        "element's mesh. If no mesh is given, the results will be evaluated "
+        "on the mesh the simulation runs on. The user may add several "
+        "ObserveField Events e.g. with and without an interpolating mesh to "
+        "output the data both on the original mesh and on a new mesh.";
   };
 
   /// The floating point type/precision with which to write the data to disk.
@@ -174,7 +221,7 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                 FloatingPointType coordinates_floating_point_type,
                 const std::vector<FloatingPointType>& floating_point_types,
                 const std::vector<std::string>& variables_to_observe,
-                std::optional<Mesh<VolumeDim>> interpolation_mesh = {},
+                std::optional<InterpolationMesh> interpolation_mesh = {},
                 const Options::Context& context = {});
 
   using compute_tags_for_observation_box =
@@ -198,8 +245,22 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     if (not section_observation_key.has_value()) {
       return;
     }
+    std::optional<Mesh<VolumeDim>> interpolation_mesh{};
+    if (interpolation_mesh_.has_value()) {
+      interpolation_mesh = std::visit(
+          [&mesh](const auto& mesh_or_coarsening) -> Mesh<VolumeDim> {
+            if constexpr (std::is_same_v<std::decay_t<decltype(
+                                             mesh_or_coarsening)>,
+                                         Mesh<VolumeDim>>) {
+              return mesh_or_coarsening;
+            } else {
+              return mesh_or_coarsening(mesh);
+            }
+          },
+          *interpolation_mesh_);
+    }
     call_operator_impl(subfile_path_ + *section_observation_key,
-                       variables_to_observe_, interpolation_mesh_, mesh, box,
+                       variables_to_observe_, interpolation_mesh, mesh, box,
                        cache, array_index, component, observation_value);
   }
 
@@ -377,7 +438,7 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
 
   std::string subfile_path_;
   std::unordered_map<std::string, FloatingPointType> variables_to_observe_{};
-  std::optional<Mesh<VolumeDim>> interpolation_mesh_{};
+  std::optional<InterpolationMesh> interpolation_mesh_{};
 };
 
 template <size_t VolumeDim, typename... Tensors,
@@ -388,7 +449,7 @@ ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                   const FloatingPointType coordinates_floating_point_type,
                   const std::vector<FloatingPointType>& floating_point_types,
                   const std::vector<std::string>& variables_to_observe,
-                  std::optional<Mesh<VolumeDim>> interpolation_mesh,
+                  std::optional<InterpolationMesh> interpolation_mesh,
                   const Options::Context& context)
     : subfile_path_("/" + subfile_name),
       variables_to_observe_([&context, &floating_point_types,
@@ -416,7 +477,7 @@ ObserveFields<VolumeDim, tmpl::list<Tensors...>,
         }
         return result;
       }()),
-      interpolation_mesh_(interpolation_mesh) {
+      interpolation_mesh_(std::move(interpolation_mesh)) {
   ASSERT(
       (... or (db::tag_name<Tensors>() == "InertialCoordinates")),
       "There is no tag with name 'InertialCoordinates' specified "
@@ -0,0 +1,100 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <utility>
+
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "IO/Observer/WriteKernelTimings.hpp"
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write the timings of the kernels annotated with
+ * `SPECTRE_KERNEL_TIMER` to the reductions file.
+ *
+ * The zeroth element asks every node to write the number of calls and the
+ * total, shortest, longest and mean wallclock times of each kernel since the
+ * previous observation to `/KernelTimings/<Kernel>.dat` (see
+ * `observers::ThreadedActions::WriteKernelTimings`). Nothing is written
+ * unless SpECTRE is configured with `-D SPECTRE_PROFILE_KERNELS=ON`.
+ */
+template <size_t Dim>
+class ObserveKernelTimings : public Event {
+ public:
+  /// \cond
+  explicit ObserveKernelTimings(CkMigrateMessage* msg) : Event(msg) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveKernelTimings);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Write the timings of the annotated kernels to the reductions file. "
+      "Requires configuring with '-D SPECTRE_PROFILE_KERNELS=ON'.";
+
+  ObserveKernelTimings() = default;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<domain::Tags::Element<Dim>>;
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void operator()(const ::Element<Dim>& element,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    if (not is_zeroth_element(element.id())) {
+      return;
+    }
+    Parallel::threaded_action<observers::ThreadedActions::WriteKernelTimings>(
+        Parallel::get_parallel_component<
+            observers::ObserverWriter<Metavariables>>(cache),
+        observation_value.value);
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+
+  std::optional<
+      std::pair<observers::TypeOfObservation, observers::ObservationKey>>
+  get_observation_type_and_key_for_registration() const {
+    return {};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override { Event::pup(p); }
+};
+
+/// \cond
+template <size_t Dim>
+PUP::able::PUP_ID ObserveKernelTimings<Dim>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
@@ -53,6 +53,9 @@ void fill_norm_values_and_names(
   }
 
   const auto& component_names = names_and_components.first;
+  // Reused for the integrands of all components to avoid an allocation per
+  // component
+  DataVector integrand{};
   if (tensor_component == "Individual") {
     for (size_t storage_index = 0; storage_index < component_names.size();
          ++storage_index) {
@@ -64,11 +67,11 @@ void fill_norm_values_and_names(
         values.push_back(
             alg::accumulate(square(components[storage_index]), 0.0));
       } else if (tensor_norm_type == "L2IntegralNorm") {
-        values.push_back(definite_integral(
-            square(components[storage_index]) * det_jacobian, mesh));
+        integrand = square(components[storage_index]) * det_jacobian;
+        values.push_back(definite_integral(integrand, mesh));
       } else if (tensor_norm_type == "VolumeIntegral") {
-        values.push_back(
-            definite_integral(components[storage_index] * det_jacobian, mesh));
+        integrand = components[storage_index] * det_jacobian;
+        values.push_back(definite_integral(integrand, mesh));
       }
       names.push_back(
           tensor_norm_type + "(" +
@@ -93,11 +96,11 @@ void fill_norm_values_and_names(
       } else if (tensor_norm_type == "L2Norm") {
         value += alg::accumulate(square(components[storage_index]), 0.0);
       } else if (tensor_norm_type == "L2IntegralNorm") {
-        value += definite_integral(
-            square(components[storage_index]) * det_jacobian, mesh);
+        integrand = square(components[storage_index]) * det_jacobian;
+        value += definite_integral(integrand, mesh);
       } else if (tensor_norm_type == "VolumeIntegral") {
-        value +=
-            definite_integral(components[storage_index] * det_jacobian, mesh);
+        integrand = components[storage_index] * det_jacobian;
+        value += definite_integral(integrand, mesh);
       }
     }
 
@@ -35,6 +35,7 @@
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Events/Tags.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
@@ -392,16 +393,24 @@ void ObserveNorms<tmpl::list<ObservableTensorTags...>,
         const Mesh<Dim>& mesh, const DataVector& det_jacobian,
         const size_t number_of_points) const {
   const std::string tensor_name = db::tag_name<TensorToObserveTag>();
+  if (alg::none_of(tensor_names_, [&tensor_name](const std::string& name) {
+        return name == tensor_name;
+      })) {
+    return;
+  }
+  ObserveNorms_impl::check_norm_is_observable(
+      tensor_name, has_value(get<TensorToObserveTag>(box)));
+  // Extract the components once and compute all norms requested for this
+  // tensor from them
+  const auto names_and_components =
+      ObserveNorms_impl::split_complex_vector_of_data(
+          value(get<TensorToObserveTag>(box)).get_vector_of_data());
   for (size_t i = 0; i < tensor_names_.size(); ++i) {
     if (tensor_name == tensor_names_[i]) {
-      ObserveNorms_impl::check_norm_is_observable(
-          tensor_name, has_value(get<TensorToObserveTag>(box)));
       ObserveNorms_impl::fill_norm_values_and_names(
-          norm_values_and_names,
-          ObserveNorms_impl::split_complex_vector_of_data(
-              value(get<TensorToObserveTag>(box)).get_vector_of_data()),
-          mesh, det_jacobian, tensor_name, tensor_norm_types_[i],
-          tensor_components_[i], number_of_points);
+          norm_values_and_names, names_and_components, mesh, det_jacobian,
+          tensor_name, tensor_norm_types_[i], tensor_components_[i],
+          number_of_points);
     }
   }
 }
@@ -57,6 +57,7 @@ CREATE_IS_CALLABLE_V(initialize)
 ///   - `Tags::PendingTemporalIds<TemporalId>`
 ///   - `Tags::TemporalIds<TemporalId>`
 ///   - `Tags::CompletedTemporalIds<TemporalId>`
+///   - `Tags::PreviousBlockLogicalCoords<volume_dim>`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag,TemporalId>`
 ///   - `::Tags::Variables<typename
 ///                   InterpolationTargetTag::vars_to_interpolate_to_target>`
@@ -72,6 +73,7 @@ struct InitializeInterpolationTarget {
       Tags::IndicesOfInvalidInterpPoints<TemporalId>,
       Tags::PendingTemporalIds<TemporalId>, Tags::TemporalIds<TemporalId>,
       Tags::CompletedTemporalIds<TemporalId>,
+      Tags::PreviousBlockLogicalCoords<Metavariables::volume_dim>,
       Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>,
       ::Tags::Variables<
           typename InterpolationTargetTag::vars_to_interpolate_to_target>>;
@@ -10,6 +10,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -46,6 +47,8 @@ namespace Actions {
 ///   - `Tags::IndicesOfFilledInterpPoints`
 ///   - `Tags::IndicesOfInvalidInterpPoints`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>`
+///   - `Tags::PreviousBlockLogicalCoords` (if present), which holds the hints
+///     for finding the blocks of the points the next time
 ///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag>
@@ -61,6 +64,14 @@ struct SendPointsToInterpolator {
         InterpolationTargetTag>(box, cache, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
         make_not_null(&box), temporal_id, coords);
+    using previous_coords_tag =
+        Tags::PreviousBlockLogicalCoords<Metavariables::volume_dim>;
+    if constexpr (db::tag_is_retrievable_v<previous_coords_tag,
+                                           db::DataBox<DbTags>>) {
+      db::mutate<previous_coords_tag>(
+          [&coords](const auto previous_coords) { *previous_coords = coords; },
+          make_not_null(&box));
+    }
 
     // If all target points are invalid, we need to notify the target as no
     // interpolation is done.
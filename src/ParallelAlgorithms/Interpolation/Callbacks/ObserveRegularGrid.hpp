@@ -0,0 +1,134 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "IO/Observer/VolumeActions.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/Protocols/PostInterpolationCallback.hpp"
+#include "ParallelAlgorithms/Interpolation/Targets/RegularGrid.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Numeric.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace intrp {
+namespace callbacks {
+
+/*!
+ * \brief post_interpolation_callback that outputs requested tensors
+ * interpolated onto a `intrp::TargetPoints::RegularGrid`.
+ *
+ * The data is written as the volume data of a single element named after the
+ * `InterpolationTargetTag` into the `Reductions` file, with Basis
+ * `FiniteDifference` and Quadrature `CellCentered` in every dimension, so each
+ * tensor component is one contiguous dataset with the extents of the grid.
+ * This is a much smaller alternative to observing the full volume data when
+ * only a uniform sampling of the fields is needed. Points outside the domain
+ * are filled with NaN.
+ *
+ * Uses:
+ * - Metavariables
+ *   - `temporal_id`
+ * - DataBox:
+ *   - `TensorsToObserve`
+ * - GlobalCache:
+ *   - `observers::Tags::ReductionFileName`
+ *   - `intrp::Tags::RegularGrid<InterpolationTargetTag, VolumeDim>`
+ *
+ * Conforms to the intrp::protocols::PostInterpolationCallback protocol
+ *
+ * For requirements on InterpolationTargetTag, see
+ * intrp::protocols::InterpolationTargetTag
+ */
+template <typename TensorsToObserve, typename InterpolationTargetTag,
+          size_t VolumeDim>
+struct ObserveRegularGrid
+    : tt::ConformsTo<intrp::protocols::PostInterpolationCallback> {
+  static constexpr double fill_invalid_points_with =
+      std::numeric_limits<double>::quiet_NaN();
+
+  using const_global_cache_tags =
+      tmpl::list<observers::Tags::ReductionFileName,
+                 Tags::RegularGrid<InterpolationTargetTag, VolumeDim>>;
+
+  template <typename DbTags, typename Metavariables, typename TemporalId>
+  static void apply(const db::DataBox<DbTags>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const TemporalId& temporal_id) {
+    static_assert(
+        tmpl::list_contains_v<TensorsToObserve,
+                              domain::Tags::Coordinates<VolumeDim,
+                                                        Frame::Inertial>>,
+        "When observing tensors on a regular grid, please include the inertial "
+        "coordinates in TensorsToObserve so the output file is all that is "
+        "needed for subsequent visualization or analysis of the output data.");
+    const auto& number_of_points =
+        Parallel::get<Tags::RegularGrid<InterpolationTargetTag, VolumeDim>>(
+            cache)
+            .number_of_points;
+    const std::vector<size_t> extents_vector(number_of_points.begin(),
+                                             number_of_points.end());
+    const size_t total_number_of_points = alg::accumulate(
+        number_of_points, 1_st, std::multiplies<size_t>{});
+
+    std::vector<TensorComponent> tensor_components{};
+    tmpl::for_each<TensorsToObserve>(
+        [&box, &tensor_components, &total_number_of_points](auto tag_v) {
+          using Tag = tmpl::type_from<decltype(tag_v)>;
+          const auto& tensor = get<Tag>(box);
+          for (size_t i = 0; i < tensor.size(); ++i) {
+            ASSERT(tensor[i].size() == total_number_of_points,
+                   "All tensor components are expected to have the size "
+                       << total_number_of_points << " of the grid, but "
+                       << db::tag_name<Tag>() + tensor.component_suffix(i)
+                       << " has size " << tensor[i].size());
+            tensor_components.emplace_back(
+                db::tag_name<Tag>() + tensor.component_suffix(i), tensor[i]);
+          }
+        });
+
+    const std::string& name = pretty_type::name<InterpolationTargetTag>();
+    const std::string subfile_path{std::string{"/"} + name};
+    const std::vector<Spectral::Basis> bases_vector(
+        VolumeDim, Spectral::Basis::FiniteDifference);
+    const std::vector<Spectral::Quadrature> quadratures_vector(
+        VolumeDim, Spectral::Quadrature::CellCentered);
+    const observers::ObservationId observation_id(
+        InterpolationTarget_detail::get_temporal_id_value(temporal_id),
+        subfile_path + ".vol");
+    auto& proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+
+    // We call this on proxy[0] because the 0th element of a NodeGroup is
+    // always guaranteed to be present.
+    Parallel::threaded_action<observers::ThreadedActions::WriteVolumeData>(
+        proxy[0], Parallel::get<observers::Tags::ReductionFileName>(cache),
+        subfile_path, observation_id,
+        std::vector<ElementVolumeData>{{name, std::move(tensor_components),
+                                        extents_vector, bases_vector,
+                                        quadratures_vector}});
+  }
+};
+}  // namespace callbacks
+}  // namespace intrp
@@ -303,13 +303,18 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
     // in several steps:
     const auto& element_coord_holder = element_coord_holders.at(array_index);
 
-    // 1. Get the list of variables
-    Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
-        interp_vars(mesh.number_of_grid_points());
+    // 1. Set up interpolator
+    intrp::Irregular<VolumeDim> interpolator(
+        mesh, element_coord_holder.element_logical_coords);
+
+    // 2. Interpolate the variables to the target points
+    using vars_to_interpolate =
+        typename InterpolationTargetTag::vars_to_interpolate_to_target;
+    Variables<vars_to_interpolate> interpolated_vars{};
 
     if constexpr (InterpolationTarget_detail::has_compute_vars_to_interpolate_v<
                       InterpolationTargetTag>) {
-      // 1a. Call compute_vars_to_interpolate.  Need the source in a
+      // 2a. Call compute_vars_to_interpolate.  Need the source in a
       // Variables, so copy the variables here.
       // This copy would be unnecessary if we passed a Variables into
       // InterpolateWithoutInterpComponent instead of passing
@@ -329,49 +334,41 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
                                     source_vars_input)...);
 
+      Variables<vars_to_interpolate> interp_vars(mesh.number_of_grid_points());
       InterpolationTarget_detail::compute_dest_vars_from_source_vars<
           InterpolationTargetTag>(make_not_null(&interp_vars), source_vars,
                                   get<domain::Tags::Domain<VolumeDim>>(cache),
                                   mesh, array_index, cache, temporal_id);
+      interpolator.interpolate(make_not_null(&interpolated_vars), interp_vars);
     } else {
-      // 1b. There is no compute_vars_to_interpolate. So copy the
-      // source vars directly into the variables.
-      // This copy would be unnecessary if:
-      //   - We passed a Variables into InterpolateWithoutInterpComponent
-      //     instead of passing individual Tensors.
-      //  and
-      //   - This Variables was actually something in the DataBox.
-      //  and
-      //   - Either the passed-in Variables was exactly the same as
-      //     InterpolationTargetTag::vars_to_interpolate_to_target,
-      //     or IrregularInterpolant::interpolate had the ability to
-      //     interpolate only a subset of the Variables passed into it,
-      //     or IrregularInterpolant::interpolate can interpolate individual
-      //     DataVectors.
-      [[maybe_unused]] const auto copy_to_variables =
-          [&interp_vars](const auto tensor_tag_v, const auto& tensor) {
+      // 2b. There is no compute_vars_to_interpolate. So interpolate each
+      // component of the source vars directly into the result, without
+      // copying the volume data into a Variables first.
+      interpolated_vars.initialize(element_coord_holder.offsets.size());
+      [[maybe_unused]] const auto interpolate_tensor =
+          [&interpolated_vars, &interpolator](const auto tensor_tag_v,
+                                              const auto& tensor) {
             using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
-            get<tensor_tag>(interp_vars) = tensor;
+            auto& interpolated_tensor = get<tensor_tag>(interpolated_vars);
+            for (size_t i = 0; i < tensor.size(); ++i) {
+              interpolator.interpolate(make_not_null(&interpolated_tensor[i]),
+                                       tensor[i]);
+            }
             return 0;
           };
-      expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
-                                    source_vars_input)...);
+      expand_pack(interpolate_tensor(tmpl::type_<SourceVarTags>{},
+                                     source_vars_input)...);
     }
 
-    // 2. Set up interpolator
-    intrp::Irregular<VolumeDim> interpolator(
-        mesh, element_coord_holder.element_logical_coords);
-
-    // 3. Interpolate and send interpolated data to target
+    // 3. Send interpolated data to target
     auto& receiver_proxy = Parallel::get_parallel_component<
         InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
     Parallel::simple_action<
         Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
         receiver_proxy,
-        std::vector<Variables<
-            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
-        block_logical_coords,
+        std::vector<Variables<vars_to_interpolate>>(
+            {std::move(interpolated_vars)}),
+        std::move(block_logical_coords),
         std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
         temporal_id);
   }
@@ -12,6 +12,7 @@
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/ResourceInfo.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetSendPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
@@ -264,6 +265,12 @@ struct InterpolationTarget {
     return pretty_type::name<InterpolationTargetTag>();
   }
   using chare_type = ::Parallel::Algorithms::Singleton;
+  /// Expensive targets (e.g. horizon finders) can set
+  /// `static constexpr bool exclusive_by_default = true;` in the
+  /// `InterpolationTargetTag` to be placed on a proc without array elements
+  /// when their resources are chosen automatically.
+  static constexpr bool exclusive_by_default =
+      Parallel::exclusive_by_default_v<InterpolationTargetTag>;
   using const_global_cache_tags =
       Parallel::get_const_global_cache_tags_from_actions<
           tmpl::flatten<tmpl::list<
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_set>
@@ -14,10 +15,12 @@
 #include "DataStructures/LinkedMessageId.hpp"
 #include "DataStructures/Tensor/Metafunctions.hpp"
 #include "DataStructures/VariablesTag.hpp"
+#include "Domain/BlockBoundingBoxes.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/CoordinateMaps/Composition.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/ElementToBlockLogicalMap.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/TagsTimeDependent.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -59,6 +62,8 @@ template <typename TemporalId>
 struct CompletedTemporalIds;
 template <typename TemporalId>
 struct PendingTemporalIds;
+template <size_t VolumeDim>
+struct PreviousBlockLogicalCoords;
 template <typename TemporalId>
 struct TemporalIds;
 }  // namespace Tags
@@ -515,6 +520,11 @@ void add_received_variables(
 /// and one Action indirectly calls this version of block_logical_coords:
 /// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
 ///                             and by FindApparentHorizon)
+///
+/// `block_hints` are passed on to `::block_logical_coordinates`; they are
+/// typically the block logical coordinates of the previous set of points.
+/// If there are more points than blocks, `domain::BlockBoundingBoxes` are
+/// computed to skip the blocks that can't contain a point.
 template <typename InterpolationTargetTag, typename Metavariables,
           typename TemporalId>
 auto block_logical_coords(
@@ -522,15 +532,35 @@ auto block_logical_coords(
     const tnsr::I<
         DataVector, Metavariables::volume_dim,
         typename InterpolationTargetTag::compute_target_points::frame>& coords,
-    const TemporalId& temporal_id) {
-  const auto& domain =
-      get<domain::Tags::Domain<Metavariables::volume_dim>>(cache);
-  if constexpr (std::is_same_v<typename InterpolationTargetTag::
-                                   compute_target_points::frame,
-                               ::Frame::Grid>) {
+    const TemporalId& temporal_id,
+    const std::vector<BlockLogicalCoords<Metavariables::volume_dim>>&
+        block_hints = {}) {
+  constexpr size_t Dim = Metavariables::volume_dim;
+  using frame = typename InterpolationTargetTag::compute_target_points::frame;
+  const auto& domain = get<domain::Tags::Domain<Dim>>(cache);
+  // Computing the bounding boxes costs about as much as a few map inversions
+  // per block, whereas the search without them inverts up to one map per block
+  // for each point.
+  const bool use_bounding_boxes =
+      get<0>(coords).size() > domain.blocks().size();
+  const auto find_blocks =
+      [&block_hints, &coords, &domain, use_bounding_boxes](
+          const double time = std::numeric_limits<double>::signaling_NaN(),
+          const domain::FunctionsOfTimeMap& functions_of_time = {}) {
+        if (use_bounding_boxes) {
+          return ::block_logical_coordinates(
+              domain, coords,
+              domain::BlockBoundingBoxes<Dim, frame>{domain, time,
+                                                     functions_of_time},
+              block_hints, time, functions_of_time);
+        }
+        return ::block_logical_coordinates(domain, coords, block_hints, time,
+                                           functions_of_time);
+      };
+  if constexpr (std::is_same_v<frame, ::Frame::Grid>) {
     // Frame is grid frame, so don't need any FunctionsOfTime,
     // whether or not the maps are time_dependent.
-    return ::block_logical_coordinates(domain, coords);
+    return find_blocks();
   }
 
   if (domain.is_time_dependent()) {
@@ -540,8 +570,7 @@ auto block_logical_coords(
       // time-dependent is responsible for ensuring
       // that functions_of_time are up to date at temporal_id.
       const auto& functions_of_time = get<domain::Tags::FunctionsOfTime>(cache);
-      return ::block_logical_coordinates(
-          domain, coords,
+      return find_blocks(
           InterpolationTarget_detail::get_temporal_id_value(temporal_id),
           functions_of_time);
     } else {
@@ -561,7 +590,7 @@ auto block_logical_coords(
   }
 
   // Time-independent case.
-  return ::block_logical_coordinates(domain, coords);
+  return find_blocks();
 }
 
 /// Version of block_logical_coords that computes the interpolation
@@ -575,16 +604,30 @@ auto block_logical_coords(
 /// Currently one Action directly calls this version of block_logical_coords:
 /// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
 ///                             and by FindApparentHorizon)
+///
+/// If the DataBox holds `Tags::PreviousBlockLogicalCoords`, they are used as
+/// hints for finding the blocks containing the points.
 template <typename InterpolationTargetTag, typename DbTags,
           typename Metavariables, typename TemporalId>
 auto block_logical_coords(const db::DataBox<DbTags>& box,
                           const Parallel::GlobalCache<Metavariables>& cache,
                           const TemporalId& temporal_id) {
-  return block_logical_coords<InterpolationTargetTag>(
-      cache,
-      InterpolationTargetTag::compute_target_points::points(
-          box, tmpl::type_<Metavariables>{}, temporal_id),
-      temporal_id);
+  using previous_coords_tag =
+      Tags::PreviousBlockLogicalCoords<Metavariables::volume_dim>;
+  if constexpr (db::tag_is_retrievable_v<previous_coords_tag,
+                                         db::DataBox<DbTags>>) {
+    return block_logical_coords<InterpolationTargetTag>(
+        cache,
+        InterpolationTargetTag::compute_target_points::points(
+            box, tmpl::type_<Metavariables>{}, temporal_id),
+        temporal_id, db::get<previous_coords_tag>(box));
+  } else {
+    return block_logical_coords<InterpolationTargetTag>(
+        cache,
+        InterpolationTargetTag::compute_target_points::points(
+            box, tmpl::type_<Metavariables>{}, temporal_id),
+        temporal_id);
+  }
 }
 
 /// Version of block_logical_coords for when the coords are
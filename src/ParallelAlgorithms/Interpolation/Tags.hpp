@@ -9,10 +9,12 @@
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
@@ -94,6 +96,17 @@ struct PendingTemporalIds : db::SimpleTag {
   using type = std::deque<TemporalId>;
 };
 
+/// The block logical coordinates of the points that an InterpolationTarget
+/// sent most recently to the Interpolator.
+///
+/// Since the target points typically move only slightly between temporal_ids,
+/// e.g. during a horizon find, these are passed as hints to
+/// `block_logical_coordinates` when the next set of points is sent.
+template <size_t VolumeDim>
+struct PreviousBlockLogicalCoords : db::SimpleTag {
+  using type = std::vector<BlockLogicalCoords<VolumeDim>>;
+};
+
 /// `temporal_id`s on which to interpolate.
 template <typename TemporalId>
 struct TemporalIds : db::SimpleTag {
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Interpolation/Targets/RegularGrid.hpp"
+
+#include <pup.h>
+#include <pup_stl.h>
+
+#include "Options/ParseError.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace intrp::OptionHolders {
+
+template <size_t VolumeDim>
+RegularGrid<VolumeDim>::RegularGrid(
+    std::array<double, VolumeDim> lower_corner_in,
+    std::array<double, VolumeDim> upper_corner_in,
+    std::array<size_t, VolumeDim> number_of_points_in,
+    const Options::Context& context)
+    : lower_corner(lower_corner_in),
+      upper_corner(upper_corner_in),
+      number_of_points(number_of_points_in) {
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    if (gsl::at(number_of_points, d) < 2) {
+      PARSE_ERROR(context, "RegularGrid expects at least 2 points in each "
+                           "dimension, not "
+                               << gsl::at(number_of_points, d)
+                               << " in dimension " << d);
+    }
+    if (gsl::at(lower_corner, d) >= gsl::at(upper_corner, d)) {
+      PARSE_ERROR(context,
+                  "RegularGrid expects LowerCorner < UpperCorner in each "
+                  "dimension, but in dimension "
+                      << d << " they are " << gsl::at(lower_corner, d)
+                      << " and " << gsl::at(upper_corner, d));
+    }
+  }
+}
+
+template <size_t VolumeDim>
+void RegularGrid<VolumeDim>::pup(PUP::er& p) {
+  p | lower_corner;
+  p | upper_corner;
+  p | number_of_points;
+}
+
+template <size_t VolumeDim>
+bool operator==(const RegularGrid<VolumeDim>& lhs,
+                const RegularGrid<VolumeDim>& rhs) {
+  return lhs.lower_corner == rhs.lower_corner and
+         lhs.upper_corner == rhs.upper_corner and
+         lhs.number_of_points == rhs.number_of_points;
+}
+
+template <size_t VolumeDim>
+bool operator!=(const RegularGrid<VolumeDim>& lhs,
+                const RegularGrid<VolumeDim>& rhs) {
+  return not(lhs == rhs);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                               \
+  template struct RegularGrid<DIM(data)>;                  \
+  template bool operator==(const RegularGrid<DIM(data)>&,  \
+                           const RegularGrid<DIM(data)>&); \
+  template bool operator!=(const RegularGrid<DIM(data)>&,  \
+                           const RegularGrid<DIM(data)>&);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+
+}  // namespace intrp::OptionHolders
@@ -0,0 +1,166 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Context.hpp"
+#include "Options/String.hpp"
+#include "ParallelAlgorithms/Interpolation/Protocols/ComputeTargetPoints.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace db {
+template <typename TagsList>
+class DataBox;
+}  // namespace db
+/// \endcond
+
+namespace intrp {
+
+namespace OptionHolders {
+/// A regular Cartesian grid extending from `LowerCorner` to `UpperCorner`,
+/// containing `NumberOfPoints` uniformly-spaced points in each dimension
+/// including the corners.
+///
+/// \note Input coordinates are interpreted in `Frame::Inertial`
+template <size_t VolumeDim>
+struct RegularGrid {
+  struct LowerCorner {
+    using type = std::array<double, VolumeDim>;
+    static constexpr Options::String help = {"Lower corner of the grid"};
+  };
+  struct UpperCorner {
+    using type = std::array<double, VolumeDim>;
+    static constexpr Options::String help = {"Upper corner of the grid"};
+  };
+  struct NumberOfPoints {
+    using type = std::array<size_t, VolumeDim>;
+    static constexpr Options::String help = {
+        "Number of points in each dimension including the corners"};
+  };
+  using options = tmpl::list<LowerCorner, UpperCorner, NumberOfPoints>;
+  static constexpr Options::String help = {
+      "A regular Cartesian grid extending from LowerCorner to UpperCorner, "
+      "containing NumberOfPoints uniformly-spaced points in each dimension "
+      "including the corners."};
+
+  RegularGrid(std::array<double, VolumeDim> lower_corner_in,
+              std::array<double, VolumeDim> upper_corner_in,
+              std::array<size_t, VolumeDim> number_of_points_in,
+              const Options::Context& context = {});
+
+  RegularGrid() = default;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+  std::array<double, VolumeDim> lower_corner{};
+  std::array<double, VolumeDim> upper_corner{};
+  std::array<size_t, VolumeDim> number_of_points{};
+};
+
+template <size_t VolumeDim>
+bool operator==(const RegularGrid<VolumeDim>& lhs,
+                const RegularGrid<VolumeDim>& rhs);
+template <size_t VolumeDim>
+bool operator!=(const RegularGrid<VolumeDim>& lhs,
+                const RegularGrid<VolumeDim>& rhs);
+
+}  // namespace OptionHolders
+
+namespace OptionTags {
+template <typename InterpolationTargetTag, size_t VolumeDim>
+struct RegularGrid {
+  using type = OptionHolders::RegularGrid<VolumeDim>;
+  static constexpr Options::String help{
+      "Options for interpolation onto a regular grid."};
+  static std::string name() {
+    return pretty_type::name<InterpolationTargetTag>();
+  }
+  using group = InterpolationTargets;
+};
+}  // namespace OptionTags
+
+namespace Tags {
+template <typename InterpolationTargetTag, size_t VolumeDim>
+struct RegularGrid : db::SimpleTag {
+  using type = OptionHolders::RegularGrid<VolumeDim>;
+  using option_tags =
+      tmpl::list<OptionTags::RegularGrid<InterpolationTargetTag, VolumeDim>>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& option) { return option; }
+};
+}  // namespace Tags
+
+namespace TargetPoints {
+/// \brief Computes points on a regular Cartesian grid.
+///
+/// The points are ordered with the first dimension varying fastest, so the
+/// interpolated data can be written as a single contiguous volume, e.g. with
+/// `intrp::callbacks::ObserveRegularGrid`. Each element only receives and
+/// interpolates to the points that lie in it, and only the interpolated
+/// points are sent to the target.
+///
+/// Conforms to the intrp::protocols::ComputeTargetPoints protocol
+///
+/// For requirements on InterpolationTargetTag, see
+/// intrp::protocols::InterpolationTargetTag
+template <typename InterpolationTargetTag, size_t VolumeDim, typename Frame>
+struct RegularGrid : tt::ConformsTo<intrp::protocols::ComputeTargetPoints> {
+  using const_global_cache_tags =
+      tmpl::list<Tags::RegularGrid<InterpolationTargetTag, VolumeDim>>;
+  using is_sequential = std::false_type;
+  using frame = Frame;
+
+  template <typename Metavariables, typename DbTags>
+  static tnsr::I<DataVector, VolumeDim, Frame> points(
+      const db::DataBox<DbTags>& box,
+      const tmpl::type_<Metavariables>& /*meta*/) {
+    const auto& options =
+        get<Tags::RegularGrid<InterpolationTargetTag, VolumeDim>>(box);
+    const Index<VolumeDim> extents{options.number_of_points};
+    std::array<double, VolumeDim> spacing{};
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      gsl::at(spacing, d) = (gsl::at(options.upper_corner, d) -
+                             gsl::at(options.lower_corner, d)) /
+                            static_cast<double>(extents[d] - 1);
+    }
+
+    tnsr::I<DataVector, VolumeDim, Frame> target_points(extents.product());
+    for (IndexIterator<VolumeDim> index(extents); index; ++index) {
+      for (size_t d = 0; d < VolumeDim; ++d) {
+        target_points.get(d)[index.collapsed_index()] =
+            gsl::at(options.lower_corner, d) +
+            static_cast<double>(index()[d]) * gsl::at(spacing, d);
+      }
+    }
+    return target_points;
+  }
+
+  template <typename Metavariables, typename DbTags, typename TemporalId>
+  static tnsr::I<DataVector, VolumeDim, Frame> points(
+      const db::DataBox<DbTags>& box, const tmpl::type_<Metavariables>& meta,
+      const TemporalId& /*temporal_id*/) {
+    return points(box, meta);
+  }
+};
+
+}  // namespace TargetPoints
+}  // namespace intrp
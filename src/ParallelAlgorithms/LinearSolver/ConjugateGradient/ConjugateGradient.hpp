@@ -42,14 +42,15 @@ namespace LinearSolver::cg {
  * been computed and stored in the DataBox, the conjugate gradient algorithm
  * implemented here will converge the field \f$x\f$ towards the solution and
  * update the operand \f$p\f$ in the process. This requires two reductions over
- * all elements that are received by a `ResidualMonitor` singleton parallel
- * component, processed, and then broadcast back to all elements. The actions
- * are implemented in the `cg::detail` namespace and constitute the full
- * algorithm in the following order:
- * 1. `PerformStep` (on elements): Compute the inner product \f$\langle p,
- * A(p)\rangle\f$ and reduce.
- * 2. `ComputeAlpha` (on `ResidualMonitor`): Compute
- * \f$\alpha=\frac{r^2}{\langle p, A(p)\rangle}\f$ and broadcast.
+ * all elements. The first is broadcast back to all elements directly. The
+ * second is received by a `ResidualMonitor` singleton parallel component,
+ * processed, and then broadcast back to all elements. The actions are
+ * implemented in the `cg::detail` namespace and constitute the full algorithm
+ * in the following order:
+ * 1. `PerformStep` (on elements): Compute the inner products \f$\langle p,
+ * A(p)\rangle\f$ and \f$\langle r, r\rangle\f$ and reduce to all elements.
+ * 2. `ComputeAlpha` (on elements): Compute
+ * \f$\alpha=\frac{r^2}{\langle p, A(p)\rangle}\f$.
  * 3. `UpdateFieldValues` (on elements): Update \f$x\f$ and \f$r\f$, then
  * compute the inner product \f$\langle r, r\rangle\f$ and reduce to find the
  * new \f$r^2\f$.
@@ -133,6 +133,24 @@ struct InitializeHasConverged {
   }
 };
 
+// Invoked on all elements by the all-reduce in `PerformStep`. Since both
+// reduced quantities are already available on the elements, computing
+// alpha doesn't need a round trip through the `ResidualMonitor`.
+template <typename FieldsTag, typename OptionsGroup>
+struct ComputeAlpha {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const size_t iteration_id,
+                    const double conj_grad_inner_product,
+                    const double residual_square) {
+    Parallel::receive_data<Tags::Alpha<OptionsGroup>>(
+        Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+        iteration_id, residual_square / conj_grad_inner_product);
+  }
+};
+
 template <typename FieldsTag, typename OptionsGroup, typename Label>
 struct PerformStep {
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -149,23 +167,28 @@ struct PerformStep {
         db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
     using operator_tag =
         db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
+    using residual_tag =
+        db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
 
     // At this point Ap must have been computed in a previous action
     // We compute the inner product <p,p> w.r.t A. This requires a global
-    // reduction.
+    // reduction. We also reduce the residual magnitude square again, so
+    // the elements can compute alpha from the reduction broadcast to them
+    // directly.
     const double local_conj_grad_inner_product =
         inner_product(get<operand_tag>(box), get<operator_tag>(box));
+    const double local_residual_magnitude_square =
+        magnitude_square(get<residual_tag>(box));
 
-    Parallel::contribute_to_reduction<
-        ComputeAlpha<FieldsTag, OptionsGroup, ParallelComponent>>(
+    Parallel::contribute_to_reduction<ComputeAlpha<FieldsTag, OptionsGroup>>(
         Parallel::ReductionData<
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+            Parallel::ReductionDatum<double, funcl::Plus<>>,
             Parallel::ReductionDatum<double, funcl::Plus<>>>{
             get<Convergence::Tags::IterationId<OptionsGroup>>(box),
-            local_conj_grad_inner_product},
+            local_conj_grad_inner_product, local_residual_magnitude_square},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
-        Parallel::get_parallel_component<
-            ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+        Parallel::get_parallel_component<ParallelComponent>(cache));
 
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
@@ -92,28 +92,6 @@ struct InitializeResidual {
   }
 };
 
-template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
-struct ComputeAlpha {
- private:
-  using fields_tag = FieldsTag;
-  using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<
-      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>;
-
- public:
-  template <typename ParallelComponent, typename DbTagsList,
-            typename Metavariables, typename ArrayIndex,
-            typename DataBox = db::DataBox<DbTagsList>>
-  static void apply(db::DataBox<DbTagsList>& box,
-                    Parallel::GlobalCache<Metavariables>& cache,
-                    const ArrayIndex& /*array_index*/,
-                    const size_t iteration_id,
-                    const double conj_grad_inner_product) {
-    Parallel::receive_data<Tags::Alpha<OptionsGroup>>(
-        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        get<residual_square_tag>(box) / conj_grad_inner_product);
-  }
-};
-
 template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
 struct UpdateResidual {
  private:
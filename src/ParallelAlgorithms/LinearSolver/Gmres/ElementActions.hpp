@@ -9,6 +9,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -370,6 +371,16 @@ struct PerformStep {
         },
         make_not_null(&box), get<operator_tag>(box));
 
+    // Project the new operand on all basis vectors at once (classical
+    // Gram-Schmidt), so the orthogonalization needs a fixed number of
+    // reductions per iteration
+    const auto& basis_history = get<basis_history_tag>(box);
+    std::vector<ValueType> local_orthogonalization(basis_history.size());
+    for (size_t i = 0; i < basis_history.size(); ++i) {
+      local_orthogonalization[i] =
+          inner_product(basis_history[i], get<operand_tag>(box));
+    }
+
     auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
         make_not_null(&box));
     Parallel::contribute_to_reduction<
@@ -377,11 +388,11 @@ struct PerformStep {
         Parallel::ReductionData<
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<ValueType, funcl::Plus<>>>{
+            Parallel::ReductionDatum<std::vector<ValueType>,
+                                     funcl::ElementWise<funcl::Plus<>>>>{
             get<Convergence::Tags::IterationId<OptionsGroup>>(box),
             get<orthogonalization_iteration_id_tag>(box),
-            inner_product(get<basis_history_tag>(box)[0],
-                          get<operand_tag>(box))},
+            std::move(local_orthogonalization)},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
@@ -426,30 +437,31 @@ struct OrthogonalizeOperand {
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
 
-    const ValueType orthogonalization =
+    const auto orthogonalization =
         std::move(inbox.extract(iteration_id).mapped());
 
     db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
-        [orthogonalization](
+        [&orthogonalization](
             const auto operand,
             const gsl::not_null<size_t*> orthogonalization_iteration_id,
             const auto& basis_history) {
-          *operand -= orthogonalization *
-                      gsl::at(basis_history, *orthogonalization_iteration_id);
+          for (size_t i = 0; i < orthogonalization.size(); ++i) {
+            *operand -= orthogonalization[i] * gsl::at(basis_history, i);
+          }
           ++(*orthogonalization_iteration_id);
         },
         make_not_null(&box), get<basis_history_tag>(box));
 
-    const auto& next_orthogonalization_iteration_id =
-        get<orthogonalization_iteration_id_tag>(box);
-    const bool orthogonalization_complete =
-        next_orthogonalization_iteration_id == iteration_id;
-    const ValueType local_orthogonalization =
-        inner_product(orthogonalization_complete
-                          ? get<operand_tag>(box)
-                          : gsl::at(get<basis_history_tag>(box),
-                                    next_orthogonalization_iteration_id),
-                      get<operand_tag>(box));
+    // Re-orthogonalize against all basis vectors in a second pass and compute
+    // the magnitude of the operand in the same reduction
+    const auto& basis_history = get<basis_history_tag>(box);
+    std::vector<ValueType> local_orthogonalization(basis_history.size() + 1);
+    for (size_t i = 0; i < basis_history.size(); ++i) {
+      local_orthogonalization[i] =
+          inner_product(basis_history[i], get<operand_tag>(box));
+    }
+    local_orthogonalization.back() =
+        inner_product(get<operand_tag>(box), get<operand_tag>(box));
 
     auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
         make_not_null(&box));
@@ -458,20 +470,16 @@ struct OrthogonalizeOperand {
         Parallel::ReductionData<
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<ValueType, funcl::Plus<>>>{
-            iteration_id, next_orthogonalization_iteration_id,
-            local_orthogonalization},
+            Parallel::ReductionDatum<std::vector<ValueType>,
+                                     funcl::ElementWise<funcl::Plus<>>>>{
+            iteration_id, get<orthogonalization_iteration_id_tag>(box),
+            std::move(local_orthogonalization)},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
         make_not_null(&section));
 
-    // Repeat this action until orthogonalization is complete
-    constexpr size_t this_action_index =
-        tmpl::index_of<ActionList, OrthogonalizeOperand>::value;
-    return {Parallel::AlgorithmExecution::Continue,
-            orthogonalization_complete ? (this_action_index + 1)
-                                       : this_action_index};
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
 
@@ -518,11 +526,12 @@ struct NormalizeOperandAndUpdateField {
     // Retrieve reduction data from inbox
     auto received_data = std::move(inbox.extract(iteration_id).mapped());
     const double normalization = get<0>(received_data);
-    const auto& minres = get<1>(received_data);
+    const auto& reorthogonalization = get<1>(received_data);
+    const auto& minres = get<2>(received_data);
     db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
         [&received_data](
             const gsl::not_null<Convergence::HasConverged*> has_converged) {
-          *has_converged = std::move(get<2>(received_data));
+          *has_converged = std::move(get<3>(received_data));
         },
         make_not_null(&box));
 
@@ -554,10 +563,13 @@ struct NormalizeOperandAndUpdateField {
     }
 
     db::mutate<operand_tag, basis_history_tag, fields_tag>(
-        [normalization, &minres](const auto operand, const auto basis_history,
-                                 const auto field, const auto& initial_field,
-                                 const auto& preconditioned_basis_history,
-                                 const auto& has_converged) {
+        [normalization, &reorthogonalization, &minres](
+            const auto operand, const auto basis_history, const auto field,
+            const auto& initial_field, const auto& preconditioned_basis_history,
+            const auto& has_converged) {
+          for (size_t i = 0; i < reorthogonalization.size(); ++i) {
+            *operand -= reorthogonalization[i] * gsl::at(*basis_history, i);
+          }
           // Avoid an FPE if the new operand norm is exactly zero. In that case
           // the problem is solved and the algorithm will terminate (see
           // Proposition 9.3 in \cite Saad2003). Since there will be no next
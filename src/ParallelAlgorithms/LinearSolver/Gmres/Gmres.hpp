@@ -56,27 +56,34 @@ namespace LinearSolver::gmres {
  * will converge the field \f$x\f$ towards the solution and update the operand
  * \f$q\f$ in the process. This requires reductions over all elements that are
  * received by a `ResidualMonitor` singleton parallel component, processed, and
- * then broadcast back to all elements. Since the reductions are performed to
- * find a vector that is orthogonal to those used in previous steps, the number
- * of reductions increases linearly with iterations. No restarting mechanism is
- * currently implemented. The actions are implemented in the `gmres::detail`
- * namespace and constitute the full algorithm in the following order:
+ * then broadcast back to all elements. To keep the number of reductions per
+ * iteration fixed, the Arnoldi orthogonalization is done with classical
+ * Gram-Schmidt and one re-orthogonalization pass (CGS2), which batches the
+ * inner products with all previous orthogonal vectors into a single reduction
+ * per pass. The re-orthogonalization makes it as robust as modified
+ * Gram-Schmidt, which would need a reduction per orthogonal vector. The memory
+ * used by the orthogonal vectors still increases linearly with iterations. No
+ * restarting mechanism is currently implemented. The actions are implemented
+ * in the `gmres::detail` namespace and constitute the full algorithm in the
+ * following order:
  * 1. `PerformStep` (on elements): Start an Arnoldi orthogonalization by
- * computing the inner product between \f$A(q)\f$ and the first of the
- * previously determined set of orthogonal vectors.
+ * computing the inner products between \f$A(q)\f$ and all of the previously
+ * determined set of orthogonal vectors.
  * 2. `StoreOrthogonalization` (on `ResidualMonitor`): Keep track of the
- * computed inner product in a Hessenberg matrix, then broadcast.
- * 3. `OrthogonalizeOperand` (on elements): Proceed with the Arnoldi
- * orthogonalization by computing inner products and reducing to
- * `StoreOrthogonalization` on the `ResidualMonitor` until the new orthogonal
- * vector is constructed. Then compute its magnitude and reduce.
- * 4. `StoreOrthogonalization` (on `ResidualMonitor`): Perform a QR
- * decomposition of the Hessenberg matrix to produce a residual vector.
- * Broadcast to `NormalizeOperandAndUpdateField` along with a termination
- * flag if the `Convergence::Tags::Criteria` are met.
- * 5. `NormalizeOperandAndUpdateField` (on elements): Set the operand \f$q\f$ as
- * the new orthogonal vector and normalize. Use the residual vector and the set
- * of orthogonal vectors to determine the solution \f$x\f$.
+ * computed inner products in a Hessenberg matrix, then broadcast.
+ * 3. `OrthogonalizeOperand` (on elements): Subtract the projections on the
+ * orthogonal vectors, then compute the inner products with the orthogonal
+ * vectors again, along with the magnitude of the operand, and reduce.
+ * 4. `StoreOrthogonalization` (on `ResidualMonitor`): Add the
+ * re-orthogonalization to the Hessenberg matrix, compute the magnitude of the
+ * new orthogonal vector and perform a QR decomposition of the Hessenberg
+ * matrix to produce a residual vector. Broadcast to
+ * `NormalizeOperandAndUpdateField` along with a termination flag if the
+ * `Convergence::Tags::Criteria` are met.
+ * 5. `NormalizeOperandAndUpdateField` (on elements): Re-orthogonalize the
+ * operand \f$q\f$, set it as the new orthogonal vector and normalize. Use the
+ * residual vector and the set of orthogonal vectors to determine the solution
+ * \f$x\f$.
  *
  * \par Array sections
  * This linear solver supports running over a subset of the elements in the
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <complex>
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -119,48 +122,63 @@ struct StoreOrthogonalization {
                     const ArrayIndex& /*array_index*/,
                     const size_t iteration_id,
                     const size_t orthogonalization_iteration_id,
-                    const ValueType orthogonalization) {
-    if (UNLIKELY(orthogonalization_iteration_id == 0)) {
-      // Append a row and a column to the orthogonalization history. Zero the
-      // entries that won't be set during the orthogonalization procedure below.
+                    std::vector<ValueType> orthogonalization) {
+    ASSERT(orthogonalization_iteration_id < 2,
+           "The orthogonalization is done in two passes, but received pass "
+               << orthogonalization_iteration_id);
+    ASSERT(orthogonalization.size() ==
+               iteration_id + orthogonalization_iteration_id,
+           "Expected " << iteration_id + orthogonalization_iteration_id
+                       << " orthogonalization entries but received "
+                       << orthogonalization.size());
+    if (orthogonalization_iteration_id == 0) {
+      // Append a row and a column to the orthogonalization history and store
+      // the projections of the new operand on all basis vectors. Then
+      // broadcast them back to all elements so they can subtract them.
       db::mutate<orthogonalization_history_tag>(
-          [iteration_id](const auto orthogonalization_history) {
+          [iteration_id,
+           &orthogonalization](const auto orthogonalization_history) {
             orthogonalization_history->resize(iteration_id + 1, iteration_id);
             for (size_t j = 0; j < orthogonalization_history->columns() - 1;
                  ++j) {
               (*orthogonalization_history)(
                   orthogonalization_history->rows() - 1, j) = 0.;
             }
-          },
-          make_not_null(&box));
-    }
-
-    // While the orthogonalization procedure is not complete, store the
-    // orthogonalization, broadcast it back to all elements and return early
-    if (orthogonalization_iteration_id < iteration_id) {
-      db::mutate<orthogonalization_history_tag>(
-          [orthogonalization, iteration_id, orthogonalization_iteration_id](
-              const auto orthogonalization_history) {
-            (*orthogonalization_history)(orthogonalization_iteration_id,
-                                         iteration_id - 1) = orthogonalization;
+            for (size_t i = 0; i < iteration_id; ++i) {
+              (*orthogonalization_history)(i, iteration_id - 1) =
+                  orthogonalization[i];
+            }
           },
           make_not_null(&box));
 
       Parallel::receive_data<Tags::Orthogonalization<OptionsGroup, ValueType>>(
           Parallel::get_parallel_component<BroadcastTarget>(cache),
-          iteration_id, orthogonalization);
+          iteration_id, std::move(orthogonalization));
       return;
     }
 
-    // At this point, the orthogonalization procedure is complete.
-    ASSERT(equal_within_roundoff(imag(orthogonalization), 0.0),
-           "Normalization is not real: " << orthogonalization);
-    const double normalization = sqrt(real(orthogonalization));
+    // The second pass re-orthogonalizes the operand against all basis vectors,
+    // which makes classical Gram-Schmidt as robust as its modified variant.
+    // Since the basis is orthonormal, the magnitude of the operand after the
+    // re-orthogonalization follows from its magnitude before.
+    const ValueType magnitude_square = orthogonalization.back();
+    ASSERT(equal_within_roundoff(imag(magnitude_square), 0.0),
+           "Normalization is not real: " << magnitude_square);
+    orthogonalization.pop_back();
+    double normalization_square = real(magnitude_square);
+    for (const auto& correction : orthogonalization) {
+      normalization_square -= std::norm(correction);
+    }
+    const double normalization = sqrt(std::max(normalization_square, 0.));
     db::mutate<orthogonalization_history_tag>(
         [normalization, iteration_id,
-         orthogonalization_iteration_id](const auto orthogonalization_history) {
-          (*orthogonalization_history)(orthogonalization_iteration_id,
-                                       iteration_id - 1) = normalization;
+         &orthogonalization](const auto orthogonalization_history) {
+          for (size_t i = 0; i < iteration_id; ++i) {
+            (*orthogonalization_history)(i, iteration_id - 1) +=
+                orthogonalization[i];
+          }
+          (*orthogonalization_history)(iteration_id, iteration_id - 1) =
+              normalization;
         },
         make_not_null(&box));
 
@@ -168,7 +186,7 @@ struct StoreOrthogonalization {
     // the orthogonalization
     const auto& orthogonalization_history =
         get<orthogonalization_history_tag>(box);
-    const auto num_rows = orthogonalization_iteration_id + 1;
+    const auto num_rows = iteration_id + 1;
     blaze::DynamicMatrix<ValueType> qr_Q;
     blaze::DynamicMatrix<ValueType> qr_R;
     blaze::qr(orthogonalization_history, qr_Q, qr_R);
@@ -242,7 +260,8 @@ struct StoreOrthogonalization {
     Parallel::receive_data<
         Tags::FinalOrthogonalization<OptionsGroup, ValueType>>(
         Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        std::make_tuple(normalization, std::move(minres),
+        std::make_tuple(normalization, std::move(orthogonalization),
+                        std::move(minres),
                         // NOLINTNEXTLINE(performance-move-const-arg)
                         std::move(has_converged)));
   }
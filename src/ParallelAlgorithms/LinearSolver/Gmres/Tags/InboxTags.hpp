@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <map>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/DynamicVector.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
@@ -26,7 +27,7 @@ template <typename OptionsGroup, typename ValueType>
 struct Orthogonalization : Parallel::InboxInserters::Value<
                                Orthogonalization<OptionsGroup, ValueType>> {
   using temporal_id = size_t;
-  using type = std::map<temporal_id, ValueType>;
+  using type = std::map<temporal_id, std::vector<ValueType>>;
 };
 
 template <typename OptionsGroup, typename ValueType>
@@ -34,9 +35,10 @@ struct FinalOrthogonalization
     : Parallel::InboxInserters::Value<
           FinalOrthogonalization<OptionsGroup, ValueType>> {
   using temporal_id = size_t;
-  using type =
-      std::map<temporal_id, std::tuple<double, blaze::DynamicVector<ValueType>,
-                                       Convergence::HasConverged>>;
+  using type = std::map<
+      temporal_id,
+      std::tuple<double, std::vector<ValueType>,
+                 blaze::DynamicVector<ValueType>, Convergence::HasConverged>>;
 };
 
 }  // namespace LinearSolver::gmres::detail::Tags
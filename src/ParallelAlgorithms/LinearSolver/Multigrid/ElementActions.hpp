@@ -73,6 +73,7 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<Tags::MaxLevels<OptionsGroup>,
+                 Tags::CoarsestGridOnSingleNode<OptionsGroup>,
                  Tags::OutputVolumeData<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
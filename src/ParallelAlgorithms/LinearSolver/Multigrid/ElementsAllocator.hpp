@@ -20,6 +20,7 @@
 #include "Elliptic/DiscontinuousGalerkin/Tags.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Protocols/ArrayElementsAllocator.hpp"
@@ -71,7 +72,10 @@ namespace LinearSolver::multigrid {
  * The elements are distributed on processors using the
  * `domain::BlockZCurveProcDistribution` for every grid independently. An
  * unordered set of `size_t`s can be passed to the `apply` function which
- * represents physical processors to avoid placing elements on.
+ * represents physical processors to avoid placing elements on. If the
+ * `LinearSolver::multigrid::Tags::CoarsestGridOnSingleNode` option is enabled,
+ * the elements of the coarsest grid are only distributed on the processors of
+ * the first node.
  */
 template <size_t Dim, typename OptionsGroup>
 struct ElementsAllocator
@@ -116,6 +120,8 @@ struct ElementsAllocator
         get<domain::Tags::ElementDistribution>(local_cache);
     std::optional<size_t> max_levels =
         get<Tags::MaxLevels<OptionsGroup>>(local_cache);
+    const bool coarsest_grid_on_single_node =
+        get<Tags::CoarsestGridOnSingleNode<OptionsGroup>>(local_cache);
     const size_t number_of_procs =
         Parallel::number_of_procs<size_t>(local_cache);
     if (max_levels == 0) {
@@ -143,6 +149,8 @@ struct ElementsAllocator
         parent_refinement_levels =
             LinearSolver::multigrid::coarsen(initial_refinement_levels);
       }
+      const bool is_coarsest_grid =
+          initial_refinement_levels == parent_refinement_levels;
       // Create element IDs for all elements on this level
       std::vector<ElementId<Dim>> element_ids{};
       for (const auto& block : blocks) {
@@ -178,9 +186,23 @@ struct ElementsAllocator
                               array_indices.data(), array_indices.size())})
               : std::nullopt;
       // Create the elements for this refinement level and distribute them among
-      // processors
+      // processors. The coarsest grid can be restricted to the first node so
+      // its latency-bound communication stays within the node.
+      std::unordered_set<size_t> level_procs_to_ignore = procs_to_ignore;
+      if (coarsest_grid_on_single_node and is_coarsest_grid) {
+        for (size_t proc = 0; proc < number_of_procs; ++proc) {
+          if (Parallel::node_of<size_t>(proc, local_cache) != 0) {
+            level_procs_to_ignore.insert(proc);
+          }
+        }
+        // Fall back to all nodes if the first node has no usable procs
+        if (level_procs_to_ignore.size() == number_of_procs) {
+          level_procs_to_ignore = procs_to_ignore;
+        }
+      }
       const size_t num_of_procs_to_use =
-          static_cast<size_t>(sys::number_of_procs()) - procs_to_ignore.size();
+          static_cast<size_t>(sys::number_of_procs()) -
+          level_procs_to_ignore.size();
       // Distributed with weighted space filling curve
       if (element_weight.has_value()) {
         const std::unordered_map<ElementId<Dim>, double> element_costs =
@@ -190,7 +212,7 @@ struct ElementsAllocator
         const domain::BlockZCurveProcDistribution<Dim> element_distribution{
             element_costs,   num_of_procs_to_use,
             blocks,          initial_refinement_levels,
-            initial_extents, procs_to_ignore};
+            initial_extents, level_procs_to_ignore};
 
         for (const auto& element_id : element_ids) {
           const size_t target_proc =
@@ -202,7 +224,8 @@ struct ElementsAllocator
         // Distributed with round-robin
         size_t which_proc = 0;
         for (const auto& element_id : element_ids) {
-          while (procs_to_ignore.find(which_proc) != procs_to_ignore.end()) {
+          while (level_procs_to_ignore.find(which_proc) !=
+                 level_procs_to_ignore.end()) {
             which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
           }
 
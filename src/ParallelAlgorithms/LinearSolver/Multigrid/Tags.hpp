@@ -72,6 +72,19 @@ struct EnablePostSmoothingAtBottom {
   using group = OptionsGroup;
 };
 
+template <typename OptionsGroup>
+struct CoarsestGridOnSingleNode {
+  using type = bool;
+  static constexpr Options::String help =
+      "Distribute the elements of the coarsest grid only on the first node. "
+      "The coarsest grid has few elements, so its smoothing is dominated by "
+      "communication latency. Placing it on a single node replaces internode "
+      "by intranode communication. Only enable this if the coarsest grid "
+      "fits into the memory of a single node.";
+  using group = OptionsGroup;
+  static bool suggested_value() { return false; }
+};
+
 }  // namespace OptionTags
 
 /// DataBox tags for the `LinearSolver::multigrid::Multigrid` linear solver
@@ -117,6 +130,20 @@ struct MaxLevels : db::SimpleTag {
   }
 };
 
+/// Whether or not to distribute the coarsest grid only on the first node
+template <typename OptionsGroup>
+struct CoarsestGridOnSingleNode : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::CoarsestGridOnSingleNode<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "CoarsestGridOnSingleNode(" + pretty_type::name<OptionsGroup>() +
+           ")";
+  }
+};
+
 /// Whether or not volume data should be recorded for debugging purposes
 template <typename OptionsGroup>
 struct OutputVolumeData : db::SimpleTag {
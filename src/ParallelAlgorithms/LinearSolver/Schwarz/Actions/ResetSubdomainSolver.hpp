@@ -3,19 +3,26 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <optional>
 #include <tuple>
+#include <type_traits>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/Printf/Printf.hpp"
+#include "ParallelAlgorithms/Amr/Protocols/Projector.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/Tags.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/NoSuchType.hpp"
 #include "Utilities/PrettyType.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -53,15 +60,51 @@ namespace LinearSolver::Schwarz::Actions {
  * expensive re-initializations are avoided but the subdomain solves may be
  * increasingly inaccurate or slow down as the linear operator changes over
  * nonlinear solver iterations. Whether or not skipping resets helps with the
- * overall convergence of the solve is highly problem-dependent. A possible
- * optimization would be to decide at runtime whether or not to reset the
- * subdomain solver.
+ * overall convergence of the solve is highly problem-dependent.
+ *
+ * \par Deciding at runtime whether to reset:
+ * If the `NonlinearSolverOptionsGroup` is specified, the reset can instead be
+ * skipped only while the nonlinear solver converges fast, using the option
+ * `LinearSolver::Schwarz::Tags::SubdomainSolverResetThreshold`. The subdomain
+ * solver is then kept as long as every nonlinear-solver iteration reduces the
+ * residual magnitude at least by the threshold factor, and reset once
+ * convergence stalls. The decision is based only on the globally-reduced
+ * nonlinear residual, so all elements make the same decision. The subdomain
+ * solver is always reset at the start of a nonlinear solve.
+ *
+ * \par AMR:
+ * This action also conforms to `amr::protocols::Projector`, so add it to the
+ * AMR projectors when its `simple_tags` are part of the DataBox. The previous
+ * nonlinear residual is cleared during AMR because the nonlinear solve
+ * restarts on the new grid. Note that
+ * `LinearSolver::Schwarz::Actions::InitializeElement` keeps the subdomain
+ * solver on elements that are unchanged by AMR, so the first solve after
+ * an AMR step can start with a warm subdomain solver unless it gets reset
+ * by this action.
  */
-template <typename OptionsGroup>
-struct ResetSubdomainSolver {
-  using const_global_cache_tags = tmpl::list<
-      LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<OptionsGroup>,
-      logging::Tags::Verbosity<OptionsGroup>>;
+template <typename OptionsGroup,
+          typename NonlinearSolverOptionsGroup = NoSuchType>
+struct ResetSubdomainSolver : tt::ConformsTo<amr::protocols::Projector> {
+ private:
+  static constexpr bool monitor_nonlinear_convergence =
+      not std::is_same_v<NonlinearSolverOptionsGroup, NoSuchType>;
+
+ public:
+  using const_global_cache_tags = tmpl::append<
+      tmpl::list<
+          LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<OptionsGroup>,
+          logging::Tags::Verbosity<OptionsGroup>>,
+      tmpl::conditional_t<
+          monitor_nonlinear_convergence,
+          tmpl::list<LinearSolver::Schwarz::Tags::SubdomainSolverResetThreshold<
+              OptionsGroup>>,
+          tmpl::list<>>>;
+  using simple_tags =
+      tmpl::conditional_t<monitor_nonlinear_convergence,
+                          tmpl::list<LinearSolver::Schwarz::Tags::
+                                         PreviousNonlinearResidualMagnitude<
+                                             OptionsGroup>>,
+                          tmpl::list<>>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             size_t Dim, typename ActionList, typename ParallelComponent>
   static Parallel::iterable_action_return_t apply(
@@ -70,8 +113,44 @@ struct ResetSubdomainSolver {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ElementId<Dim>& element_id, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
-    if (not get<LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<
-            OptionsGroup>>(box)) {
+    bool reset = not get<
+        LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<OptionsGroup>>(
+        box);
+    if constexpr (monitor_nonlinear_convergence) {
+      const auto& has_converged =
+          get<Convergence::Tags::HasConverged<NonlinearSolverOptionsGroup>>(
+              box);
+      const double residual_magnitude = has_converged.residual_magnitude();
+      const double previous_residual_magnitude = get<
+          LinearSolver::Schwarz::Tags::PreviousNonlinearResidualMagnitude<
+              OptionsGroup>>(box);
+      const auto& reset_threshold = get<
+          LinearSolver::Schwarz::Tags::SubdomainSolverResetThreshold<
+              OptionsGroup>>(box);
+      if (reset and reset_threshold.has_value() and
+          has_converged.num_iterations() > 0 and
+          not std::isnan(previous_residual_magnitude) and
+          residual_magnitude <=
+              *reset_threshold * previous_residual_magnitude) {
+        reset = false;
+        if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                     ::Verbosity::Debug)) {
+          Parallel::printf(
+              "%s %s: Skip subdomain solver reset (nonlinear residual "
+              "decreased by factor %g)\n",
+              element_id, pretty_type::name<OptionsGroup>(),
+              residual_magnitude / previous_residual_magnitude);
+        }
+      }
+      db::mutate<
+          LinearSolver::Schwarz::Tags::PreviousNonlinearResidualMagnitude<
+              OptionsGroup>>(
+          [&residual_magnitude](const gsl::not_null<double*> previous) {
+            *previous = residual_magnitude;
+          },
+          make_not_null(&box));
+    }
+    if (reset) {
       if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                    ::Verbosity::Debug)) {
         Parallel::printf("%s %s: Reset subdomain solver\n", element_id,
@@ -93,6 +172,21 @@ struct ResetSubdomainSolver {
     }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
+
+ public:  // amr::protocols::Projector
+  using return_tags = simple_tags;
+  using argument_tags = tmpl::list<>;
+
+  template <typename AmrData>
+  static void apply(const AmrData& /*amr_data*/) {}
+
+  template <typename AmrData>
+  static void apply(
+      const gsl::not_null<double*> previous_nonlinear_residual_magnitude,
+      const AmrData& /*amr_data*/) {
+    *previous_nonlinear_residual_magnitude =
+        std::numeric_limits<double>::quiet_NaN();
+  }
 };
 
 }  // namespace LinearSolver::Schwarz::Actions
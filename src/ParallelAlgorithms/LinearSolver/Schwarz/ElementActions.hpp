@@ -307,6 +307,19 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
         // h-coarsening, copy from one of the children (doesn't matter which)
         *subdomain_solver =
             get<subdomain_solver_tag>(amr_data.begin()->second...)->get_clone();
+      } else {
+        // The element wasn't h-refined. If neither its mesh nor its neighbors
+        // changed we keep the subdomain solver and its caches (e.g. the
+        // explicit inverse of the subdomain operator), so the next solve
+        // starts with a warm preconditioner. A p-refinement of a neighbor can
+        // only modify the overlap region, so the kept subdomain solver remains
+        // a good (but inexact) preconditioner. Subdomain solvers that cache
+        // data rebuild it if the size of the subdomain changes.
+        const auto& [old_mesh, old_element] =
+            std::get<0>(std::forward_as_tuple(amr_data...));
+        if (old_mesh == mesh and old_element == element) {
+          return;
+        }
       }
       (*subdomain_solver)->reset();
     }
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/Subitems.hpp"
@@ -54,6 +55,19 @@ struct SkipSubdomainSolverResets {
       "overall is highly problem-dependent.";
 };
 
+template <typename OptionsGroup>
+struct SubdomainSolverResetThreshold {
+  static std::string name() { return "ResetThreshold"; }
+  using type = Options::Auto<double, Options::AutoLabel::None>;
+  using group = OptionsGroup;
+  static constexpr Options::String help =
+      "Skip resets of the subdomain solver while the nonlinear solver "
+      "converges fast, i.e. while each nonlinear-solver iteration reduces the "
+      "residual at least by this factor. The subdomain solver is reset once "
+      "convergence stalls. Set to 'None' to reset in every nonlinear-solver "
+      "iteration. Has no effect if 'SkipResets' is enabled.";
+};
+
 template <typename OptionsGroup>
 struct ObservePerCoreReductions {
   using type = bool;
@@ -113,6 +127,33 @@ struct SkipSubdomainSolverResets : db::SimpleTag {
   static bool create_from_options(const bool value) { return value; }
 };
 
+/// Skip resets of the subdomain solver while the nonlinear residual decreases
+/// at least by this factor per iteration. `std::nullopt` means the subdomain
+/// solver is reset in every nonlinear-solver iteration.
+///
+/// \see LinearSolver::Schwarz::Actions::ResetSubdomainSolver
+template <typename OptionsGroup>
+struct SubdomainSolverResetThreshold : db::SimpleTag {
+  using type = std::optional<double>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::SubdomainSolverResetThreshold<OptionsGroup>>;
+  static type create_from_options(const type& value) { return value; }
+};
+
+/// The nonlinear residual magnitude when the subdomain solver was last asked
+/// to reset, used to monitor the nonlinear convergence.
+///
+/// \see LinearSolver::Schwarz::Actions::ResetSubdomainSolver
+template <typename OptionsGroup>
+struct PreviousNonlinearResidualMagnitude : db::SimpleTag {
+  using type = double;
+  static std::string name() {
+    return "PreviousNonlinearResidualMagnitude(" +
+           pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
 /// Enable per-core reduction observations
 template <typename OptionsGroup>
 struct ObservePerCoreReductions : db::SimpleTag {
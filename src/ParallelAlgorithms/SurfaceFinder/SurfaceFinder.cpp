@@ -20,18 +20,43 @@
 
 namespace SurfaceFinder {
 namespace {
-// Wrapping for the interpolator for Toms748 rootfind.
+// Wrapping for the interpolator for Toms748 rootfind. The root find evaluates
+// the interpolant many times along the same ray, so evaluate the barycentric
+// form directly instead of building an interpolation matrix for every point.
 struct RayInterpolant {
  public:
-  double operator()(double x) const {
-    std::array<Matrix, 1> interpolation_matrices{
-        Spectral::interpolation_matrix(mesh, x)};
-    return apply_matrices(interpolation_matrices, values, mesh.extents())[0];
+  double operator()(const double x) const {
+    double numerator = 0.0;
+    double denominator = 0.0;
+    for (size_t j = 0; j < values.size(); ++j) {
+      const double dx = x - collocation_points[j];
+      if (dx == 0.0) {
+        return values[j];
+      }
+      const double weight_over_dx = barycentric_weights[j] / dx;
+      numerator += weight_over_dx * values[j];
+      denominator += weight_over_dx;
+    }
+    return numerator / denominator;
   }
 
   const DataVector& values{};
-  const Mesh<1>& mesh{};
+  const DataVector& collocation_points{};
+  const DataVector& barycentric_weights{};
 };
+
+DataVector barycentric_weights(const DataVector& collocation_points) {
+  DataVector weights(collocation_points.size(), 1.0);
+  for (size_t j = 0; j < collocation_points.size(); ++j) {
+    for (size_t k = 0; k < collocation_points.size(); ++k) {
+      if (k != j) {
+        weights[j] *= collocation_points[j] - collocation_points[k];
+      }
+    }
+    weights[j] = 1.0 / weights[j];
+  }
+  return weights;
+}
 }  // namespace
 
 std::vector<std::optional<double>> find_radial_surface(
@@ -48,6 +73,10 @@ std::vector<std::optional<double>> find_radial_surface(
   DataVector interpolated_data(ray_size);
   const auto xi_mesh = mesh.slice_through(0);
   const auto eta_mesh = mesh.slice_through(1);
+  const DataVector& radial_collocation_points =
+      Spectral::collocation_points(mesh.slice_through(2));
+  const DataVector radial_barycentric_weights =
+      barycentric_weights(radial_collocation_points);
 
   for (size_t i = 0; i < num_rays; i++) {
     // Potential speed-up: Currently, the interpolation is done one ray at a
@@ -63,7 +92,8 @@ std::vector<std::optional<double>> find_radial_surface(
     apply_matrices(make_not_null(&interpolated_data), interpolation_matrices,
                    subtracted_data, mesh.extents());
     const RayInterpolant data_interpolator{interpolated_data,
-                                           mesh.slice_through(2)};
+                                           radial_collocation_points,
+                                           radial_barycentric_weights};
 
     // Perform root-find only if the element brackets a root.
     const double lower_radial_bound =
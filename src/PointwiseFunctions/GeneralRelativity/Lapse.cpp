@@ -4,6 +4,8 @@
 #include "PointwiseFunctions/GeneralRelativity/Lapse.hpp"
 
 #include <cmath>
+#include <cstddef>
+#include <utility>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -13,6 +15,20 @@
 #include "Utilities/MakeWithValue.hpp"
 
 namespace gr {
+namespace {
+// Evaluate the whole sum in one expression so it takes a single pass over
+// the points.
+template <typename DataType, size_t SpatialDim, typename Frame, size_t... Is>
+void lapse_impl(const gsl::not_null<Scalar<DataType>*> lapse,
+                const tnsr::I<DataType, SpatialDim, Frame>& shift,
+                const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
+                std::index_sequence<Is...> /*meta*/) {
+  get(*lapse) =
+      sqrt((-get<0, 0>(spacetime_metric) + ... +
+            (shift.get(Is) * spacetime_metric.get(Is + 1, 0))));
+}
+}  // namespace
+
 template <typename DataType, size_t SpatialDim, typename Frame>
 Scalar<DataType> lapse(
     const tnsr::I<DataType, SpatialDim, Frame>& shift,
@@ -26,11 +42,8 @@ template <typename DataType, size_t SpatialDim, typename Frame>
 void lapse(const gsl::not_null<Scalar<DataType>*> lapse,
            const tnsr::I<DataType, SpatialDim, Frame>& shift,
            const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric) {
-  get(*lapse) = -get<0, 0>(spacetime_metric);
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    get(*lapse) += shift.get(i) * spacetime_metric.get(i + 1, 0);
-  }
-  get(*lapse) = sqrt(get(*lapse));
+  lapse_impl(lapse, shift, spacetime_metric,
+             std::make_index_sequence<SpatialDim>{});
 }
 }  // namespace gr
 
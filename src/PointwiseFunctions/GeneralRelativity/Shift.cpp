@@ -4,6 +4,8 @@
 #include "PointwiseFunctions/GeneralRelativity/Shift.hpp"
 
 #include <cmath>
+#include <cstddef>
+#include <utility>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -13,6 +15,22 @@
 #include "Utilities/MakeWithValue.hpp"
 
 namespace gr {
+namespace {
+// Evaluate each contraction in one expression so every component takes a
+// single pass over the points.
+template <typename DataType, size_t SpatialDim, typename Frame, size_t... Js>
+void shift_impl(
+    const gsl::not_null<tnsr::I<DataType, SpatialDim, Frame>*> shift,
+    const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
+    const tnsr::II<DataType, SpatialDim, Frame>& inverse_spatial_metric,
+    std::index_sequence<Js...> /*meta*/) {
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    shift->get(i) = (... + (inverse_spatial_metric.get(i, Js) *
+                            spacetime_metric.get(Js + 1, 0)));
+  }
+}
+}  // namespace
+
 template <typename DataType, size_t SpatialDim, typename Frame>
 tnsr::I<DataType, SpatialDim, Frame> shift(
     const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
@@ -28,14 +46,8 @@ void shift(
     const gsl::not_null<tnsr::I<DataType, SpatialDim, Frame>*> shift,
     const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
     const tnsr::II<DataType, SpatialDim, Frame>& inverse_spatial_metric) {
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    shift->get(i) =
-        inverse_spatial_metric.get(i, 0) * get<1, 0>(spacetime_metric);
-    for (size_t j = 1; j < SpatialDim; ++j) {
-      shift->get(i) +=
-          inverse_spatial_metric.get(i, j) * spacetime_metric.get(j + 1, 0);
-    }
-  }
+  shift_impl(shift, spacetime_metric, inverse_spatial_metric,
+             std::make_index_sequence<SpatialDim>{});
 }
 }  // namespace gr
 
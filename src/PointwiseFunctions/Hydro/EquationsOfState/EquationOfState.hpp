@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
 #include "Utilities/CallWithDynamicType.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -720,6 +721,28 @@ class EquationOfState<IsRelativistic, 3> : public PUP::able {
       const Scalar<DataVector>& /*electron_fraction*/) const = 0;
   /// @}
 
+  /*!
+   * Computes the pressure \f$p\f$ and the specific internal energy
+   * \f$\epsilon\f$ from the rest mass density \f$\rho\f$, the temperature
+   * \f$T\f$, and electron fraction \f$Y_e\f$ in one call.
+   *
+   * The default calls the two separate functions. Tabulated equations of
+   * state override this to convert the inputs to table coordinates and compute
+   * the interpolation weights only once.
+   */
+  virtual void pressure_and_energy_from_density_and_temperature(
+      const gsl::not_null<Scalar<DataVector>*> pressure,
+      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& temperature,
+      const Scalar<DataVector>& electron_fraction) const {
+    *specific_internal_energy =
+        specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction);
+    *pressure = pressure_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction);
+  }
+
   /// The lower bound of the electron fraction that is valid for this EOS
   virtual double electron_fraction_lower_bound() const = 0;
 
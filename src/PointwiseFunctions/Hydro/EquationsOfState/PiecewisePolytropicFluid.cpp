@@ -31,6 +31,17 @@ void choose_polytropic_properties(
     *polytropic_exponent = hi_exponent;
   }
 }
+
+// The specific internal energy in the high-density region is offset by this
+// coefficient times (hi_exponent - lo_exponent). It is independent of the
+// primitives, so we evaluate it once and not at every point.
+double eint_offset_coefficient(const double transition_density,
+                               const double lo_constant,
+                               const double lo_exponent,
+                               const double hi_exponent) {
+  return lo_constant * pow(transition_density, lo_exponent - 1.0) /
+         ((hi_exponent - 1.0) * (lo_exponent - 1.0));
+}
 }  // namespace
 
 namespace EquationsOfState {
@@ -155,6 +166,10 @@ PiecewisePolytropicFluid<true>::rest_mass_density_from_enthalpy_impl(
   const double transition_spec_enthalpy =
       1.0 + transition_spec_eint_ + transition_pressure_ / transition_density_;
 
+  const double spec_eint_offset_coefficient = eint_offset_coefficient(
+      transition_density_, polytropic_constant_lo_, polytropic_exponent_lo_,
+      polytropic_exponent_hi_);
+
   double polytropic_constant = std::numeric_limits<double>::signaling_NaN();
   double polytropic_exponent = std::numeric_limits<double>::signaling_NaN();
 
@@ -173,11 +188,8 @@ PiecewisePolytropicFluid<true>::rest_mass_density_from_enthalpy_impl(
         pow(((polytropic_exponent - 1.0) /
              (polytropic_constant * polytropic_exponent)) *
                 (spec_enthalpy - 1.0 -
-                 (polytropic_exponent - polytropic_exponent_lo_) /
-                     ((polytropic_exponent_hi_ - 1.0) *
-                      (polytropic_exponent_lo_ - 1.0)) *
-                     polytropic_constant_lo_ *
-                     pow(transition_density_, polytropic_exponent_lo_ - 1.0)),
+                 (polytropic_exponent - polytropic_exponent_lo_) *
+                     spec_eint_offset_coefficient),
             1.0 / (polytropic_exponent - 1.0));
   }
   return result;
@@ -192,6 +204,10 @@ PiecewisePolytropicFluid<false>::rest_mass_density_from_enthalpy_impl(
   const double transition_spec_enthalpy =
       transition_spec_eint_ + transition_pressure_ / transition_density_;
 
+  const double spec_eint_offset_coefficient = eint_offset_coefficient(
+      transition_density_, polytropic_constant_lo_, polytropic_exponent_lo_,
+      polytropic_exponent_hi_);
+
   double polytropic_constant = std::numeric_limits<double>::signaling_NaN();
   double polytropic_exponent = std::numeric_limits<double>::signaling_NaN();
 
@@ -210,11 +226,8 @@ PiecewisePolytropicFluid<false>::rest_mass_density_from_enthalpy_impl(
         pow(((polytropic_exponent - 1.0) /
              (polytropic_constant * polytropic_exponent)) *
                 (spec_enthalpy -
-                 (polytropic_exponent - polytropic_exponent_lo_) /
-                     ((polytropic_exponent_hi_ - 1.0) *
-                      (polytropic_exponent_lo_ - 1.0)) *
-                     polytropic_constant_lo_ *
-                     pow(transition_density_, polytropic_exponent_lo_ - 1.0)),
+                 (polytropic_exponent - polytropic_exponent_lo_) *
+                     spec_eint_offset_coefficient),
             1.0 / (polytropic_exponent - 1.0));
   }
   return result;
@@ -225,6 +238,10 @@ template <class DataType>
 Scalar<DataType> PiecewisePolytropicFluid<IsRelativistic>::
     specific_internal_energy_from_density_impl(
         const Scalar<DataType>& rest_mass_density) const {
+  const double spec_eint_offset_coefficient = eint_offset_coefficient(
+      transition_density_, polytropic_constant_lo_, polytropic_exponent_lo_,
+      polytropic_exponent_hi_);
+
   double polytropic_constant = std::numeric_limits<double>::signaling_NaN();
   double polytropic_exponent = std::numeric_limits<double>::signaling_NaN();
 
@@ -241,11 +258,8 @@ Scalar<DataType> PiecewisePolytropicFluid<IsRelativistic>::
     get_element(get(result), i) =
         polytropic_constant / (polytropic_exponent - 1.0) *
             pow(density, polytropic_exponent - 1.0) +
-        (polytropic_exponent - polytropic_exponent_lo_) /
-            ((polytropic_exponent_hi_ - 1.0) *
-             (polytropic_exponent_lo_ - 1.0)) *
-            polytropic_constant_lo_ *
-            pow(transition_density_, (polytropic_exponent_lo_ - 1.0));
+        (polytropic_exponent - polytropic_exponent_lo_) *
+            spec_eint_offset_coefficient;
   }
   return result;
 }
@@ -3,7 +3,9 @@
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/Spectral.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <memory>
 
 #include "DataStructures/DataVector.hpp"
@@ -12,6 +14,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/Barotropic2D.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/Barotropic3D.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/MakeWithValue.hpp"
 
 namespace {
@@ -70,6 +73,15 @@ Spectral::Spectral(const double reference_density,
            exp(-xm) * pressure_from_log_density(xm));
     }
   }
+  // Tabulate the specific enthalpy at the same points. It increases
+  // monotonically with the density, so the table brackets the root when
+  // inverting h(rho), and provides the enthalpies at the reference and
+  // upper densities.
+  table_of_specific_enthalpies_.resize(n_points_epsilon);
+  for (size_t i = 0; i < n_points_epsilon; i++) {
+    table_of_specific_enthalpies_[i] =
+        specific_enthalpy_from_density(tabulated_density(i));
+  }
 }
 
 EQUATION_OF_STATE_MEMBER_DEFINITIONS(, Spectral, double, 1)
@@ -117,6 +129,7 @@ void Spectral::pup(PUP::er& p) {
   p | quadrature_weights_;
   p | quadrature_points_;
   p | table_of_specific_energies_;
+  p | table_of_specific_enthalpies_;
 }
 
 // this evaluates the power series
@@ -262,6 +275,17 @@ double Spectral::pressure_from_log_density(const double x) const {
   return reference_pressure_ * exp(integral_of_gamma_of_x);
 }
 
+double Spectral::tabulated_density(const size_t table_index) const {
+  const size_t n_points_epsilon = table_of_specific_energies_.size();
+  const double delta_x = x_max_ / (n_points_epsilon - 1.0);
+  // Use x_max_ for the last point so the upper density is exactly
+  // reference_density_ * exp(x_max_)
+  const double x = table_index + 1 == n_points_epsilon
+                       ? x_max_
+                       : static_cast<double>(table_index) * delta_x;
+  return reference_density_ * exp(x);
+}
+
 double Spectral::pressure_from_density(const double rest_mass_density) const {
   const double x = log(rest_mass_density / reference_density_);
   return pressure_from_log_density(x);
@@ -270,11 +294,8 @@ double Spectral::pressure_from_density(const double rest_mass_density) const {
 // Solve for h(rho)=h0, which requires rootfinding for this EoS
 double Spectral::rest_mass_density_from_enthalpy(
     const double specific_enthalpy) const {
-  const double reference_enthalpy =
-      specific_enthalpy_from_density(reference_density_);
-  const double upper_density = reference_density_ * exp(x_max_);
-  const double enthalpy_of_x_max_ =
-      specific_enthalpy_from_density(upper_density);
+  const double reference_enthalpy = table_of_specific_enthalpies_.front();
+  const double enthalpy_of_x_max_ = table_of_specific_enthalpies_.back();
   if (specific_enthalpy <= reference_enthalpy) {
     double rest_mass_density =
         (specific_enthalpy - 1.0) * (gamma_coefficients_[0] - 1.0) /
@@ -291,6 +312,7 @@ double Spectral::rest_mass_density_from_enthalpy(
     const size_t n_points_epsilon = table_of_specific_energies_.size();
     const double specific_internal_energy_of_x_max_ =
         table_of_specific_energies_[n_points_epsilon - 1];
+    const double upper_density = tabulated_density(n_points_epsilon - 1);
     const double pressure_of_x_max_ = pressure_from_log_density(x_max_);
     double x_target =
         ((specific_enthalpy - 1.0 - specific_internal_energy_of_x_max_) *
@@ -301,12 +323,26 @@ double Spectral::rest_mass_density_from_enthalpy(
     return reference_density_ * exp(x_target);
   } else {
     // Root-finding appropriate between reference density and maximum density
-    // We can use x=0 and x=x_max as bounds
+    // We can bracket the root between two neighboring points of the enthalpy
+    // table and reuse the tabulated enthalpies as the function values at the
+    // bounds
     const auto f = [this, &specific_enthalpy](const double density) {
       return this->specific_enthalpy_from_density(density) - specific_enthalpy;
     };
+    const auto upper_index = static_cast<size_t>(std::distance(
+        table_of_specific_enthalpies_.begin(),
+        std::upper_bound(table_of_specific_enthalpies_.begin(),
+                         table_of_specific_enthalpies_.end(),
+                         specific_enthalpy)));
+    ASSERT(upper_index > 0 and
+               upper_index < table_of_specific_enthalpies_.size(),
+           "The specific enthalpy " << specific_enthalpy
+                                    << " is not within the tabulated range.");
     const auto root_from_lambda = RootFinder::toms748(
-        f, reference_density_, upper_density, 1.0e-14, 1.0e-15);
+        f, tabulated_density(upper_index - 1), tabulated_density(upper_index),
+        table_of_specific_enthalpies_[upper_index - 1] - specific_enthalpy,
+        table_of_specific_enthalpies_[upper_index] - specific_enthalpy,
+        1.0e-14, 1.0e-15);
     return root_from_lambda;
   }
 }
@@ -160,6 +160,7 @@ class Spectral : public EquationOfState<true, 1> {
   double specific_enthalpy_from_density(const double density) const;
   double pressure_from_density(const double density) const;
   double pressure_from_log_density(const double x) const;
+  double tabulated_density(size_t table_index) const;
   double rest_mass_density_from_enthalpy(const double specific_enthalpy) const;
 
   double reference_density_ = std::numeric_limits<double>::signaling_NaN();
@@ -171,6 +172,7 @@ class Spectral : public EquationOfState<true, 1> {
   double integral_of_gamma_of_x_max_ =
       std::numeric_limits<double>::signaling_NaN();
   std::vector<double> table_of_specific_energies_{};
+  std::vector<double> table_of_specific_enthalpies_{};
   // Information for Gaussian quadrature
   size_t number_of_quadrature_coefs_ =
       std::numeric_limits<size_t>::signaling_NaN();
@@ -3,7 +3,11 @@
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 
+#include <array>
 #include <limits>
+#include <memory>
+#include <string>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -128,27 +132,19 @@ void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos) {
 
   std::vector<double> table_data(size * NumberOfVars);
 
-  // Need to setup index variables
+  // STEP 1: Determine the energy shift from the specific internal energy
 
-  auto pressure = spectre_eos.read_quantity("pressure");
-  auto eps = spectre_eos.read_quantity("specific internal energy");
-  auto cs2 = spectre_eos.read_quantity("sound speed squared");
-
-  auto mu_l = spectre_eos.read_quantity("lepton chemical potential");
-  //  WILL BE NEEDED FOR FUTURE PR
-  //  auto mu_q = spectre_eos.read_quantity("charge chemical potential");
-  //  auto mu_b = spectre_eos.read_quantity("baryon chemical potential");
-
-  double enthalpy_minimum = 1.e99;
   double eps_min = 1.e99;
-
-  for (size_t s = 0; s < size; ++s) {
-    eps_min = std::min(eps_min, eps[s]);
+  {
+    const auto eps = spectre_eos.read_quantity("specific internal energy");
+    for (size_t s = 0; s < size; ++s) {
+      eps_min = std::min(eps_min, eps[s]);
+    }
   }
 
   double energy_shift = (eps_min < 0) ? 2. * eps_min : 0.;
 
-  // STEP 3: Fun with indices
+  // STEP 2: Fun with indices
 
   // nb is in units of 1/fm^3
   // convert to geometrical units
@@ -162,33 +158,62 @@ void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos) {
     log_density_i += std::log(nb_fm3_to_geom);
   }
 
-  // Convert table
-  for (size_t iR = 0; iR < log_density.size(); ++iR) {
-    for (size_t iT = 0; iT < log_temperature.size(); ++iT) {
-      for (size_t iY = 0; iY < electron_fraction.size(); ++iY) {
-        // Index spectre table
-        // Ye varies fastest
-        size_t index_spectre =
-            iY + electron_fraction.size() * (iR + log_density.size() * iT);
-        // Local index
-        // T varies fastest
-        size_t index_tab3D =
-            iT + log_temperature.size() * (iR + log_density.size() * iY);
-
-        constexpr double press_MeV_to_geom =
-            1.0 / hydro::units::nuclear::pressure_unit;
-
-        double* table_point = &(table_data[index_tab3D * NumberOfVars]);
-
-        table_point[Pressure] =
-            std::log(press_MeV_to_geom * pressure[index_spectre]);
-        table_point[Epsilon] = std::log(eps[index_spectre] - energy_shift);
-        table_point[CsSquared] = cs2[index_spectre];
-        table_point[DeltaMu] = mu_l[index_spectre];
-
-        // Determine specific enthalpy minimum
-        double h = 1. + table_point[Epsilon] +
-                   table_point[Pressure] / std::exp(log_density[iR]);
+  // STEP 3: Convert table
+  // Read one quantity at a time and write it into the interpolator layout
+  // right away, so only one quantity of the file is held in memory in
+  // addition to the final table.
+  const auto convert_quantity = [&table_data, &electron_fraction,
+                                 &log_density, &log_temperature,
+                                 &spectre_eos](const std::string& name,
+                                               const size_t var_index,
+                                               const auto& convert) {
+    const auto quantity = spectre_eos.read_quantity(name);
+    for (size_t iR = 0; iR < log_density.size(); ++iR) {
+      for (size_t iT = 0; iT < log_temperature.size(); ++iT) {
+        for (size_t iY = 0; iY < electron_fraction.size(); ++iY) {
+          // Index spectre table
+          // Ye varies fastest
+          const size_t index_spectre =
+              iY + electron_fraction.size() * (iR + log_density.size() * iT);
+          // Local index
+          // T varies fastest
+          const size_t index_tab3D =
+              iT + log_temperature.size() * (iR + log_density.size() * iY);
+          table_data[index_tab3D * NumberOfVars + var_index] =
+              convert(quantity[index_spectre]);
+        }
+      }
+    }
+  };
+
+  constexpr double press_MeV_to_geom =
+      1.0 / hydro::units::nuclear::pressure_unit;
+  convert_quantity("pressure", Pressure, [](const double pressure) {
+    return std::log(press_MeV_to_geom * pressure);
+  });
+  convert_quantity("specific internal energy", Epsilon,
+                   [&energy_shift](const double eps) {
+                     return std::log(eps - energy_shift);
+                   });
+  convert_quantity("sound speed squared", CsSquared,
+                   [](const double cs2) { return cs2; });
+  convert_quantity("lepton chemical potential", DeltaMu,
+                   [](const double mu_l) { return mu_l; });
+  //  WILL BE NEEDED FOR FUTURE PR
+  //  "charge chemical potential"
+  //  "baryon chemical potential"
+
+  // Determine specific enthalpy minimum
+  double enthalpy_minimum = 1.e99;
+  for (size_t iY = 0; iY < electron_fraction.size(); ++iY) {
+    for (size_t iR = 0; iR < log_density.size(); ++iR) {
+      for (size_t iT = 0; iT < log_temperature.size(); ++iT) {
+        const double* table_point =
+            &(table_data[(iT + log_temperature.size() *
+                                   (iR + log_density.size() * iY)) *
+                         NumberOfVars]);
+        const double h = 1. + table_point[Epsilon] +
+                         table_point[Pressure] / std::exp(log_density[iR]);
         enthalpy_minimum = std::min(enthalpy_minimum, h);
       }
     }
@@ -208,11 +233,49 @@ void Tabulated3D<IsRelativistic>::initialize(
   table_electron_fraction_ = std::move(electron_fraction);
   table_log_density_ = std::move(log_density);
   table_log_temperature_ = std::move(log_temperature);
-  table_data_ = std::move(table_data);
+  table_data_ =
+      std::make_shared<const std::vector<double>>(std::move(table_data));
 
   initialize_interpolator();
 }
 
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(const Tabulated3D& rhs)
+    : EquationOfState<IsRelativistic, 3>(rhs),
+      energy_shift_(rhs.energy_shift_),
+      enthalpy_minimum_(rhs.enthalpy_minimum_),
+      table_electron_fraction_(rhs.table_electron_fraction_),
+      table_log_density_(rhs.table_log_density_),
+      table_log_temperature_(rhs.table_log_temperature_),
+      table_data_(rhs.table_data_) {
+  // The interpolator holds views of the tables, so it must point to the
+  // coordinates of this object.
+  if (table_data_ != nullptr) {
+    initialize_interpolator();
+  }
+}
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>& Tabulated3D<IsRelativistic>::operator=(
+    const Tabulated3D& rhs) {
+  if (this == &rhs) {
+    return *this;
+  }
+  EquationOfState<IsRelativistic, 3>::operator=(rhs);
+  energy_shift_ = rhs.energy_shift_;
+  enthalpy_minimum_ = rhs.enthalpy_minimum_;
+  table_electron_fraction_ = rhs.table_electron_fraction_;
+  table_log_density_ = rhs.table_log_density_;
+  table_log_temperature_ = rhs.table_log_temperature_;
+  table_data_ = rhs.table_data_;
+  if (table_data_ != nullptr) {
+    initialize_interpolator();
+  } else {
+    interpolator_ = {};
+  }
+  return *this;
+}
+
 template <bool IsRelativistic>
 void Tabulated3D<IsRelativistic>::initialize_interpolator() {
   Index<3> num_x_points;
@@ -234,7 +297,7 @@ void Tabulated3D<IsRelativistic>::initialize_interpolator() {
       gsl::span<double const>{table_electron_fraction_.data(), num_x_points[2]};
 
   interpolator_ = intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars>(
-      independent_data_view, {table_data_.data(), table_data_.size()},
+      independent_data_view, {table_data_->data(), table_data_->size()},
       num_x_points);
 }
 
@@ -255,7 +318,9 @@ bool Tabulated3D<IsRelativistic>::operator==(
   result &= (rhs.table_electron_fraction_ == this->table_electron_fraction_);
   result &= (rhs.table_log_density_ == this->table_log_density_);
   result &= (rhs.table_log_temperature_ == this->table_log_temperature_);
-  result &= (rhs.table_data_ == this->table_data_);
+  result &= (rhs.table_data_ == this->table_data_ or
+             (rhs.table_data_ != nullptr and this->table_data_ != nullptr and
+              *rhs.table_data_ == *this->table_data_));
 
   return result;
 }
@@ -304,6 +369,31 @@ void Tabulated3D<IsRelativistic>::enforce_physicality(
   }
 }
 
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::
+    pressure_and_energy_from_density_and_temperature(
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+        const Scalar<DataVector>& rest_mass_density,
+        const Scalar<DataVector>& temperature,
+        const Scalar<DataVector>& electron_fraction) const {
+  Scalar<DataVector> converted_electron_fraction;
+  Scalar<DataVector> log_rest_mass_density;
+  Scalar<DataVector> log_temperature;
+
+  convert_to_table_quantities(
+      make_not_null(&converted_electron_fraction),
+      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+      electron_fraction, rest_mass_density, temperature);
+
+  std::array<DataVector, 2> interpolated_state{};
+  interpolator_.template interpolate<Pressure, Epsilon>(
+      make_not_null(&interpolated_state), get(log_temperature),
+      get(log_rest_mass_density), get(converted_electron_fraction));
+  get(*pressure) = exp(interpolated_state[0]);
+  get(*specific_internal_energy) = exp(interpolated_state[1]) + energy_shift_;
+}
+
 template <bool IsRelativistic>
 template <class DataType>
 Scalar<DataType>
@@ -346,14 +436,11 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
     get(pressure) = std::exp(interpolated_state[0]);
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Pressure>(weights);
-      get(pressure)[s] = std::exp(interpolated_state[0]);
-    }
+    std::array<DataVector, 1> interpolated_state{};
+    interpolator_.template interpolate<Pressure>(
+        make_not_null(&interpolated_state), get(log_temperature),
+        get(log_rest_mass_density), get(converted_electron_fraction));
+    get(pressure) = exp(interpolated_state[0]);
   }
 
   return pressure;
@@ -367,10 +454,17 @@ void Tabulated3D<IsRelativistic>::pup(PUP::er& p) {
   p | table_electron_fraction_;
   p | table_log_density_;
   p | table_log_temperature_;
-  p | table_data_;
-
+  size_t table_size = table_data_ == nullptr ? 0 : table_data_->size();
+  p | table_size;
   if (p.isUnpacking()) {
+    auto table_data = std::make_shared<std::vector<double>>(table_size);
+    PUParray(p, table_data->data(), table_size);
+    table_data_ = std::move(table_data);
     initialize_interpolator();
+  } else if (table_size > 0) {
+    // Packing and sizing only read the data
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    PUParray(p, const_cast<double*>(table_data_->data()), table_size);
   }
 }
 
@@ -525,15 +619,11 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(specific_internal_energy) =
         std::exp(interpolated_state[0]) + energy_shift_;
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Epsilon>(weights);
-      get(specific_internal_energy)[s] =
-          std::exp(interpolated_state[0]) + energy_shift_;
-    }
+    std::array<DataVector, 1> interpolated_state{};
+    interpolator_.template interpolate<Epsilon>(
+        make_not_null(&interpolated_state), get(log_temperature),
+        get(log_rest_mass_density), get(converted_electron_fraction));
+    get(specific_internal_energy) = exp(interpolated_state[0]) + energy_shift_;
   }
 
   return specific_internal_energy;
@@ -567,14 +657,11 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(cs2) = interpolated_state[0];
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<CsSquared>(weights);
-      get(cs2)[s] = interpolated_state[0];
-    }
+    std::array<DataVector, 1> interpolated_state{};
+    interpolator_.template interpolate<CsSquared>(
+        make_not_null(&interpolated_state), get(log_temperature),
+        get(log_rest_mass_density), get(converted_electron_fraction));
+    get(cs2) = std::move(interpolated_state[0]);
   }
 
   return cs2;
@@ -11,6 +11,7 @@
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/tuple/to_list.hpp>
 #include <limits>
+#include <memory>
 #include <pup.h>
 
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -21,6 +22,7 @@
 #include "Options/String.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -72,8 +74,9 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   enum : size_t { Epsilon = 0, Pressure, CsSquared, DeltaMu, NumberOfVars };
 
   Tabulated3D() = default;
-  Tabulated3D(const Tabulated3D&) = default;
-  Tabulated3D& operator=(const Tabulated3D&) = default;
+  /// Copies share the (immutable) table data.
+  Tabulated3D(const Tabulated3D& rhs);
+  Tabulated3D& operator=(const Tabulated3D& rhs);
   Tabulated3D(Tabulated3D&&) = default;
   Tabulated3D& operator=(Tabulated3D&&) = default;
   ~Tabulated3D() override = default;
@@ -91,6 +94,15 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
 
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(Tabulated3D, 3)
 
+  /// Interpolates the pressure and the specific internal energy with shared
+  /// interpolation weights.
+  void pressure_and_energy_from_density_and_temperature(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& temperature,
+      const Scalar<DataVector>& electron_fraction) const override;
+
   template <class DataType>
   void convert_to_table_quantities(
       const gsl::not_null<Scalar<DataType>*> converted_electron_fraction,
@@ -245,8 +257,10 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   std::vector<double> table_log_density_{};
   /// Logarithmic temperature
   std::vector<double> table_log_temperature_{};
-  /// Tabulate data. Entries are stated in the enum
-  std::vector<double> table_data_{};
+  /// Tabulate data. Entries are stated in the enum. The table is never
+  /// modified after construction, so it is shared by all copies (e.g. the
+  /// clones held by initial data and the DataBox) instead of duplicated.
+  std::shared_ptr<const std::vector<double>> table_data_{};
 
   /// Tolerance on upper bound for root finding
   static constexpr double upper_bound_tolerance_ = 0.9999;
@@ -701,10 +701,16 @@ class History
   // onto the last value if it gets discarded.
   std::optional<Vars> latest_value_if_discarded_{};
 
-  // Memory allocations available for reuse.
-  boost::container::static_vector<Vars, max_size() + history_max_substeps>
+  // Memory allocations available for reuse.  A step of any of the
+  // time steppers discards at most one step and all its substeps
+  // before inserting again, so that is all that is kept in steady
+  // state.  Allocations beyond that, e.g., from clearing a
+  // self-start history or lowering the integration order, are freed
+  // instead of being held for the lifetime of the element.
+  static constexpr size_t max_cached_allocations = history_max_substeps + 1;
+  boost::container::static_vector<Vars, max_cached_allocations>
       vars_allocation_cache_{};
-  boost::container::static_vector<DerivVars, max_size() + history_max_substeps>
+  boost::container::static_vector<DerivVars, max_cached_allocations>
       deriv_vars_allocation_cache_{};
 };
 
@@ -922,7 +928,8 @@ void History<Vars>::discard_value(
     return;
   }
   // If caching doesn't save anything, don't allocate memory for the cache.
-  if (contains_allocations(**value)) {
+  if (contains_allocations(**value) and
+      vars_allocation_cache_.size() < max_cached_allocations) {
     vars_allocation_cache_.emplace_back(std::move(**value));
   }
   value->reset();
@@ -934,7 +941,8 @@ void History<Vars>::cache_allocations(
     const gsl::not_null<StepRecord<Vars>*> record) {
   discard_value(&record->value);
   // If caching doesn't save anything, don't allocate memory for the cache.
-  if (contains_allocations(record->derivative)) {
+  if (contains_allocations(record->derivative) and
+      deriv_vars_allocation_cache_.size() < max_cached_allocations) {
     deriv_vars_allocation_cache_.emplace_back(std::move(record->derivative));
   }
 }
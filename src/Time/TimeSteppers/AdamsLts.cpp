@@ -4,10 +4,16 @@
 #include "Time/TimeSteppers/AdamsLts.hpp"
 
 #include <algorithm>
+#include <array>
+#include <boost/container/small_vector.hpp>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/MathWrapper.hpp"
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
@@ -301,19 +307,13 @@ LtsCoefficients lts_coefficients_for_gts(
   }
   return lts_coefficients;
 }
-}  // namespace
 
 template <typename TimeType>
-LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
-                                 const ConstBoundaryHistoryTimes& remote_times,
-                                 const Time& start_time,
-                                 const TimeType& end_time,
-                                 const AdamsScheme& local_scheme,
-                                 const AdamsScheme& remote_scheme,
-                                 const AdamsScheme& small_step_scheme) {
-  if (start_time == end_time) {
-    return {};
-  }
+LtsCoefficients lts_coefficients_impl(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const TimeType& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
   const evolution_less<Time> time_less{local_times.front().time_runs_forward()};
 
   LtsCoefficients step_coefficients{};
@@ -422,6 +422,174 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
   return step_coefficients;
 }
 
+// The coefficients for a step only depend on the times in the
+// histories relative to the step, and are proportional to the step
+// size.  When neighbors keep a fixed step ratio the same pattern of
+// times repeats every few steps, so we cache the coefficients of
+// recent patterns in units of the step size.
+//
+// The times in a pattern are stored as their offset from the start
+// of the step in units of the step size, as multiples of
+// 1/pattern_denominator, which is divisible by every possible step
+// ratio up to 16.  Patterns that cannot be represented exactly this
+// way are not cached.
+constexpr double pattern_denominator = 720720.0;
+constexpr size_t maximum_cached_patterns = 64;
+
+struct StepPattern {
+  bool time_runs_forward{};
+  std::array<AdamsScheme, 3> schemes{};
+  // For each side: for each step the number of substeps followed by
+  // the offset of each substep and the slab number relative to the
+  // first local step.
+  boost::container::small_vector<int64_t, 64> local{};
+  boost::container::small_vector<int64_t, 64> remote{};
+
+  friend bool operator==(const StepPattern& a, const StepPattern& b) {
+    return a.time_runs_forward == b.time_runs_forward and
+           a.schemes == b.schemes and a.local == b.local and
+           a.remote == b.remote;
+  }
+};
+
+struct PatternCoefficient {
+  std::pair<size_t, size_t> local_entry{};
+  std::pair<size_t, size_t> remote_entry{};
+  double coefficient_per_step_size{};
+};
+
+struct CachedPattern {
+  StepPattern pattern{};
+  boost::container::small_vector<PatternCoefficient,
+                                 lts_coefficients_static_size>
+      coefficients{};
+};
+
+struct PatternCache {
+  std::vector<CachedPattern> patterns{};
+  // The next entry to overwrite once the cache is full
+  size_t next_replaced = 0;
+};
+
+PatternCache& pattern_cache() {
+  thread_local PatternCache cache{};
+  return cache;
+}
+
+bool append_pattern(
+    const gsl::not_null<boost::container::small_vector<int64_t, 64>*> result,
+    const ConstBoundaryHistoryTimes& times, const double start,
+    const double step_size, const int64_t first_slab) {
+  for (size_t step = 0; step < times.size(); ++step) {
+    if (times[step].slab_number() < 0) {
+      // Times are not ordered during self-start.
+      return false;
+    }
+    result->push_back(static_cast<int64_t>(times.number_of_substeps(step)));
+    result->push_back(times[step].slab_number() - first_slab);
+    for (size_t substep = 0; substep < times.number_of_substeps(step);
+         ++substep) {
+      const double offset =
+          (exact_substep_time(times[{step, substep}]).value() - start) /
+          step_size * pattern_denominator;
+      const double rounded_offset = std::round(offset);
+      if (std::abs(offset - rounded_offset) > 1.0e-3 or
+          std::abs(rounded_offset) > 1.0e15) {
+        return false;
+      }
+      result->push_back(static_cast<int64_t>(rounded_offset));
+    }
+  }
+  return true;
+}
+
+std::optional<StepPattern> step_pattern(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const Time& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
+  StepPattern pattern{local_times.front().time_runs_forward(),
+                      {{local_scheme, remote_scheme, small_step_scheme}}};
+  const double start = start_time.value();
+  const double step_size = end_time.value() - start;
+  const int64_t first_slab = local_times.front().slab_number();
+  if (not append_pattern(make_not_null(&pattern.local), local_times, start,
+                         step_size, first_slab) or
+      not append_pattern(make_not_null(&pattern.remote), remote_times, start,
+                         step_size, first_slab)) {
+    return std::nullopt;
+  }
+  return pattern;
+}
+
+std::pair<size_t, size_t> entry_index(const ConstBoundaryHistoryTimes& times,
+                                      const TimeStepId& id) {
+  for (size_t step = 0; step < times.size(); ++step) {
+    for (size_t substep = 0; substep < times.number_of_substeps(step);
+         ++substep) {
+      if (times[{step, substep}] == id) {
+        return {step, substep};
+      }
+    }
+  }
+  ERROR("Id " << id << " not present in the history.");
+}
+}  // namespace
+
+template <typename TimeType>
+LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
+                                 const ConstBoundaryHistoryTimes& remote_times,
+                                 const Time& start_time,
+                                 const TimeType& end_time,
+                                 const AdamsScheme& local_scheme,
+                                 const AdamsScheme& remote_scheme,
+                                 const AdamsScheme& small_step_scheme) {
+  if (start_time == end_time) {
+    return {};
+  }
+  if constexpr (std::is_same_v<TimeType, Time>) {
+    std::optional<StepPattern> pattern =
+        step_pattern(local_times, remote_times, start_time, end_time,
+                     local_scheme, remote_scheme, small_step_scheme);
+    if (pattern.has_value()) {
+      const double step_size = (end_time - start_time).value();
+      auto& cache = pattern_cache();
+      for (const auto& cached : cache.patterns) {
+        if (cached.pattern == *pattern) {
+          LtsCoefficients result{};
+          for (const auto& term : cached.coefficients) {
+            result.emplace_back(local_times[term.local_entry],
+                                remote_times[term.remote_entry],
+                                term.coefficient_per_step_size * step_size);
+          }
+          return result;
+        }
+      }
+
+      LtsCoefficients result = lts_coefficients_impl(
+          local_times, remote_times, start_time, end_time, local_scheme,
+          remote_scheme, small_step_scheme);
+      CachedPattern new_entry{std::move(*pattern), {}};
+      for (const auto& term : result) {
+        new_entry.coefficients.push_back(
+            {entry_index(local_times, get<0>(term)),
+             entry_index(remote_times, get<1>(term)),
+             get<2>(term) / step_size});
+      }
+      if (cache.patterns.size() < maximum_cached_patterns) {
+        cache.patterns.push_back(std::move(new_entry));
+      } else {
+        cache.patterns[cache.next_replaced] = std::move(new_entry);
+        cache.next_replaced =
+            (cache.next_replaced + 1) % maximum_cached_patterns;
+      }
+      return result;
+    }
+  }
+  return lts_coefficients_impl(local_times, remote_times, start_time, end_time,
+                               local_scheme, remote_scheme, small_step_scheme);
+}
+
 #define MATH_WRAPPER_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                          \
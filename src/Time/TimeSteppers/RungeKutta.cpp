@@ -4,8 +4,16 @@
 #include "Time/TimeSteppers/RungeKutta.hpp"
 
 #include <algorithm>
+#include <array>
+#include <boost/container/small_vector.hpp>
+#include <complex>
+#include <cstddef>
 #include <optional>
+#include <type_traits>
+#include <vector>
 
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/History.hpp"
 #include "Time/LargestStepperError.hpp"
@@ -66,39 +74,129 @@ TimeStepId RungeKutta::next_time_id_for_error(
 }
 
 namespace {
+// The coefficients of the derivatives in the history for a step or
+// substep, and optionally of the error estimate.
 template <typename T>
-void compute_substep(const gsl::not_null<T*> u,
-                     const ConstUntypedHistory<T>& history, const double dt,
-                     const std::vector<double>& substep_coefficients) {
-  *u = *history.back().value;
-  if (substep_coefficients[0] != 0.0) {
-    *u += substep_coefficients[0] * dt * history.back().derivative;
-  }
-  for (size_t i = 1; i < substep_coefficients.size(); ++i) {
+struct UpdateTerms {
+  static constexpr size_t max_terms = history_max_substeps + 1;
+  boost::container::small_vector<const T*, max_terms> derivatives{};
+  boost::container::small_vector<double, max_terms> coefficients{};
+  boost::container::small_vector<double, max_terms> error_coefficients{};
+};
+
+template <typename T>
+const T& derivative(const ConstUntypedHistory<T>& history, const size_t i) {
+  return i == 0 ? history.back().derivative
+                : history.substeps()[i - 1].derivative;
+}
+
+template <typename T>
+UpdateTerms<T> update_terms(const ConstUntypedHistory<T>& history,
+                            const double dt,
+                            const std::vector<double>& substep_coefficients) {
+  UpdateTerms<T> terms{};
+  for (size_t i = 0; i < substep_coefficients.size(); ++i) {
     if (substep_coefficients[i] != 0.0) {
-      *u += substep_coefficients[i] * dt * history.substeps()[i - 1].derivative;
+      terms.derivatives.push_back(&derivative(history, i));
+      terms.coefficients.push_back(substep_coefficients[i] * dt);
     }
   }
+  return terms;
 }
 
 template <typename T>
-void step_error(const gsl::not_null<T*> u_error,
-                const ConstUntypedHistory<T>& history, const double dt,
-                const RungeKutta::ButcherTableau& tableau) {
+UpdateTerms<T> update_terms_with_error(
+    const ConstUntypedHistory<T>& history, const double dt,
+    const RungeKutta::ButcherTableau& tableau) {
   const auto& coefficients = tableau.result_coefficients;
   const auto& error_coefficients = tableau.error_coefficients;
-
-  *u_error = (coefficients[0] - error_coefficients[0]) * dt *
-             history.back().derivative;
+  UpdateTerms<T> terms{};
   const size_t num_coefficients =
       std::max(coefficients.size(), error_coefficients.size());
-  for (size_t i = 1; i < num_coefficients; ++i) {
-    const double coefficient =
-        (i < coefficients.size() ? coefficients[i] : 0.0) -
+  for (size_t i = 0; i < num_coefficients; ++i) {
+    const double coefficient = i < coefficients.size() ? coefficients[i] : 0.0;
+    const double error_coefficient =
+        coefficient -
         (i < error_coefficients.size() ? error_coefficients[i] : 0.0);
-    if (coefficient != 0.0) {
-      *u_error += coefficient * dt * history.substeps()[i - 1].derivative;
+    if (coefficient != 0.0 or error_coefficient != 0.0) {
+      terms.derivatives.push_back(&derivative(history, i));
+      terms.coefficients.push_back(coefficient * dt);
+      terms.error_coefficients.push_back(error_coefficient * dt);
+    }
+  }
+  return terms;
+}
+
+// Sets `u` to `initial` plus the sum of the `terms`.  If the terms
+// include error coefficients, the largest error relative to the
+// `tolerances` is returned.
+//
+// For vectors, all terms are accumulated one block of points at a
+// time, so the history is only read from memory once.  This is
+// significant for systems with many variables, since the update is
+// memory bound.
+template <typename T>
+double fused_update(const gsl::not_null<T*> u, const T& initial,
+                    const UpdateTerms<T>& terms,
+                    const StepperErrorTolerances* const tolerances) {
+  const bool compute_error = not terms.error_coefficients.empty();
+  ASSERT(not compute_error or tolerances != nullptr,
+         "Must pass tolerances to compute the error.");
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    T error = 0.0;
+    *u = initial;
+    for (size_t j = 0; j < terms.derivatives.size(); ++j) {
+      *u += terms.coefficients[j] * *terms.derivatives[j];
+      if (compute_error) {
+        error += terms.error_coefficients[j] * *terms.derivatives[j];
+      }
+    }
+    return compute_error ? largest_stepper_error(initial, error, *tolerances)
+                         : 0.0;
+  } else {
+    using ElementType = typename T::ElementType;
+    constexpr size_t block_size = 256;
+    const size_t size = initial.size();
+    ASSERT(u->size() == size, "Size of u (" << u->size()
+                                            << ") does not match history ("
+                                            << size << ").");
+    std::array<ElementType, block_size> error{};
+    double largest_error = 0.0;
+    ElementType* const result = u->data();
+    for (size_t block_start = 0; block_start < size;
+         block_start += block_size) {
+      const size_t block_end = std::min(block_start + block_size, size);
+      std::copy(initial.data() + block_start, initial.data() + block_end,
+                result + block_start);
+      if (compute_error) {
+        std::fill(error.begin(), error.end(), ElementType{0.0});
+      }
+      for (size_t j = 0; j < terms.derivatives.size(); ++j) {
+        const ElementType* const term = terms.derivatives[j]->data();
+        const double coefficient = terms.coefficients[j];
+        if (coefficient != 0.0) {
+          for (size_t i = block_start; i < block_end; ++i) {
+            result[i] += coefficient * term[i];
+          }
+        }
+        if (compute_error) {
+          const double error_coefficient = terms.error_coefficients[j];
+          for (size_t i = block_start; i < block_end; ++i) {
+            error[i - block_start] += error_coefficient * term[i];
+          }
+        }
+      }
+      if (compute_error) {
+        for (size_t i = block_start; i < block_end; ++i) {
+          largest_error =
+              std::max(largest_error,
+                       largest_stepper_error(initial[i], error[i - block_start],
+                                             *tolerances));
+        }
+      }
     }
+    return largest_error;
   }
 }
 
@@ -112,9 +210,14 @@ void update_u_impl_with_tableau(const gsl::not_null<T*> u,
 
   const auto substep = history.at_step_start() ? 0 : history.substeps().size();
   if (substep == number_of_substeps - 1) {
-    compute_substep(u, history, dt, tableau.result_coefficients);
+    fused_update(u, *history.back().value,
+                 update_terms(history, dt, tableau.result_coefficients),
+                 nullptr);
   } else if (substep < number_of_substeps - 1) {
-    compute_substep(u, history, dt, tableau.substep_coefficients[substep]);
+    fused_update(
+        u, *history.back().value,
+        update_terms(history, dt, tableau.substep_coefficients[substep]),
+        nullptr);
   } else {
     ERROR("Substep should be less than " << number_of_substeps << ", not "
                                          << substep);
@@ -146,18 +249,19 @@ std::optional<StepperErrorEstimate> RungeKutta::update_u_impl(
   const auto number_of_substeps = number_of_substeps_for_error();
   const size_t substep =
       history.at_step_start() ? 0 : history.substeps().size();
-  std::optional<StepperErrorEstimate> error{};
   if (substep == number_of_substeps - 1 and tolerances.has_value()) {
-    const double dt = time_step.value();
-    step_error(u, history, dt, tableau);
-    error.emplace(StepperErrorEstimate{
-        history.back().time_step_id.step_time(), time_step, order() - 1,
-        largest_stepper_error(*history.back().value, *u, *tolerances)});
+    // Compute the result and the error estimate in a single pass.
+    const double largest_error = fused_update(
+        u, *history.back().value,
+        update_terms_with_error(history, time_step.value(), tableau),
+        &*tolerances);
+    return StepperErrorEstimate{history.back().time_step_id.step_time(),
+                                time_step, order() - 1, largest_error};
   }
 
   update_u_impl_with_tableau(u, history, time_step, tableau,
                              number_of_substeps);
-  return error;
+  return std::nullopt;
 }
 
 template <typename T>
@@ -0,0 +1,22 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/System/MemoryUsage.hpp"
+
+#include <sys/resource.h>
+
+namespace sys {
+double peak_resident_memory_in_megabytes() {
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0.0;
+  }
+#ifdef __APPLE__
+  // macOS reports the maximum resident set size in bytes
+  return static_cast<double>(usage.ru_maxrss) / 1.0e6;
+#else
+  // Linux reports the maximum resident set size in kilobytes
+  return static_cast<double>(usage.ru_maxrss) / 1.0e3;
+#endif
+}
+}  // namespace sys
@@ -0,0 +1,21 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions that query the memory usage of the current process.
+
+#pragma once
+
+namespace sys {
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief The peak resident set size (the high-water mark of the physical
+ * memory used) of the current process in megabytes.
+ *
+ * \details This is the memory the operating system reports for the whole
+ * process, so unlike `size_of_object_in_bytes` it includes allocator overhead
+ * and fragmentation, temporaries, and memory that is not serialized (e.g.
+ * Charm++ message buffers). Returns 0 if the value can't be determined.
+ */
+double peak_resident_memory_in_megabytes();
+}  // namespace sys
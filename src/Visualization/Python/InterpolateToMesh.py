@@ -133,17 +133,13 @@ def interpolate_to_mesh(
             )
 
         # pre-load all tensors to avoid loading the full tensor for each element
-        tensors = [
-            np.array(
-                source_vol.get_tensor_component(obs, name).data, copy=False
-            )
-            for name in tensor_names
-        ]
+        tensors = source_vol.get_tensor_components(obs, tensor_names)
 
         source_file.close_current_object()
 
         volume_data = []
-        # iterate over elements
+        # iterate over elements, which are stored contiguously in this order
+        offset = 0
         for grid_name, extent, basis, quadrature in zip(
             grid_names, extents, bases, quadratures
         ):
@@ -154,9 +150,7 @@ def interpolate_to_mesh(
             )
 
             tensor_comps = []
-            offset, length = spectre_h5.offset_and_length_for_grid(
-                grid_name, grid_names, extents
-            )
+            length = source_mesh.number_of_grid_points()
             # iterate over tensors
             for j, tensor in enumerate(tensors):
                 component_data = DataVector(
@@ -179,6 +173,7 @@ def interpolate_to_mesh(
                     quadrature=target_mesh.quadrature(),
                 )
             )
+            offset += length
         target_file.close_current_object()
         target_vol = target_file.get_vol(target_volume_data)
         target_vol.write_volume_data(obs, obs_value, volume_data)
@@ -22,6 +22,7 @@ class Cli(click.MultiCommand):
     def list_commands(self, ctx):
         return [
             "bbh",
+            "benchmark-report",
             "clean-output",
             "combine-h5",
             "delete-subfiles",
@@ -49,7 +50,11 @@ class Cli(click.MultiCommand):
             from spectre.Pipelines.Bbh import bbh_pipeline
 
             return bbh_pipeline
-        if name == "clean-output":
+        elif name == "benchmark-report":
+            from spectre.tools.BenchmarkReport import benchmark_report_command
+
+            return benchmark_report_command
+        elif name == "clean-output":
             from spectre.tools.CleanOutput import clean_output_command
 
             return clean_output_command
@@ -6,6 +6,7 @@
 #include <climits>
 #include <complex>
 #include <cstddef>
+#include <initializer_list>
 #include <random>
 #include <type_traits>
 
@@ -943,6 +944,52 @@ void test_assign_double(const DataType& used_for_size) {
   }
 }
 
+// Checks that evaluating in chunks of grid points gives the same result as
+// evaluating each component over all grid points, including when the number of
+// grid points is not a multiple of the chunk size
+template <typename Generator, typename DataType>
+void test_evaluate_in_chunks(const gsl::not_null<Generator*> generator,
+                             const DataType& used_for_size) {
+  CAPTURE(used_for_size.size());
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+
+  const auto R = make_with_random_values<tnsr::ab<DataType, 3, Frame::Grid>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto S = make_with_random_values<tnsr::A<DataType, 3, Frame::Grid>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto G = make_with_random_values<tnsr::a<DataType, 3, Frame::Grid>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto H = make_with_random_values<tnsr::abC<DataType, 3, Frame::Grid>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto T = make_with_random_values<Scalar<DataType>>(
+      generator, make_not_null(&distribution), used_for_size);
+
+  using result_tensor_type = tnsr::a<DataType, 3, Frame::Grid>;
+  const result_tensor_type expected_result_tensor =
+      compute_expected_mixed_arithmetic_ops(R, S, G, H, T, used_for_size);
+
+  result_tensor_type actual_result_tensor{};
+  tenex::evaluate_in_chunks<ti::a>(
+      make_not_null(&actual_result_tensor),
+      R(ti::a, ti::b) * S(ti::B) + G(ti::a) - H(ti::b, ti::a, ti::B) * T());
+  // Also check with a non-owning LHS tensor
+  Variables<tmpl::list<::Tags::TempTensor<1, result_tensor_type>>>
+      actual_result_tensor_temp_var{used_for_size.size()};
+  result_tensor_type& actual_result_tensor_temp =
+      get<::Tags::TempTensor<1, result_tensor_type>>(
+          actual_result_tensor_temp_var);
+  tenex::evaluate_in_chunks<ti::a>(
+      make_not_null(&actual_result_tensor_temp),
+      R(ti::a, ti::b) * S(ti::B) + G(ti::a) - H(ti::b, ti::a, ti::B) * T());
+
+  for (size_t a = 0; a < 4; a++) {
+    CHECK_ITERABLE_APPROX(actual_result_tensor.get(a),
+                          expected_result_tensor.get(a));
+    CHECK_ITERABLE_APPROX(actual_result_tensor_temp.get(a),
+                          expected_result_tensor.get(a));
+  }
+}
+
 // Test cases include equations with a mixture of arithmetic operations or more
 // that one assignment of the LHS tensor (more than one call to
 // `tenex::evaluate` or `tenex::update`)
@@ -973,4 +1020,15 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.MixedOperations",
   test_mixed_operations(
       make_not_null(&generator),
       ComplexDataVector(5, std::numeric_limits<double>::signaling_NaN()));
+
+  for (const size_t size :
+       {size_t{5}, tenex::detail::evaluate_in_chunks_size,
+        2 * tenex::detail::evaluate_in_chunks_size + 7}) {
+    test_evaluate_in_chunks(
+        make_not_null(&generator),
+        DataVector(size, std::numeric_limits<double>::signaling_NaN()));
+    test_evaluate_in_chunks(
+        make_not_null(&generator),
+        ComplexDataVector(size, std::numeric_limits<double>::signaling_NaN()));
+  }
 }
@@ -69,6 +69,15 @@ class TestTensor(unittest.TestCase):
             # Construction of Scalar from 1D array
             scalar = Scalar[DataVector](data_scalar, copy=copy)
             npt.assert_equal(np.array(scalar), [data_scalar])
+        # Tensors referencing a Numpy array are viewed without copying
+        coords = tnsr.I[DataVector, 3, Frame.Inertial](data, copy=False)
+        coords_view = np.asarray(coords)
+        self.assertTrue(np.shares_memory(coords_view, data))
+        coords_view[1, 2] = 4.0
+        self.assertEqual(coords[1][2], 4.0)
+        coords_copy = np.array(coords, copy=True)
+        self.assertFalse(np.shares_memory(coords_copy, data))
+        npt.assert_equal(coords_copy, data)
         with self.assertRaisesRegex(RuntimeError, "expected to be 2D"):
             tnsr.ii[DataVector, 3](np.random.rand(3, 3, 4))
         with self.assertRaisesRegex(RuntimeError, "3 independent components"):
@@ -131,6 +131,36 @@ struct CheckApply<LocalScalarTag, LocalTensorTag, Dim, Dim> {
     CHECK(apply_matrices(ref_matrices, get(get<LocalScalarTag>(source_data)),
                          source_mesh.extents()) == vector_result);
 
+    {
+      INFO("Caller-supplied scratch buffer");
+      DataVector scratch{};
+      std::decay_t<decltype(result)> result_with_scratch(
+          result.number_of_grid_points());
+      apply_matrices(make_not_null(&result_with_scratch), matrices,
+                     source_data, source_mesh.extents(),
+                     make_not_null(&scratch));
+      CHECK(result_with_scratch == result);
+      // Reusing the buffer must not reallocate it
+      const double* const scratch_data = scratch.data();
+      const size_t scratch_size = scratch.size();
+      std::decay_t<decltype(result)> second_result_with_scratch(
+          result.number_of_grid_points());
+      apply_matrices(make_not_null(&second_result_with_scratch), ref_matrices,
+                     source_data, source_mesh.extents(),
+                     make_not_null(&scratch));
+      CHECK(second_result_with_scratch == result);
+      CHECK(scratch.data() == scratch_data);
+      CHECK(scratch.size() == scratch_size);
+
+      std::decay_t<decltype(vector_result)> vector_result_with_scratch(
+          vector_result.size());
+      apply_matrices(make_not_null(&vector_result_with_scratch), ref_matrices,
+                     get(get<LocalScalarTag>(source_data)),
+                     source_mesh.extents(), make_not_null(&scratch));
+      CHECK(vector_result_with_scratch == vector_result);
+      CHECK(scratch.data() == scratch_data);
+    }
+
     // Test multiple independent components in a "vector"
     using DataType =
         std::decay_t<decltype(get(get<LocalScalarTag>(source_data)))>;
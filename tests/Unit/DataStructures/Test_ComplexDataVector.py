@@ -0,0 +1,56 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import unittest
+
+import numpy as np
+import numpy.testing as npt
+
+from spectre.DataStructures import ComplexDataVector, DataVector
+
+
+class TestComplexDataVector(unittest.TestCase):
+    def test_construction(self):
+        a = ComplexDataVector(3, 1.0 + 2.0j)
+        self.assertEqual(len(a), 3)
+        self.assertEqual(a[1], 1.0 + 2.0j)
+        b = ComplexDataVector([1.0 + 2.0j, -3.0j])
+        self.assertEqual(b[1], -3.0j)
+        b[0] = 4.0
+        self.assertEqual(b[0], 4.0 + 0.0j)
+        with self.assertRaisesRegex(RuntimeError, "Out of bounds"):
+            b[2]
+
+    def test_math(self):
+        a = ComplexDataVector([1.0 + 2.0j, -3.0j])
+        self.assertEqual(a.real(), DataVector([1.0, 0.0]))
+        self.assertEqual(a.imag(), DataVector([2.0, -3.0]))
+        self.assertEqual(a.conj(), ComplexDataVector([1.0 - 2.0j, 3.0j]))
+        npt.assert_allclose(a.abs(), [np.sqrt(5.0), 3.0])
+
+    def test_numpy_interoperability(self):
+        data = np.array([1.0 + 2.0j, 3.0 - 4.0j, 5.0j])
+        # Copy from Numpy
+        a_copy = ComplexDataVector(data)
+        a_copy[0] = 0.0
+        self.assertEqual(data[0], 1.0 + 2.0j)
+        # Reference Numpy data
+        a_reference = ComplexDataVector(data, copy=False)
+        a_reference[0] = 0.0
+        self.assertEqual(data[0], 0.0)
+        # View as a Numpy array without copying
+        a_view = np.asarray(a_copy)
+        self.assertEqual(a_view.dtype, np.complex128)
+        a_view[1] = 1.0j
+        self.assertEqual(a_copy[1], 1.0j)
+        # Strided data can only be copied
+        strided = np.arange(6.0).astype(complex)[::2]
+        npt.assert_equal(np.array(ComplexDataVector(strided)), strided)
+        with self.assertRaisesRegex(RuntimeError, "Non-owning"):
+            ComplexDataVector(strided, copy=False)
+        with self.assertRaisesRegex(RuntimeError, "Incompatible format"):
+            ComplexDataVector(np.ones(3), copy=False)
+
+
+if __name__ == "__main__":
+    unittest.main(verbosity=2)
@@ -339,6 +339,14 @@ class TestDataVector(unittest.TestCase):
         b_dv_reference = DataVector(b, copy=False)
         b_dv_reference[2] = 4.0
         self.assertEqual(b[2], 4.0)
+        # Strided arrays are copied element by element, but can't be referenced
+        strided = np.arange(6.0)[::2]
+        self.assertEqual(DataVector(strided), DataVector([0.0, 2.0, 4.0]))
+        with self.assertRaisesRegex(RuntimeError, "Non-owning"):
+            DataVector(strided, copy=False)
+        # A non-owning DataVector keeps the referenced array alive
+        b_dv_reference = DataVector(np.array([1.0, 2.0, 3.0]), copy=False)
+        self.assertEqual(b_dv_reference, DataVector([1.0, 2.0, 3.0]))
 
     def test_iterator(self):
         a = DataVector([1.0, 2.0, 3.0, 4.0, 5.0])
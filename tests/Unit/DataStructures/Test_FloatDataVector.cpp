@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/ConvertPrecision.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/FloatDataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Helpers/DataStructures/VectorImplTestHelper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <typename DataType>
+struct ScalarTag : db::SimpleTag {
+  using type = Scalar<DataType>;
+};
+
+template <typename DataType>
+struct VectorTag : db::SimpleTag {
+  using type = tnsr::I<DataType, 2>;
+};
+
+void test_convert_precision() {
+  const DataVector double_data{1., 0.1, -3.25, 1.e-10};
+  FloatDataVector float_data{};
+  convert_precision(make_not_null(&float_data), double_data);
+  CHECK(float_data == FloatDataVector{1.f, 0.1f, -3.25f, 1.e-10f});
+  DataVector roundtrip{};
+  convert_precision(make_not_null(&roundtrip), float_data);
+  CHECK(roundtrip[0] == 1.);
+  CHECK(roundtrip[2] == -3.25);
+  Approx single_precision_approx = Approx::custom().epsilon(1.e-7).scale(1.);
+  CHECK_ITERABLE_CUSTOM_APPROX(roundtrip, double_data,
+                               single_precision_approx);
+
+  tnsr::I<DataVector, 2> double_vector{{{double_data, 2. * double_data}}};
+  tnsr::I<FloatDataVector, 2> float_vector{};
+  convert_precision(make_not_null(&float_vector), double_vector);
+  CHECK(get<0>(float_vector) == float_data);
+  CHECK(get<1>(float_vector) == FloatDataVector(2.f * float_data));
+
+  Variables<tmpl::list<ScalarTag<DataVector>, VectorTag<DataVector>>>
+      double_vars{double_data.size()};
+  get(get<ScalarTag<DataVector>>(double_vars)) = double_data;
+  get<VectorTag<DataVector>>(double_vars) = double_vector;
+  Variables<tmpl::list<ScalarTag<FloatDataVector>,
+                       VectorTag<FloatDataVector>>>
+      float_vars{};
+  convert_precision(make_not_null(&float_vars), double_vars);
+  CHECK(float_vars.number_of_grid_points() == double_data.size());
+  CHECK(get(get<ScalarTag<FloatDataVector>>(float_vars)) == float_data);
+  CHECK(get<VectorTag<FloatDataVector>>(float_vars) == float_vector);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.FloatDataVector",
+                  "[DataStructures][Unit]") {
+  {
+    INFO("test construct and assign");
+    TestHelpers::VectorImpl::vector_test_construct_and_assign<FloatDataVector,
+                                                              float>();
+  }
+  {
+    INFO("test serialize and deserialize");
+    TestHelpers::VectorImpl::vector_test_serialize<FloatDataVector, float>();
+  }
+  {
+    INFO("test set_data_ref functionality");
+    TestHelpers::VectorImpl::vector_test_ref<FloatDataVector, float>();
+  }
+  {
+    INFO("test math after move");
+    TestHelpers::VectorImpl::vector_test_math_after_move<FloatDataVector,
+                                                         float>();
+  }
+  {
+    INFO("test convert_precision");
+    test_convert_precision();
+  }
+}
@@ -0,0 +1,94 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <thread>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/TempBuffer.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct ScalarTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct VectorTag : db::SimpleTag {
+  using type = tnsr::I<DataVector, 3>;
+};
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ScratchArena",
+                  "[DataStructures][Unit]") {
+  {
+    ScratchArena arena{};
+    CHECK(arena.allocate(0).empty());
+    const auto first = arena.allocate(5);
+    CHECK(first.size() == 5);
+    const auto second = arena.allocate(3);
+    CHECK(second.size() == 3);
+    // Allocations don't overlap and are padded to a full cache line
+    CHECK(second.data() == first.data() + 8);
+    for (size_t i = 0; i < first.size(); ++i) {
+      first[i] = 1.0;
+    }
+    for (size_t i = 0; i < second.size(); ++i) {
+      second[i] = 2.0;
+    }
+    {
+      // A nested arena allocates after the memory of the outer one and
+      // releases it when it goes out of scope
+      ScratchArena inner_arena{};
+      auto vars = inner_arena.make_variables<
+          Variables<tmpl::list<ScalarTag, VectorTag>>>(10);
+      CHECK(vars.number_of_grid_points() == 10);
+      CHECK(vars.size() == 40);
+      CHECK(vars.data() == second.data() + 8);
+      get(get<ScalarTag>(vars)) = 3.0;
+      CHECK(get(get<ScalarTag>(vars)) == DataVector(10, 3.0));
+      auto buffer =
+          inner_arena.make_variables<TempBuffer<tmpl::list<VectorTag>>>(4);
+      CHECK(buffer.size() == 12);
+      CHECK(buffer.data() == vars.data() + 40);
+    }
+    CHECK(arena.allocate(1).data() == second.data() + 8);
+    for (size_t i = 0; i < first.size(); ++i) {
+      CHECK(first[i] == 1.0);
+    }
+    for (size_t i = 0; i < second.size(); ++i) {
+      CHECK(second[i] == 2.0);
+    }
+
+    // Requests that don't fit grow the arena without invalidating earlier
+    // memory
+    const size_t initial_capacity = ScratchArena::capacity();
+    const auto large = arena.allocate(2 * initial_capacity);
+    CHECK(large.size() == 2 * initial_capacity);
+    CHECK(ScratchArena::capacity() > 2 * initial_capacity);
+    large[large.size() - 1] = 4.0;
+    CHECK(first[0] == 1.0);
+    CHECK(second[0] == 2.0);
+  }
+  // After all arenas are released the memory is kept for the next use
+  const size_t capacity = ScratchArena::capacity();
+  {
+    ScratchArena arena{};
+    arena.allocate(capacity);
+    CHECK(ScratchArena::capacity() == capacity);
+  }
+
+  // Every thread has its own memory
+  std::thread other_thread{[]() {
+    CHECK(ScratchArena::capacity() == 0);
+    ScratchArena arena{};
+    arena.allocate(10);
+    CHECK(ScratchArena::capacity() > 0);
+  }};
+  other_thread.join();
+}
+}  // namespace
@@ -70,6 +70,11 @@ SPECTRE_TEST_CASE("Unit.DataStructures.SliceIterator",
     ++slice_iter;
     slice_iter.reset();
     check_slice_iterator_helper(slice_iter);
+
+    CHECK(SliceIterator::stride(Index<3>(3, 4, 5), 0) == 1);
+    CHECK(SliceIterator::stride(Index<3>(3, 4, 5), 1) == 3);
+    CHECK(SliceIterator::stride(Index<3>(3, 4, 5), 2) == 12);
+    CHECK(SliceIterator::stride(Index<1>(3), 0) == 1);
   }
   SECTION("volume_and_slice_indices function") {
     check_slice_and_volume_indices(Index<1>{2});
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <pup.h>
@@ -1160,6 +1161,15 @@ void test_time_dependent_map() {
                                           functions_of_time)),
       tnsr_double_logical);
 
+  CHECK_ITERABLE_APPROX(
+      time_dependent_map_first.inverse(tnsr_datavector_inertial_1, final_time,
+                                       functions_of_time),
+      tnsr_datavector_logical);
+  CHECK_ITERABLE_APPROX(
+      time_dependent_map_second.inverse(tnsr_datavector_inertial_2, final_time,
+                                        functions_of_time),
+      tnsr_datavector_logical);
+
   CHECK(time_dependent_map_first
             .jacobian(tnsr_double_logical, final_time, functions_of_time)
             .get(0, 0) == 1.5);
@@ -1254,6 +1264,39 @@ void test_time_dependent_map() {
   }
 }
 
+void test_batched_inverse() {
+  INFO("Batched inverse");
+  const auto map = make_coordinate_map_base<Frame::BlockLogical, Frame::Grid>(
+      CoordinateMaps::Wedge<3>(0.2, 4.0, 0.0, 1.0, OrientationMap<3>{}, true),
+      CoordinateMaps::Rotation<3>(0.5, 1.0, 2.0));
+  // The last point can't be inverted by the wedge and the one before is NaN
+  const tnsr::I<DataVector, 3, Frame::BlockLogical> logical_points{
+      {{{-0.9, 0.3, 0.0, 1.0}, {0.1, -0.5, 0.0, 1.0}, {-1.0, 0.4, 0.0, 1.0}}}};
+  auto grid_points = (*map)(logical_points);
+  for (size_t d = 0; d < 3; ++d) {
+    grid_points.get(d)[2] = std::numeric_limits<double>::quiet_NaN();
+  }
+  const std::array<double, 3> below_wedge = CoordinateMaps::Rotation<3>(
+      0.5, 1.0, 2.0)(std::array<double, 3>{{0.0, 0.0, -1.0}});
+  for (size_t d = 0; d < 3; ++d) {
+    grid_points.get(d)[3] = gsl::at(below_wedge, d);
+  }
+  CHECK_FALSE(
+      map->inverse(tnsr::I<double, 3, Frame::Grid>{below_wedge}).has_value());
+
+  const auto batched = map->inverse(grid_points);
+  for (size_t s = 0; s < 2; ++s) {
+    for (size_t d = 0; d < 3; ++d) {
+      CHECK(batched.get(d)[s] == approx(logical_points.get(d)[s]));
+    }
+  }
+  for (size_t s = 2; s < 4; ++s) {
+    for (size_t d = 0; d < 3; ++d) {
+      CHECK(std::isnan(batched.get(d)[s]));
+    }
+  }
+}
+
 void test_push_back() {
   INFO("Coordinate map with affine map");
   using affine_map = CoordinateMaps::Affine;
@@ -1501,6 +1544,7 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
   test_make_vector_coordinate_map_base();
   test_coordinate_maps_are_identity();
   test_time_dependent_map();
+  test_batched_inverse();
   test_push_back();
   test_jacobian_is_time_dependent();
   test_coords_frame_velocity_jacobians();
@@ -467,6 +467,40 @@ void test_RotScaleTrans() {
       test_inv_jacobian(rot_scale_trans_map_outer, point_to_check, t,
                         f_of_t_list);
     };
+    const auto check_uniform_jacobian = [&](const auto& map,
+                                            const bool is_uniform) {
+      const auto uniform_jac = map.uniform_jacobian(t, f_of_t_list);
+      REQUIRE(uniform_jac.has_value() == is_uniform);
+      if (not is_uniform) {
+        return;
+      }
+      CHECK_ITERABLE_CUSTOM_APPROX(*uniform_jac,
+                                   map.jacobian(point_xi, t, f_of_t_list),
+                                   custom_approx);
+      // The coordinate map applies the uniform Jacobian as a matrix of
+      // doubles, which must agree with the pointwise Jacobians.
+      const auto coord_map =
+          make_coordinate_map<Frame::Grid, Frame::Inertial>(map);
+      const tnsr::I<DataVector, Dim, Frame::Grid> source_points{point_xi_dv};
+      const auto [coords, inv_jac, jac, frame_velocity] =
+          coord_map.coords_frame_velocity_jacobians(source_points, t,
+                                                    f_of_t_list);
+      CHECK_ITERABLE_CUSTOM_APPROX(
+          coords, coord_map(source_points, t, f_of_t_list), custom_approx);
+      CHECK_ITERABLE_CUSTOM_APPROX(
+          jac, coord_map.jacobian(source_points, t, f_of_t_list),
+          custom_approx);
+      CHECK_ITERABLE_CUSTOM_APPROX(
+          inv_jac, coord_map.inv_jacobian(source_points, t, f_of_t_list),
+          custom_approx);
+      const auto expected_frame_velocity =
+          map.frame_velocity(point_xi_dv, t, f_of_t_list);
+      for (size_t i = 0; i < Dim; ++i) {
+        CHECK_ITERABLE_CUSTOM_APPROX(frame_velocity.get(i),
+                                     gsl::at(expected_frame_velocity, i),
+                                     custom_approx);
+      }
+    };
 
     if (radius <= inner_radius) {
       check_inner_maps_inverse(point_xi);
@@ -476,6 +510,15 @@ void test_RotScaleTrans() {
     check_all_maps_frame_velocity(point_xi);
     check_all_maps_jacobian(point_xi);
     check_all_maps_jacobian(point_xi_dv);
+    check_uniform_jacobian(rot_map, true);
+    check_uniform_jacobian(scale_map_inner, true);
+    check_uniform_jacobian(scale_map_transition, false);
+    check_uniform_jacobian(scale_map_outer, true);
+    check_uniform_jacobian(trans_map_inner, true);
+    check_uniform_jacobian(trans_map_transition, false);
+    check_uniform_jacobian(rot_scale_trans_map_inner, true);
+    check_uniform_jacobian(rot_scale_trans_map_transition, false);
+    check_uniform_jacobian(rot_scale_trans_map_outer, true);
 
     if (far_radius <= outer_radius) {
       check_transition_maps_inverse(far_point_xi);
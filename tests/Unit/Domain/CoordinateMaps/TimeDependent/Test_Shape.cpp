@@ -8,6 +8,7 @@
 #include <complex>
 #include <cstddef>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <random>
 #include <string>
@@ -516,6 +517,16 @@ void test_inverse(const gsl::not_null<Generator*> generator) {
   std::uniform_real_distribution<double> dist_phi{0.0, 2.0 * M_PI};
   std::uniform_real_distribution<double> dist_theta{0.0, M_PI};
 
+  // The batched inverse is checked on the same points, with an additional
+  // NaN point that must remain NaN
+  std::array<DataVector, 3> batched_grid_coords{};
+  std::array<DataVector, 3> batched_coords{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(batched_grid_coords, d) = DataVector(4);
+    gsl::at(batched_coords, d) =
+        DataVector(4, std::numeric_limits<double>::quiet_NaN());
+  }
+  size_t point_index = 0;
   for (const double radius : std::array{1.0, 1.2, 1.5}) {
     const double theta = dist_theta(*generator);
     const double phi = dist_phi(*generator);
@@ -535,7 +546,21 @@ void test_inverse(const gsl::not_null<Generator*> generator) {
 
     CHECK_ITERABLE_APPROX(grid_coords, mapped_coords.value());
     CHECK(radius == approx(mapped_radius));
+
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(batched_grid_coords, d)[point_index] = gsl::at(grid_coords, d);
+      gsl::at(batched_coords, d)[point_index] = gsl::at(inertial_coords, d);
+    }
+    ++point_index;
+  }
+
+  shape.inverse(make_not_null(&batched_coords), time, functions_of_time);
+  for (size_t d = 0; d < 3; ++d) {
+    CHECK(std::isnan(gsl::at(batched_coords, d)[3]));
+    gsl::at(batched_coords, d)[3] = 0.0;
+    gsl::at(batched_grid_coords, d)[3] = 0.0;
   }
+  CHECK_ITERABLE_APPROX(batched_coords, batched_grid_coords);
 }
 }  // namespace
 
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <limits>
 #include <utility>
 
@@ -132,6 +133,17 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.ThreadsafeList",
     CHECK_FALSE(it != list.end());
   }
 
+  {
+    ThreadsafeList<int> id_list(1.0);
+    const auto initial_id = id_list.id();
+    id_list.insert(1.0, 0, 3.0);
+    id_list.insert(3.0, 0, 5.0);
+    CHECK(id_list.id() == initial_id);
+    const auto id_list_copy = id_list;
+    CHECK(id_list_copy.id() != id_list.id());
+    id_list.truncate_to_length(1);
+    CHECK(id_list.id() != initial_id);
+  }
   {
     ThreadsafeList<int> truncate_list(1.0);
     truncate_list.insert(1.0, 0, 3.0);
@@ -198,6 +210,40 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.ThreadsafeList",
     CHECK(truncate_list.initial_time() == 3.0);
   }
 
+  {
+    // Repeated lookups of old intervals are served from the per-thread
+    // cursor, which must respect the interval boundaries and be
+    // invalidated when intervals are removed.
+    ThreadsafeList<int> cursor_list(0.0);
+    for (int i = 0; i < 6; ++i) {
+      cursor_list.insert(i, i, i + 1.0);
+    }
+    ThreadsafeList<int> other_list(0.0);
+    for (int i = 0; i < 6; ++i) {
+      other_list.insert(i, 10 + i, i + 1.0);
+    }
+    for (size_t repeat = 0; repeat < 2; ++repeat) {
+      CHECK(cursor_list(1.5).data == 1);
+      CHECK(cursor_list(1.25).data == 1);
+      CHECK(other_list(1.5).data == 11);
+      CHECK(cursor_list(2.0).data == 1);
+      CHECK(cursor_list(1.0).data == 0);
+      CHECK(cursor_list(0.0).data == 0);
+      CHECK(cursor_list.expiration_after(1.0) == 2.0);
+      CHECK(cursor_list.expiration_after(1.5) == 2.0);
+      CHECK(cursor_list.expiration_after(2.0) == 3.0);
+      CHECK(cursor_list(3.5).data == 3);
+      CHECK(cursor_list(5.5).data == 5);
+    }
+    const auto cursor_list_copy = cursor_list;
+    CHECK(cursor_list_copy(1.5).data == 1);
+    cursor_list.truncate_to_length(3);
+    CHECK(cursor_list.initial_time() == 3.0);
+    CHECK(cursor_list(3.5).data == 3);
+    CHECK(cursor_list_copy(1.5).data == 1);
+    CHECK(cursor_list_copy(3.5).data == 3);
+  }
+
   {
     ThreadsafeList<int> infinite_list(0.0);
     infinite_list.insert(0.0, 1, std::numeric_limits<double>::infinity());
@@ -25,6 +25,8 @@ void test_retrieval() {
       CHECK(did.direction() == direction);
       CHECK(hash_value(did.direction()) == hash_value(direction));
       CHECK(hash_value(did) != hash_value(direction));
+      CHECK(DirectionalIdHash<Dim>{}(did) ==
+            DirectionalIdHash<Dim>{}(DirectionalId{direction, element_id}));
     };
     const DirectionalId did0{direction, element_id};
     check_impl(did0);
@@ -18,6 +18,7 @@
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockBoundingBoxes.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Creators/Brick.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
@@ -278,6 +279,29 @@ void fuzzy_test_block_and_element_logical_coordinates_unrefined(
                           block_coords[s]);
   }
 
+  // Hints don't change the result, whether they are right or wrong
+  CHECK(block_logical_coordinates(domain, inertial_coords, block_logical_result,
+                                  time, functions_of_time) ==
+        block_logical_result);
+  if (n_pts > 1) {
+    auto wrong_hints = block_logical_result;
+    std::rotate(wrong_hints.begin(), wrong_hints.begin() + 1,
+                wrong_hints.end());
+    wrong_hints.back() = std::nullopt;
+    CHECK(block_logical_coordinates(domain, inertial_coords, wrong_hints, time,
+                                    functions_of_time) == block_logical_result);
+  }
+  CHECK(block_logical_coordinates(
+            domain, inertial_coords,
+            std::vector<BlockLogicalCoords<Dim>>(n_pts + 1), time,
+            functions_of_time) == block_logical_result);
+  // Neither do bounding boxes
+  CHECK(block_logical_coordinates(
+            domain, inertial_coords,
+            domain::BlockBoundingBoxes<Dim, Frame::Inertial>{
+                domain, time, functions_of_time},
+            {}, time, functions_of_time) == block_logical_result);
+
   // Map to distorted coords
   // For this test, we test distorted coords only if the first block has
   // a distorted frame.  For this test, either all blocks have a distorted
@@ -317,6 +341,11 @@ void fuzzy_test_block_and_element_logical_coordinates_unrefined(
       CHECK_ITERABLE_APPROX(block_logical_result[s].value().data,
                             block_coords[s]);
     }
+    CHECK(block_logical_coordinates(
+              domain, distorted_coords,
+              domain::BlockBoundingBoxes<Dim, Frame::Distorted>{
+                  domain, time, functions_of_time},
+              {}, time, functions_of_time) == block_logical_result);
   }
 
   // Map to grid coords
@@ -352,6 +381,10 @@ void fuzzy_test_block_and_element_logical_coordinates_unrefined(
     CHECK_ITERABLE_APPROX(block_logical_result[s].value().data,
                           block_coords[s]);
   }
+  CHECK(block_logical_coordinates(
+            domain, grid_coords,
+            domain::BlockBoundingBoxes<Dim, Frame::Grid>{domain}, {}, time,
+            functions_of_time) == block_logical_result);
 }
 
 void fuzzy_test_block_and_element_logical_coordinates_shell(
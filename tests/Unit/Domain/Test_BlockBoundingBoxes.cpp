@@ -0,0 +1,114 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockBoundingBoxes.hpp"
+#include "Domain/Creators/Brick.hpp"
+#include "Domain/Creators/Sphere.hpp"
+#include "Domain/Creators/TimeDependence/UniformTranslation.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+template <typename Frame>
+tnsr::I<double, 3, Frame> point(const std::array<double, 3>& x) {
+  return tnsr::I<double, 3, Frame>{x};
+}
+
+void test_rectilinear() {
+  const Domain<3> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<3>{2, 2, 2},
+          std::array<std::vector<double>, 3>{
+              {{0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}}},
+          {Index<3>{}}),
+      corners_for_rectilinear_domains(Index<3>{2, 2, 2}));
+  const domain::BlockBoundingBoxes<3, Frame::Inertial> boxes{domain};
+  CHECK(boxes.number_of_blocks() == 8);
+  CHECK(boxes.may_contain(0, point<Frame::Inertial>({{0.1, 0.2, 0.3}})));
+  CHECK_FALSE(boxes.may_contain(1, point<Frame::Inertial>({{0.1, 0.2, 0.3}})));
+  CHECK_FALSE(boxes.may_contain(7, point<Frame::Inertial>({{0.1, 0.2, 0.3}})));
+  CHECK(boxes.may_contain(7, point<Frame::Inertial>({{0.9, 0.8, 0.7}})));
+  // Points on shared boundaries are in the boxes of all adjacent blocks
+  for (size_t block_id = 0; block_id < 8; ++block_id) {
+    CHECK(boxes.may_contain(block_id,
+                            point<Frame::Inertial>({{0.5, 0.5, 0.5}})));
+  }
+  // The boxes are padded by a small fraction of their size
+  CHECK(boxes.may_contain(0, point<Frame::Inertial>({{0.52, 0.5, 0.5}})));
+  CHECK_FALSE(
+      boxes.may_contain(0, point<Frame::Inertial>({{0.6, 0.5, 0.5}})));
+  CHECK_FALSE(
+      boxes.may_contain(0, point<Frame::Inertial>({{-0.1, 0.2, 0.3}})));
+  // Time-independent maps have the same boxes in all frames
+  const domain::BlockBoundingBoxes<3, Frame::Grid> grid_boxes{domain};
+  CHECK(grid_boxes.may_contain(7, point<Frame::Grid>({{0.9, 0.8, 0.7}})));
+  const domain::BlockBoundingBoxes<3, Frame::Distorted> distorted_boxes{
+      domain};
+  CHECK(distorted_boxes.may_contain(
+      7, point<Frame::Distorted>({{0.9, 0.8, 0.7}})));
+}
+
+void test_curved_blocks() {
+  const auto shell = domain::creators::Sphere(
+      1.5, 2.5, domain::creators::Sphere::Excision{}, 0_st, 3_st, true);
+  const auto domain = shell.create_domain();
+  const domain::BlockBoundingBoxes<3, Frame::Inertial> boxes{domain};
+  CHECK(boxes.number_of_blocks() == domain.blocks().size());
+  // All points in the curved blocks are in their boxes
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (const auto& block : domain.blocks()) {
+    CAPTURE(block.id());
+    for (size_t i = 0; i < 100; ++i) {
+      const tnsr::I<double, 3, Frame::BlockLogical> x_logical{
+          {{dist(gen), dist(gen), dist(gen)}}};
+      CHECK(boxes.may_contain(block.id(), block.stationary_map()(x_logical)));
+    }
+  }
+  CHECK_FALSE(boxes.may_contain(0, point<Frame::Inertial>({{0.0, 0.0, 0.0}})));
+}
+
+void test_time_dependent() {
+  const auto uniform_translation =
+      domain::creators::time_dependence::UniformTranslation<3>(
+          0.0, {{1.0, 0.0, 0.0}});
+  const auto brick = domain::creators::Brick(
+      {{-0.1, -0.2, -0.3}}, {{0.1, 0.2, 0.3}}, {{0, 0, 0}}, {{3, 3, 3}},
+      {{false, false, false}}, uniform_translation.get_clone());
+  const auto domain = brick.create_domain();
+  const auto functions_of_time = uniform_translation.functions_of_time();
+  const domain::BlockBoundingBoxes<3, Frame::Inertial> boxes_at_start{
+      domain, 0.0, functions_of_time};
+  const domain::BlockBoundingBoxes<3, Frame::Inertial> boxes_later{
+      domain, 1.0, functions_of_time};
+  CHECK(boxes_at_start.may_contain(0, point<Frame::Inertial>({{0., 0., 0.}})));
+  CHECK_FALSE(
+      boxes_later.may_contain(0, point<Frame::Inertial>({{0., 0., 0.}})));
+  CHECK(boxes_later.may_contain(0, point<Frame::Inertial>({{1., 0., 0.}})));
+  // Grid-frame boxes don't move
+  const domain::BlockBoundingBoxes<3, Frame::Grid> grid_boxes{domain};
+  CHECK(grid_boxes.may_contain(0, point<Frame::Grid>({{0., 0., 0.}})));
+  // The block has no distorted frame
+  const domain::BlockBoundingBoxes<3, Frame::Distorted> distorted_boxes{
+      domain, 1.0, functions_of_time};
+  CHECK_FALSE(
+      distorted_boxes.may_contain(0, point<Frame::Distorted>({{1., 0., 0.}})));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockBoundingBoxes", "[Domain][Unit]") {
+  test_rectilinear();
+  test_curved_blocks();
+  test_time_dependent();
+}
@@ -14,16 +14,22 @@
 #include <vector>
 
 #include "Domain/Block.hpp"
+#include "Domain/CreateInitialElement.hpp"
 #include "Domain/Creators/AlignedLattice.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/Neighbors.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Numeric.hpp"
 
 namespace {
 // Test the weighting done by `domain::get_element_costs` for a uniform cost
@@ -498,6 +504,141 @@ void test_proc_retrieval(
     }
   }
 }
+
+// The number of element faces whose two sides are on different nodes
+template <size_t Dim>
+size_t number_of_faces_between_nodes(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::unordered_map<ElementId<Dim>, size_t>& proc_for_element,
+    const std::vector<size_t>& node_of_proc) {
+  size_t result = 0;
+  for (const auto& [element_id, proc] : proc_for_element) {
+    const auto element = domain::Initialization::create_initial_element(
+        element_id, blocks[element_id.block_id()], initial_refinement_levels);
+    for (const auto& [direction, neighbors] : element.neighbors()) {
+      for (const auto& neighbor_id : neighbors.ids()) {
+        if (node_of_proc[proc_for_element.at(neighbor_id)] !=
+            node_of_proc[proc]) {
+          ++result;
+        }
+      }
+    }
+  }
+  return result / 2;
+}
+
+// Test that `domain::minimize_inter_node_communication` reduces the number of
+// faces between nodes without emptying or overloading any processor
+void test_minimize_inter_node_communication() {
+  const auto domain_creator = domain::creators::AlignedLattice<2>(
+      {{{{0.0, 1.0}}, {{0.0, 1.0}}}}, {{2, 2}}, {{3, 3}}, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  const auto& blocks = domain.blocks();
+  const auto initial_refinement_levels =
+      domain_creator.initial_refinement_levels();
+  const auto initial_extents = domain_creator.initial_extents();
+  const auto costs = domain::get_element_costs(
+      blocks, initial_refinement_levels, initial_extents,
+      domain::ElementWeight::Uniform, std::nullopt);
+
+  // Procs 0 and 2 are on the same node, so the Z-curve distribution places
+  // the elements of proc 1 between two halves of node 0. Proc 3 is ignored.
+  const std::vector<size_t> node_of_proc{0, 1, 0, 1};
+  const domain::BlockZCurveProcDistribution<2> element_distribution(
+      costs, 3, blocks, initial_refinement_levels, initial_extents, {3});
+
+  std::unordered_map<ElementId<2>, size_t> initial_proc_for_element{};
+  for (const auto& element_id_and_cost : costs) {
+    initial_proc_for_element.emplace(
+        element_id_and_cost.first,
+        element_distribution.get_proc_for_element(element_id_and_cost.first));
+  }
+  CHECK(number_of_faces_between_nodes(blocks, initial_refinement_levels,
+                                      initial_proc_for_element,
+                                      node_of_proc) == 10);
+
+  {
+    INFO("Without a cost tolerance");
+    const auto proc_for_element = domain::minimize_inter_node_communication(
+        element_distribution, costs, blocks, initial_refinement_levels,
+        initial_extents, node_of_proc, 0.0);
+    CHECK(proc_for_element.size() == costs.size());
+    CHECK(number_of_faces_between_nodes(blocks, initial_refinement_levels,
+                                        proc_for_element, node_of_proc) <= 10);
+  }
+
+  const auto proc_for_element = domain::minimize_inter_node_communication(
+      element_distribution, costs, blocks, initial_refinement_levels,
+      initial_extents, node_of_proc, 0.5);
+  REQUIRE(proc_for_element.size() == costs.size());
+  CHECK(number_of_faces_between_nodes(blocks, initial_refinement_levels,
+                                      proc_for_element, node_of_proc) == 4);
+
+  std::vector<size_t> elements_on_proc(node_of_proc.size(), 0);
+  for (const auto& element_id_and_proc : proc_for_element) {
+    ++elements_on_proc[element_id_and_proc.second];
+  }
+  CHECK(elements_on_proc[3] == 0);
+  for (size_t proc = 0; proc < 3; ++proc) {
+    CHECK(elements_on_proc[proc] > 0);
+    // 1.5 times the average of 16 / 3 elements per proc
+    CHECK(elements_on_proc[proc] <= 8);
+  }
+}
+
+// Test that consecutive blocks along the Hilbert curve are neighbors and that
+// the distribution assigns blocks to processors in this order
+template <size_t Dim>
+void test_hilbert_curve_block_order(const size_t blocks_per_dim) {
+  std::vector<double> block_bounds(blocks_per_dim + 1);
+  alg::iota(block_bounds, 0.0);
+  std::array<std::vector<double>, Dim> all_block_bounds{};
+  all_block_bounds.fill(block_bounds);
+  std::array<size_t, Dim> refinement_levels{};
+  std::array<size_t, Dim> extents{};
+  extents.fill(3);
+  const auto domain_creator = domain::creators::AlignedLattice<Dim>(
+      all_block_bounds, refinement_levels, extents, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  const auto& blocks = domain.blocks();
+  const size_t num_blocks = blocks.size();
+
+  const auto block_order = domain::hilbert_curve_block_order(blocks);
+  REQUIRE(block_order.size() == num_blocks);
+  std::vector<size_t> sorted_block_order = block_order;
+  alg::sort(sorted_block_order);
+  std::vector<size_t> all_block_ids(num_blocks);
+  alg::iota(all_block_ids, 0_st);
+  CHECK(sorted_block_order == all_block_ids);
+  for (size_t i = 0; i + 1 < num_blocks; ++i) {
+    CAPTURE(block_order[i]);
+    CAPTURE(block_order[i + 1]);
+    CHECK(alg::any_of(blocks[block_order[i]].neighbors(),
+                      [&block_order, &i](const auto& direction_and_neighbor) {
+                        return direction_and_neighbor.second.id() ==
+                               block_order[i + 1];
+                      }));
+  }
+
+  // One element per block, so each processor gets consecutive blocks along
+  // the Hilbert curve
+  const auto initial_refinement_levels =
+      domain_creator.initial_refinement_levels();
+  const auto initial_extents = domain_creator.initial_extents();
+  const auto costs = domain::get_element_costs(
+      blocks, initial_refinement_levels, initial_extents,
+      domain::ElementWeight::Uniform, std::nullopt);
+  const size_t number_of_procs = 4;
+  const domain::BlockZCurveProcDistribution<Dim> element_distribution(
+      costs, number_of_procs, blocks, initial_refinement_levels,
+      initial_extents, {}, true);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    CHECK(element_distribution.get_proc_for_element(
+              ElementId<Dim>{block_order[i]}) ==
+          i / (num_blocks / number_of_procs));
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
@@ -543,4 +684,10 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   // `Element`s in the domain
   test_proc_retrieval(domain::ElementWeight::NumGridPointsAndGridSpacing,
                       lattice_2d, 100, std::unordered_set<size_t>{17});
+
+  test_minimize_inter_node_communication();
+
+  test_hilbert_curve_block_order<1>(8);
+  test_hilbert_curve_block_order<2>(4);
+  test_hilbert_curve_block_order<3>(2);
 }
@@ -37,6 +37,7 @@
 #include "Evolution/DgSubcell/Tags/DataForRdmpTci.hpp"
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciGridHistory.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
@@ -105,6 +106,7 @@ struct component {
           evolution::dg::subcell::Tags::DidRollback,
           evolution::dg::subcell::Tags::GhostDataForReconstruction<Dim>,
           evolution::dg::subcell::Tags::TciDecision,
+          evolution::dg::subcell::Tags::StepsSinceTciCall,
           evolution::dg::subcell::Tags::DataForRdmpTci,
           domain::Tags::NeighborMesh<Dim>, ::Tags::Variables<tmpl::list<Var1>>,
           ::Tags::HistoryEvolvedVariables<::Tags::Variables<tmpl::list<Var1>>>,
@@ -413,7 +415,7 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
         &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0}, 0,
         {std::make_unique<DummyReconstructor>(), time_step_id, dg_mesh,
          subcell_mesh, element, active_grid, did_rollback, ghost_data,
-         tci_decision, rdmp_tci_data, neighbor_meshes, evolved_vars,
+         tci_decision, 0_st, rdmp_tci_data, neighbor_meshes, evolved_vars,
          time_stepper_history, initial_value_evolved_vars, neighbor_decisions,
          Interps{}, prim_vars, initial_value_prim_vars});
   } else {
@@ -423,7 +425,7 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
         &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0}, 0,
         {std::make_unique<DummyReconstructor>(), time_step_id, dg_mesh,
          subcell_mesh, element, active_grid, did_rollback, ghost_data,
-         tci_decision, rdmp_tci_data, neighbor_meshes, evolved_vars,
+         tci_decision, 0_st, rdmp_tci_data, neighbor_meshes, evolved_vars,
          time_stepper_history, initial_value_evolved_vars, neighbor_decisions,
          Interps{}});
   }
@@ -585,6 +587,103 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
   CHECK(ActionTesting::get_databox_tag<
             comp, evolution::dg::subcell::Tags::TciDecision>(runner, 0) ==
         (metavars::tci_invoked ? (rdmp_fails ? 10 : (tci_fails ? 5 : 0)) : -1));
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::StepsSinceTciCall>(runner,
+                                                                   0) == 0);
+}
+
+// Check that the TCI is only called every `NumberOfStepsBetweenTciCalls` steps
+// on DG for systems without primitive variables, unless a neighbor is troubled
+template <size_t Dim>
+void test_skip_tci(const size_t steps_since_tci_call, const size_t substep,
+                   const bool neighbor_is_troubled) {
+  CAPTURE(Dim);
+  CAPTURE(steps_since_tci_call);
+  CAPTURE(substep);
+  CAPTURE(neighbor_is_troubled);
+  using Interps = DirectionalIdMap<Dim, std::optional<intrp::Irregular<Dim>>>;
+  using metavars = Metavariables<Dim, false>;
+  using comp = component<Dim, metavars>;
+  metavars::rdmp_fails = false;
+  metavars::tci_fails = false;
+  metavars::tci_invoked = false;
+  metavars::expected_evolve_on_dg_after_tci_failure = false;
+
+  const evolution::dg::subcell::SubcellOptions subcell_options{
+      evolution::dg::subcell::SubcellOptions{
+          4.0, 1_st, 1.0e-3, 1.0e-4, false,
+          evolution::dg::subcell::fd::ReconstructionMethod::DimByDim, false,
+          std::optional<std::vector<std::string>>{},
+          ::fd::DerivativeOrder::Two, 1, 1, 1, 3},
+      TestCreator<Dim>{}};
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
+  MockRuntimeSystem runner{{subcell_options}};
+
+  const Slab slab{1.0, 2.0};
+  const TimeStepId time_step_id =
+      substep == 0 ? TimeStepId{true, 1, slab.start()}
+                   : TimeStepId{true,         1,
+                                slab.start(), substep,
+                                slab.duration(), slab.start().value()};
+  const Mesh<Dim> dg_mesh{5, Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto};
+  const Mesh<Dim> subcell_mesh = evolution::dg::subcell::fd::mesh(dg_mesh);
+  const Element<Dim> element = create_element<Dim>(true);
+
+  DirectionalIdMap<Dim, evolution::dg::subcell::GhostData> ghost_data{};
+  DirectionalIdMap<Dim, Mesh<Dim>> neighbor_meshes{};
+  typename evolution::dg::subcell::Tags::NeighborTciDecisions<Dim>::type
+      neighbor_decisions{};
+  for (const auto& [direction, neighbors] : element.neighbors()) {
+    const DirectionalId<Dim> directional_element_id{direction,
+                                                    *neighbors.ids().begin()};
+    neighbor_meshes[directional_element_id] = dg_mesh;
+    ghost_data[directional_element_id] = evolution::dg::subcell::GhostData{1};
+    ghost_data.at(directional_element_id)
+        .neighbor_ghost_data_for_reconstruction() =
+        DataVector{dg_mesh.number_of_grid_points(), 1.0};
+    neighbor_decisions.insert(std::pair{directional_element_id, 0});
+  }
+  if (neighbor_is_troubled) {
+    neighbor_decisions.begin()->second = 10;
+  }
+
+  using evolved_vars_tags = tmpl::list<Var1>;
+  Variables<evolved_vars_tags> evolved_vars{dg_mesh.number_of_grid_points()};
+  get(get<Var1>(evolved_vars)) = get<0>(logical_coordinates(dg_mesh));
+  const evolution::dg::subcell::RdmpTciData rdmp_tci_data{{2.0}, {-2.0}};
+
+  ActionTesting::emplace_array_component_and_initialize<comp>(
+      &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0}, 0,
+      {std::make_unique<DummyReconstructor>(), time_step_id, dg_mesh,
+       subcell_mesh, element, evolution::dg::subcell::ActiveGrid::Dg, false,
+       ghost_data, 0, steps_since_tci_call, rdmp_tci_data, neighbor_meshes,
+       evolved_vars, TimeSteppers::History<Variables<evolved_vars_tags>>{1},
+       evolved_vars, neighbor_decisions, Interps{}});
+  ActionTesting::next_action<comp>(make_not_null(&runner), 0);
+
+  const bool expect_tci_call =
+      neighbor_is_troubled or
+      (substep == 0 ? steps_since_tci_call + 1 >= 3
+                    : steps_since_tci_call == 0);
+  CHECK(metavars::tci_invoked == expect_tci_call);
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::StepsSinceTciCall>(runner,
+                                                                   0) ==
+        (expect_tci_call ? 0_st
+                         : steps_since_tci_call + (substep == 0 ? 1 : 0)));
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::GhostDataForReconstruction<
+                      Dim>>(runner, 0)
+            .empty());
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::ActiveGrid>(runner, 0) ==
+        evolution::dg::subcell::ActiveGrid::Dg);
+  if (not expect_tci_call) {
+    CHECK(ActionTesting::get_databox_tag<
+              comp, evolution::dg::subcell::Tags::DataForRdmpTci>(runner, 0) ==
+          rdmp_tci_data);
+  }
 }
 
 template <size_t Dim>
@@ -603,6 +702,11 @@ void test() {
                           self_starting, have_neighbors, use_halo,
                           neighbor_is_troubled, disable_subcell_in_block);
   }
+  for (const auto& [steps_since_tci_call, substep, neighbor_is_troubled] :
+       cartesian_product(make_array(0_st, 1_st, 2_st), make_array(0_st, 1_st),
+                         make_array(false, true))) {
+    test_skip_tci<Dim>(steps_since_tci_call, substep, neighbor_is_troubled);
+  }
 }
 
 // [[TimeOut, 10]]
@@ -106,6 +106,15 @@ void test_persson_impl(
   CHECK(evolution::dg::subcell::persson_tci(
             get<TagToCheck>(vars), dg_mesh, persson_exponent,
             persson_number_of_highest_modes) == expected_tci_triggered);
+  // Checking all the Variables at once must agree with checking each tensor
+  CHECK(evolution::dg::subcell::persson_tci(vars, dg_mesh, persson_exponent,
+                                            persson_number_of_highest_modes) ==
+        (evolution::dg::subcell::persson_tci(get<Tags::Scalar>(vars), dg_mesh,
+                                             persson_exponent,
+                                             persson_number_of_highest_modes) or
+         evolution::dg::subcell::persson_tci(get<Tags::Vector<Dim>>(vars),
+                                             dg_mesh, persson_exponent,
+                                             persson_number_of_highest_modes)));
 }
 
 template <size_t Dim>
@@ -115,6 +115,15 @@ void test_impl(const std::vector<double>& expected_values,
                   expected_values[0], static_cast<size_t>(expected_values[1]),
                   expected_values[2], expected_values[3], false, recons_method,
                   false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1));
+  CHECK_FALSE(SubcellOptions(
+                  expected_values[0], static_cast<size_t>(expected_values[1]),
+                  expected_values[2], expected_values[3], false, recons_method,
+                  false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1,
+                  2) ==
+              SubcellOptions(
+                  expected_values[0], static_cast<size_t>(expected_values[1]),
+                  expected_values[2], expected_values[3], false, recons_method,
+                  false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1));
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
@@ -129,7 +138,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
       expected_values[0], static_cast<size_t>(expected_values[1]),
       expected_values[2], expected_values[3], true,
       fd::ReconstructionMethod::DimByDim, true, std::nullopt,
-      ::fd::DerivativeOrder::Four, 1, 1, 1);
+      ::fd::DerivativeOrder::Four, 1, 1, 1, 4);
+  CHECK(options.number_of_steps_between_dg_tci_calls() == 4);
   const SubcellOptions deserialized_options =
       serialize_and_deserialize(options);
   CHECK(options == deserialized_options);
@@ -146,6 +156,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
                        "    NumberOfStepsBetweenTciCalls: 1\n"
                        "    MinTciCallsAfterRollback: 1\n"
                        "    MinimumClearTcis: 1\n"
+                       "  DgToFdTci:\n"
+                       "    NumberOfStepsBetweenTciCalls: 4\n"
                        "  AlwaysUseSubcells: true\n"
                        "  UseHalo: true\n"
                        "  OnlyDgBlocksAndGroups: None\n"
@@ -167,6 +179,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
       "    NumberOfStepsBetweenTciCalls: 1\n"
       "    MinTciCallsAfterRollback: 1\n"
       "    MinimumClearTcis: 1\n"
+      "  DgToFdTci:\n"
+      "    NumberOfStepsBetweenTciCalls: 1\n"
       "  AlwaysUseSubcells: true\n"
       "  UseHalo: true\n";
   const std::string opts_end =
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -14,6 +15,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -174,6 +176,59 @@ void test_oscillation_indicator_3d() {
   test_oscillation_indicator_3d_impl(Spectral::Quadrature::Gauss);
 }
 
+void test_oscillation_indicators_impl(const Spectral::Quadrature quadrature) {
+  CAPTURE(quadrature);
+  const Mesh<2> mesh({{4, 5}}, Spectral::Basis::Legendre, quadrature);
+  const auto logical_coords = logical_coordinates(mesh);
+  const DataVector& x = get<0>(logical_coords);
+  const DataVector& y = get<1>(logical_coords);
+
+  const auto data =
+      DataVector{square(x) + cube(y) - 2.5 * x * y + square(x) * y};
+  const auto linear_data = DataVector{2. * x - y};
+  const auto scaled_data = DataVector{2. * data};
+
+  std::vector<double> indicators{};
+  Limiters::Weno_detail::oscillation_indicators(
+      make_not_null(&indicators),
+      Limiters::Weno_detail::DerivativeWeight::Unity,
+      {&data, &linear_data, &scaled_data}, mesh);
+  // The indicator of `data` is computed in test_oscillation_indicator_2d_impl,
+  // and the indicator of 2 x - y is 4 * (2^2 + 1^2) = 20.
+  REQUIRE(indicators.size() == 3);
+  CHECK(indicators[0] == approx(2647. / 9.));
+  CHECK(indicators[1] == approx(20.));
+  CHECK(indicators[2] == approx(4. * 2647. / 9.));
+
+  // Batched indicators agree with the indicator of each DataVector
+  for (const auto derivative_weight :
+       {Limiters::Weno_detail::DerivativeWeight::PowTwoEll,
+        Limiters::Weno_detail::DerivativeWeight::PowTwoEllOverEllFactorial}) {
+    CAPTURE(derivative_weight);
+    Limiters::Weno_detail::oscillation_indicators(
+        make_not_null(&indicators), derivative_weight,
+        {&linear_data, &data}, mesh);
+    REQUIRE(indicators.size() == 2);
+    CHECK(indicators[0] ==
+          approx(Limiters::Weno_detail::oscillation_indicator(
+              derivative_weight, linear_data, mesh)));
+    CHECK(indicators[1] ==
+          approx(Limiters::Weno_detail::oscillation_indicator(
+              derivative_weight, data, mesh)));
+  }
+
+  Limiters::Weno_detail::oscillation_indicators(
+      make_not_null(&indicators),
+      Limiters::Weno_detail::DerivativeWeight::Unity, {}, mesh);
+  CHECK(indicators.empty());
+}
+
+void test_oscillation_indicators() {
+  INFO("Testing batched oscillation_indicators");
+  test_oscillation_indicators_impl(Spectral::Quadrature::GaussLobatto);
+  test_oscillation_indicators_impl(Spectral::Quadrature::Gauss);
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.Weno.OscillationIndicator",
@@ -183,4 +238,5 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.Weno.OscillationIndicator",
   test_oscillation_indicator_1d();
   test_oscillation_indicator_2d();
   test_oscillation_indicator_3d();
+  test_oscillation_indicators();
 }
@@ -11,6 +11,7 @@
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
@@ -108,6 +109,66 @@ void test_boundary_message(const gsl::not_null<Generator*> generator,
   CHECK(unpacked_message == repacked_unpacked_message);
 }
 
+template <size_t Dim, typename Generator>
+void test_allocate(const gsl::not_null<Generator*> generator,
+                   const size_t subcell_size, const size_t dg_size) {
+  CAPTURE(Dim);
+  CAPTURE(subcell_size);
+  CAPTURE(dg_size);
+
+  const Slab slab{0.1, 0.5};
+  const TimeStepId current_time_id{true, 0, Time{slab, {0, 1}}};
+  const TimeStepId next_time_id{true, 0, Time{slab, {1, 2}}};
+  const Mesh<Dim> volume_mesh{4, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto};
+  const Mesh<Dim - 1> interface_mesh = volume_mesh.slice_away(0);
+
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  const auto subcell_data = make_with_random_values<DataVector>(
+      generator, make_not_null(&dist), subcell_size);
+  const auto dg_data = make_with_random_values<DataVector>(
+      generator, make_not_null(&dist), dg_size);
+
+  BoundaryMessage<Dim>* message = BoundaryMessage<Dim>::allocate(
+      false, 1, 4, 2, 3, current_time_id, next_time_id,
+      Direction<Dim>{0, Side::Lower}, ElementId<Dim>{0}, volume_mesh,
+      interface_mesh, subcell_data, dg_data);
+  CHECK(message->owning);
+  CHECK(message->subcell_ghost_data_size == subcell_size);
+  CHECK(message->dg_flux_data_size == dg_size);
+  CHECK((message->subcell_ghost_data == nullptr) == (subcell_size == 0));
+  CHECK((message->dg_flux_data == nullptr) == (dg_size == 0));
+
+  // An allocated message is already in the packed layout, so sending it
+  // neither allocates nor copies.
+  BoundaryMessage<Dim>* received_message =
+      BoundaryMessage<Dim>::unpack(BoundaryMessage<Dim>::pack(message));
+  CHECK(received_message == message);
+
+  const BoundaryData<Dim> view =
+      boundary_data_view(make_not_null(received_message));
+  CHECK(view.volume_mesh_ghost_cell_data == volume_mesh);
+  CHECK(view.interface_mesh == interface_mesh);
+  CHECK(view.validity_range == next_time_id);
+  CHECK(view.tci_status == 2);
+  CHECK(view.integration_order == 3);
+  CHECK(view.ghost_cell_data.has_value() == (subcell_size != 0));
+  CHECK(view.boundary_correction_data.has_value() == (dg_size != 0));
+  if (subcell_size != 0) {
+    CHECK_FALSE(view.ghost_cell_data->is_owning());
+    CHECK(view.ghost_cell_data->data() ==
+          received_message->subcell_ghost_data);
+    CHECK(*view.ghost_cell_data == subcell_data);
+  }
+  if (dg_size != 0) {
+    CHECK_FALSE(view.boundary_correction_data->is_owning());
+    CHECK(view.boundary_correction_data->data() ==
+          received_message->dg_flux_data);
+    CHECK(*view.boundary_correction_data == dg_data);
+  }
+  delete received_message;  // NOLINT
+}
+
 void test_output() {
   const size_t subcell_size = 4;
   const size_t dg_size = 3;
@@ -202,6 +263,13 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.BoundaryMessage", "[Unit][Evolution]") {
         // test it for completeness to ensure pack/unpack are doing the correct
         // thing
         test_boundary_message<Dim>(make_not_null(&generator), 0, 0);
+
+        test_allocate<Dim>(make_not_null(&generator), size_dist(generator),
+                           0);
+        test_allocate<Dim>(make_not_null(&generator), 0, size_dist(generator));
+        test_allocate<Dim>(make_not_null(&generator), size_dist(generator),
+                           size_dist(generator));
+        test_allocate<Dim>(make_not_null(&generator), 0, 0);
       });
 }
 }  // namespace
@@ -8,12 +8,14 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
 
 namespace evolution::dg {
 namespace {
@@ -68,6 +70,43 @@ void test() {
                     "\nBoundary correction: " + get_output(DataVector{1, 4.4}) +
                     "\nValidy range: " + get_output(TimeStepId{true, 1, time}) +
                     "\nTCI status: 7\nIntegration order: 3"));
+
+  test_serialization(data0);
+
+  BoundaryData<Dim> data1{volume_mesh,
+                          interface_mesh,
+                          DataVector{200, 1.0 / 3.0},
+                          std::nullopt,
+                          TimeStepId{true, 1, time},
+                          7,
+                          3,
+                          true};
+  // The flag is not compared
+  CHECK(data1 == BoundaryData<Dim>{volume_mesh, interface_mesh,
+                                   DataVector{200, 1.0 / 3.0}, std::nullopt,
+                                   TimeStepId{true, 1, time}, 7, 3, false});
+  const auto deserialized_data1 = serialize_and_deserialize(data1);
+  CHECK(deserialized_data1.serialize_in_single_precision);
+  CHECK(deserialized_data1.volume_mesh_ghost_cell_data == volume_mesh);
+  CHECK(deserialized_data1.interface_mesh == interface_mesh);
+  CHECK(deserialized_data1.validity_range == TimeStepId{true, 1, time});
+  CHECK(deserialized_data1.tci_status == 7);
+  CHECK(deserialized_data1.integration_order == 3);
+  CHECK_FALSE(deserialized_data1.boundary_correction_data.has_value());
+  REQUIRE(deserialized_data1.ghost_cell_data.has_value());
+  Approx single_precision_approx = Approx::custom().epsilon(1.0e-7).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(*deserialized_data1.ghost_cell_data,
+                               *data1.ghost_cell_data, single_precision_approx);
+  // A third isn't representable as a float, so the data is not exact
+  CHECK(*deserialized_data1.ghost_cell_data != *data1.ghost_cell_data);
+
+  data1.boundary_correction_data = DataVector{100, -2.0};
+  const size_t single_precision_size = serialize(data1).size();
+  data1.serialize_in_single_precision = false;
+  const size_t double_precision_size = serialize(data1).size();
+  CHECK(double_precision_size - single_precision_size ==
+        300 * (sizeof(double) - sizeof(float)));
+  CHECK(serialize_and_deserialize(data1) == data1);
 }
 }  // namespace
 
@@ -657,6 +657,73 @@ void test_point_reseting() {
   CHECK_ITERABLE_APPROX(get(get<Var1>(box)), (get<0, 0>(var2)));
 }
 
+struct ConvergedGuessSector
+    : tt::ConformsTo<imex::protocols::ImplicitSector> {
+  using tensors = tmpl::list<Var1>;
+  using initial_guess = imex::GuessExplicitResult;
+
+  struct SolveAttempt {
+    using tags_from_evolution = tmpl::list<>;
+    using simple_tags = tmpl::list<>;
+    using compute_tags = tmpl::list<>;
+
+    using source_prep = tmpl::list<>;
+    using jacobian_prep = tmpl::list<>;
+
+    struct source {
+      using return_tags = tmpl::list<::Tags::Source<Var1>>;
+      using argument_tags = tmpl::list<>;
+
+      static void apply(const gsl::not_null<Scalar<DataVector>*> source_var1) {
+        get(*source_var1) = 0.0;
+      }
+    };
+
+    struct jacobian {
+      using return_tags = tmpl::list<>;
+      using argument_tags = tmpl::list<>;
+
+      static void apply() { CHECK(false); }
+    };
+  };
+
+  using solve_attempts = tmpl::list<SolveAttempt>;
+};
+
+// Points where the initial guess already solves the equation should
+// not go through the nonlinear solver.
+void test_converged_initial_guess() {
+  using variables_tag = ::Tags::Variables<tmpl::list<Var1>>;
+
+  const Slab slab(0.0, 2.0);
+  const auto time_step = slab.duration();
+
+  // NOLINTNEXTLINE(misc-const-correctness)
+  variables_tag::type initial_value(2, 1.0);
+  TimeSteppers::History<variables_tag::type> history(2);
+  history.insert(TimeStepId(true, 0, slab.start()), decltype(history)::no_value,
+                 db::prefix_variables<Tags::dt, variables_tag::type>(2, 0.0));
+
+  auto box = db::create<
+      db::AddSimpleTags<
+          variables_tag, imex::Tags::ImplicitHistory<ConvergedGuessSector>,
+          imex::Tags::Mode, Tags::ConcreteTimeStepper<ImexTimeStepper>,
+          Tags::TimeStep, imex::Tags::SolveFailures<ConvergedGuessSector>,
+          imex::Tags::SolveTolerance>,
+      time_stepper_ref_tags<ImexTimeStepper>>(
+      std::move(initial_value), std::move(history), imex::Mode::Implicit,
+      static_cast<std::unique_ptr<ImexTimeStepper>>(
+          std::make_unique<TimeSteppers::Heun2>()),
+      time_step, Scalar<DataVector>(DataVector(2, 0.0)), 1.0e-10);
+  db::mutate_apply<
+      imex::SolveImplicitSector<variables_tag, ConvergedGuessSector>>(
+      make_not_null(&box));
+
+  CHECK(get(get<Var1>(box)) == DataVector(2, 1.0));
+  CHECK(get(get<imex::Tags::SolveFailures<ConvergedGuessSector>>(box)) ==
+        DataVector(2, 0.0));
+}
+
 struct DesiredLevel : db::SimpleTag {
   using type = Scalar<DataVector>;
 };
@@ -766,5 +833,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.Imex.SolveImplicitSector",
   test_solve_implicit_sector<false>(imex::Mode::SemiImplicit);
   test_solve_implicit_sector<true>(imex::Mode::SemiImplicit);
   test_point_reseting();
+  test_converged_initial_guess();
   test_fallback();
 }
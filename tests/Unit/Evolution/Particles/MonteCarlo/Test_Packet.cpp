@@ -3,12 +3,17 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
+#include <cstddef>
+#include <vector>
+
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Particles/MonteCarlo/EvolvePackets.hpp"
 #include "Evolution/Particles/MonteCarlo/Packet.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -74,9 +79,32 @@ void check_packet() {
   CHECK(packet.number_of_neutrinos == 2.0);
 }
 
+
+void check_sort_packets() {
+  std::vector<Particles::MonteCarlo::Packet> packets{};
+  // Species, closest grid point and a tag (number of neutrinos) to check the
+  // sort is stable
+  for (const auto& [species, index, tag] :
+       std::vector<std::array<size_t, 3>>{{{1, 4, 0}},
+                                          {{0, 4, 1}},
+                                          {{2, 1, 2}},
+                                          {{0, 1, 3}},
+                                          {{0, 4, 4}}}) {
+    packets.emplace_back(species, static_cast<double>(tag), index, 0.0, 0.0,
+                         0.0, 0.0, 1.0, 1.0, 0.0, 0.0);
+  }
+  Particles::MonteCarlo::sort_packets_by_cell(make_not_null(&packets));
+  REQUIRE(packets.size() == 5);
+  const std::array<double, 5> expected_tags{{3.0, 2.0, 1.0, 4.0, 0.0}};
+  for (size_t i = 0; i < packets.size(); ++i) {
+    CAPTURE(i);
+    CHECK(packets[i].number_of_neutrinos == gsl::at(expected_tags, i));
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.Particles.MonteCarloPacket",
                   "[Unit][Evolution]") {
   check_packet();
+  check_sort_packets();
 }
@@ -11,10 +11,12 @@
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 #include "Evolution/Systems/Cce/OptionTags.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/Threading.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/CceComputationTestHelpers.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -482,6 +484,15 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
                                       number_of_radial_grid_points, l_max);
   test_pole_integration_with_linear_operator<Tags::BondiH>(
       make_not_null(&gen), number_of_radial_grid_points, l_max);
+  {
+    INFO("Linear solves split across threads");
+    set_number_of_threads(3);
+    CHECK(number_of_threads() == 3);
+    CHECK(Spectral::Swsh::number_of_transform_threads() == 3);
+    test_pole_integration_with_linear_operator<Tags::BondiH>(
+        make_not_null(&gen), number_of_radial_grid_points, l_max);
+    set_number_of_threads(1);
+  }
 }
 }  // namespace
 }  // namespace Cce
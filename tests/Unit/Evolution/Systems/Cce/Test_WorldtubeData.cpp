@@ -18,6 +18,7 @@
 #include "Evolution/Systems/Cce/WorldtubeDataManager.hpp"
 #include "Framework/CheckWithRandomValues.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/BoundaryTestHelpers.hpp"
 #include "Helpers/Evolution/Systems/Cce/WriteToWorldtubeH5.hpp"
@@ -479,6 +480,82 @@ void test_data_manager_with_dummy_buffer_updater(
       });
 }
 
+// Prefetching must not change the boundary data, even though the buffer
+// windows are chosen differently.
+template <typename DataManager, typename DummyUpdater, typename Generator>
+void test_prefetching_data_manager(const gsl::not_null<Generator*> gen) {
+  UniformCustomDistribution<double> value_dist{0.1, 0.5};
+  const double mass = value_dist(*gen);
+  const std::array<double, 3> spin{
+      {value_dist(*gen), value_dist(*gen), value_dist(*gen)}};
+  const std::array<double, 3> center{
+      {value_dist(*gen), value_dist(*gen), value_dist(*gen)}};
+  gr::Solutions::KerrSchild solution{mass, spin, center};
+
+  const double frequency = 0.1 * value_dist(*gen);
+  const double amplitude = 0.1 * value_dist(*gen);
+  const double target_time = 50.0 * value_dist(*gen);
+
+  const size_t buffer_size = 4;
+  const size_t l_max = 8;
+
+  DataVector time_buffer{30};
+  for (size_t i = 0; i < time_buffer.size(); ++i) {
+    time_buffer[i] = target_time - 1.55 + 0.1 * i;
+  }
+
+  const auto make_data_manager = [&](const bool prefetch) {
+    auto interpolator =
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u);
+    if constexpr (std::is_same_v<DataManager, MetricWorldtubeDataManager>) {
+      return DataManager{
+          std::make_unique<DummyUpdater>(time_buffer, solution, std::nullopt,
+                                         amplitude, frequency, l_max),
+          l_max, buffer_size, std::move(interpolator), true, prefetch};
+    } else {
+      return DataManager{
+          std::make_unique<DummyUpdater>(time_buffer, solution, std::nullopt,
+                                         amplitude, frequency, l_max),
+          l_max, buffer_size, std::move(interpolator), prefetch};
+    }
+  };
+  const auto data_manager = make_data_manager(false);
+  const auto prefetching_data_manager = make_data_manager(true);
+  const auto deserialized_prefetching_data_manager =
+      serialize_and_deserialize(prefetching_data_manager);
+  const auto cloned_prefetching_data_manager =
+      prefetching_data_manager.get_clone();
+
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  using manager_base_type = WorldtubeDataManager<
+      Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>;
+  using boundary_variables_type = Variables<
+      Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>;
+  boundary_variables_type expected_boundary_variables{
+      number_of_angular_points};
+  boundary_variables_type prefetched_boundary_variables{
+      number_of_angular_points};
+  Parallel::NodeLock hdf5_lock{};
+  // step through several buffer windows, including the end of the data
+  for (size_t i = 0; i < 50; ++i) {
+    const double time = target_time - 1.2 + 0.05 * static_cast<double>(i);
+    CAPTURE(time);
+    CHECK(data_manager.populate_hypersurface_boundary_data(
+        make_not_null(&expected_boundary_variables), time,
+        make_not_null(&hdf5_lock)));
+    for (const auto* manager : std::array<const manager_base_type*, 3>{
+             {&prefetching_data_manager, &deserialized_prefetching_data_manager,
+              cloned_prefetching_data_manager.get()}}) {
+      CHECK(manager->populate_hypersurface_boundary_data(
+          make_not_null(&prefetched_boundary_variables), time,
+          make_not_null(&hdf5_lock)));
+      CHECK_VARIABLES_APPROX(prefetched_boundary_variables,
+                             expected_boundary_variables);
+    }
+  }
+}
+
 template <typename Generator>
 void test_spec_worldtube_buffer_updater(
     const gsl::not_null<Generator*> gen,
@@ -822,6 +899,11 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
     test_data_manager_with_dummy_buffer_updater<BondiWorldtubeDataManager,
                                                 ReducedDummyBufferUpdater>(
         make_not_null(&gen));
+    test_prefetching_data_manager<MetricWorldtubeDataManager,
+                                  DummyBufferUpdater>(make_not_null(&gen));
+    test_prefetching_data_manager<BondiWorldtubeDataManager,
+                                  ReducedDummyBufferUpdater>(
+        make_not_null(&gen));
   }
 }
 }  // namespace Cce
@@ -48,6 +48,35 @@ struct component {
                      typename Metavariables::system, false>>>>;
 };
 
+template <typename Metavariables>
+struct rotating_component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<3>;
+
+  using initial_tags =
+      tmpl::list<CurvedScalarWave::Tags::BackgroundSpacetime<
+                     typename Metavariables::background_spacetime>,
+                 domain::Tags::Coordinates<3, Frame::Grid>,
+                 domain::Tags::Coordinates<3, Frame::Inertial>, ::Tags::Time>;
+  using calculate_gr_vars = CurvedScalarWave::Actions::CalculateGrVars<
+      typename Metavariables::system, false, true>;
+
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<initial_tags>,
+                 calculate_gr_vars, calculate_gr_vars, calculate_gr_vars,
+                 calculate_gr_vars>>>;
+};
+
+template <typename System, typename BackgroundSpacetime>
+struct RotatingMetavariables {
+  using background_spacetime = BackgroundSpacetime;
+  using component_list = tmpl::list<rotating_component<RotatingMetavariables>>;
+  using system = System;
+  using const_global_cache_tag_list = tmpl::list<>;
+};
+
 template <size_t Dim, typename System, typename BackgroundSpacetime>
 struct Metavariables {
   using background_spacetime = BackgroundSpacetime;
@@ -87,6 +116,121 @@ void test(const BackgroundSpacetime& background_spacetime,
       });
 }
 
+tnsr::I<DataVector, 3> rotated_about_z(
+    const tnsr::I<DataVector, 3, Frame::Grid>& grid_coords,
+    const double angle) {
+  tnsr::I<DataVector, 3> result{};
+  get<0>(result) = cos(angle) * get<0>(grid_coords) -
+                   sin(angle) * get<1>(grid_coords);
+  get<1>(result) = sin(angle) * get<0>(grid_coords) +
+                   cos(angle) * get<1>(grid_coords);
+  get<2>(result) = get<2>(grid_coords);
+  return result;
+}
+
+void test_rotated_cached_background(
+    const gsl::not_null<std::mt19937*> generator) {
+  using system = CurvedScalarWave::System<3>;
+  using metavars = RotatingMetavariables<system, gr::Solutions::KerrSchild>;
+  using comp = rotating_component<metavars>;
+  using grid_coords_tag = domain::Tags::Coordinates<3, Frame::Grid>;
+  using inertial_coords_tag = domain::Tags::Coordinates<3, Frame::Inertial>;
+  using cache_tag =
+      CurvedScalarWave::Tags::BackgroundInGridFrame<system::spacetime_tag_list,
+                                                    3>;
+  const gr::Solutions::KerrSchild background_spacetime(1., {0., 0., 0.4},
+                                                       {0., 0., 0.3});
+  CHECK(CurvedScalarWave::detail::is_invariant_under_rotations_about_z(
+      background_spacetime));
+  CHECK(CurvedScalarWave::detail::is_invariant_under_rotations_about_z(
+      gr::Solutions::Minkowski<3>{}));
+  CHECK_FALSE(CurvedScalarWave::detail::is_invariant_under_rotations_about_z(
+      gr::Solutions::KerrSchild(1., {0.1, 0., 0.4}, {0., 0., 0.3})));
+  CHECK_FALSE(CurvedScalarWave::detail::is_invariant_under_rotations_about_z(
+      gr::Solutions::KerrSchild(1., {0., 0., 0.4}, {0., 0.2, 0.3})));
+
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
+  MockRuntimeSystem runner{{}};
+  const size_t num_points = 42;
+  std::uniform_real_distribution dist{-10., 10.};
+  auto grid_coords =
+      make_with_random_values<tnsr::I<DataVector, 3, Frame::Grid>>(
+          generator, make_not_null(&dist), DataVector{num_points});
+  const double time = 0.;
+  const ElementId<3> element_id{0};
+  ActionTesting::emplace_component_and_initialize<comp>(
+      &runner, element_id,
+      {background_spacetime, grid_coords, rotated_about_z(grid_coords, 0.3),
+       time});
+  auto& box = ActionTesting::get_databox<comp>(make_not_null(&runner),
+                                               element_id);
+
+  const auto check_background = [&runner, &element_id, &background_spacetime,
+                                 &box](const bool expect_exact) {
+    const auto expected = background_spacetime.variables(
+        db::get<inertial_coords_tag>(box), time, system::spacetime_tag_list{});
+    tmpl::for_each<system::spacetime_tag_list>(
+        [&runner, &element_id, &expected, &expect_exact](auto spacetime_tag_v) {
+          using spacetime_tag = tmpl::type_from<decltype(spacetime_tag_v)>;
+          const auto& computed =
+              ActionTesting::get_databox_tag<comp, spacetime_tag>(runner,
+                                                                  element_id);
+          if (expect_exact) {
+            CHECK(computed == get<spacetime_tag>(expected));
+          } else {
+            Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+            CHECK_ITERABLE_CUSTOM_APPROX(
+                computed, get<spacetime_tag>(expected), custom_approx);
+          }
+        });
+  };
+
+  {
+    INFO("Rotated element fills the cache");
+    ActionTesting::next_action<comp>(make_not_null(&runner), element_id);
+    check_background(false);
+    CHECK(get<grid_coords_tag>(db::get<cache_tag>(box)) == grid_coords);
+  }
+  {
+    INFO("Rotated element reuses the cache");
+    const auto cached_background = db::get<cache_tag>(box);
+    db::mutate<inertial_coords_tag>(
+        [&grid_coords](const auto inertial_coords) {
+          *inertial_coords = rotated_about_z(grid_coords, -2.1);
+        },
+        make_not_null(&box));
+    ActionTesting::next_action<comp>(make_not_null(&runner), element_id);
+    check_background(false);
+    CHECK(db::get<cache_tag>(box) == cached_background);
+  }
+  {
+    INFO("Changing the grid coordinates recomputes the cache");
+    grid_coords = make_with_random_values<tnsr::I<DataVector, 3, Frame::Grid>>(
+        generator, make_not_null(&dist), DataVector{num_points + 3});
+    db::mutate<grid_coords_tag, inertial_coords_tag>(
+        [&grid_coords](const auto local_grid_coords,
+                       const auto inertial_coords) {
+          *local_grid_coords = grid_coords;
+          *inertial_coords = rotated_about_z(grid_coords, 1.2);
+        },
+        make_not_null(&box));
+    ActionTesting::next_action<comp>(make_not_null(&runner), element_id);
+    check_background(false);
+    CHECK(get<grid_coords_tag>(db::get<cache_tag>(box)) == grid_coords);
+  }
+  {
+    INFO("Other maps evaluate the background directly");
+    db::mutate<inertial_coords_tag>(
+        [&grid_coords](const auto inertial_coords) {
+          *inertial_coords = rotated_about_z(grid_coords, 0.4);
+          get<0>(*inertial_coords) += 0.5;
+        },
+        make_not_null(&box));
+    ActionTesting::next_action<comp>(make_not_null(&runner), element_id);
+    check_background(true);
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.CurvedScalarWave.CalculateGrVars",
                   "[Unit][Evolution]") {
   MAKE_GENERATOR(generator);
@@ -95,5 +239,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.CurvedScalarWave.CalculateGrVars",
   test(gr::Solutions::Minkowski<3>(), make_not_null(&generator));
   test(gr::Solutions::KerrSchild(1., {0.5, 0., 0.1}, {0.2, 0.5, -0.7}),
        make_not_null(&generator));
+  test_rotated_cached_background(make_not_null(&generator));
 }
 }  // namespace
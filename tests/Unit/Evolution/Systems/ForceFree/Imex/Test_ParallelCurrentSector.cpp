@@ -0,0 +1,94 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Imex/GuessResult.hpp"
+#include "Evolution/Imex/Protocols/ImplicitSector.hpp"
+#include "Evolution/Systems/ForceFree/Imex/ParallelCurrentSector.hpp"
+#include "Evolution/Systems/ForceFree/Tags.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+
+namespace {
+using Sector = ForceFree::Imex::ParallelCurrentSector;
+static_assert(
+    tt::assert_conforms_to_v<Sector, imex::protocols::ImplicitSector>);
+
+void test_solution(const gsl::not_null<std::mt19937*> generator,
+                   const double parallel_conductivity,
+                   const double inhomogeneous_scale) {
+  CAPTURE(parallel_conductivity);
+  CAPTURE(inhomogeneous_scale);
+  const size_t num_points = 20;
+  const DataVector used_for_size(num_points);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  std::uniform_real_distribution<> weight_dist(0.01, 1.0);
+
+  const auto lapse = TestHelpers::gr::random_lapse(generator, used_for_size);
+  const auto spatial_metric =
+      TestHelpers::gr::random_spatial_metric<3>(generator, used_for_size);
+  const auto sqrt_det_spatial_metric =
+      Scalar<DataVector>(sqrt(get(determinant(spatial_metric))));
+  const auto tilde_q = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&dist), used_for_size);
+  const auto tilde_b = make_with_random_values<tnsr::I<DataVector, 3>>(
+      generator, make_not_null(&dist), used_for_size);
+  Variables<tmpl::list<ForceFree::Tags::TildeE>> inhomogeneous_terms(
+      num_points);
+  auto& x = get<ForceFree::Tags::TildeE>(inhomogeneous_terms);
+  fill_with_random_values(make_not_null(&x), generator, make_not_null(&dist));
+  for (size_t i = 0; i < 3; ++i) {
+    x.get(i) *= inhomogeneous_scale;
+  }
+  const double implicit_weight = weight_dist(*generator);
+
+  tnsr::I<DataVector, 3> tilde_e(num_points);
+  const std::vector<imex::GuessResult> guess_result =
+      Sector::initial_guess::apply(make_not_null(&tilde_e), tilde_b,
+                                   parallel_conductivity, lapse,
+                                   spatial_metric, inhomogeneous_terms,
+                                   implicit_weight);
+  CHECK(guess_result == std::vector<imex::GuessResult>(
+                            num_points, imex::GuessResult::ExactSolution));
+
+  // Check that the implicit equation tilde_e = x + w S(tilde_e) is satisfied
+  tnsr::I<DataVector, 3> source(num_points);
+  Sector::SolveAttempt::source::apply(
+      make_not_null(&source), tilde_q, tilde_e, tilde_b, parallel_conductivity,
+      lapse, sqrt_det_spatial_metric, spatial_metric);
+  tnsr::I<DataVector, 3> expected_tilde_e(num_points);
+  for (size_t i = 0; i < 3; ++i) {
+    expected_tilde_e.get(i) = x.get(i) + implicit_weight * source.get(i);
+  }
+  Approx custom_approx =
+      Approx::custom().epsilon(1.0e-12).scale(
+          std::max(1.0, parallel_conductivity) * inhomogeneous_scale);
+  CHECK_ITERABLE_CUSTOM_APPROX(tilde_e, expected_tilde_e, custom_approx);
+}
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.ForceFree.Imex.ParallelCurrentSector",
+                  "[Unit][Evolution]") {
+  MAKE_GENERATOR(generator);
+  for (const double parallel_conductivity : {0.0, 0.1, 10.0, 1.0e6}) {
+    // Small and large inhomogeneous terms cover both the magnetically and the
+    // electrically dominated solutions.
+    for (const double inhomogeneous_scale : {0.1, 1.0, 10.0}) {
+      test_solution(make_not_null(&generator), parallel_conductivity,
+                    inhomogeneous_scale);
+    }
+  }
+}
+}  // namespace
@@ -471,6 +471,18 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAlHydro>,
       false>(&generator, wrapped_3d_polytrope, dv);
+  INFO("3D EoS Kastaun, several SIMD batches");
+  const DataVector larger_dv(17);
+  test_primitive_from_conservative_known<tmpl::list<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>>(
+      larger_dv);
+  test_primitive_from_conservative_random<tmpl::list<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>>(
+      &generator, wrapped_ideal_fluid, larger_dv);
+  test_primitive_from_conservative_random<
+      tmpl::list<
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>,
+      true>(&generator, wrapped_3d_polytrope, larger_dv);
   INFO("3D EoS Newman-Hamlin");
   test_primitive_from_conservative_random<
       tmpl::list<
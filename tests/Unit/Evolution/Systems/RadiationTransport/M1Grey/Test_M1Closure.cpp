@@ -356,6 +356,29 @@ void check_random() {
       momentum_density, closure_factor, comoving_energy_density,
       comoving_momentum_density_spatial, comoving_momentum_density_normal,
       pressure_tensor);
+
+  // The result doesn't depend on the initial guess for the closure factor
+  {
+    const auto cold_start_closure_factor = closure_factor;
+    for (const double initial_guess : {0.3, 0.9}) {
+      CAPTURE(initial_guess);
+      Scalar<DataVector> warm_start_closure_factor(used_for_size,
+                                                   initial_guess);
+      // Also try a guess close to the solution
+      get(warm_start_closure_factor)[0] =
+          get(cold_start_closure_factor)[0] + 0.01;
+      closure::apply(make_not_null(&warm_start_closure_factor),
+                     make_not_null(&pressure_tensor),
+                     make_not_null(&comoving_energy_density),
+                     make_not_null(&comoving_momentum_density_normal),
+                     make_not_null(&comoving_momentum_density_spatial),
+                     energy_density, momentum_density, fluid_velocity,
+                     fluid_lorentz_factor, spatial_metric, inv_spatial_metric);
+      Approx closure_approx = Approx::custom().epsilon(1.0e-5).scale(1.0);
+      CHECK_ITERABLE_CUSTOM_APPROX(warm_start_closure_factor,
+                                   cold_start_closure_factor, closure_approx);
+    }
+  }
 }
 }  // namespace
 
@@ -529,7 +529,8 @@ class MockDistributedObjectProxy : public CProxyElement_ArrayElement {
       const CacheProxy& /*global_cache_proxy*/,
       Parallel::Phase /*current_phase*/,
       const std::unordered_map<Parallel::Phase, size_t>& /*phase_bookmarks*/,
-      const std::unique_ptr<Parallel::Callback>& callback) {
+      const std::unique_ptr<Parallel::Callback>& callback,
+      const int /*on_proc*/ = -1) {
     callback->invoke();
   }
 
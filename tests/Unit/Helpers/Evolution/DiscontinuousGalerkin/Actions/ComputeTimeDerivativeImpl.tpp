@@ -981,6 +981,9 @@ struct Metavariables {
   static constexpr bool use_moving_mesh = UseMovingMesh;
   static constexpr bool local_time_stepping = LocalTimeStepping;
   static constexpr bool pass_variables = PassVariables;
+  // Piggyback on PassVariables so both the overlapping and the sequential
+  // communication are tested without doubling the number of instantiations.
+  static constexpr bool overlap_boundary_communication = PassVariables;
   using system =
       System<Dim, system_type, HasPrimitiveVariables, pass_variables>;
   using normal_dot_numerical_flux =
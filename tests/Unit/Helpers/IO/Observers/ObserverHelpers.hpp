@@ -119,9 +119,10 @@ using reduction_data_from_ds_and_vs = Parallel::ReductionData<
                              funcl::ElementWise<funcl::Plus<>>>,
     l2_error_datum>;
 
-template <typename RegistrationActionsList>
+template <typename RegistrationActionsList, bool SingleVolumeFile = false>
 struct Metavariables {
   static constexpr size_t volume_dim = 3;
+  static constexpr bool single_volume_file = SingleVolumeFile;
 
   using component_list =
       tmpl::list<element_component<Metavariables, RegistrationActionsList>,
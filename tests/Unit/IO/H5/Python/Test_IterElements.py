@@ -97,6 +97,21 @@ class TestIterElements(unittest.TestCase):
                 "Psi",
                 "Error(Psi)",
             ]
+            all_tensor_data = volfile.get_tensor_components(
+                obs_id, tensor_components
+            )
+            self.assertEqual(
+                all_tensor_data.shape, (len(tensor_components), 2 * 4**3)
+            )
+            for component, component_data in zip(
+                tensor_components, all_tensor_data
+            ):
+                npt.assert_equal(
+                    component_data,
+                    np.asarray(
+                        volfile.get_tensor_component(obs_id, component).data
+                    ),
+                )
             for i, (element, data) in enumerate(
                 iter_elements(
                     [volfile],
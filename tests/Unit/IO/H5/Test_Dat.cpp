@@ -262,6 +262,23 @@ void test_core_functionality() {
     }();
     CHECK(subset == answer);
   }
+  {
+    const auto subset = error_file.get_data_subset({0, 1, 3}, 1, 3);
+    const Matrix answer = []() {
+      Matrix result(3, 3);
+      result(0, 0) = 0.11;
+      result(0, 1) = 0.4;
+      result(0, 2) = 0.6;
+      result(1, 0) = 0.22;
+      result(1, 1) = 0.55;
+      result(1, 2) = 0.8;
+      result(2, 0) = 0.33;
+      result(2, 1) = 0.66;
+      result(2, 2) = 0.9;
+      return result;
+    }();
+    CHECK(subset == answer);
+  }
   {
     const auto subset = error_file.get_data_subset({}, 0, 2);
     const Matrix answer(2, 0, 0.0);
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <hdf5.h>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -20,6 +21,7 @@
 #include "Helpers/IO/VolumeData.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
@@ -29,6 +31,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
 
 namespace {
@@ -300,6 +303,28 @@ void test() {
           extra_tensor_component);
   }
 
+  {
+    INFO("get_tensor_components");
+    const size_t observation_id = observation_ids.front();
+    const std::vector<std::string> component_names{"S", "U"};
+    std::vector<double> buffer(2 * 16);
+    volume_file.get_tensor_components(buffer, observation_id, component_names);
+    for (size_t i = 0; i < component_names.size(); ++i) {
+      const auto expected = get<DataType>(
+          volume_file.get_tensor_component(observation_id, component_names[i])
+              .data);
+      REQUIRE(expected.size() == 16);
+      for (size_t j = 0; j < expected.size(); ++j) {
+        CHECK(buffer[i * 16 + j] == static_cast<double>(expected[j]));
+      }
+    }
+    CHECK_THROWS_WITH(
+        volume_file.get_tensor_components(
+            gsl::span<double>{buffer.data(), 2 * 8}, observation_id,
+            component_names),
+        Catch::Matchers::ContainsSubstring("has 16 points"));
+  }
+
   {
     INFO("offset_and_length_for_grid");
     const size_t observation_id = observation_ids.front();
@@ -553,6 +578,54 @@ void test_extend_connectivity_data() {
     file_system::rm(h5_file_name, true);
   }
 }
+void test_compression() {
+  const std::string h5_file_name{"Unit.IO.H5.VolumeData.Compression.h5"};
+  const uint32_t version_number = 4;
+  const std::vector<size_t> extents{4, 3, 2};
+  const std::vector<Spectral::Basis> bases{3, Spectral::Basis::Legendre};
+  const std::vector<Spectral::Quadrature> quadratures{
+      3, Spectral::Quadrature::GaussLobatto};
+  DataVector scalar{24};
+  for (size_t i = 0; i < scalar.size(); ++i) {
+    scalar[i] = 0.5 * static_cast<double>(i) - 3.0;
+  }
+  const std::vector<ElementVolumeData> element_data{
+      {"[B0,(L0I0,L0I0,L0I0)]",
+       {{"Scalar", scalar}},
+       extents,
+       bases,
+       quadratures}};
+
+  for (const auto& compression :
+       {h5::Compression{h5::Compression::Codec::None, 5, true, 131'072},
+        h5::Compression{h5::Compression::Codec::Deflate, 1, false, 64},
+        h5::Compression{h5::Compression::Codec::Deflate, 9, true, 1}}) {
+    CAPTURE(compression.codec);
+    CAPTURE(compression.level);
+    if (file_system::check_if_file_exists(h5_file_name)) {
+      file_system::rm(h5_file_name, true);
+    }
+    {
+      h5::H5File<h5::AccessType::ReadWrite> h5_file{h5_file_name};
+      auto& volume_file =
+          h5_file.insert<h5::VolumeData>("/element_data", version_number);
+      volume_file.write_volume_data(1, 0.5, element_data, std::nullopt,
+                                    std::nullopt, compression);
+    }
+    h5::H5File<h5::AccessType::ReadOnly> h5_file{h5_file_name};
+    const auto& volume_file =
+        h5_file.get<h5::VolumeData>("/element_data", version_number);
+    CHECK(get<0>(volume_file.get_tensor_component(1, "Scalar").data) ==
+          scalar);
+  }
+  CHECK(h5::Compression{} == h5::Compression{});
+  CHECK(h5::Compression{} !=
+        h5::Compression{h5::Compression::Codec::None, 5, true, 131'072});
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
 }  // namespace
 
 // [[TimeOut, 20]]
@@ -563,6 +636,7 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   test_extend_connectivity_data<1>();
   test_extend_connectivity_data<2>();
   test_extend_connectivity_data<3>();
+  test_compression();
 
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH(
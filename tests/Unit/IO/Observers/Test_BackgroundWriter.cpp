@@ -0,0 +1,68 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IO/Observer/BackgroundWriter.hpp"
+
+namespace {
+struct MetavariablesWithAsyncWrites {
+  static constexpr bool asynchronous_volume_writes = true;
+};
+struct MetavariablesWithoutOption {};
+
+static_assert(
+    observers::asynchronous_volume_writes_v<MetavariablesWithAsyncWrites>);
+static_assert(
+    not observers::asynchronous_volume_writes_v<MetavariablesWithoutOption>);
+
+void test_tasks_run_in_order() {
+  std::mutex mutex{};
+  std::vector<size_t> finished_tasks{};
+  std::vector<std::thread::id> thread_ids{};
+  {
+    observers::BackgroundWriter writer{};
+    for (size_t i = 0; i < 5; ++i) {
+      writer.enqueue([i, &mutex, &finished_tasks, &thread_ids]() {
+        // Make the caller wait for the queue to drain
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        const std::lock_guard lock(mutex);
+        finished_tasks.push_back(i);
+        thread_ids.push_back(std::this_thread::get_id());
+      });
+    }
+    writer.wait_until_idle();
+    const std::lock_guard lock(mutex);
+    CHECK(finished_tasks == std::vector<size_t>{0, 1, 2, 3, 4});
+    for (const auto& id : thread_ids) {
+      CHECK(id != std::this_thread::get_id());
+    }
+
+    // The destructor finishes the queued tasks
+    writer.enqueue([&mutex, &finished_tasks]() {
+      const std::lock_guard task_lock(mutex);
+      finished_tasks.push_back(5);
+    });
+  }
+  CHECK(finished_tasks == std::vector<size_t>{0, 1, 2, 3, 4, 5});
+}
+
+void test_process_writer() {
+  bool ran = false;
+  observers::background_writer().enqueue([&ran]() { ran = true; });
+  observers::background_writer().wait_until_idle();
+  CHECK(ran);
+  CHECK(&observers::background_writer() == &observers::background_writer());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.BackgroundWriter", "[Unit][Observers]") {
+  test_tasks_run_in_order();
+  test_process_writer();
+}
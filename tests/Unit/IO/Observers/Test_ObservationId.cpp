@@ -52,6 +52,9 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.ObservationId", "[Unit][Observers]") {
   CHECK(key0 == ObservationKey{"ObservationType1"});
   CHECK(key0 != key1);
   CHECK(key0 == id0.observation_key());
+  CHECK(ObservationId(4., key0) == id0);
+  CHECK(ObservationId(4., key0).observation_key() == id0.observation_key());
+  CHECK(ObservationId(8., key1) == id2);
   CHECK(get_output(key0) == "(" + get_output(key0.tag()) + ")");
   test_serialization(key0);
 }
@@ -0,0 +1,84 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+struct BufferedMetavariables {
+  static constexpr bool buffered_reduction_writes = true;
+};
+struct UnbufferedMetavariables {};
+
+static_assert(observers::buffered_reduction_writes_v<BufferedMetavariables>);
+static_assert(
+    not observers::buffered_reduction_writes_v<UnbufferedMetavariables>);
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionDataBuffer",
+                  "[Unit][Observers]") {
+  const std::string file_prefix = "Unit.IO.Observers.ReductionDataBuffer";
+  const std::string file_name = file_prefix + ".h5";
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  const std::vector<std::string> legend{"Time", "Value"};
+  const std::vector<std::string> other_legend{"Time", "A", "B"};
+
+  observers::ReductionDataBuffer buffer{};
+  CHECK(buffer.number_of_buffered_rows() == 0);
+  CHECK_FALSE(buffer.needs_flush());
+  buffer.append(file_prefix, "InputSource", "/Norms", legend, {0.0, 1.0});
+  buffer.append(file_prefix, "InputSource", "/Other", other_legend,
+                {0.0, 2.0, 3.0});
+  buffer.append(file_prefix, "InputSource", "/Norms", legend, {0.5, 4.0});
+  CHECK(buffer.number_of_buffered_rows() == 3);
+  CHECK_FALSE(buffer.needs_flush());
+  // Nothing is written until the buffer is flushed
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+
+  for (size_t i = buffer.number_of_buffered_rows();
+       i < observers::ReductionDataBuffer::max_buffered_rows; ++i) {
+    CHECK_FALSE(buffer.needs_flush());
+    buffer.append(file_prefix, "InputSource", "/Other", other_legend,
+                  {static_cast<double>(i), 0.0, 0.0});
+  }
+  CHECK(buffer.needs_flush());
+  buffer.flush();
+  CHECK(buffer.number_of_buffered_rows() == 0);
+  CHECK_FALSE(buffer.needs_flush());
+
+  // Rows appended after a flush go to the end of the existing subfiles
+  buffer.append(file_prefix, "InputSource", "/Norms", legend, {1.0, 5.0});
+  buffer.flush();
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> file{file_name};
+    const auto& norms = file.get<h5::Dat>("/Norms");
+    CHECK(norms.get_legend() == legend);
+    const Matrix norms_data = norms.get_data();
+    CHECK(norms_data.rows() == 3);
+    CHECK(norms_data(0, 1) == 1.0);
+    CHECK(norms_data(1, 1) == 4.0);
+    CHECK(norms_data(2, 0) == 1.0);
+    CHECK(norms_data(2, 1) == 5.0);
+    file.close_current_object();
+    const auto& other = file.get<h5::Dat>("/Other");
+    CHECK(other.get_legend() == other_legend);
+    const Matrix other_data = other.get_data();
+    CHECK(other_data.rows() ==
+          observers::ReductionDataBuffer::max_buffered_rows - 2);
+    CHECK(other_data(0, 1) == 2.0);
+    CHECK(other_data(0, 2) == 3.0);
+  }
+  file_system::rm(file_name, true);
+}
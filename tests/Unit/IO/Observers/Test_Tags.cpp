@@ -29,6 +29,11 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
       "ContributorsOfTensorData");
   TestHelpers::db::test_simple_tag<VolumeDataLock>("VolumeDataLock");
   TestHelpers::db::test_simple_tag<TensorData>("TensorData");
+  TestHelpers::db::test_simple_tag<NodesThatContributedVolumeData>(
+      "NodesThatContributedVolumeData");
+  TestHelpers::db::test_simple_tag<NodesExpectedToContributeVolumeData>(
+      "NodesExpectedToContributeVolumeData");
+  TestHelpers::db::test_simple_tag<VolumeDataFromNodes>("VolumeDataFromNodes");
   TestHelpers::db::test_simple_tag<ReductionData<double>>("ReductionData");
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
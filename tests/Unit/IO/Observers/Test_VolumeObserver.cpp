@@ -159,15 +159,17 @@ void check_write_volume_data(
     file_system::rm(h5_write_volume_file_name + ".h5"s, true);
   }
 }
-}  // namespace
 
-SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
+template <bool SingleVolumeFile>
+void test_volume_observer() {
+  CAPTURE(SingleVolumeFile);
   using registration_list = tmpl::list<
       observers::Actions::RegisterWithObservers<
           helpers::RegisterObservers<observers::TypeOfObservation::Volume>>,
       Parallel::Actions::TerminatePhase>;
 
-  using metavariables = helpers::Metavariables<registration_list>;
+  using metavariables =
+      helpers::Metavariables<registration_list, SingleVolumeFile>;
   using obs_component = helpers::observer_component<metavariables>;
   using obs_writer = helpers::observer_writer_component<metavariables>;
   using element_comp =
@@ -183,9 +185,6 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
       std::make_unique<
           domain::creators::time_dependence::UniformTranslation<3, 0>>(
           1., std::array<double, 3>{{2., 3., 4.}})};
-  domain::creators::register_derived_with_charm();
-  domain::creators::time_dependence::register_derived_with_charm();
-  domain::FunctionsOfTime::register_derived_with_charm();
   tuples::TaggedTuple<observers::Tags::ReductionFileName,
                       observers::Tags::VolumeFileName, domain::Tags::Domain<3>,
                       domain::Tags::FunctionsOfTimeInitialize>
@@ -222,9 +221,16 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   // Invoke the simple_action RegisterVolumeContributorWithObserverWriter.
   ActionTesting::invoke_queued_simple_action<obs_writer>(make_not_null(&runner),
                                                          0);
+  if constexpr (SingleVolumeFile) {
+    // Invoke the simple_action RegisterVolumeNodeWithWritingNode.
+    ActionTesting::invoke_queued_simple_action<obs_writer>(
+        make_not_null(&runner), 0);
+  }
+  CHECK(ActionTesting::is_simple_action_queue_empty<obs_writer>(runner, 0));
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
 
-  const std::string h5_file_name = output_file_prefix + "0.h5";
+  const std::string h5_file_name =
+      output_file_prefix + (SingleVolumeFile ? ".h5" : "0.h5");
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
@@ -236,14 +242,19 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
         Parallel::make_array_component_id<element_comp>(id);
 
     auto [mesh, fake_volume_data] = make_fake_volume_data(array_id);
-    runner
-        .simple_action<obs_component, observers::Actions::ContributeVolumeData>(
+    runner.template simple_action<obs_component,
+                                  observers::Actions::ContributeVolumeData>(
             0, observation_id, std::string{"/element_data"}, array_id,
             ElementVolumeData{id, std::move(fake_volume_data), mesh});
   }
   // Invoke the simple action 'ContributeVolumeDataToWriter'
   // to move the volume data to the Writer parallel component.
-  runner.invoke_queued_threaded_action<obs_writer>(0);
+  runner.template invoke_queued_threaded_action<obs_writer>(0);
+  if constexpr (SingleVolumeFile) {
+    // Invoke the threaded action 'ContributeVolumeDataToWritingNode' that
+    // collects the data of all nodes on node 0.
+    runner.template invoke_queued_threaded_action<obs_writer>(0);
+  }
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
 
   REQUIRE(file_system::check_if_file_exists(h5_file_name));
@@ -344,3 +355,12 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   check_write_volume_data<metavariables, obs_writer, element_comp>(
       make_not_null(&runner), element_ids[0], expected_tensor_names);
 }
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
+  domain::creators::register_derived_with_charm();
+  domain::creators::time_dependence::register_derived_with_charm();
+  domain::FunctionsOfTime::register_derived_with_charm();
+  test_volume_observer<false>();
+  test_volume_observer<true>();
+}
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
@@ -18,6 +19,7 @@
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -315,10 +317,44 @@ void test_projections() {
     }
   }
 }
+
+void test_projection_reuses_memory() {
+  using Spectral::MortarSize;
+  const auto face_mesh = lgl_mesh<2>({{4, 5}});
+  const auto mortar_mesh = lgl_mesh<2>({{6, 5}});
+  const std::array<MortarSize, 2> mortar_size{
+      {MortarSize::LowerHalf, MortarSize::Full}};
+  Variables<tmpl::list<Var>> vars(face_mesh.number_of_grid_points());
+  get(get<Var>(vars)) = get<0>(logical_coordinates(face_mesh)) +
+                        square(get<1>(logical_coordinates(face_mesh)));
+  Variables<tmpl::list<Var>> on_mortar(mortar_mesh.number_of_grid_points());
+  Variables<tmpl::list<Var>> on_face(face_mesh.number_of_grid_points());
+  dg::project_to_mortar(make_not_null(&on_mortar), vars, face_mesh,
+                        mortar_mesh, mortar_size);
+  dg::project_from_mortar(make_not_null(&on_face), on_mortar, face_mesh,
+                          mortar_mesh, mortar_size);
+  // Once the scratch arena has grown to the size needed, projecting again
+  // doesn't require more memory.
+  const size_t capacity = ScratchArena::capacity();
+  for (size_t i = 0; i < 3; ++i) {
+    dg::project_to_mortar(make_not_null(&on_mortar), vars, face_mesh,
+                          mortar_mesh, mortar_size);
+    dg::project_from_mortar(make_not_null(&on_face), on_mortar, face_mesh,
+                            mortar_mesh, mortar_size);
+  }
+  CHECK(ScratchArena::capacity() == capacity);
+  CHECK_VARIABLES_APPROX(
+      on_mortar,
+      dg::project_to_mortar(vars, face_mesh, mortar_mesh, mortar_size));
+  CHECK_VARIABLES_APPROX(
+      on_face,
+      dg::project_from_mortar(on_mortar, face_mesh, mortar_mesh, mortar_size));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DG.MortarHelpers", "[Unit][NumericalAlgorithms]") {
   test_mortar_mesh();
   test_mortar_size();
   test_projections();
+  test_projection_reuses_memory();
 }
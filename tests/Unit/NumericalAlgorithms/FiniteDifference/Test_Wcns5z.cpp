@@ -5,6 +5,8 @@
 
 #include <array>
 #include <cstddef>
+#include <random>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -12,6 +14,7 @@
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Framework/Pypp.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Exact.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Python.hpp"
 #include "NumericalAlgorithms/FiniteDifference/FallbackReconstructorType.hpp"
@@ -19,6 +22,8 @@
 #include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
 #include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace fd::reconstruction {
 namespace {
@@ -161,6 +166,35 @@ void test(const FallbackReconstructorType fallback_recons) {
                     Catch::Matchers::ContainsSubstring(
                         "Nonlinear weight exponent should be 1 or 2"));
 }
+
+template <size_t NonlinearWeightExponent>
+void test_simd_pointwise() {
+#ifdef SPECTRE_USE_XSIMD
+  // Reconstructing a batch of cells must give the same result as
+  // reconstructing one cell at a time.
+  using SimdType = simd::batch<double>;
+  constexpr size_t simd_width = simd::size<SimdType>();
+  using Reconstructor =
+      detail::Wcns5zReconstructor<NonlinearWeightExponent, void>;
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> q(simd_width + 4);
+  for (size_t trial = 0; trial < 100; ++trial) {
+    for (double& value : q) {
+      value = dist(gen);
+    }
+    const auto batch_result = Reconstructor::template pointwise<SimdType>(
+        &q[2], 1, 2.0e-16, 1_st);
+    for (size_t lane = 0; lane < simd_width; ++lane) {
+      CAPTURE(lane);
+      const auto result = Reconstructor::pointwise(&q[2 + lane], 1, 2.0e-16,
+                                                   1_st);
+      CHECK(get<0>(batch_result).get(lane) == approx(get<0>(result)));
+      CHECK(get<1>(batch_result).get(lane) == approx(get<1>(result)));
+    }
+  }
+#endif  // SPECTRE_USE_XSIMD
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.FiniteDifference.Wcns5z",
@@ -182,6 +216,9 @@ SPECTRE_TEST_CASE("Unit.FiniteDifference.Wcns5z",
   test<3, detail::MonotonisedCentralReconstructor>(
       FallbackReconstructorType::MonotonisedCentral);
   test<3, void>(FallbackReconstructorType::None);
+
+  test_simd_pointwise<1>();
+  test_simd_pointwise<2>();
 }
 
 }  // namespace fd::reconstruction
@@ -3,7 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cstddef>
+#include <tuple>
 
 #include "DataStructures/DataVector.hpp"
 #include "Framework/TestHelpers.hpp"
@@ -144,6 +146,42 @@ void test() {
     CHECK(std::abs(gsl::at(y_expected, nv) - gsl::at(y_interpolated_gen, nv)) <
           epsilon * std::abs(gsl::at(y_expected, nv)));
   }
+
+  // Interpolate to several points at once, which for uniform tables uses the
+  // vectorized lookup for all but the last few points
+  const size_t number_of_target_points = 11;
+  std::array<DataVector, Dim> target_points{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(target_points, d) = DataVector{number_of_target_points};
+    for (size_t s = 0; s < number_of_target_points; ++s) {
+      gsl::at(target_points, d)[s] = dist_func(gen);
+    }
+  }
+  std::array<DataVector, 2> interpolated_variables{};
+  std::array<DataVector, 2> interpolated_variables_gen{};
+  std::apply(
+      [&uniform_intp, &general_intp, &interpolated_variables,
+       &interpolated_variables_gen](const auto&... targets) {
+        uniform_intp.template interpolate<0, NumVar - 1>(
+            make_not_null(&interpolated_variables), targets...);
+        general_intp.template interpolate<0, NumVar - 1>(
+            make_not_null(&interpolated_variables_gen), targets...);
+      },
+      target_points);
+  for (size_t s = 0; s < number_of_target_points; ++s) {
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(point, d) = gsl::at(target_points, d)[s];
+    }
+    y_expected = mock_function(point);
+    CHECK(gsl::at(interpolated_variables, 0)[s] ==
+          approx(gsl::at(y_expected, 0)));
+    CHECK(gsl::at(interpolated_variables, 1)[s] ==
+          approx(gsl::at(y_expected, NumVar - 1)));
+    CHECK(gsl::at(interpolated_variables_gen, 0)[s] ==
+          approx(gsl::at(y_expected, 0)));
+    CHECK(gsl::at(interpolated_variables_gen, 1)[s] ==
+          approx(gsl::at(y_expected, NumVar - 1)));
+  }
 }
 }  // namespace
 
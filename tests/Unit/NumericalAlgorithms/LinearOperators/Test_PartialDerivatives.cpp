@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <memory>
 #include <pup.h>
+#include <random>
 #include <string>
 #include <type_traits>
 
@@ -19,6 +20,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -29,6 +31,7 @@
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/Tags.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -37,6 +40,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -487,8 +491,47 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+void test_apply_differentiation_matrix() {
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  // Covers both the fixed-extent kernels and the BLAS fallback
+  for (size_t extent = 1; extent <= 14; ++extent) {
+    CAPTURE(extent);
+    Matrix matrix(extent, extent);
+    for (size_t i = 0; i < extent; ++i) {
+      for (size_t j = 0; j < extent; ++j) {
+        matrix(i, j) = dist(gen);
+      }
+    }
+    for (const size_t number_of_stripes : {1_st, 3_st, 17_st}) {
+      CAPTURE(number_of_stripes);
+      const auto u = make_with_random_values<DataVector>(
+          make_not_null(&gen), make_not_null(&dist),
+          DataVector{extent * number_of_stripes});
+      DataVector expected{u.size(), 0.0};
+      for (size_t stripe = 0; stripe < number_of_stripes; ++stripe) {
+        for (size_t i = 0; i < extent; ++i) {
+          for (size_t j = 0; j < extent; ++j) {
+            expected[i + stripe * extent] +=
+                matrix(i, j) * u[j + stripe * extent];
+          }
+        }
+      }
+      DataVector result{u.size()};
+      partial_derivatives_detail::apply_differentiation_matrix(
+          make_not_null(result.data()), matrix, u.data(), number_of_stripes);
+      CHECK_ITERABLE_APPROX(result, expected);
+    }
+  }
+}
 }  // namespace
 
+SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.ApplyDifferentiationMatrix",
+                  "[NumericalAlgorithms][LinearOperators][Unit]") {
+  test_apply_differentiation_matrix();
+}
+
 // [[Timeout, 20]]
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.LogicalDerivs",
                   "[NumericalAlgorithms][LinearOperators][Unit]") {
@@ -88,6 +88,26 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.BuildMatrix",
     CHECK(operator_invocations == 2);
     CHECK(matrix_representation.nonZeros() == 2);
   }
+  {
+    INFO("Build column-major sparse matrix");
+    const blaze::DynamicMatrix<double> matrix{
+        {4., 0., 1.}, {0., 0., 0.}, {2., 3., 0.}};
+    const auto linear_operator =
+        [&matrix](const gsl::not_null<blaze::StaticVector<double, 3>*>
+                      local_result,
+                  const blaze::StaticVector<double, 3>& local_operand) {
+          *local_result = matrix * local_operand;
+        };
+    blaze::CompressedMatrix<double, blaze::columnMajor> matrix_representation(
+        3, 3);
+    blaze::StaticVector<double, 3> operand_buffer(0.);
+    blaze::StaticVector<double, 3> result_buffer(0.);
+    build_matrix(make_not_null(&matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 linear_operator);
+    CHECK(matrix_representation == matrix);
+    CHECK(matrix_representation.nonZeros() == 4);
+  }
   {
     INFO("Build matrix from a heterogeneous data structure");
     using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
@@ -75,8 +75,37 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.ExplicitInverse",
       // Still the inverse of the operator we solved first
       CHECK_ITERABLE_APPROX(solver.matrix_representation(), blaze::inv(matrix));
       CHECK_ITERABLE_APPROX(solution, expected_solution);
+      // Solving a problem of different size rebuilds the inverse even without
+      // resetting
+      const blaze::DynamicMatrix<double> matrix3{{2.}};
+      const helpers::ApplyMatrix<double> linear_operator3{matrix3};
+      const blaze::DynamicVector<double> source3{1.};
+      blaze::DynamicVector<double> solution3(1);
+      resetting_solver.solve(make_not_null(&solution3), linear_operator3,
+                             source3);
+      CHECK_ITERABLE_APPROX(resetting_solver.matrix_representation(),
+                            blaze::inv(matrix3));
+      CHECK_ITERABLE_APPROX(solution3, blaze::DynamicVector<double>{0.5});
     }
   }
+  {
+    INFO("Solve in single precision");
+    const blaze::DynamicMatrix<double> matrix{{4., 1.}, {3., 1.}};
+    const helpers::ApplyMatrix<double> linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2.};
+    const blaze::DynamicVector<double> expected_solution{-1., 5.};
+    blaze::DynamicVector<double> solution(2);
+    const auto solver = serialize_and_deserialize(
+        ExplicitInverse<double>{std::nullopt, true});
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    Approx single_precision_approx = Approx::custom().epsilon(1.e-6).scale(1.);
+    CHECK_ITERABLE_CUSTOM_APPROX(solver.matrix_representation(),
+                                 blaze::inv(matrix), single_precision_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(solution, expected_solution,
+                                 single_precision_approx);
+  }
   {
     INFO("Solve a complex matrix");
     const blaze::DynamicMatrix<std::complex<double>> matrix{
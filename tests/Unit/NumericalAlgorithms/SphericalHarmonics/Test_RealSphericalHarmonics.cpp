@@ -10,6 +10,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshInterpolation.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 
 namespace ylm {
 SPECTRE_TEST_CASE("Unit.SphericalHarmonics.RealSphericalHarmonics",
@@ -26,11 +27,23 @@ SPECTRE_TEST_CASE("Unit.SphericalHarmonics.RealSphericalHarmonics",
       make_not_null(&gen), make_not_null(&phi_distribution),
       DataVector(num_points));
   Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  const DataVector all_spherical_harmonics =
+      real_spherical_harmonics(thetas, phis, l_max);
+  CHECK(all_spherical_harmonics.size() == square(l_max + 1) * num_points);
+  size_t index = 0;
 
   for (size_t l = 0; l <= l_max; ++l) {
     for (int m = -l; m <= static_cast<int>(l); ++m) {
       const auto spherical_harmonic =
           real_spherical_harmonic(thetas, phis, l, m);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const DataVector batched_spherical_harmonic(
+          const_cast<double*>(all_spherical_harmonics.data()) +
+              index * num_points,
+          num_points);
+      CHECK_ITERABLE_CUSTOM_APPROX(batched_spherical_harmonic,
+                                   spherical_harmonic, custom_approx);
+      ++index;
       if (m == 0) {
         const Spectral::Swsh::SpinWeightedSphericalHarmonic
             complex_spherical_harmonic(0, l, m);
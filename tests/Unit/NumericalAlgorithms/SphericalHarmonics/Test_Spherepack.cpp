@@ -151,6 +151,64 @@ void test_loop_over_offset(
   }
 }
 
+void test_multiple_fields(const size_t l_max, const size_t m_max) {
+  const Spherepack ylm_spherepack(l_max, m_max);
+  const size_t physical_size = ylm_spherepack.physical_size();
+  const size_t spectral_size = ylm_spherepack.spectral_size();
+  const auto& theta = ylm_spherepack.theta_points();
+  const auto& phi = ylm_spherepack.phi_points();
+
+  // Instances with the same resolution share their tables
+  CHECK(&Spherepack(l_max, m_max).theta_points() == &theta);
+  const Spherepack ylm_copy = ylm_spherepack;
+  CHECK(&ylm_copy.phi_points() == &phi);
+
+  const YlmTestFunctions::Y00 y00{};
+  const YlmTestFunctions::Y10 y10{};
+  const YlmTestFunctions::Y11 y11{};
+  const std::array<const YlmTestFunctions::ScalarFunctionWithDerivs*, 3>
+      funcs{{&y00, &y10, &y11}};
+  const size_t number_of_fields = funcs.size();
+  DataVector u(number_of_fields * physical_size);
+  DataVector u_spec_expected(number_of_fields * spectral_size);
+  DataVector du_expected(2 * number_of_fields * physical_size);
+  for (size_t k = 0; k < number_of_fields; ++k) {
+    DataVector u_k(u.data() + k * physical_size, physical_size);
+    gsl::at(funcs, k)->func(&u_k, 1, 0, theta, phi);
+    DataVector u_spec_k(u_spec_expected.data() + k * spectral_size,
+                        spectral_size);
+    ylm_spherepack.phys_to_spec(u_spec_k.data(), u_k.data());
+    const std::array<double*, 2> du_k{
+        {du_expected.data() + k * physical_size,
+         du_expected.data() + (number_of_fields + k) * physical_size}};
+    ylm_spherepack.gradient(du_k, u_k.data());
+  }
+
+  DataVector u_spec(number_of_fields * spectral_size);
+  ylm_spherepack.phys_to_spec_multiple_fields(u_spec.data(), u.data(),
+                                              number_of_fields);
+  CHECK_ITERABLE_APPROX(u_spec, u_spec_expected);
+
+  DataVector u_test(number_of_fields * physical_size);
+  ylm_spherepack.spec_to_phys_multiple_fields(u_test.data(), u_spec.data(),
+                                              number_of_fields);
+  CHECK_ITERABLE_APPROX(u_test, u);
+
+  DataVector du(2 * number_of_fields * physical_size);
+  const std::array<double*, 2> du_components{
+      {du.data(), du.data() + number_of_fields * physical_size}};
+  ylm_spherepack.gradient_multiple_fields(du_components, u.data(),
+                                          number_of_fields);
+  CHECK_ITERABLE_APPROX(du, du_expected);
+
+  // A single field is forwarded to the single-field functions
+  DataVector u_spec_single(spectral_size);
+  ylm_spherepack.phys_to_spec_multiple_fields(u_spec_single.data(), u.data(),
+                                              1);
+  CHECK_ITERABLE_APPROX(u_spec_single,
+                        DataVector(u_spec_expected.data(), spectral_size));
+}
+
 void test_theta_phi_points(
     const size_t l_max, const size_t m_max,
     const YlmTestFunctions::ScalarFunctionWithDerivs& func) {
@@ -798,6 +856,12 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.Spherepack",
     }
   }
 
+  for (size_t l_max = 3; l_max < 5; ++l_max) {
+    for (size_t m_max = 2; m_max <= l_max; ++m_max) {
+      test_multiple_fields(l_max, m_max);
+    }
+  }
+
   test_prolong_restrict();
 
   Spherepack s(4, 4);
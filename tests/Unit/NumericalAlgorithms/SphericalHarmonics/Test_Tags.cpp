@@ -72,6 +72,17 @@ void test_radius_and_derivs() {
       db::get<ylm::Tags::PhysicalCenter<Frame::Inertial>>(box);
   CHECK(strahlkorper_physical_center == strahlkorper.physical_center());
 
+  // Test the angular derivatives of the radius shared by the compute tags
+  const auto expected_angular_derivs =
+      strahlkorper.ylm_spherepack().first_and_second_derivative(
+          strahlkorper_radius);
+  CHECK_ITERABLE_APPROX(
+      db::get<ylm::Tags::AngularGradientOfRadius<Frame::Inertial>>(box),
+      expected_angular_derivs.first);
+  CHECK_ITERABLE_APPROX(
+      db::get<ylm::Tags::AngularSecondDerivsOfRadius<Frame::Inertial>>(box),
+      expected_angular_derivs.second);
+
   // Test derivative of radius
   tnsr::i<DataVector, 3> expected_dx_radius(n_pts);
   for (size_t s = 0; s < n_pts; ++s) {
@@ -285,6 +296,12 @@ SPECTRE_TEST_CASE("Unit.SphericalHarmonics.Tags",
       "Radius");
   TestHelpers::db::test_simple_tag<ylm::Tags::CartesianCoords<Frame::Inertial>>(
       "CartesianCoords");
+  TestHelpers::db::test_simple_tag<
+      ylm::Tags::AngularGradientOfRadius<Frame::Inertial>>(
+      "AngularGradientOfRadius");
+  TestHelpers::db::test_simple_tag<
+      ylm::Tags::AngularSecondDerivsOfRadius<Frame::Inertial>>(
+      "AngularSecondDerivsOfRadius");
   TestHelpers::db::test_simple_tag<ylm::Tags::DxRadius<Frame::Inertial>>(
       "DxRadius");
   TestHelpers::db::test_simple_tag<ylm::Tags::D2xRadius<Frame::Inertial>>(
@@ -314,6 +331,12 @@ SPECTRE_TEST_CASE("Unit.SphericalHarmonics.Tags",
       ylm::Tags::PhysicalCenterCompute<Frame::Inertial>>("PhysicalCenter");
   TestHelpers::db::test_compute_tag<
       ylm::Tags::CartesianCoordsCompute<Frame::Inertial>>("CartesianCoords");
+  TestHelpers::db::test_compute_tag<
+      ylm::Tags::AngularGradientOfRadiusCompute<Frame::Inertial>>(
+      "AngularGradientOfRadius");
+  TestHelpers::db::test_compute_tag<
+      ylm::Tags::AngularSecondDerivsOfRadiusCompute<Frame::Inertial>>(
+      "AngularSecondDerivsOfRadius");
   TestHelpers::db::test_compute_tag<
       ylm::Tags::DxRadiusCompute<Frame::Inertial>>("DxRadius");
   TestHelpers::db::test_compute_tag<
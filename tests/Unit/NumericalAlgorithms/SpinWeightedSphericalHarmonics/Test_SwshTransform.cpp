@@ -26,6 +26,7 @@
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTags.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
 
@@ -286,6 +287,40 @@ void test_interpolate_to_collocation() {
   }
 }
 
+template <int S>
+void test_threaded_transforms() {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> coefficient_distribution{-10.0, 10.0};
+  const size_t l_max = 4;
+  // Enough radial points that the transforms are split into several chunks of
+  // at most `detail::max_libsharp_transforms` that don't divide evenly among
+  // the threads
+  const size_t number_of_radial_points = 123;
+  SpinWeighted<ComplexModalVector, S> modes{
+      number_of_radial_points * size_of_libsharp_coefficient_vector(l_max)};
+  TestHelpers::generate_swsh_modes<S>(
+      make_not_null(&modes.data()), make_not_null(&gen),
+      make_not_null(&coefficient_distribution), number_of_radial_points, l_max);
+
+  CHECK(number_of_transform_threads() == 1);
+  const auto expected_collocation =
+      inverse_swsh_transform(l_max, number_of_radial_points, modes);
+  const auto expected_modes =
+      swsh_transform(l_max, number_of_radial_points, expected_collocation);
+  for (const size_t number_of_threads : {2_st, 3_st, 7_st}) {
+    CAPTURE(number_of_threads);
+    set_number_of_transform_threads(number_of_threads);
+    CHECK(number_of_transform_threads() == number_of_threads);
+    const auto collocation =
+        inverse_swsh_transform(l_max, number_of_radial_points, modes);
+    CHECK_ITERABLE_APPROX(collocation.data(), expected_collocation.data());
+    CHECK_ITERABLE_APPROX(
+        swsh_transform(l_max, number_of_radial_points, collocation).data(),
+        expected_modes.data());
+  }
+  set_number_of_transform_threads(1);
+}
+
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshTransform",
                   "[Unit][NumericalAlgorithms]") {
   {
@@ -312,6 +347,11 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshTransform",
     test_interpolate_to_collocation<0>();
     test_interpolate_to_collocation<-1>();
   }
+  {
+    INFO("Testing transforms split across threads");
+    test_threaded_transforms<0>();
+    test_threaded_transforms<-2>();
+  }
 }
 }  // namespace
 }  // namespace Spectral::Swsh
@@ -9,6 +9,8 @@
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocationsReference.hpp"
+#include "Parallel/ArrayCollection/Tags/MeasuredElementCosts.hpp"
+#include "Parallel/ArrayCollection/Tags/NodesWithMeasuredElementCosts.hpp"
 #include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
 
 namespace Parallel {
@@ -19,6 +21,10 @@ SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.Tags", "[Unit][Parallel]") {
       "ElementLocations");
   TestHelpers::db::test_reference_tag<
       Tags::ElementLocationsReference<3, void, void>>("ElementLocations");
+  TestHelpers::db::test_simple_tag<Tags::MeasuredElementCosts<3>>(
+      "MeasuredElementCosts");
+  TestHelpers::db::test_simple_tag<Tags::NodesWithMeasuredElementCosts>(
+      "NodesWithMeasuredElementCosts");
   TestHelpers::db::test_simple_tag<Tags::NumberOfElementsTerminated>(
       "NumberOfElementsTerminated");
 }
@@ -11,6 +11,7 @@
 
 #include "Parallel/Printf/Printf.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 struct TestStream {
@@ -61,6 +62,17 @@ void test_fprintf() {
       Catch::Matchers::ContainsSubstring("Could not open '" + test_file + "'"));
   file_system::rm(test_file, true);
 }
+
+void test_rate_limit() {
+  CHECK(Parallel::detail::rate_limit("SourceA", 1.0e6) == 0_st);
+  CHECK_FALSE(Parallel::detail::rate_limit("SourceA", 1.0e6).has_value());
+  CHECK_FALSE(Parallel::detail::rate_limit("SourceA", 1.0e6).has_value());
+  // Sources are limited independently
+  CHECK(Parallel::detail::rate_limit("SourceB", 1.0e6) == 0_st);
+  // The interval has passed, so the dropped messages are reported
+  CHECK(Parallel::detail::rate_limit("SourceA", 0.0) == 2_st);
+  CHECK(Parallel::detail::rate_limit("SourceA", 0.0) == 0_st);
+}
 }  // namespace
 
 // [output_test_example]
@@ -85,5 +97,6 @@ SPECTRE_TEST_CASE("Unit.Parallel.printf", "[Unit][Parallel]") {
   delete[] c_string1; // NOLINT
 
   test_fprintf();
+  test_rate_limit();
 }
 // [output_test_example]
@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/Phase.hpp"
+
+namespace {
+struct Component {};
+struct ActionA {};
+struct ActionB {};
+
+SPECTRE_TEST_CASE("Unit.Parallel.ActionTimings", "[Unit][Parallel]") {
+  // Discard anything recorded by other tests in this executable
+  Parallel::collect_action_timings();
+  CHECK(Parallel::collect_action_timings().empty());
+
+  const std::string component_name = pretty_type::name<Component>();
+  const std::string name_a = pretty_type::name<ActionA>();
+  const std::string name_b = pretty_type::name<ActionB>();
+
+  Parallel::record_action_timing<Component, ActionA>(
+      Parallel::Phase::Evolve, 1.0, false, 0.0);
+  Parallel::record_action_timing<Component, ActionA>(
+      Parallel::Phase::Evolve, 0.5, true, 0.0);
+  Parallel::record_action_timing<Component, ActionA>(
+      Parallel::Phase::Initialization, 2.0, false, 0.0);
+  // Timings recorded on other threads are collected as well
+  std::thread other_thread{[]() {
+    Parallel::record_action_timing<Component, ActionA>(
+        Parallel::Phase::Evolve, 0.25, true, 4.0);
+    Parallel::record_action_timing<Component, ActionB>(
+        Parallel::Phase::Evolve, 3.0, false, 0.0);
+  }};
+  other_thread.join();
+
+  const auto timings = Parallel::collect_action_timings();
+  CHECK(timings.size() == 3);
+  const auto& evolve_a = timings.at(
+      std::tuple{component_name, Parallel::Phase::Evolve, name_a});
+  CHECK(evolve_a.calls == 3);
+  CHECK(evolve_a.retries == 2);
+  CHECK(evolve_a.time == approx(1.75));
+  CHECK(evolve_a.retry_time == approx(0.75));
+  CHECK(evolve_a.wait_time == approx(4.0));
+  CHECK(timings.at(std::tuple{component_name, Parallel::Phase::Initialization,
+                              name_a}) ==
+        Parallel::ActionTiming{1, 0, 2.0, 0.0, 0.0});
+  CHECK(timings.at(std::tuple{component_name, Parallel::Phase::Evolve,
+                              name_b}) ==
+        Parallel::ActionTiming{1, 0, 3.0, 0.0, 0.0});
+  CHECK(evolve_a != Parallel::ActionTiming{});
+  test_serialization(evolve_a);
+
+  // Collecting resets the timings
+  CHECK(Parallel::collect_action_timings().empty());
+  Parallel::record_action_timing(component_name, Parallel::Phase::Evolve,
+                                 name_b, 1.5, false, 0.5);
+  CHECK(Parallel::collect_action_timings() ==
+        Parallel::ActionTimings{
+            {std::tuple{component_name, Parallel::Phase::Evolve, name_b},
+             Parallel::ActionTiming{1, 0, 1.5, 0.0, 0.5}}});
+}
+}  // namespace
@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <thread>
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/KernelTimings.hpp"
+
+namespace {
+// [kernel_timer_example]
+double expensive_kernel(const double x) {
+  SPECTRE_KERNEL_TIMER("ExpensiveKernel");
+  return x * x;
+}
+// [kernel_timer_example]
+
+SPECTRE_TEST_CASE("Unit.Parallel.KernelTimings", "[Unit][Parallel]") {
+  // Discard anything recorded by other tests in this executable
+  Parallel::collect_kernel_timings();
+  CHECK(Parallel::collect_kernel_timings().empty());
+
+  static const std::string name_a = "KernelA";
+  static const std::string name_b = "KernelB";
+
+  Parallel::record_kernel_timing(name_a, 1.0);
+  Parallel::record_kernel_timing(name_a, 0.5);
+  // Timings recorded on other threads are collected as well
+  std::thread other_thread{[]() {
+    Parallel::record_kernel_timing(name_a, 2.0);
+    Parallel::record_kernel_timing(name_b, 3.0);
+  }};
+  other_thread.join();
+
+  const auto timings = Parallel::collect_kernel_timings();
+  CHECK(timings.size() == 2);
+  const auto& timing_a = timings.at(name_a);
+  CHECK(timing_a.calls == 3);
+  CHECK(timing_a.time == approx(3.5));
+  CHECK(timing_a.min_time == 0.5);
+  CHECK(timing_a.max_time == 2.0);
+  CHECK(timings.at(name_b) == Parallel::KernelTiming{1, 3.0, 3.0, 3.0});
+  CHECK(timing_a != Parallel::KernelTiming{});
+  test_serialization(timing_a);
+
+  // Collecting resets the timings
+  CHECK(Parallel::collect_kernel_timings().empty());
+  {
+    const Parallel::ScopedKernelTimer timer{name_b};
+  }
+  const auto scoped_timings = Parallel::collect_kernel_timings();
+  CHECK(scoped_timings.size() == 1);
+  CHECK(scoped_timings.at(name_b).calls == 1);
+  CHECK(scoped_timings.at(name_b).time >= 0.0);
+
+  CHECK(expensive_kernel(3.0) == 9.0);
+#ifdef SPECTRE_PROFILE_KERNELS
+  CHECK(Parallel::collect_kernel_timings().at("ExpensiveKernel").calls == 1);
+#else
+  CHECK(Parallel::collect_kernel_timings().empty());
+#endif  // SPECTRE_PROFILE_KERNELS
+}
+}  // namespace
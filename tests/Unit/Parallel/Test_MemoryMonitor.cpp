@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -24,6 +25,7 @@
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessHighWaterMark.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
 #include "Utilities/Gsl.hpp"
@@ -430,6 +432,55 @@ void test_process_array(const gsl::not_null<Gen*> gen) {
   check_output<array_comp<metavars>>(runner, time, num_nodes, size_per_node);
 }
 
+template <typename Gen>
+void test_process_high_water_mark(const gsl::not_null<Gen*> gen) {
+  INFO("Test ProcessHighWaterMark");
+  std::uniform_real_distribution<double> dist{0, 10.0};
+
+  // 4 mock nodes, 3 mock cores per node
+  const size_t num_nodes = 4;
+  const size_t num_procs_per_node = 3;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, num_procs_per_node)};
+
+  setup_runner(make_not_null(&runner));
+
+  auto& cache = ActionTesting::cache<mem_mon_comp<metavars>>(runner, 0);
+  auto& mem_monitor_proxy =
+      Parallel::get_parallel_component<mem_mon_comp<metavars>>(cache);
+
+  const double time = 0.5;
+  std::vector<double> high_water_marks(num_nodes);
+  fill_with_random_values(make_not_null(&high_water_marks), gen,
+                          make_not_null(&dist));
+
+  Parallel::simple_action<mem_monitor::ProcessHighWaterMark>(
+      mem_monitor_proxy, time, high_water_marks);
+  ActionTesting::invoke_queued_simple_action<mem_mon_comp<metavars>>(
+      make_not_null(&runner), 0);
+  CHECK(ActionTesting::number_of_queued_threaded_actions<
+            obs_writer_comp<metavars>>(runner, 0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp<metavars>, TestHelpers::observers::MockReductionFileTag>(
+      runner, 0);
+  const auto& dataset = read_file.get_dat("/MemoryMonitors/HighWaterMark");
+  const std::vector<std::string>& legend = dataset.get_legend();
+  // time, high-water mark on node 0, ..., max over nodes
+  CHECK(legend.size() == num_nodes + 2);
+  CHECK(legend[1] == "High-water mark on node 0 (MB)");
+  const Matrix data = dataset.get_data();
+  CHECK(data.rows() == 1);
+  CHECK(data(0, 0) == time);
+  for (size_t i = 0; i < num_nodes; i++) {
+    CHECK(data(0, i + 1) == high_water_marks[i]);
+  }
+  CHECK(data(0, num_nodes + 1) == *std::max_element(high_water_marks.begin(),
+                                                    high_water_marks.end()));
+}
+
 void test_process_singleton() {
   INFO("Test ProcessSingleton");
 
@@ -660,6 +711,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   // Then test the Process(Node)Group actions (second arg true)
   test_contribute_memory_data(make_not_null(&gen), true);
   test_process_array(make_not_null(&gen));
+  test_process_high_water_mark(make_not_null(&gen));
   test_process_singleton();
   test_event_construction();
   test_monitor_memory_event();
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -34,6 +35,24 @@ struct FakeSingleton {
   using simple_tags_from_options = tmpl::list<>;
 };
 
+template <typename Metavariables>
+struct FakeHeavySingleton {
+  using chare_type = Parallel::Algorithms::Singleton;
+  using metavariables = Metavariables;
+  static constexpr bool exclusive_by_default = true;
+  static std::string name() { return "FakeHeavySingleton"; }
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+  using simple_tags_from_options = tmpl::list<>;
+};
+
+struct HeavyMetavariables {
+  using component_list =
+      tmpl::list<FakeSingleton<HeavyMetavariables, 0>,
+                 FakeHeavySingleton<HeavyMetavariables>,
+                 FakeSingleton<HeavyMetavariables, 1>>;
+};
+
 template <size_t... Indices>
 struct Metavariables {
   using component_list = tmpl::list<FakeSingleton<Metavariables, Indices>...>;
@@ -903,6 +922,68 @@ void test_multi_node_multi_core_large(const gsl::not_null<Gen*> gen) {
     check_resource_info(cache, true, singletons, expected);
   }
 }
+void test_exclusive_by_default() {
+  using metavars = HeavyMetavariables;
+  using heavy = FakeHeavySingleton<metavars>;
+  using light_0 = FakeSingleton<metavars, 0>;
+  using light_1 = FakeSingleton<metavars, 1>;
+  static_assert(exclusive_by_default_v<heavy>);
+  static_assert(not exclusive_by_default_v<light_0>);
+  CHECK(SingletonInfoHolder<heavy>{}.is_exclusive());
+  CHECK_FALSE(SingletonInfoHolder<light_0>{}.is_exclusive());
+
+  {
+    INFO("Reserve a proc for the heavy singleton");
+    Parallel::GlobalCache<metavars> cache{{}, {}, {2, 2}};
+    auto resource_info =
+        TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
+            "AvoidGlobalProc0: false\n"
+            "Singletons: Auto\n");
+    resource_info.build_singleton_map(cache);
+    const size_t heavy_proc = resource_info.proc_for<heavy>();
+    CHECK(resource_info.get_singleton_info<heavy>().is_exclusive());
+    CHECK_FALSE(resource_info.get_singleton_info<light_0>().is_exclusive());
+    CHECK_FALSE(resource_info.get_singleton_info<light_1>().is_exclusive());
+    CHECK(resource_info.procs_to_ignore() ==
+          std::unordered_set<size_t>{heavy_proc});
+    CHECK(resource_info.procs_available_for_elements().count(heavy_proc) ==
+          0);
+    CHECK(resource_info.procs_available_for_elements().size() == 3);
+    CHECK(resource_info.proc_for<light_0>() != heavy_proc);
+    CHECK(resource_info.proc_for<light_1>() != heavy_proc);
+    CHECK(serialize_and_deserialize(resource_info) == resource_info);
+  }
+  {
+    INFO("Explicit options take precedence");
+    Parallel::GlobalCache<metavars> cache{{}, {}, {2, 2}};
+    auto resource_info =
+        TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
+            "AvoidGlobalProc0: false\n"
+            "Singletons:\n"
+            "  FakeSingleton0: Auto\n"
+            "  FakeHeavySingleton:\n"
+            "    Proc: Auto\n"
+            "    Exclusive: false\n"
+            "  FakeSingleton1: Auto\n");
+    resource_info.build_singleton_map(cache);
+    CHECK_FALSE(resource_info.get_singleton_info<heavy>().is_exclusive());
+    CHECK(resource_info.procs_to_ignore().empty());
+    CHECK(resource_info.procs_available_for_elements().size() == 4);
+  }
+  {
+    INFO("Not enough procs to reserve one");
+    Parallel::GlobalCache<metavars> cache{};
+    auto resource_info =
+        TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
+            "AvoidGlobalProc0: false\n"
+            "Singletons: Auto\n");
+    resource_info.build_singleton_map(cache);
+    CHECK_FALSE(resource_info.get_singleton_info<heavy>().is_exclusive());
+    CHECK(resource_info.proc_for<heavy>() == 0);
+    CHECK(resource_info.procs_to_ignore().empty());
+    CHECK(resource_info.procs_available_for_elements() == std::set<size_t>{0});
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
@@ -914,6 +995,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
   test_single_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core_large(make_not_null(&gen));
+  test_exclusive_by_default();
   test_errors();
 }
 }  // namespace Parallel
@@ -48,13 +48,14 @@ struct MockCreateParent {
       ElementId<Metavariables::volume_dim> parent_id,
       const ElementId<Metavariables::volume_dim>& child_id,
       std::deque<ElementId<Metavariables::volume_dim>> sibling_ids_to_collect,
-      const std::unordered_map<Parallel::Phase, size_t>&
-          child_phase_bookmarks) {
+      const std::unordered_map<Parallel::Phase, size_t>& child_phase_bookmarks,
+      const int new_element_proc) {
     CHECK(parent_id == ElementId<1>{0, std::array{SegmentId{2, 0}}});
     CHECK(child_id == ElementId<1>{0, std::array{SegmentId{3, 0}}});
     CHECK(sibling_ids_to_collect ==
           std::deque{ElementId<1>{0, std::array{SegmentId{3, 1}}}});
     CHECK(child_phase_bookmarks.empty());
+    CHECK(new_element_proc == 0);
   }
 };
 
@@ -67,8 +68,8 @@ struct MockCreateChild {
       ElementId<Metavariables::volume_dim> parent_id,
       std::vector<ElementId<Metavariables::volume_dim>> children_ids,
       const size_t index_of_child_id,
-      const std::unordered_map<Parallel::Phase, size_t>&
-          parent_phase_bookmarks) {
+      const std::unordered_map<Parallel::Phase, size_t>& parent_phase_bookmarks,
+      const int new_element_proc) {
     CHECK(parent_id == ElementId<1>{0, std::array{SegmentId{1, 1}}});
     if (index_of_child_id == 0) {
       CHECK(children_ids ==
@@ -81,6 +82,7 @@ struct MockCreateChild {
                         ElementId<1>{0, std::array{SegmentId{2, 3}}}});
     }
     CHECK(parent_phase_bookmarks.empty());
+    CHECK(new_element_proc == 0);
   }
 };
 
@@ -139,7 +139,7 @@ void test() {
   // the singleton component in order to create the second child
   ActionTesting::simple_action<singleton_component, amr::Actions::CreateChild>(
       make_not_null(&runner), 0, element_proxy, parent_id, children_ids, 0_st,
-      std::unordered_map<Parallel::Phase, size_t>{});
+      std::unordered_map<Parallel::Phase, size_t>{}, 0);
   for (const auto& child_id : children_ids) {
     CHECK(ActionTesting::is_simple_action_queue_empty<array_component>(
         runner, child_id));
@@ -13,11 +13,13 @@
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/PowerMonitors.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/TruncationError.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
@@ -50,7 +52,11 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
                   "[Unit][ParallelAlgorithms]") {
   static constexpr size_t Dim = 2;
   register_factory_classes_with_charm<Metavariables<Dim>>();
-  const TruncationError<Dim, tmpl::list<TestVector<Dim>>> criterion{
+  TestHelpers::db::test_compute_tag<
+      Tags::PowerMonitorsCompute<TestVector<Dim>, tmpl::size_t<Dim>>>(
+      "PowerMonitors");
+  using CriterionType = TruncationError<Dim, tmpl::list<TestVector<Dim>>>;
+  const CriterionType criterion{
       {"TestVector"}, 1.e-3, 1.e-3};
   const auto criterion_from_option_string = TestHelpers::test_factory_creation<
       amr::Criterion, TruncationError<Dim, tmpl::list<TestVector<Dim>>>>(
@@ -77,10 +83,24 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
         db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
             mesh, std::move(test_data));
     ObservationBox<
-        tmpl::list<>,
+        CriterionType::compute_tags_for_observation_box,
         db::DataBox<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>>
         box{make_not_null(&databox)};
 
+    // The power monitors are computed once for each tensor component
+    const auto& power_monitors =
+        get<Tags::PowerMonitors<TestVector<Dim>, tmpl::size_t<Dim>>>(box);
+    const auto& tensor = get<TestVector<Dim>>(box);
+    REQUIRE(power_monitors.size() == tensor.size());
+    for (size_t i = 0; i < tensor.size(); ++i) {
+      const auto expected_power_monitors =
+          PowerMonitors::power_monitors(tensor[i], mesh);
+      for (size_t d = 0; d < Dim; ++d) {
+        CHECK_ITERABLE_APPROX(gsl::at(power_monitors[i], d),
+                              gsl::at(expected_power_monitors, d));
+      }
+    }
+
     return criterion.evaluate(box, empty_cache, ElementId<Dim>{0});
   };
 
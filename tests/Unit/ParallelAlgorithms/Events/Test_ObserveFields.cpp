@@ -468,6 +468,25 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
                 interpolating_mesh)),
         interpolating_mesh, true);
   }
+
+  {
+    INFO("Coarsen each element's mesh");
+    const auto coarsening =
+        TestHelpers::test_creation<dg::Events::CoarsenObservationMesh>(
+            "Factor: 2");
+    CHECK(coarsening.factor == 2);
+    CHECK(coarsening(Mesh<2>{{{9, 4}},
+                             Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto}) ==
+          Mesh<2>{{{5, 2}},
+                  Spectral::Basis::Legendre,
+                  Spectral::Quadrature::GaussLobatto});
+    CHECK(dg::Events::CoarsenObservationMesh{8}(
+              Mesh<1>{3, Spectral::Basis::Legendre,
+                      Spectral::Quadrature::Gauss}) ==
+          Mesh<1>{1, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
+    CHECK(serialize_and_deserialize(coarsening).factor == 2);
+  }
   CHECK_THROWS_WITH(
       TestHelpers::test_creation<
           typename ScalarSystem<dg::Events::ObserveFields>::ObserveEvent>(
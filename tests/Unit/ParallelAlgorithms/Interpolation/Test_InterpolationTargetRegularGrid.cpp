@@ -0,0 +1,135 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Creators/Sphere.hpp"
+#include "Domain/Domain.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Helpers/ParallelAlgorithms/Interpolation/InterpolationTargetTestHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
+#include "ParallelAlgorithms/Interpolation/Targets/RegularGrid.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Time/Tags/TimeStepId.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+
+template <InterpTargetTestHelpers::ValidPoints ValidPoints>
+domain::creators::Sphere make_sphere() {
+  if constexpr (ValidPoints == InterpTargetTestHelpers::ValidPoints::All) {
+    return {0.9, 4.9, domain::creators::Sphere::Excision{}, 1_st, 5_st, false};
+  }
+  if constexpr (ValidPoints == InterpTargetTestHelpers::ValidPoints::None) {
+    return {4.9, 8.9, domain::creators::Sphere::Excision{}, 1_st, 5_st, false};
+  }
+  return {3.4, 4.9, domain::creators::Sphere::Excision{}, 1_st, 5_st, false};
+}
+
+template <typename Frame>
+struct MockMetavariables {
+  struct InterpolationTargetA
+      : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
+    using temporal_id = ::Tags::TimeStepId;
+    using vars_to_interpolate_to_target =
+        tmpl::list<gr::Tags::Lapse<DataVector>>;
+    using compute_items_on_target = tmpl::list<>;
+    using compute_target_points =
+        ::intrp::TargetPoints::RegularGrid<InterpolationTargetA, 3, Frame>;
+    using post_interpolation_callbacks = tmpl::list<>;
+  };
+  static constexpr size_t volume_dim = 3;
+  using interpolator_source_vars = tmpl::list<gr::Tags::Lapse<DataVector>>;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+
+  using component_list =
+      tmpl::list<InterpTargetTestHelpers::mock_interpolation_target<
+                     MockMetavariables, InterpolationTargetA>,
+                 InterpTargetTestHelpers::mock_interpolator<MockMetavariables>>;
+};
+
+template <InterpTargetTestHelpers::ValidPoints ValidPoints>
+void test() {
+  // Options for RegularGrid
+  intrp::OptionHolders::RegularGrid<3> regular_grid_opts(
+      {{1.0, 1.0, 1.0}}, {{2.0, 2.0, 2.5}}, {{3, 2, 4}});
+
+  // Test creation of options
+  const auto created_opts =
+      TestHelpers::test_creation<intrp::OptionHolders::RegularGrid<3>>(
+          "LowerCorner: [1.0, 1.0, 1.0]\n"
+          "UpperCorner: [2.0, 2.0, 2.5]\n"
+          "NumberOfPoints: [3, 2, 4]");
+  CHECK(created_opts == regular_grid_opts);
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<intrp::OptionHolders::RegularGrid<3>>(
+          "LowerCorner: [1.0, 1.0, 1.0]\n"
+          "UpperCorner: [2.0, 2.0, 2.5]\n"
+          "NumberOfPoints: [3, 1, 4]"),
+      Catch::Matchers::ContainsSubstring(
+          "RegularGrid expects at least 2 points in each dimension"));
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<intrp::OptionHolders::RegularGrid<3>>(
+          "LowerCorner: [1.0, 1.0, 1.0]\n"
+          "UpperCorner: [2.0, 1.0, 2.5]\n"
+          "NumberOfPoints: [3, 2, 4]"),
+      Catch::Matchers::ContainsSubstring(
+          "RegularGrid expects LowerCorner < UpperCorner"));
+
+  const auto domain_creator = make_sphere<ValidPoints>();
+
+  const auto expected_block_coord_holders = [&domain_creator]() {
+    tnsr::I<DataVector, 3, Frame::Inertial> points(24);
+    size_t s = 0;
+    for (size_t k = 0; k < 4; ++k) {
+      for (size_t j = 0; j < 2; ++j) {
+        for (size_t i = 0; i < 3; ++i) {
+          // The first dimension varies fastest
+          get<0>(points)[s] = 1.0 + 0.5 * i;
+          get<1>(points)[s] = 1.0 + 1.0 * j;
+          get<2>(points)[s] = 1.0 + 0.5 * k;
+          ++s;
+        }
+      }
+    }
+    return block_logical_coordinates(domain_creator.create_domain(), points);
+  }();
+
+  TestHelpers::db::test_simple_tag<intrp::Tags::RegularGrid<
+      MockMetavariables<Frame::Grid>::InterpolationTargetA, 3>>("RegularGrid");
+  TestHelpers::db::test_simple_tag<intrp::Tags::RegularGrid<
+      MockMetavariables<Frame::Inertial>::InterpolationTargetA, 3>>(
+      "RegularGrid");
+
+  InterpTargetTestHelpers::test_interpolation_target<
+      MockMetavariables<Frame::Grid>,
+      intrp::Tags::RegularGrid<
+          MockMetavariables<Frame::Grid>::InterpolationTargetA, 3>>(
+      domain_creator, regular_grid_opts, expected_block_coord_holders);
+  InterpTargetTestHelpers::test_interpolation_target<
+      MockMetavariables<Frame::Inertial>,
+      intrp::Tags::RegularGrid<
+          MockMetavariables<Frame::Inertial>::InterpolationTargetA, 3>>(
+      domain_creator, regular_grid_opts, expected_block_coord_holders);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.InterpolationTarget.RegularGrid",
+                  "[Unit]") {
+  domain::creators::register_derived_with_charm();
+  test<InterpTargetTestHelpers::ValidPoints::All>();
+  test<InterpTargetTestHelpers::ValidPoints::Some>();
+  test<InterpTargetTestHelpers::ValidPoints::None>();
+}
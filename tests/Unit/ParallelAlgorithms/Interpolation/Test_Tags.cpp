@@ -93,6 +93,8 @@ SPECTRE_TEST_CASE("Unit.Interpolation.Tags", "[Unit][NumericalAlgorithms]") {
       "TemporalIds");
   TestHelpers::db::test_simple_tag<intrp::Tags::CompletedTemporalIds<Metavars>>(
       "CompletedTemporalIds");
+  TestHelpers::db::test_simple_tag<intrp::Tags::PreviousBlockLogicalCoords<3>>(
+      "PreviousBlockLogicalCoords");
   TestHelpers::db::test_simple_tag<
       intrp::Tags::VolumeVarsInfo<Metavars, SomeTag>>("VolumeVarsInfo");
   TestHelpers::db::test_simple_tag<
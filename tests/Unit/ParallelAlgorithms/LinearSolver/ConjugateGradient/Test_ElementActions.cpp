@@ -44,6 +44,8 @@ struct ElementArray {
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = int;
+  using inbox_tags =
+      tmpl::list<LinearSolver::cg::detail::Tags::Alpha<DummyOptionsGroup>>;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
           Parallel::Phase::Initialization,
@@ -141,6 +143,18 @@ SPECTRE_TEST_CASE(
     test_initialize_has_converged(Convergence::HasConverged{1, 1});
   }
 
+  SECTION("ComputeAlpha") {
+    ActionTesting::simple_action<
+        element_array,
+        LinearSolver::cg::detail::ComputeAlpha<fields_tag, DummyOptionsGroup>>(
+        make_not_null(&runner), 0, 0_st, 2., 1.);
+    CHECK(ActionTesting::get_inbox_tag<
+              element_array,
+              LinearSolver::cg::detail::Tags::Alpha<DummyOptionsGroup>>(
+              runner, 0)
+              .at(0) == 0.5);
+  }
+
   const auto test_update_operand = [&runner, &get_tag,
                                     &set_tag](const Convergence::HasConverged&
                                                   has_converged) {
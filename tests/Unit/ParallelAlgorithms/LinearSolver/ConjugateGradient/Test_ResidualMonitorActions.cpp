@@ -178,23 +178,6 @@ SPECTRE_TEST_CASE(
               .at(0));
   }
 
-  SECTION("ComputeAlpha") {
-    ActionTesting::simple_action<
-        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
-                              fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
-    ActionTesting::simple_action<
-        residual_monitor, LinearSolver::cg::detail::ComputeAlpha<
-                              fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 2.);
-    // Test residual monitor state
-    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 1.);
-    // Test element state
-    CHECK(get_element_inbox_tag(
-              LinearSolver::cg::detail::Tags::Alpha<TestLinearSolver>{})
-              .at(0) == 0.5);
-  }
-
   SECTION("UpdateResidual") {
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
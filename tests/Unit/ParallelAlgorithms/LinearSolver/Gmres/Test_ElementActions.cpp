@@ -209,12 +209,15 @@ void test_element_actions() {
             element_array,
             LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
                 DummyOptionsGroup, double>>(make_not_null(&runner), 0);
-        const double normalization = 4.;
+        const double normalization = 3.;
+        const std::vector<double> reorthogonalization{1., 0.};
         const blaze::DynamicVector<double> minres{2., 4.};
         CAPTURE(has_converged);
-        inbox[iteration_id] =
-            std::make_tuple(normalization, minres, has_converged);
+        inbox[iteration_id] = std::make_tuple(
+            normalization, reorthogonalization, minres, has_converged);
         ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
+        // (operand - reorthogonalization * basis_history) / normalization
+        // = (2 - 1 * 0.5) / 3 = 0.5
         CHECK_ITERABLE_APPROX(get_tag(operand_tag{}),
                               blaze::DynamicVector<double>(3, 0.5));
         CHECK(get_tag(basis_history_tag{}).size() == 3);
@@ -158,7 +158,7 @@ SPECTRE_TEST_CASE(
                 TestLinearSolver>{})
             .at(0);
     CHECK(get<0>(element_inbox) == 2.);
-    const auto& has_converged = get<1>(element_inbox);
+    const auto& has_converged = get<2>(element_inbox);
     CHECK_FALSE(has_converged);
     // Test observer writer state
     CHECK(get_observer_writer_tag(helpers::CheckSubfileNameTag{}) ==
@@ -186,7 +186,7 @@ SPECTRE_TEST_CASE(
                 TestLinearSolver>{})
             .at(0);
     CHECK(get<0>(element_inbox) == 0.);
-    const auto& has_converged = get<1>(element_inbox);
+    const auto& has_converged = get<2>(element_inbox);
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::AbsoluteResidual);
   }
@@ -200,7 +200,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 2.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{2.});
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
           2.);
@@ -208,7 +208,7 @@ SPECTRE_TEST_CASE(
     CHECK(get_element_inbox_tag(
               LinearSolver::gmres::detail::Tags::Orthogonalization<
                   TestLinearSolver, double>{})
-              .at(1) == 2.);
+              .at(1) == std::vector<double>{2.});
   }
 
   SECTION("StoreOrthogonalization (final)") {
@@ -222,36 +222,39 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{3.});
     // Test intermediate residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
           3.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 4.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.5, 4.25});
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     // Test residual monitor state
-    // H = [[3.], [2.]]
+    // The re-orthogonalization adds to the projection, and the normalization
+    // is sqrt(4.25 - 0.5^2) = 2.
+    // H = [[3.5], [2.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
-          blaze::DynamicMatrix<double>({{3.}, {2.}}));
+          blaze::DynamicMatrix<double>({{3.5}, {2.}}));
     // Test element state
     const auto& element_inbox =
         get_element_inbox_tag(
             LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
                 TestLinearSolver, double>{})
             .at(1);
+    CHECK(get<1>(element_inbox) == std::vector<double>{0.5});
     // beta = [2., 0.]
-    // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.4615384615384615]
-    const auto& minres = get<1>(element_inbox);
+    // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.4307692307692308]
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres,
-                          blaze::DynamicVector<double>({0.4615384615384615}));
-    // r = beta - H * minres = [0.6153846153846154, -0.923076923076923]
-    // |r| = 1.1094003924504583
-    const double residual_magnitude = 1.1094003924504583;
-    const auto& has_converged = get<2>(element_inbox);
+                          blaze::DynamicVector<double>({0.4307692307692308}));
+    // r = beta - H * minres = [0.4923076923076923, -0.8615384615384616]
+    // |r| = 0.9922778767136677
+    const double residual_magnitude = 0.9922778767136677;
+    const auto& has_converged = get<3>(element_inbox);
     CHECK_FALSE(has_converged);
     CHECK(get<0>(element_inbox) == approx(2.));
     // Test observer writer state
@@ -274,11 +277,11 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 1.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{1.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 0.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0., 0.});
     // Test residual monitor state
     // H = [[1.], [0.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -291,12 +294,12 @@ SPECTRE_TEST_CASE(
             .at(1);
     // beta = [2., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [2.]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres, blaze::DynamicVector<double>({2.}));
     // r = beta - H * minres = [0., 0.]
     // |r| = 0.
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::AbsoluteResidual);
     CHECK(get<0>(element_inbox) == 0.);
@@ -312,23 +315,20 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 1.);
-    ActionTesting::simple_action<
-        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
-                              fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 4.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{1.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0., 4.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2_st, 1_st, 4.);
+        make_not_null(&runner), 0, 2_st, 0_st, std::vector<double>{3., 4.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2_st, 2_st, 25.);
+        make_not_null(&runner), 0, 2_st, 1_st,
+        std::vector<double>{0., 0., 25.});
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
           blaze::DynamicMatrix<double>({{1., 3.}, {2., 4.}, {0., 5.}}));
@@ -340,14 +340,14 @@ SPECTRE_TEST_CASE(
             .at(2);
     // beta = [1., 0., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.13178295, 0.03100775]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 2);
     CHECK_ITERABLE_APPROX(
         minres,
         blaze::DynamicVector<double>({0.1317829457364342, 0.0310077519379845}));
     // r = beta - H * minres = [0.77519, -0.38759, -0.15503]
     // |r| = 0.8804509063256237
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     CHECK(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::MaxIterations);
   }
@@ -361,11 +361,11 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{3.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 1.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0., 1.});
     // Test residual monitor state
     // H = [[3.], [1.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -378,13 +378,13 @@ SPECTRE_TEST_CASE(
             .at(1);
     // beta = [2., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.6]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres, blaze::DynamicVector<double>({0.6}));
     // r = beta - H * minres = [0.2, -0.6]
     // |r| = 0.6324555320336759
     // |r| / |r_initial| = 0.31622776601683794
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
@@ -398,11 +398,11 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{3.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 1.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0., 1.});
     // Test residual monitor state
     // H = [[3.], [1.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -414,10 +414,10 @@ SPECTRE_TEST_CASE(
             LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
                 TestLinearSolver, double>{})
             .at(1);
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres, blaze::DynamicVector<double>({0.}));
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     REQUIRE(has_converged);
     CHECK_THROWS_WITH(has_converged.check_for_error(),
                       Catch::Matchers::ContainsSubstring(
@@ -3,8 +3,10 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -12,16 +14,23 @@
 #include "Framework/ActionTesting.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/Criteria.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Amr/Protocols/Projector.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/Actions/ResetSubdomainSolver.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/Tags.hpp"
+#include "Utilities/NoSuchType.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace {
 
 struct DummyOptionsGroup {};
+struct DummyNonlinearOptionsGroup {};
 
 struct SubdomainSolver {
   void reset() { is_reset = true; }
@@ -35,19 +44,24 @@ struct ElementArray {
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = ElementId<1>;
+  using nonlinear_options_group =
+      typename Metavariables::nonlinear_options_group;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
           Parallel::Phase::Initialization,
-          tmpl::list<ActionTesting::InitializeDataBox<
-              tmpl::list<LinearSolver::Schwarz::Tags::SubdomainSolver<
-                  std::unique_ptr<SubdomainSolver>, DummyOptionsGroup>>>>>,
+          tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<
+              LinearSolver::Schwarz::Tags::SubdomainSolver<
+                  std::unique_ptr<SubdomainSolver>, DummyOptionsGroup>,
+              Convergence::Tags::HasConverged<nonlinear_options_group>>>>>,
       Parallel::PhaseActions<
           Parallel::Phase::Testing,
           tmpl::list<LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
-              DummyOptionsGroup>>>>;
+              DummyOptionsGroup, nonlinear_options_group>>>>;
 };
 
+template <typename NonlinearOptionsGroup>
 struct Metavariables {
+  using nonlinear_options_group = NonlinearOptionsGroup;
   using element_array = ElementArray<Metavariables>;
   using component_list = tmpl::list<element_array>;
 };
@@ -55,15 +69,16 @@ struct Metavariables {
 void test_reset_subdomain_solver(const bool skip_resets) {
   CAPTURE(skip_resets);
 
-  using element_array = typename Metavariables::element_array;
-  ActionTesting::MockRuntimeSystem<Metavariables> runner{tuples::TaggedTuple<
+  using metavariables = Metavariables<NoSuchType>;
+  using element_array = typename metavariables::element_array;
+  ActionTesting::MockRuntimeSystem<metavariables> runner{tuples::TaggedTuple<
       LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<DummyOptionsGroup>,
       logging::Tags::Verbosity<DummyOptionsGroup>>{skip_resets,
                                                    Verbosity::Verbose}};
   const ElementId<1> element_id{0};
   ActionTesting::emplace_component_and_initialize<element_array>(
       make_not_null(&runner), element_id,
-      {std::make_unique<SubdomainSolver>()});
+      {std::make_unique<SubdomainSolver>(), Convergence::HasConverged{}});
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
   REQUIRE_FALSE(
       ActionTesting::get_databox_tag<
@@ -80,10 +95,76 @@ void test_reset_subdomain_solver(const bool skip_resets) {
           .is_reset != skip_resets);
 }
 
+void test_monitor_nonlinear_convergence(
+    const std::optional<double>& reset_threshold) {
+  CAPTURE(reset_threshold);
+  using metavariables = Metavariables<DummyNonlinearOptionsGroup>;
+  using element_array = typename metavariables::element_array;
+  ActionTesting::MockRuntimeSystem<metavariables> runner{tuples::TaggedTuple<
+      LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<DummyOptionsGroup>,
+      logging::Tags::Verbosity<DummyOptionsGroup>,
+      LinearSolver::Schwarz::Tags::SubdomainSolverResetThreshold<
+          DummyOptionsGroup>>{false, Verbosity::Debug, reset_threshold}};
+  const ElementId<1> element_id{0};
+  ActionTesting::emplace_component_and_initialize<element_array>(
+      make_not_null(&runner), element_id,
+      {std::make_unique<SubdomainSolver>(), Convergence::HasConverged{}});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+  const Convergence::Criteria criteria{10, 0., 0.};
+  const auto is_reset_after_iteration = [&runner, &element_id, &criteria](
+                                            const size_t iteration_id,
+                                            const double residual_magnitude) {
+    db::mutate<LinearSolver::Schwarz::Tags::SubdomainSolverBase<
+                   DummyOptionsGroup>,
+               Convergence::Tags::HasConverged<DummyNonlinearOptionsGroup>>(
+        [&criteria, &iteration_id, &residual_magnitude](
+            const auto subdomain_solver,
+            const gsl::not_null<Convergence::HasConverged*> has_converged) {
+          (*subdomain_solver)->is_reset = false;
+          *has_converged = Convergence::HasConverged{
+              criteria, iteration_id, residual_magnitude, 1.};
+        },
+        make_not_null(&ActionTesting::get_databox<element_array>(
+            make_not_null(&runner), element_id)));
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              element_id);
+    return ActionTesting::get_databox_tag<
+               element_array,
+               LinearSolver::Schwarz::Tags::SubdomainSolverBase<
+                   DummyOptionsGroup>>(runner, element_id)
+        .is_reset;
+  };
+  // Always reset at the start of a nonlinear solve
+  CHECK(is_reset_after_iteration(0, 1.));
+  // Fast convergence
+  CHECK(is_reset_after_iteration(1, 0.1) != reset_threshold.has_value());
+  // Stalling convergence
+  CHECK(is_reset_after_iteration(2, 0.08));
+  // Fast convergence again
+  CHECK(is_reset_after_iteration(3, 0.01) != reset_threshold.has_value());
+  // Restarting the nonlinear solve
+  CHECK(is_reset_after_iteration(0, 1.e-4));
+
+  // AMR clears the previous nonlinear residual
+  static_assert(
+      tt::assert_conforms_to_v<
+          LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
+              DummyOptionsGroup, DummyNonlinearOptionsGroup>,
+          amr::protocols::Projector>);
+  double previous_residual_magnitude = 1.;
+  LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
+      DummyOptionsGroup, DummyNonlinearOptionsGroup>::
+      apply(make_not_null(&previous_residual_magnitude),
+            tuples::TaggedTuple<>{});
+  CHECK(std::isnan(previous_residual_magnitude));
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ParallelSchwarz.Action.ResetSubdomainSolver",
                   "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
   test_reset_subdomain_solver(false);
   test_reset_subdomain_solver(true);
+  test_monitor_nonlinear_convergence(std::nullopt);
+  test_monitor_nonlinear_convergence(0.5);
 }
@@ -235,6 +235,23 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
                      vector_state[1], eps_interp_vector, vector_state[2]))[0]) <
         1.e-12);
 
+  {
+    INFO("Pressure and energy from one interpolation");
+    Scalar<DataVector> pressure{data_vector_length};
+    Scalar<DataVector> specific_internal_energy{data_vector_length};
+    const EoS::EquationOfState<true, 3>& base_eos = eos;
+    base_eos.pressure_and_energy_from_density_and_temperature(
+        make_not_null(&pressure), make_not_null(&specific_internal_energy),
+        vector_state[1], vector_state[0], vector_state[2]);
+    CHECK_ITERABLE_APPROX(
+        get(pressure), get(eos.pressure_from_density_and_temperature(
+                           vector_state[1], vector_state[0], vector_state[2])));
+    CHECK_ITERABLE_APPROX(
+        get(specific_internal_energy),
+        get(eos.specific_internal_energy_from_density_and_temperature(
+            vector_state[1], vector_state[0], vector_state[2])));
+  }
+
   auto test_against_reference_values = [&](auto& this_eos) {
     get(state[1]) = 1.e-4;
 
@@ -547,6 +547,40 @@ void test_lts_coefficients() {
     // clang-format on
   }
 
+  {
+    INFO("AB 2:1 order 3 repeated pattern");
+    // The same pattern of steps as above, shifted by one large step.
+    // The coefficients for repeated patterns are cached, so this also
+    // checks that cached coefficients are mapped to the new ids.
+    //  -4           0           4           8
+    //               0     2     4     6     8
+    const adams_lts::AdamsScheme ab3{adams_lts::SchemeType::Explicit, 3};
+    const std::vector<FakeId> steps_large{{-8}, {-4}, {0}};
+    const std::vector<FakeId> steps_small{{-4}, {-2}, {0}, {2}};
+    const std::vector<FakeId> shifted_steps_large{{-4}, {0}, {4}};
+    const std::vector<FakeId> shifted_steps_small{{0}, {2}, {4}, {6}};
+    const auto shift = [](const ExpectedCoefficients& coefs) {
+      ExpectedCoefficients shifted{};
+      for (const auto& [ids, coef] : coefs) {
+        shifted.insert({{{ids.first.step_time + 4}, {ids.second.step_time + 4}},
+                        coef});
+      }
+      return shifted;
+    };
+    for (size_t repeat = 0; repeat < 2; ++repeat) {
+      CHECK_ITERABLE_APPROX(
+          step_coefficients(shifted_steps_large, shifted_steps_small, ab3, ab3,
+                            ab3, 4, 8, false),
+          shift(step_coefficients(steps_large, steps_small, ab3, ab3, ab3, 0,
+                                  4, false)));
+      CHECK_ITERABLE_APPROX(
+          step_coefficients(shifted_steps_small, shifted_steps_large, ab3, ab3,
+                            ab3, 6, 8),
+          shift(step_coefficients(steps_small, steps_large, ab3, ab3, ab3, 2,
+                                  4)));
+    }
+  }
+
   {
     INFO("AB LTS -> GTS order 2");
     // -2     0  1
@@ -0,0 +1,24 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "Utilities/System/MemoryUsage.hpp"
+
+SPECTRE_TEST_CASE("Unit.Utilities.System.MemoryUsage", "[Unit][Utilities]") {
+  const double peak_before = sys::peak_resident_memory_in_megabytes();
+  CHECK(peak_before > 0.0);
+  {
+    // Touch about 50 MB so it becomes resident
+    std::vector<char> buffer(50'000'000);
+    for (size_t i = 0; i < buffer.size(); i += 4096) {
+      buffer[i] = static_cast<char>(i);
+    }
+    CHECK(sys::peak_resident_memory_in_megabytes() >= peak_before);
+  }
+  // The high-water mark never decreases
+  CHECK(sys::peak_resident_memory_in_megabytes() >= peak_before);
+}
@@ -0,0 +1,126 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import os
+import shutil
+import unittest
+
+import h5py
+import numpy as np
+import yaml
+from click.testing import CliRunner
+
+from spectre import Informer
+from spectre.tools.BenchmarkReport import (
+    benchmark_report,
+    benchmark_report_command,
+)
+
+
+def write_dat(h5file, name, legend, data):
+    dataset = h5file.create_dataset(name, data=np.asarray(data))
+    dataset.attrs["Legend"] = legend
+
+
+class TestBenchmarkReport(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = os.path.join(
+            Informer.unit_test_build_path(), "tools", "BenchmarkReport"
+        )
+        self.reductions_file = os.path.join(self.test_dir, "Reductions.h5")
+        os.makedirs(self.test_dir, exist_ok=True)
+        with h5py.File(self.reductions_file, "w") as h5file:
+            # 100 points with an effective step of 0.5, so 200 point updates
+            # per unit time, observed every 2 time units and 4 seconds
+            write_dat(
+                h5file,
+                "TimeSteps.dat",
+                [
+                    "Time",
+                    "NumberOfPoints",
+                    "Slab size",
+                    "Minimum time step",
+                    "Maximum time step",
+                    "Effective time step",
+                    "Minimum Walltime",
+                    "Maximum Walltime",
+                ],
+                [
+                    [0.0, 100, 1.0, 0.25, 1.0, 0.5, 1.0, 2.0],
+                    [2.0, 100, 1.0, 0.25, 1.0, 0.5, 5.0, 6.0],
+                    [4.0, 100, 1.0, 0.25, 1.0, 0.5, 9.0, 10.0],
+                ],
+            )
+            legend = [
+                "WallclockTime",
+                "Node",
+                "Calls",
+                "Retries",
+                "Time",
+                "RetryTime",
+                "WaitTime",
+            ]
+            write_dat(
+                h5file,
+                "ActionTimings/Evolve/DgElementArray/ActionA.dat",
+                legend,
+                [[1.0, 0, 10, 2, 3.0, 0.5, 1.0], [1.0, 1, 10, 0, 2.0, 0, 0]],
+            )
+            write_dat(
+                h5file,
+                "ActionTimings/Evolve/DgElementArray/ActionB.dat",
+                legend,
+                [[1.0, 0, 5, 1, 1.0, 0.1, 1.0]],
+            )
+            write_dat(
+                h5file,
+                "ActionTimings/Initialization/DgElementArray/ActionA.dat",
+                legend,
+                [[1.0, 0, 1, 0, 100.0, 0, 100.0]],
+            )
+            write_dat(
+                h5file,
+                "MemoryMonitors/DgElementArray.dat",
+                [
+                    "Time",
+                    "Size on node 0 (MB)",
+                    "Size on node 1 (MB)",
+                    "Average size per node (MB)",
+                ],
+                [[0.0, 1.0, 1.0, 1.0], [4.0, 2.0, 3.0, 2.5]],
+            )
+
+    def tearDown(self):
+        shutil.rmtree(self.test_dir)
+
+    def test_benchmark_report(self):
+        report = benchmark_report(self.reductions_file, num_cores=2)
+        self.assertEqual(report["Cores"], 2)
+        self.assertEqual(report["Observations"], 3)
+        self.assertAlmostEqual(report["WallTime"], 8.0)
+        self.assertAlmostEqual(report["PointUpdates"], 800.0)
+        self.assertAlmostEqual(report["PointUpdatesPerSecondPerCore"], 50.0)
+        self.assertAlmostEqual(report["WaitFraction"], 2.0 / 8.0)
+        self.assertAlmostEqual(report["SerializedBytesPerPoint"], 5.0e4)
+        self.assertNotIn("HighWaterMarkBytesPerPoint", report)
+
+    def test_cli(self):
+        output_file = os.path.join(self.test_dir, "Report.yaml")
+        result = CliRunner().invoke(
+            benchmark_report_command,
+            [self.reductions_file, "-j", "2", "-o", output_file],
+            catch_exceptions=False,
+        )
+        self.assertEqual(result.exit_code, 0, result.output)
+        with open(output_file, "r") as open_output_file:
+            report = yaml.safe_load(open_output_file)
+        self.assertAlmostEqual(report["PointUpdatesPerSecondPerCore"], 50.0)
+        result = CliRunner().invoke(
+            benchmark_report_command,
+            [self.reductions_file, "-j", "2", "--time-steps-subfile", "Nope"],
+        )
+        self.assertNotEqual(result.exit_code, 0)
+
+
+if __name__ == "__main__":
+    unittest.main(verbosity=2)
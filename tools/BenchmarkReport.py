@@ -0,0 +1,201 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import logging
+from typing import Optional
+
+import click
+import h5py
+import numpy as np
+import yaml
+
+from spectre.Visualization.ReadH5 import to_dataframe
+
+logger = logging.getLogger(__name__)
+
+
+def _throughput(time_steps, num_cores: int) -> dict:
+    """Grid-point updates per second per core between the first and last
+    observation of the `ObserveTimeStep` event."""
+    times = np.asarray(time_steps.iloc[:, 0])
+    # The effective time step is the harmonic mean over all grid points, so
+    # the number of point updates over an interval is the number of points
+    # times the interval divided by the effective time step.
+    point_updates = np.sum(
+        time_steps["NumberOfPoints"].iloc[1:]
+        * np.diff(times)
+        / time_steps["Effective time step"].iloc[1:]
+    )
+    wall_time = (
+        time_steps["Maximum Walltime"].iloc[-1]
+        - time_steps["Maximum Walltime"].iloc[0]
+    )
+    return {
+        "Cores": num_cores,
+        "Observations": len(times),
+        "WallTime": float(wall_time),
+        "PointUpdates": float(point_updates),
+        "PointUpdatesPerSecondPerCore": float(
+            point_updates / wall_time / num_cores
+        ),
+    }
+
+
+def _wait_fraction(open_h5file: h5py.File, phase: str) -> Optional[float]:
+    """Fraction of the wallclock time of the parallel objects spent idle
+    waiting after an action retried, from the `ActionTimings`."""
+    if "ActionTimings" not in open_h5file or (
+        phase not in open_h5file["ActionTimings"]
+    ):
+        return None
+    action_time = 0.0
+    wait_time = 0.0
+
+    def visitor(name, obj):
+        nonlocal action_time, wait_time
+        if isinstance(obj, h5py.Dataset) and name.endswith(".dat"):
+            timings = to_dataframe(obj)
+            action_time += timings["Time"].sum()
+            wait_time += timings["WaitTime"].sum()
+
+    open_h5file["ActionTimings"][phase].visititems(visitor)
+    if action_time + wait_time == 0.0:
+        return None
+    return float(wait_time / (action_time + wait_time))
+
+
+def _memory_per_point(
+    open_h5file: h5py.File, number_of_points: int, component: str
+) -> Optional[dict]:
+    """Memory in bytes per grid point from the last memory monitor
+    observation."""
+    subfile_name = f"MemoryMonitors/{component}.dat"
+    if subfile_name not in open_h5file:
+        return None
+    memory = to_dataframe(open_h5file[subfile_name]).iloc[-1]
+    total_mb = sum(
+        memory[column]
+        for column in memory.index
+        if column.startswith("Size on node ")
+    )
+    result = {"SerializedBytesPerPoint": 1e6 * total_mb / number_of_points}
+    if "MemoryMonitors/HighWaterMark.dat" in open_h5file:
+        high_water_mark = to_dataframe(
+            open_h5file["MemoryMonitors/HighWaterMark.dat"]
+        ).iloc[-1]
+        result["HighWaterMarkBytesPerPoint"] = (
+            1e6
+            * sum(
+                high_water_mark[column]
+                for column in high_water_mark.index
+                if column.startswith("High-water mark on node ")
+            )
+            / number_of_points
+        )
+    return result
+
+
+def benchmark_report(
+    reductions_file: str,
+    num_cores: int,
+    time_steps_subfile: str = "TimeSteps",
+    phase: str = "Evolve",
+    component: str = "DgElementArray",
+) -> dict:
+    """Summarize the performance of an evolution from its reductions file.
+
+    Reports:
+
+    \b
+    - The number of grid-point updates per second per core, from the
+      'ObserveTimeStep' event. Substeps are not counted separately.
+    - The fraction of time the parallel objects were idle waiting for data,
+      e.g. from neighbors or for function of time updates. This requires
+      configuring with '-D SPECTRE_PROFILE_ACTIONS=ON'.
+    - The memory per grid point of the 'component', from the 'MonitorMemory'
+      event.
+
+    To benchmark, run an executable with an input file that triggers
+    'Completion' after a fixed number of slabs and observes the time steps
+    (and optionally the memory) regularly, on the hardware or build
+    configuration to compare.
+    """
+    with h5py.File(reductions_file, "r") as open_h5file:
+        subfile_name = time_steps_subfile + ".dat"
+        if subfile_name not in open_h5file:
+            raise click.UsageError(
+                f"No subfile '{subfile_name}' in '{reductions_file}'. Observe"
+                " the time steps with the 'ObserveTimeStep' event."
+            )
+        time_steps = to_dataframe(open_h5file[subfile_name])
+        if len(time_steps) < 2:
+            raise click.UsageError(
+                "Need at least two time step observations to measure the"
+                " throughput."
+            )
+        report = _throughput(time_steps, num_cores)
+        wait_fraction = _wait_fraction(open_h5file, phase)
+        if wait_fraction is None:
+            logger.warning(
+                "No action timings found. Configure with"
+                " '-D SPECTRE_PROFILE_ACTIONS=ON' to measure the wait fraction."
+            )
+        else:
+            report["WaitFraction"] = wait_fraction
+        memory = _memory_per_point(
+            open_h5file,
+            int(time_steps["NumberOfPoints"].iloc[-1]),
+            component,
+        )
+        if memory is not None:
+            report.update(memory)
+    return report
+
+
+@click.command(name="benchmark-report", help=benchmark_report.__doc__)
+@click.argument(
+    "reductions_file",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, readable=True),
+)
+@click.option(
+    "--num-cores",
+    "-j",
+    type=int,
+    required=True,
+    help="Number of cores the evolution ran on.",
+)
+@click.option(
+    "--time-steps-subfile",
+    default="TimeSteps",
+    show_default=True,
+    help="Subfile written by the 'ObserveTimeStep' event.",
+)
+@click.option(
+    "--phase",
+    default="Evolve",
+    show_default=True,
+    help="Phase of the action timings to consider.",
+)
+@click.option(
+    "--component",
+    default="DgElementArray",
+    show_default=True,
+    help="Component whose memory monitor to report.",
+)
+@click.option(
+    "--output",
+    "-o",
+    type=click.Path(writable=True),
+    help="Write the report to this YAML file instead of printing it.",
+)
+def benchmark_report_command(output, **kwargs):
+    report = benchmark_report(**kwargs)
+    if output:
+        with open(output, "w") as open_output_file:
+            yaml.safe_dump(report, open_output_file)
+    else:
+        click.echo(yaml.safe_dump(report), nl=False)
+
+
+if __name__ == "__main__":
+    benchmark_report_command(help_option_names=["-h", "--help"])